@@ -0,0 +1,155 @@
+# Benchmarks for the public ExPgQuery API.
+#
+# Runs every benchmarked function over statements taken from the PostgreSQL
+# regression tests in libpg_query/test/sql/postgres_regress, grouped into
+# buckets by statement size. Each call gets one statement, so throughput,
+# latency and memory are per call. Usage:
+#
+#     mix bench                    # run all benchmarks
+#     mix bench --only parse,normalize
+#     mix bench --save-baseline    # store the results as the baseline
+#     mix bench --compare          # compare against the stored baseline
+#
+# Results are written as JSON to bench/results/results.json, which is ignored
+# by git. The baseline is kept in bench/baseline.benchee so it can be committed.
+
+defmodule ExPgQuery.Bench.Corpus do
+  @moduledoc false
+
+  @regress_dir "libpg_query/test/sql/postgres_regress"
+
+  # Size buckets and their upper bounds in bytes (numbers sort before atoms,
+  # so every size is <= :infinity)
+  @buckets [
+    {"small (<= 64 bytes)", 64},
+    {"medium (65-256 bytes)", 256},
+    {"large (257-1024 bytes)", 1024},
+    {"huge (> 1024 bytes)", :infinity}
+  ]
+
+  # Number of statements per bucket, which keeps run times bounded
+  @per_bucket 200
+
+  @doc """
+  Returns a map of bucket name to a list of statements.
+
+  Statements are split off at top-level semicolons using the scanner, and only
+  statements that parse are kept. The selection is deterministic.
+  """
+  def load do
+    statements =
+      @regress_dir
+      |> Path.join("*.sql")
+      |> Path.wildcard()
+      |> Enum.sort()
+      |> Enum.flat_map(&statements/1)
+      |> Enum.uniq()
+
+    for {bucket, _} <- @buckets, into: %{} do
+      {bucket,
+       statements
+       |> Enum.filter(&(bucket_for(byte_size(&1)) == bucket))
+       |> take_evenly(@per_bucket)}
+    end
+  end
+
+  defp statements(path) do
+    sql = File.read!(path)
+
+    case ExPgQuery.Native.scan(sql) do
+      {:ok, bytes} ->
+        %PgQuery.ScanResult{tokens: tokens} = Protox.decode!(bytes, PgQuery.ScanResult)
+
+        tokens
+        |> Enum.filter(&(&1.token == :ASCII_59))
+        |> Enum.map_reduce(0, fn token, start ->
+          {binary_part(sql, start, token.start - start), Map.fetch!(token, :end)}
+        end)
+        |> elem(0)
+        |> Enum.map(&String.trim/1)
+        |> Enum.reject(&(&1 == ""))
+        |> Enum.filter(&match?({:ok, _}, ExPgQuery.Native.parse_protobuf(&1)))
+
+      {:error, _} ->
+        []
+    end
+  end
+
+  defp bucket_for(size) do
+    Enum.find_value(@buckets, fn {bucket, max} -> if size <= max, do: bucket end)
+  end
+
+  defp take_evenly(list, count) when length(list) <= count, do: list
+
+  defp take_evenly(list, count) do
+    step = length(list) / count
+    tuple = List.to_tuple(list)
+
+    for i <- 0..(count - 1), do: elem(tuple, trunc(i * step))
+  end
+end
+
+{opts, _, _} =
+  OptionParser.parse(System.argv(),
+    strict: [only: :string, save_baseline: :boolean, compare: :boolean, time: :float]
+  )
+
+baseline = "bench/baseline.benchee"
+inputs = ExPgQuery.Bench.Corpus.load()
+
+for {bucket, statements} <- Enum.sort(inputs) do
+  IO.puts("#{bucket}: #{length(statements)} statements")
+end
+
+# Each iteration runs a job on one statement, taking the statements of the
+# bucket in turn, so the figures are per call. Jobs that take a parse tree
+# instead of SQL text get their input converted once per scenario, outside of
+# the measured function
+rotate = fn statements -> {List.to_tuple(statements), :counters.new(1, [])} end
+parse_trees = &rotate.(Enum.map(&1, fn sql -> ExPgQuery.Protobuf.from_sql!(sql) end))
+
+next_statement = fn {statements, counter} ->
+  :counters.add(counter, 1, 1)
+  elem(statements, rem(:counters.get(counter, 1), tuple_size(statements)))
+end
+
+per_statement = &{&1, before_scenario: rotate, before_each: next_statement}
+per_tree = &{&1, before_scenario: parse_trees, before_each: next_statement}
+
+jobs = %{
+  "parse" => per_statement.(&ExPgQuery.parse/1),
+  "fingerprint" => per_statement.(&ExPgQuery.Fingerprint.fingerprint/1),
+  "normalize" => per_statement.(&ExPgQuery.Normalize.normalize/1),
+  "scan" => per_statement.(&ExPgQuery.Native.scan/1),
+  "protobuf_from_sql" => per_statement.(&ExPgQuery.Protobuf.from_sql/1),
+  "protobuf_to_sql" => per_tree.(&ExPgQuery.Protobuf.to_sql/1),
+  "truncate" => per_tree.(&ExPgQuery.Truncator.truncate(&1, 40)),
+  "param_refs" => per_tree.(&ExPgQuery.ParamRefs.param_refs/1),
+  # A batch call takes the whole bucket, so its figures are per batch
+  "batch_fingerprint" => &ExPgQuery.Batch.run(&1, [:fingerprint])
+}
+
+jobs =
+  case opts[:only] do
+    nil -> jobs
+    only -> Map.take(jobs, String.split(only, ","))
+  end
+
+File.mkdir_p!("bench/results")
+
+Benchee.run(
+  jobs,
+  [
+    inputs: inputs,
+    warmup: 1,
+    time: Keyword.get(opts, :time, 5),
+    memory_time: 1,
+    percentiles: [50, 95, 99],
+    formatters: [
+      Benchee.Formatters.Console,
+      {Benchee.Formatters.JSON, file: "bench/results/results.json"}
+    ]
+  ] ++
+    if(opts[:save_baseline], do: [save: [path: baseline, tag: "baseline"]], else: []) ++
+    if(opts[:compare] && File.exists?(baseline), do: [load: baseline], else: [])
+)
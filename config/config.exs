@@ -4,4 +4,11 @@ if Mix.env() == :test do
   config :junit_formatter,
     report_file: "ex_pg_query.junit.xml",
     print_report_file: true
+
+  config :ex_pg_query,
+    cache_size: 1024 * 1024,
+    slow_query_threshold: 1,
+    parse_max_memory: 16 * 1024 * 1024,
+    parse_max_nodes: 20_000,
+    parse_max_depth: 1_000
 end
@@ -540,6 +540,243 @@ defmodule ExPgQuery do
     end)
   end
 
+  @doc """
+  Parses a SQL query into JSON, e.g. to hand the parse tree to a service
+  written in another language without a protobuf dependency.
+
+  The JSON is the protobuf JSON mapping of the tree `parse/1` works on, as
+  produced by libpg_query's `pg_query_parse`.
+
+  ## Parameters
+
+    * `query` - SQL query string to parse
+
+  ## Returns
+
+    * `{:ok, binary}` - JSON of the parse tree
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, json} = ExPgQuery.parse_json("SELECT * FROM users")
+      iex> json =~ ~s("RangeVar":{"relname":"users")
+      true
+
+  """
+  def parse_json(query) do
+    ExPgQuery.Native.parse_json(query)
+  end
+
+  @doc """
+  Returns the statement types of a query and whether it is read-only, without
+  building a `ExPgQuery.ParseResult`.
+
+  Much cheaper than `parse/1` followed by `statement_types/1` when only the
+  kind of query matters, e.g. to route read-only queries to a replica. See
+  `ExPgQuery.Native.classify/1` for what counts as read-only.
+
+  ## Parameters
+
+    * `query` - SQL query string to classify
+
+  ## Returns
+
+    * `{:ok, %{statement_types: [atom], read_only: boolean}}` - Statement types
+      in the same form as `statement_types/1`
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.classify("SELECT 1; INSERT INTO users (id) VALUES (1)")
+      {:ok, %{statement_types: [:select_stmt, :insert_stmt], read_only: false}}
+
+      iex> ExPgQuery.classify("WITH active AS (SELECT * FROM users WHERE active) SELECT count(*) FROM active")
+      {:ok, %{statement_types: [:select_stmt], read_only: true}}
+
+  """
+  def classify(query) do
+    ExPgQuery.Native.classify(query)
+  end
+
+  @doc """
+  Splits a SQL string into its statements.
+
+  Unlike splitting on semicolons, this handles semicolons inside string
+  literals, quoted identifiers, comments and function bodies. See
+  `ExPgQuery.Native.split/2` for the difference between the `:parser` and
+  `:scanner` modes.
+
+  ## Parameters
+
+    * `query` - SQL string to split
+    * `options` - List of options (defaults to `[:parser]`):
+      * `:parser` or `:scanner` - How to find the statement boundaries
+      * `:binaries` - Return sub-binaries of `query` instead of
+        `{location, length}` byte ranges, without copying the statement text
+
+  ## Returns
+
+    * `{:ok, [{location, length}]}` - Byte ranges of the statements
+    * `{:ok, [binary]}` - Statement texts, with `:binaries`
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.split("SELECT 1; INSERT INTO t VALUES (1)")
+      {:ok, [{0, 8}, {9, 25}]}
+
+      iex> ExPgQuery.split("SELECT ';'; -- done;\nSELECT 2", [:scanner, :binaries])
+      {:ok, ["SELECT ';'", " -- done;\nSELECT 2"]}
+
+  """
+  def split(query, options \\ [:parser]) do
+    ExPgQuery.Native.split(query, options)
+  end
+
+  @doc """
+  Parses the PL/pgSQL functions (`CREATE FUNCTION ... LANGUAGE plpgsql`,
+  `CREATE PROCEDURE` and `DO` blocks) in a SQL string into JSON.
+
+  ## Parameters
+
+    * `query` - SQL string containing the functions
+    * `options` - List of options (defaults to `[]`):
+      * `:functions` - Return the JSON of each function separately, e.g. to
+        process a schema dump function by function
+
+  ## Returns
+
+    * `{:ok, binary}` - JSON array with one `PLpgSQL_function` object per
+      function
+    * `{:ok, [binary]}` - JSON of each function, with `:functions`
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, [json]} = ExPgQuery.parse_plpgsql("DO $$ BEGIN RAISE NOTICE 'hi'; END $$", [:functions])
+      iex> json =~ "PLpgSQL_stmt_raise"
+      true
+
+  """
+  def parse_plpgsql(query, options \\ []) do
+    ExPgQuery.Native.parse_plpgsql(query, options)
+  end
+
+  @doc """
+  Returns the tables and functions that the body of each function (`CREATE
+  FUNCTION`, `CREATE PROCEDURE` and `DO` blocks) in a SQL string refers to,
+  e.g. to track which tables the stored functions of a schema dump depend on.
+
+  The SQL embedded in the bodies is parsed and analyzed natively in one call,
+  without decoding any parse tree. SQL that is built at runtime and run with
+  `EXECUTE` can't be analyzed.
+
+  ## Parameters
+
+    * `query` - SQL string containing the functions
+
+  ## Returns
+
+    * `{:ok, [map]}` - For each function, in input order, a map with its
+      `:name` (`nil` for `DO` blocks), the `:tables` it refers to as
+      `%{name: binary, type: :select | :dml | :ddl}` and the `:functions` it
+      uses as `%{name: binary, type: :call | :ddl}`
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.plpgsql_dependencies("""
+      ...> CREATE FUNCTION archive(days int) RETURNS void AS $$
+      ...> BEGIN
+      ...>   INSERT INTO archive SELECT * FROM events WHERE created_at < now() - days * interval '1 day';
+      ...> END
+      ...> $$ LANGUAGE plpgsql
+      ...> """)
+      {:ok,
+       [
+         %{
+           name: "archive",
+           tables: [%{name: "archive", type: :dml}, %{name: "events", type: :select}],
+           functions: [%{name: "now", type: :call}]
+         }
+       ]}
+
+  """
+  def plpgsql_dependencies(query) do
+    ExPgQuery.Native.plpgsql_dependencies(query)
+  end
+
+  @doc """
+  Rewrites a SQL query, e.g. to scope every statement a proxy forwards to a
+  tenant, and returns the new SQL.
+
+  The changes are made natively on the parse tree and the tree is deparsed
+  in the same call, which is much cheaper than decoding it with `parse/1`,
+  updating it with `ExPgQuery.TreeUtils` and deparsing it again.
+
+  Relations are renamed and qualified in DML and SELECT statements, including
+  their subqueries and CTEs, and in `EXPLAIN`, `COPY`, `CREATE TABLE AS`,
+  `CREATE VIEW`, `TRUNCATE` and `LOCK`; references to CTEs are left alone.
+  Renamed relations keep their old name as alias, so columns qualified with
+  it still resolve. The WHERE expression and the LIMIT only go into the
+  top-level statements, except that UPDATEs and DELETEs in WITH clauses get
+  the WHERE expression too. SELECTs without a FROM clause don't get it.
+
+  ## Parameters
+
+    * `query` - SQL query string to rewrite
+    * `options` - Keyword list of rewrites:
+      * `:rename` - List of `{from, to}` relations, each given as `name` or
+        `{schema, name}`. A plain `from` name only matches unqualified
+        relations, a plain `to` name keeps the schema
+      * `:schema` - Schema to qualify the remaining unqualified relations with
+      * `:where` - SQL expression to AND into the WHERE clause, e.g.
+        `"tenant_id = $1"`
+      * `:where_statements` - Statements that get the WHERE expression
+        (defaults to `[:select, :update, :delete]`); each side of a top-level
+        `UNION` gets it
+      * `:limit` - LIMIT to set on SELECTs
+      * `:max_limit` - LIMIT to cap SELECTs to; SELECTs without a LIMIT get
+        it, and parameters are capped with `LEAST`
+
+  ## Returns
+
+    * `{:ok, string}` - Rewritten query
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.rewrite("SELECT * FROM users WHERE active OR admin",
+      ...>   rename: [{"users", {"tenant_1", "accounts"}}],
+      ...>   where: "tenant_id = $1",
+      ...>   max_limit: 100
+      ...> )
+      {:ok, "SELECT * FROM tenant_1.accounts users WHERE (active OR admin) AND tenant_id = $1 LIMIT 100"}
+
+  """
+  def rewrite(query, options) do
+    relations =
+      options
+      |> Keyword.get(:rename, [])
+      |> Enum.map(fn {from, to} ->
+        {schema, name} = rewrite_relation(from)
+        {new_schema, new_name} = rewrite_relation(to)
+        {schema, name, new_schema, new_name}
+      end)
+
+    ExPgQuery.Native.rewrite(query, %{
+      relations: relations,
+      schema: Keyword.get(options, :schema),
+      where: Keyword.get(options, :where),
+      where_statements: Keyword.get(options, :where_statements, [:select, :update, :delete]),
+      limit: Keyword.get(options, :limit),
+      max_limit: Keyword.get(options, :max_limit)
+    })
+  end
+
+  defp rewrite_relation({schema, name}), do: {schema, name}
+  defp rewrite_relation(name), do: {nil, name}
+
   @doc """
   Truncates query to be below the specified length.
 
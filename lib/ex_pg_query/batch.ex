@@ -0,0 +1,103 @@
+defmodule ExPgQuery.Batch do
+  @moduledoc """
+  Processes large lists of queries in parallel on native worker threads.
+
+  Meant for bulk jobs such as backfilling fingerprints, where calling the
+  single-query functions for every query would spend a large share of the time
+  on per-call overhead. The queries are handed to a fixed pool of native
+  threads in one call, and the results come back to the calling process in
+  chunks.
+
+  The size of the pool is read when the NIF is loaded, and defaults to the
+  number of online schedulers:
+
+      config :ex_pg_query, batch_workers: 8
+
+  ## Examples
+
+      iex> ExPgQuery.Batch.run(["SELECT * FROM users WHERE id = 1", "SELECT 1"], [:fingerprint, :normalize])
+      {:ok,
+       [
+         %{
+           fingerprint: {:ok, %{fingerprint: 11595314936444286341, fingerprint_str: "a0ead580058af585"}},
+           normalize: {:ok, "SELECT * FROM users WHERE id = $1"}
+         },
+         %{
+           fingerprint: {:ok, %{fingerprint: 5836069208177285818, fingerprint_str: "50fde20626009aba"}},
+           normalize: {:ok, "SELECT $1"}
+         }
+       ]}
+
+  """
+
+  @default_chunk_size 100
+
+  @doc """
+  Runs the given operations on every query and waits for all results.
+
+  ## Parameters
+
+    * `queries` - List of SQL query strings
+    * `ops` - List of operations to run, any of `:parse`, `:fingerprint`
+      and `:normalize`. Defaults to `[:fingerprint]`
+    * `opts` - Keyword list of options:
+      * `:chunk_size` - Number of queries a worker processes and sends back at
+        a time. Defaults to #{@default_chunk_size}
+      * `:timeout` - Time in milliseconds to wait for all results. Defaults to
+        `:infinity`. On timeout the remaining work is cancelled and no results
+        are left in the mailbox
+
+  ## Returns
+
+    * `{:ok, results}` - One map per query, in input order, with the result of
+      each operation under its name. The results have the same shape as
+      `ExPgQuery.Native.parse_protobuf/1`, `ExPgQuery.Native.fingerprint/1` and
+      `ExPgQuery.Native.normalize/1` respectively
+    * `{:error, :timeout}` - Not all results arrived within the timeout
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.Batch.run(["SELECT 1", "SELEC 1"], [:normalize])
+      {:ok, [%{normalize: {:ok, "SELECT $1"}}, %{normalize: {:error, %{message: "syntax error at or near \\"SELEC\\"", cursorpos: 0}}}]}
+
+  """
+  def run(queries, ops \\ [:fingerprint], opts \\ []) do
+    chunk_size = Keyword.get(opts, :chunk_size, @default_chunk_size)
+    timeout = Keyword.get(opts, :timeout, :infinity)
+
+    with {:ok, ref} <- ExPgQuery.Native.batch_start(queries, ops, chunk_size) do
+      collect(ref, length(queries), [], timeout)
+    end
+  end
+
+  defp collect(_ref, 0, chunks, _timeout) do
+    results =
+      chunks
+      |> Enum.sort_by(fn {start, _results} -> start end)
+      |> Enum.flat_map(fn {_start, results} -> results end)
+
+    {:ok, results}
+  end
+
+  defp collect(ref, remaining, chunks, timeout) do
+    receive do
+      {:ex_pg_query_batch, ^ref, {:chunk, start, results}} ->
+        collect(ref, remaining - length(results), [{start, results} | chunks], timeout)
+    after
+      timeout ->
+        :ok = ExPgQuery.Native.batch_cancel(ref)
+        flush(ref)
+        {:error, :timeout}
+    end
+  end
+
+  # Nothing is sent for a cancelled job, so this drops everything that's left
+  defp flush(ref) do
+    receive do
+      {:ex_pg_query_batch, ^ref, _} -> flush(ref)
+    after
+      0 -> :ok
+    end
+  end
+end
@@ -24,11 +24,19 @@ defmodule ExPgQuery.Fingerprint do
   ## Parameters
 
     * `sql` - String containing the SQL query to fingerprint
+    * `opts` - Keyword list of options:
+      * `:max_list_length` - Collapses constant lists longer than this while
+        parsing, like `ExPgQuery.Protobuf.from_sql/2` does. The fingerprint
+        is the same, but queries with huge `IN` or `VALUES` lists take less
+        time and memory
 
   ## Returns
 
     * `{:ok, string}` - Successfully generated fingerprint
-    * `{:error, reason}` - Error with reason
+    * `{:error, %{message: message, cursorpos: cursorpos}}` - The query couldn't
+      be parsed. Errors caused by a parse limit also have a `:code`, see
+      `ExPgQuery.Native.parse_protobuf/1`
+    * `{:error, reason}` - Other errors, with a message
 
   ## Examples
 
@@ -36,12 +44,76 @@ defmodule ExPgQuery.Fingerprint do
       {:ok, "a0ead580058af585"}
       iex> ExPgQuery.Fingerprint.fingerprint("SELECT * FROM users WHERE id = 2")
       {:ok, "a0ead580058af585"}
+      iex> ExPgQuery.Fingerprint.fingerprint("SELECT * FROM users WHERE id IN (1, 2, 3)", max_list_length: 2)
+      {:ok, "a0ead580058af585"}
 
   """
-  def fingerprint(sql) do
-    case ExPgQuery.Native.fingerprint(sql) do
+  def fingerprint(sql, opts \\ []) do
+    result =
+      case Keyword.get(opts, :max_list_length) do
+        nil -> ExPgQuery.Native.fingerprint(sql)
+        max_list_length -> ExPgQuery.Native.fingerprint(sql, max_list_length)
+      end
+
+    case result do
       {:ok, %{fingerprint_str: fingerprint}} -> {:ok, fingerprint}
       {:error, _reason} = err -> err
     end
   end
+
+  @doc """
+  Generates fingerprints for every statement, subquery and CTE in a SQL query.
+
+  Each subtree fingerprint only depends on the subtree itself, so it can be used
+  to group queries by the shape of their subqueries and CTEs. All fingerprints
+  are calculated in a single pass, without extracting and re-fingerprinting the
+  subtrees individually.
+
+  ## Parameters
+
+    * `sql` - String containing the SQL query to fingerprint
+
+  ## Returns
+
+    * `{:ok, list}` - List of maps (in the order the nodes appear in the query) with:
+      * `:node_type` - One of `:select_stmt`, `:common_table_expr`, `:sub_link`
+        or `:range_subselect`
+      * `:location` - Byte offset of the node in the query, or `nil` if the node
+        doesn't record its location
+      * `:parent` - Index of the enclosing subtree in the list, or `nil`
+      * `:fingerprint` - Fingerprint string of the subtree
+    * `{:error, %{message: message, cursorpos: cursorpos}}` - The query couldn't
+      be parsed. Errors caused by a parse limit also have a `:code`, see
+      `ExPgQuery.Native.parse_protobuf/1`
+    * `{:error, reason}` - Other errors, with a message
+
+  ## Examples
+
+      iex> ExPgQuery.Fingerprint.subtree_fingerprints("SELECT * FROM (SELECT id FROM users WHERE id = 1) u")
+      {:ok,
+       [
+         %{node_type: :select_stmt, location: 0, parent: nil, fingerprint: "a24bfd34d5c57535"},
+         %{node_type: :range_subselect, location: nil, parent: 0, fingerprint: "f2f649127f48d1e9"},
+         %{node_type: :select_stmt, location: nil, parent: 1, fingerprint: "62ecf932c00d5750"}
+       ]}
+      iex> ExPgQuery.Fingerprint.subtree_fingerprints("SELECT id FROM users WHERE id = 2")
+      {:ok, [%{node_type: :select_stmt, location: 0, parent: nil, fingerprint: "62ecf932c00d5750"}]}
+
+  """
+  def subtree_fingerprints(sql) do
+    case ExPgQuery.Native.fingerprint_subtrees(sql) do
+      {:ok, %{subtrees: subtrees}} ->
+        {:ok, Enum.map(subtrees, &%{&1 | fingerprint: fingerprint_to_string(&1.fingerprint)})}
+
+      {:error, _reason} = err ->
+        err
+    end
+  end
+
+  defp fingerprint_to_string(fingerprint) do
+    fingerprint
+    |> Integer.to_string(16)
+    |> String.downcase()
+    |> String.pad_leading(16, "0")
+  end
 end
@@ -17,7 +17,20 @@ defmodule ExPgQuery.Native do
     :ex_pg_query
     |> Application.app_dir("priv/ex_pg_query")
     |> String.to_charlist()
-    |> :erlang.load_nif(0)
+    |> :erlang.load_nif(load_options())
+  end
+
+  # Options read by the NIF when it is loaded, see the README for details
+  defp load_options do
+    %{
+      batch_workers: Application.get_env(:ex_pg_query, :batch_workers, System.schedulers_online()),
+      cache_size: Application.get_env(:ex_pg_query, :cache_size, 0),
+      cache_shards: Application.get_env(:ex_pg_query, :cache_shards, 16),
+      slow_query_threshold: Application.get_env(:ex_pg_query, :slow_query_threshold, 0),
+      parse_max_memory: Application.get_env(:ex_pg_query, :parse_max_memory, 0),
+      parse_max_nodes: Application.get_env(:ex_pg_query, :parse_max_nodes, 0),
+      parse_max_depth: Application.get_env(:ex_pg_query, :parse_max_depth, 0)
+    }
   end
 
   @doc """
@@ -32,7 +45,9 @@ defmodule ExPgQuery.Native do
   ## Returns
 
     * `{:ok, binary}` - Successfully parsed query as serialized protobuf
-    * `{:error, reason}` - Error with reason
+    * `{:error, reason}` - Error with reason. When the query goes over one of
+      the configured parse limits, the error map has a `:code` of
+      `:memory_limit`, `:node_limit` or `:depth_limit`
 
   ## Examples
 
@@ -44,6 +59,62 @@ defmodule ExPgQuery.Native do
   """
   def parse_protobuf(_), do: exit(:nif_library_not_loaded)
 
+  @doc """
+  Parses a SQL query into a Protocol Buffer representation, collapsing long
+  constant lists.
+
+  `IN` lists, `ARRAY[...]` and `VALUES` lists of more than `max_list_length`
+  constants are replaced by a single `IntList` of the number of items, and
+  the location and length of their source text. A collapsed `VALUES` list
+  keeps one row, holding the `IntList`. The collapsed tree can't be deparsed.
+
+  ## Parameters
+
+    * `query` - SQL query string to parse
+    * `max_list_length` - Integer from 1 to 32767
+
+  ## Returns
+
+    * `{:ok, binary}` - Successfully parsed query as serialized protobuf
+    * `{:error, "invalid options"}` - `max_list_length` is out of range
+    * `{:error, reason}` - Error with reason, as for `parse_protobuf/1`
+
+  ## Examples
+
+      iex> {:ok, bytes} = ExPgQuery.Native.parse_protobuf("SELECT * FROM t WHERE id IN (1, 2, 3)", 2)
+      iex> {:ok, result} = Protox.decode(bytes, PgQuery.ParseResult)
+      iex> [%{stmt: %{node: {:select_stmt, stmt}}}] = result.stmts
+      iex> %{node: {:a_expr, %{rexpr: %{node: {:list, %{items: [%{node: {:int_list, int_list}}]}}}}}} = stmt.where_clause
+      iex> Enum.map(int_list.items, fn %{node: {:integer, %{ival: ival}}} -> ival end)
+      [3, 29, 7]
+
+  """
+  def parse_protobuf(_, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Parses a SQL query into a JSON representation.
+
+  The JSON holds the same tree as `parse_protobuf/1`, in the protobuf JSON
+  mapping of `PgQuery.ParseResult` that libpg_query's `pg_query_parse`
+  produces, for consumers that read JSON rather than protobuf.
+
+  ## Parameters
+
+    * `query` - SQL query string to parse
+
+  ## Returns
+
+    * `{:ok, binary}` - Successfully parsed query as JSON
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
+
+  ## Examples
+
+      iex> ExPgQuery.Native.parse_json("SELECT 1")
+      {:ok, ~s({"version":170000,"stmts":[{"stmt":{"SelectStmt":{"targetList":[{"ResTarget":{"val":{"A_Const":{"ival":{"ival":1},"location":7}},"location":7}}],"limitOption":"LIMIT_OPTION_DEFAULT","op":"SETOP_NONE"}}}]})}
+
+  """
+  def parse_json(_), do: exit(:nif_library_not_loaded)
+
   @doc """
   Converts a Protocol Buffer AST back into a SQL query string.
 
@@ -65,6 +136,103 @@ defmodule ExPgQuery.Native do
   """
   def deparse_protobuf(_), do: exit(:nif_library_not_loaded)
 
+  @doc """
+  Converts a single Protocol Buffer `PgQuery.Node` back into SQL.
+
+  The node is deparsed on its own, without a statement around it. It can be
+  a statement, an expression, a type name, a relation, a target list or a
+  list of expressions (such as a `GROUP BY` clause).
+
+  ## Parameters
+
+    * `protobuf` - Serialized `PgQuery.Node` binary
+
+  ## Returns
+
+    * `{:ok, string}` - Successfully deparsed node
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> node = %PgQuery.Node{node: {:column_ref, %PgQuery.ColumnRef{fields: [%PgQuery.Node{node: {:a_star, %PgQuery.A_Star{}}}]}}}
+      iex> bytes = node |> Protox.encode!() |> IO.iodata_to_binary()
+      iex> ExPgQuery.Native.deparse_node_protobuf(bytes)
+      {:ok, "*"}
+
+  """
+  def deparse_node_protobuf(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Converts a tree of `PgQuery` structs back into SQL.
+
+  The structs are read directly, without encoding them to protobuf first, so
+  this is faster than `deparse_protobuf/1` for trees that were built or
+  modified in Elixir.
+
+  ## Parameters
+
+    * `tree` - `PgQuery.ParseResult`, or a `PgQuery.Node` to deparse on its
+      own like with `deparse_node_protobuf/1`
+
+  ## Returns
+
+    * `{:ok, string}` - Successfully deparsed query
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, tree} = ExPgQuery.Protobuf.from_sql("SELECT * FROM users")
+      iex> ExPgQuery.Native.deparse_struct(tree)
+      {:ok, "SELECT * FROM users"}
+
+  """
+  def deparse_struct(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Rewrites a SQL query and returns the new SQL.
+
+  The query is parsed, changed on the parse tree and deparsed within the same
+  call, so no tree has to be decoded or encoded. `ExPgQuery.rewrite/2` builds
+  the options from a keyword list.
+
+  ## Parameters
+
+    * `query` - SQL query string to rewrite
+    * `options` - Map with:
+      * `:relations` - `{schema, name, new_schema, new_name}` tuples. Relations
+        called `name` in `schema` (`nil` matches unqualified relations only)
+        are moved to `new_schema` and renamed to `new_name` (`nil` keeps the
+        current one)
+      * `:schema` - Schema for the remaining unqualified relations, or `nil`
+      * `:where` - SQL expression to AND into the WHERE clause of the
+        top-level statements and of UPDATEs and DELETEs in WITH clauses, or
+        `nil`. SELECTs without a FROM clause are skipped
+      * `:where_statements` - Statements that get the WHERE expression, any
+        of `:select`, `:update` and `:delete`
+      * `:limit` - LIMIT to set on top-level SELECTs, or `nil`
+      * `:max_limit` - LIMIT to cap top-level SELECTs to, or `nil`
+
+  ## Returns
+
+    * `{:ok, string}` - Rewritten query
+    * `{:error, reason}` - Error with reason, as returned by
+      `parse_protobuf/1`, or `"invalid options"`
+
+  ## Examples
+
+      iex> ExPgQuery.Native.rewrite("SELECT * FROM users", %{
+      ...>   relations: [],
+      ...>   schema: "tenant_1",
+      ...>   where: nil,
+      ...>   where_statements: [],
+      ...>   limit: nil,
+      ...>   max_limit: 100
+      ...> })
+      {:ok, "SELECT * FROM tenant_1.users LIMIT 100"}
+
+  """
+  def rewrite(_, _), do: exit(:nif_library_not_loaded)
+
   @doc """
   Generates a fingerprint string that identifies structurally similar queries.
 
@@ -80,7 +248,7 @@ defmodule ExPgQuery.Native do
     * `{:ok, map}` - Successfully generated fingerprint containing:
       * `:fingerprint` - Integer fingerprint value
       * `:fingerprint_str` - String representation of fingerprint
-    * `{:error, reason}` - Error with reason
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
 
   ## Examples
 
@@ -92,6 +260,69 @@ defmodule ExPgQuery.Native do
   """
   def fingerprint(_), do: exit(:nif_library_not_loaded)
 
+  @doc """
+  Generates a fingerprint, collapsing constant lists of more than
+  `max_list_length` (1 to 32767) items while parsing.
+
+  The fingerprint is the same as that of `fingerprint/1`, but queries with
+  huge `IN` or `VALUES` lists take less time and memory.
+
+  ## Examples
+
+      iex> ExPgQuery.Native.fingerprint("SELECT * FROM users WHERE id IN (1, 2, 3)", 2)
+      {:ok, %{fingerprint: 11595314936444286341, fingerprint_str: "a0ead580058af585"}}
+      iex> ExPgQuery.Native.fingerprint("SELECT 1", 0)
+      {:error, "invalid options"}
+
+  """
+  def fingerprint(_, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Generates the fingerprint of a SQL query along with the fingerprints of every
+  `SelectStmt`, `CommonTableExpr`, `SubLink` and `RangeSubselect` node in it.
+
+  All fingerprints are calculated in a single pass over the parse tree. A
+  subtree's fingerprint only depends on the subtree itself, so the same subquery
+  or CTE has the same fingerprint regardless of the statement it appears in.
+
+  ## Parameters
+
+    * `query` - SQL query string to fingerprint
+
+  ## Returns
+
+    * `{:ok, map}` - Successfully generated fingerprints containing:
+      * `:fingerprint` - Integer fingerprint value of the whole query
+      * `:fingerprint_str` - String representation of the query fingerprint
+      * `:subtrees` - List of maps (in the order the nodes appear in the tree) with:
+        * `:node_type` - One of `:select_stmt`, `:common_table_expr`, `:sub_link`
+          or `:range_subselect`
+        * `:location` - Byte offset of the node in the query, or `nil` if the
+          node doesn't record its location
+        * `:parent` - Index of the enclosing subtree in the list, or `nil`
+        * `:fingerprint` - Integer fingerprint value of the subtree
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
+
+  ## Examples
+
+      iex> {:ok, result} = ExPgQuery.Native.fingerprint_subtrees("SELECT * FROM (SELECT id FROM users WHERE id = 1) u")
+      iex> result.subtrees
+      [
+        %{node_type: :select_stmt, location: 0, parent: nil, fingerprint: 11694719260764239157},
+        %{node_type: :range_subselect, location: nil, parent: 0, fingerprint: 17507260945243099625},
+        %{node_type: :select_stmt, location: nil, parent: 1, fingerprint: 7128346306586433360}
+      ]
+      iex> ExPgQuery.Native.fingerprint_subtrees("SELECT id FROM users WHERE id = 2")
+      {:ok,
+       %{
+         fingerprint: 7205240676408839573,
+         fingerprint_str: "63fe28385e8b4d95",
+         subtrees: [%{node_type: :select_stmt, location: 0, parent: nil, fingerprint: 7128346306586433360}]
+       }}
+
+  """
+  def fingerprint_subtrees(_), do: exit(:nif_library_not_loaded)
+
   @doc """
   Performs lexical scanning of a SQL query into tokens.
 
@@ -129,7 +360,7 @@ defmodule ExPgQuery.Native do
   ## Returns
 
     * `{:ok, string}` - Successfully normalized query
-    * `{:error, reason}` - Error with reason
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
 
   ## Examples
 
@@ -147,4 +378,437 @@ defmodule ExPgQuery.Native do
 
   """
   def normalize(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Finds the parameter references (`$1`, `$2`, etc.) in a SQL query.
+
+  The references are collected by libpg_query while walking the parse tree,
+  so the tree isn't encoded or decoded. Param refs in utility statements
+  other than PREPARE, EXECUTE, CREATE TABLE [AS], ALTER TABLE, CREATE VIEW
+  and CALL are not found. `ExPgQuery.ParamRefs.param_refs_from_sql/1` uses
+  this function.
+
+  ## Parameters
+
+    * `query` - SQL query string
+
+  ## Returns
+
+    * `{:ok, list}` - Maps sorted by location with:
+      * `:location` - Byte offset of the parameter reference, or of the type
+        name when the reference is cast with the type first (`INTERVAL $1`)
+      * `:length` - Length in bytes, including the type name in that case
+      * `:typename` - List of type name parts, only present when the
+        reference is cast
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.Native.param_refs("SELECT * FROM x WHERE y = $1 AND z = $2::text")
+      {:ok, [%{location: 26, length: 2}, %{location: 37, length: 2, typename: ["text"]}]}
+
+  """
+  def param_refs(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Returns the type of each statement in a SQL query and whether the query is
+  read-only.
+
+  Statements are classified from their leading tokens, which is much cheaper
+  than parsing. Only when the tokens don't settle a statement's type (e.g. most
+  `ALTER` statements other than `ALTER TABLE`, or a parenthesized query) is the
+  query parsed. The statement types of valid SQL match what `parse_protobuf/1`
+  gives, but a statement classified from its tokens isn't checked for syntax
+  errors beyond those the scanner finds, such as an unterminated string, so
+  invalid SQL may still be classified.
+
+  A query is read-only if none of its statements write data or change the
+  schema, so it could run in a read-only transaction. Functions called by the
+  query aren't looked at: `SELECT nextval('seq')` counts as read-only.
+
+  ## Parameters
+
+    * `query` - SQL query string to classify
+
+  ## Returns
+
+    * `{:ok, map}` - Map with:
+      * `:statement_types` - List of statement type atoms, named like the
+        `PgQuery.Node` oneof fields (e.g. `:select_stmt`)
+      * `:read_only` - Whether every statement is read-only
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
+
+  ## Examples
+
+      iex> ExPgQuery.Native.classify("BEGIN; SELECT * FROM users; COMMIT")
+      {:ok, %{statement_types: [:transaction_stmt, :select_stmt, :transaction_stmt], read_only: true}}
+
+      iex> ExPgQuery.Native.classify("SELECT * FROM users FOR UPDATE")
+      {:ok, %{statement_types: [:select_stmt], read_only: false}}
+
+  """
+  def classify(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Splits a SQL string into its statements.
+
+  With `:parser` (the default) the input is parsed, so splitting fails on
+  syntax errors but is always exact. With `:scanner` the input is only
+  tokenized, which is much cheaper and keeps going past syntax errors, but
+  skips statements that contain no keyword.
+
+  Each statement starts right after the previous semicolon (so it includes the
+  whitespace in front of it) and ends before its own semicolon.
+
+  ## Parameters
+
+    * `query` - SQL string to split
+    * `options` - List of options:
+      * `:parser` or `:scanner` - How to find the statement boundaries
+      * `:binaries` - Return the statements as sub-binaries of `query`
+        instead of `{location, length}` byte ranges. The sub-binaries share
+        the memory of `query`, so no statement text is copied, but they keep
+        all of `query` alive for as long as any of them is referenced
+
+  ## Returns
+
+    * `{:ok, list}` - List of `{location, length}` tuples, or of binaries with
+      `:binaries`, in statement order
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`
+
+  ## Examples
+
+      iex> ExPgQuery.Native.split("SELECT 1; SELECT 'a;b'", [])
+      {:ok, [{0, 8}, {9, 13}]}
+
+      iex> ExPgQuery.Native.split("SELECT 1; SELECT 'a;b'", [:scanner, :binaries])
+      {:ok, ["SELECT 1", " SELECT 'a;b'"]}
+
+  """
+  def split(_, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Parses the PL/pgSQL functions in a SQL string into JSON.
+
+  Every `CREATE FUNCTION`, `CREATE PROCEDURE` and `DO` statement in the input
+  is compiled by the PL/pgSQL parser, and its function tree is returned as a
+  JSON object of the form `{"PLpgSQL_function": {...}}`.
+
+  ## Parameters
+
+    * `query` - SQL string containing the functions
+    * `options` - List of options:
+      * `:functions` - Return a list with the JSON of each function instead of
+        one JSON array. The elements are sub-binaries of one binary holding
+        all functions, so no JSON is copied, but they keep all of it alive for
+        as long as any of them is referenced
+
+  ## Returns
+
+    * `{:ok, binary}` - JSON array of the functions, in input order
+    * `{:ok, [binary]}` - JSON object of each function, with `:functions`
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`,
+      also when the body of a function doesn't parse
+
+  ## Examples
+
+      iex> {:ok, json} = ExPgQuery.Native.parse_plpgsql("DO $$ BEGIN RETURN; END $$", [])
+      iex> String.starts_with?(json, ~s([\\n{"PLpgSQL_function":))
+      true
+
+      iex> {:ok, [_, _] = functions} = ExPgQuery.Native.parse_plpgsql("DO $$ BEGIN END $$; DO $$ BEGIN END $$", [:functions])
+      iex> Enum.all?(functions, &String.starts_with?(&1, ~s({"PLpgSQL_function":)))
+      true
+
+  """
+  def parse_plpgsql(_, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Returns the tables and functions the body of each function in a SQL string
+  refers to.
+
+  Every SQL statement and expression in the body of a `CREATE FUNCTION`,
+  `CREATE PROCEDURE` or `DO` statement is parsed and analyzed natively, in
+  the same call that compiles the body. PL/pgSQL bodies are compiled by the
+  PL/pgSQL parser, `LANGUAGE sql` bodies are parsed as SQL, and bodies in
+  other languages have no dependencies. The strings run by `EXECUTE` aren't
+  known before the function runs, only the expression building them is
+  analyzed.
+
+  ## Parameters
+
+    * `query` - SQL string containing the functions
+
+  ## Returns
+
+    * `{:ok, [map]}` - One map per function, in input order, with:
+      * `:name` - Name of the function as written, `nil` for `DO` blocks
+      * `:tables` - `%{name: binary, type: :select | :dml | :ddl}` for every
+        table the body refers to, with the same types as
+        `ExPgQuery.ParseResult`; CTEs are left out
+      * `:functions` - `%{name: binary, type: :call | :ddl}` for every
+        function the body calls, creates or drops
+    * `{:error, reason}` - Error with reason, as returned by `parse_protobuf/1`,
+      also when the body of a function doesn't parse
+
+  ## Examples
+
+      iex> ExPgQuery.Native.plpgsql_dependencies("DO $$ BEGIN PERFORM f() FROM t; END $$")
+      {:ok, [%{name: nil, tables: [%{name: "t", type: :select}], functions: [%{name: "f", type: :call}]}]}
+
+  """
+  def plpgsql_dependencies(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Creates a splitter for SQL that arrives in chunks.
+
+  See `ExPgQuery.SplitStream` for a wrapper that turns a stream of chunks into
+  a stream of statements.
+
+  ## Returns
+
+    * `{:ok, reference}` - The splitter, to pass to `split_stream_feed/2` and
+      `split_stream_finish/1`
+    * `{:error, reason}` - Error with reason
+
+  """
+  def split_stream_new, do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Feeds the next chunk of input to a splitter.
+
+  A chunk may end anywhere, also inside a string literal, comment or
+  multi-byte character. Only the statements that end in the chunk are
+  returned. The data following a `COPY ... FROM STDIN` statement, up to the
+  line holding only `\\.`, is skipped.
+
+  ## Parameters
+
+    * `stream` - Splitter returned by `split_stream_new/0`
+    * `chunk` - Next part of the SQL input
+
+  ## Returns
+
+    * `{:ok, [{location, length}], pending_location}` - Byte ranges of the
+      completed statements, counted from the start of the whole input, and
+      the location before which no later statement starts, so input before
+      it can be dropped
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, stream} = ExPgQuery.Native.split_stream_new()
+      iex> ExPgQuery.Native.split_stream_feed(stream, "SELECT 'a;")
+      {:ok, [], 0}
+      iex> ExPgQuery.Native.split_stream_feed(stream, "b'; SELECT 2")
+      {:ok, [{0, 12}], 13}
+      iex> ExPgQuery.Native.split_stream_finish(stream)
+      {:ok, [{13, 9}]}
+
+  """
+  def split_stream_feed(_, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Ends the input of a splitter and returns its last statement.
+
+  ## Parameters
+
+    * `stream` - Splitter returned by `split_stream_new/0`
+
+  ## Returns
+
+    * `{:ok, [{location, length}]}` - Byte range of the last statement, or an
+      empty list if there is nothing but whitespace and comments after the
+      last semicolon
+    * `{:error, reason}` - Error with reason, e.g. when the input ends inside a
+      string literal
+
+  """
+  def split_stream_finish(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Queues a list of queries for processing on the native batch worker threads.
+
+  Returns immediately with a reference. The results are sent to the calling
+  process in chunks of up to `chunk_size` consecutive queries, as messages of
+  the form `{:ex_pg_query_batch, ref, {:chunk, start_index, results}}`, where
+  `results` holds one map per query in input order. Each map has a key for
+  every requested operation, holding the same result tuple as the
+  corresponding single-query function (`parse_protobuf/1`, `fingerprint/1`,
+  `normalize/1`).
+
+  Chunks may arrive in any order. See `ExPgQuery.Batch` for a wrapper that
+  collects them. The job keeps running until all chunks are sent or it is
+  stopped with `batch_cancel/1`.
+
+  ## Parameters
+
+    * `queries` - List of SQL query strings
+    * `ops` - List of operations to run, any of `:parse`, `:fingerprint`
+      and `:normalize`
+    * `chunk_size` - Maximum number of results per message
+
+  ## Returns
+
+    * `{:ok, reference}` - The queries were queued
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, ref} = ExPgQuery.Native.batch_start(["SELECT 1", "SELECT 2"], [:normalize], 10)
+      iex> receive do
+      ...>   {:ex_pg_query_batch, ^ref, {:chunk, 0, results}} -> results
+      ...> end
+      [%{normalize: {:ok, "SELECT $1"}}, %{normalize: {:ok, "SELECT $1"}}]
+
+  """
+  def batch_start(_, _, _), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Cancels a job started with `batch_start/3`.
+
+  Chunks that haven't been sent yet are skipped. No message for the job is
+  sent after this returns, so the caller can flush the ones already in its
+  mailbox.
+
+  ## Parameters
+
+    * `ref` - Reference returned by `batch_start/3`
+
+  ## Returns
+
+    * `:ok` - The job was cancelled
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, ref} = ExPgQuery.Native.batch_start(["SELECT 1"], [:normalize], 10)
+      iex> ExPgQuery.Native.batch_cancel(ref)
+      :ok
+
+  """
+  def batch_cancel(_), do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Returns the counters of the result cache used by `fingerprint/1` and
+  `normalize/1`.
+
+  The cache is keyed by a hash of the query text and is disabled unless a
+  memory budget (in bytes) is configured before the NIF is loaded:
+
+      config :ex_pg_query, cache_size: 64 * 1024 * 1024, cache_shards: 16
+
+  ## Returns
+
+    * `{:ok, map}` - Map with the following keys, summed over all shards:
+      * `:hits` - Lookups answered from the cache
+      * `:misses` - Lookups that had to parse the query
+      * `:evictions` - Entries dropped to stay within the memory budget
+      * `:entries` - Number of cached query texts
+      * `:memory` - Bytes currently used by the cache
+      * `:max_memory` - Configured memory budget, `0` when disabled
+
+  ## Examples
+
+      iex> {:ok, stats} = ExPgQuery.Native.cache_stats()
+      iex> Map.keys(stats) |> Enum.sort()
+      [:entries, :evictions, :hits, :max_memory, :memory, :misses]
+
+  """
+  def cache_stats, do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Returns the runtime statistics of the single-query NIFs.
+
+  The counters are cumulative since the NIF was loaded. See
+  `ExPgQuery.Telemetry` for emitting them as `:telemetry` events.
+
+  ## Returns
+
+    * `{:ok, map}` - Map of function name (`:parse_protobuf`,
+      `:deparse_protobuf`, `:scan`, `:fingerprint`, `:fingerprint_subtrees`,
+      `:normalize`, `:classify`, `:split`, `:parse_plpgsql`,
+      `:plpgsql_dependencies`, `:parse_json`, `:deparse_node_protobuf`,
+      `:deparse_struct`, `:rewrite`, `:param_refs`) to a map with:
+      * `:calls` - Number of calls
+      * `:errors` - Number of calls that returned an error
+      * `:input_bytes` - Total size of the input binaries
+      * `:output_bytes` - Total size of the returned binaries (functions that
+        return maps don't count towards this)
+      * `:duration` - Total time spent, in nanoseconds
+      * `:peak_memory` - Sum of the peak number of bytes libpg_query's memory
+        contexts held during each call
+      * `:peak_memory_max` - Highest peak of a single call, in bytes
+      * `:blocks` - Number of memory blocks libpg_query allocated
+      * `:histogram` - Call durations as a list of `{upper_bound, count}`
+        tuples, where `upper_bound` is a power of two in nanoseconds (or
+        `:infinity`). Empty buckets are left out
+
+  ## Examples
+
+      iex> {:ok, _} = ExPgQuery.Native.scan("SELECT 1")
+      iex> {:ok, %{scan: scan}} = ExPgQuery.Native.stats()
+      iex> scan.calls > 0
+      true
+
+  """
+  def stats, do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Returns and clears the queries that took longer than the configured
+  threshold (in microseconds), oldest first.
+
+  Sampling is disabled unless a threshold is configured before the NIF is
+  loaded:
+
+      config :ex_pg_query, slow_query_threshold: 50_000
+
+  Up to 64 samples are kept between calls, with the query text truncated to
+  1024 bytes.
+
+  ## Returns
+
+    * `{:ok, %{queries: list, dropped: integer}}` - `queries` holds maps with
+      `:function`, `:duration` (nanoseconds), `:input_bytes` and `:query`.
+      `dropped` is the number of samples that were overwritten because the
+      buffer was full
+
+  """
+  def take_slow_queries, do: exit(:nif_library_not_loaded)
+
+  @doc """
+  Runs one of the single-query functions and returns how much memory
+  libpg_query used for the call.
+
+  The call is counted in `stats/0` like a direct call. Results served from
+  the result cache report zeros.
+
+  ## Parameters
+
+    * `function` - One of `:parse_protobuf`, `:deparse_protobuf`, `:scan`,
+      `:fingerprint`, `:fingerprint_subtrees`, `:normalize`, `:classify`,
+      `:split`, `:parse_plpgsql`, `:rewrite` (these three run with their
+      default options, which leave the query unchanged for `:rewrite`),
+      `:plpgsql_dependencies`, `:parse_json`, `:deparse_node_protobuf`,
+      `:deparse_struct` and `:param_refs`
+    * `arg` - The argument to pass to the function
+
+  ## Returns
+
+    * `{:ok, {result, memory}}` - `result` is what the function returned, and
+      `memory` a map with:
+      * `:peak_memory` - Highest number of bytes held by libpg_query's memory
+        contexts during the call
+      * `:memory` - Bytes held when the call finished
+      * `:blocks` - Number of memory blocks allocated during the call
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, {{:ok, _scan}, memory}} = ExPgQuery.Native.with_memory_stats(:scan, "SELECT 1")
+      iex> memory.peak_memory > 0 and memory.blocks > 0
+      true
+
+  """
+  def with_memory_stats(_, _), do: exit(:nif_library_not_loaded)
 end
@@ -30,7 +30,10 @@ defmodule ExPgQuery.Normalize do
   ## Returns
 
     * `{:ok, string}` - Successfully normalized query
-    * `{:error, reason}` - Error with reason
+    * `{:error, %{message: message, cursorpos: cursorpos}}` - The query couldn't
+      be parsed. Errors caused by a parse limit also have a `:code`, see
+      `ExPgQuery.Native.parse_protobuf/1`
+    * `{:error, reason}` - Other errors, with a message
 
   ## Examples
 
@@ -7,13 +7,13 @@ defmodule ExPgQuery.ParamRefs do
   associated type casts.
   """
 
+  alias ExPgQuery.Native
   alias ExPgQuery.TreeWalker
 
   @doc """
   Extracts parameter references from a parsed PostgreSQL query tree.
 
-  Returns a list of maps containing information about each parameter reference found
-  in the query. Each map contains:
+  Returns a list of maps, each containing:
 
     * `location` - The character position where the parameter reference starts
     * `length` - The length of the parameter reference
@@ -95,6 +95,28 @@ defmodule ExPgQuery.ParamRefs do
     |> Enum.sort_by(& &1.location)
   end
 
+  @doc """
+  Extracts parameter references from a SQL query.
+
+  The references are found by `ExPgQuery.Native.param_refs/1` without decoding
+  a parse tree, and are the same as those `param_refs/1` returns for the
+  parsed query, with one exception: param refs in utility statements other
+  than PREPARE, EXECUTE, CREATE TABLE [AS], ALTER TABLE, CREATE VIEW and CALL
+  (e.g. in the predicate of `CREATE INDEX ... WHERE`) are not found.
+
+  ## Returns
+
+    * `{:ok, list}` - Maps as returned by `param_refs/1`
+    * `{:error, reason}` - Error with reason
+
+  ## Examples
+
+      iex> ExPgQuery.ParamRefs.param_refs_from_sql("SELECT * FROM x WHERE y = $1::text")
+      {:ok, [%{location: 26, length: 2, typename: ["text"]}]}
+
+  """
+  def param_refs_from_sql(query), do: Native.param_refs(query)
+
   defp param_ref_length(node) do
     if node.number == 0 do
       # Actually a `?` replacement character
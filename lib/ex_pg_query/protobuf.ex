@@ -13,7 +13,10 @@ defmodule ExPgQuery.Protobuf do
     files: ["./libpg_query/protobuf/pg_query.proto"],
     keep_unknown_fields: false
 
-  @postgres_query_version 170_000
+  # Maps each node struct to the name of its field in the `PgQuery.Node` oneof,
+  # e.g. `PgQuery.SelectStmt` to `:select_stmt`
+  @node_oneof_names PgQuery.Node.fields_defs()
+                    |> Map.new(fn %{name: name, type: {:message, module}} -> {module, name} end)
 
   @doc """
   Parses a SQL query into a Protocol Buffer AST.
@@ -21,6 +24,14 @@ defmodule ExPgQuery.Protobuf do
   ## Parameters
 
     * `query` - SQL query string to parse
+    * `opts` - Keyword list of options:
+      * `:max_list_length` - Collapses `IN` lists, `ARRAY[...]` and `VALUES`
+        lists of more constants than this (1 to 32767) into a single
+        `PgQuery.IntList` of three integers: the number of items, and the
+        location and length of their source text. A collapsed `VALUES` list
+        keeps one row, holding the `PgQuery.IntList`. This keeps huge literal
+        lists from blowing up the tree, which still has the same fingerprint,
+        but can't be deparsed anymore
 
   ## Returns
 
@@ -33,8 +44,8 @@ defmodule ExPgQuery.Protobuf do
       {:ok, %PgQuery.ParseResult{}} = parsed
 
   """
-  def from_sql(query) do
-    with {:ok, binary} <- ExPgQuery.Native.parse_protobuf(query),
+  def from_sql(query, opts \\ []) do
+    with {:ok, binary} <- parse_protobuf(query, Keyword.get(opts, :max_list_length)),
          {:ok, protobuf} <- Protox.decode(binary, PgQuery.ParseResult) do
       {:ok, protobuf}
     else
@@ -43,11 +54,12 @@ defmodule ExPgQuery.Protobuf do
   end
 
   @doc """
-  Identical to `from_sql/1` but raises on error.
+  Identical to `from_sql/2` but raises on error.
 
   ## Parameters
 
     * `query` - SQL query string to parse
+    * `opts` - Keyword list of options, see `from_sql/2`
 
   ## Returns
 
@@ -58,13 +70,18 @@ defmodule ExPgQuery.Protobuf do
     * Runtime error if parsing fails
 
   """
-  def from_sql!(query) do
-    case from_sql(query) do
+  def from_sql!(query, opts \\ []) do
+    case from_sql(query, opts) do
       {:ok, protobuf} -> protobuf
       {:error, error} -> raise "Parse error: #{inspect(error)}"
     end
   end
 
+  defp parse_protobuf(query, nil), do: ExPgQuery.Native.parse_protobuf(query)
+
+  defp parse_protobuf(query, max_list_length),
+    do: ExPgQuery.Native.parse_protobuf(query, max_list_length)
+
   @doc """
   Converts a Protocol Buffer AST back into a SQL query string.
 
@@ -85,8 +102,7 @@ defmodule ExPgQuery.Protobuf do
 
   """
   def to_sql(%PgQuery.ParseResult{} = protobuf) do
-    binary_protobuf = Protox.encode!(protobuf) |> IO.iodata_to_binary()
-    ExPgQuery.Native.deparse_protobuf(binary_protobuf)
+    ExPgQuery.Native.deparse_struct(protobuf)
   end
 
   @doc """
@@ -143,18 +159,7 @@ defmodule ExPgQuery.Protobuf do
       {:ok, "SELECT * FROM users"}
 
   """
-  def stmt_to_sql(stmt) do
-    %{name: oneof_name} =
-      PgQuery.Node.fields_defs() |> Enum.find(&(&1.type == {:message, stmt.__struct__}))
-
-    protobuf =
-      %PgQuery.ParseResult{
-        version: @postgres_query_version,
-        stmts: [%PgQuery.RawStmt{stmt: %PgQuery.Node{node: {oneof_name, stmt}}}]
-      }
-
-    to_sql(protobuf)
-  end
+  def stmt_to_sql(stmt), do: node_to_sql(stmt)
 
   @doc """
   Similar to `stmt_to_sql/1` but raises on error.
@@ -182,12 +187,9 @@ defmodule ExPgQuery.Protobuf do
   @doc """
   Deparses a single expression node into SQL.
 
-  Takes an expression node and converts it to its SQL representation by wrapping
-  it in a SELECT statement and extracting the WHERE clause.
-
   ## Parameters
 
-    * `expr` - `PgQuery` expression struct
+    * `expr` - `PgQuery` expression struct, or `PgQuery.Node` wrapping one
 
   ## Returns
 
@@ -195,15 +197,7 @@ defmodule ExPgQuery.Protobuf do
     * `{:error, error}` - Error with reason
 
   """
-  def expr_to_sql(expr) do
-    case stmt_to_sql(%PgQuery.SelectStmt{where_clause: expr, op: :SETOP_NONE}) do
-      {:ok, query} ->
-        {:ok, String.replace_leading(query, "SELECT WHERE ", "")}
-
-      {:error, error} ->
-        {:error, error}
-    end
-  end
+  def expr_to_sql(expr), do: node_to_sql(expr)
 
   @doc """
   Similar to `expr_to_sql/1` but raises on error.
@@ -227,4 +221,69 @@ defmodule ExPgQuery.Protobuf do
       {:error, error} -> raise "Deparse error: #{inspect(error)}"
     end
   end
+
+  @doc """
+  Deparses a fragment of a query into SQL on its own, without wrapping it in
+  a statement.
+
+  The fragment can be a statement, an expression, a type name, a relation, a
+  target list or a list of expressions (such as a `GROUP BY` clause), given
+  either as a `PgQuery.Node`, as the struct it wraps or as a list of nodes.
+
+  ## Parameters
+
+    * `node` - `PgQuery.Node`, `PgQuery` node struct or list of `PgQuery.Node`
+
+  ## Returns
+
+    * `{:ok, string}` - Successfully deparsed fragment
+    * `{:error, error}` - Error with reason
+
+  ## Examples
+
+      iex> {:ok, %PgQuery.ParseResult{stmts: [%{stmt: %{node: {:select_stmt, stmt}}}]}} =
+      ...>   ExPgQuery.Protobuf.from_sql("SELECT id, name::text FROM users GROUP BY id")
+      iex> ExPgQuery.Protobuf.node_to_sql(stmt.target_list)
+      {:ok, "id, name::text"}
+      iex> ExPgQuery.Protobuf.node_to_sql(hd(stmt.from_clause))
+      {:ok, "users"}
+
+  """
+  def node_to_sql(%PgQuery.Node{} = node) do
+    ExPgQuery.Native.deparse_struct(node)
+  end
+
+  def node_to_sql(nodes) when is_list(nodes) do
+    node_to_sql(%PgQuery.Node{node: {:list, %PgQuery.List{items: nodes}}})
+  end
+
+  def node_to_sql(%module{} = node) do
+    case @node_oneof_names do
+      %{^module => oneof_name} -> node_to_sql(%PgQuery.Node{node: {oneof_name, node}})
+      %{} -> {:error, "#{inspect(module)} is not a node"}
+    end
+  end
+
+  @doc """
+  Similar to `node_to_sql/1` but raises on error.
+
+  ## Parameters
+
+    * `node` - `PgQuery.Node`, `PgQuery` node struct or list of `PgQuery.Node`
+
+  ## Returns
+
+    * SQL string
+
+  ## Raises
+
+    * Runtime error if deparsing fails
+
+  """
+  def node_to_sql!(node) do
+    case node_to_sql(node) do
+      {:ok, sql} -> sql
+      {:error, error} -> raise "Deparse error: #{inspect(error)}"
+    end
+  end
 end
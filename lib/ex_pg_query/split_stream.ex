@@ -0,0 +1,113 @@
+defmodule ExPgQuery.SplitStream do
+  @moduledoc """
+  Splits SQL that arrives in chunks, such as a `pg_dump` file too large to
+  read at once, into its statements.
+
+  The chunks are fed to a native splitter that keeps its lexer state between
+  them, so a chunk may end anywhere: inside a string literal, a dollar-quoted
+  function body, a comment or a `CREATE RULE ... (...; ...)` statement. Only
+  the statement currently being read is held in memory, no matter how large
+  the input is.
+
+  Statements are delimited like with `ExPgQuery.split/2` in `:scanner` mode,
+  except that statements consisting of only whitespace and comments are left
+  out, and semicolons inside the `BEGIN ATOMIC ... END` body of a function
+  don't end the statement. The data following a `COPY ... FROM STDIN`
+  statement, up to the line holding only `\\.`, is skipped without being kept
+  in memory.
+
+  ## Examples
+
+      iex> ["SELECT 'a;", "b'; SELECT $$", ";$$;"]
+      ...> |> ExPgQuery.SplitStream.stream()
+      ...> |> Enum.to_list()
+      ["SELECT 'a;b'", " SELECT $$;$$"]
+
+  """
+
+  @doc """
+  Returns a stream of the statements in the given chunks of SQL.
+
+  Statements that lie within a single chunk are sub-binaries of it, so they
+  keep the whole chunk alive; use `:binary.copy/1` on statements that are
+  kept around for long. Statements that span chunks are copied.
+
+  The stream raises if the input ends inside a string literal, quoted
+  identifier or comment.
+
+  ## Parameters
+
+    * `enumerable` - Enumerable of binaries, e.g. `File.stream!(path, 65_536)`
+
+  ## Examples
+
+      "dump.sql"
+      |> File.stream!(1_048_576)
+      |> ExPgQuery.SplitStream.stream()
+      |> Stream.map(&ExPgQuery.classify/1)
+      |> Enum.count(&match?({:ok, %{read_only: false}}, &1))
+
+  """
+  def stream(enumerable) do
+    Stream.transform(enumerable, &start/0, &feed/2, &finish/1, fn _state -> :ok end)
+  end
+
+  defp start do
+    {:ok, stream} = ExPgQuery.Native.split_stream_new()
+
+    # `pending` holds the input from `pending_start` up to the current chunk,
+    # in reverse, as far as it can still be part of a statement
+    %{stream: stream, offset: 0, pending: [], pending_start: 0}
+  end
+
+  defp feed(chunk, state) do
+    case ExPgQuery.Native.split_stream_feed(state.stream, chunk) do
+      {:ok, ranges, pending_location} -> take_statements(ranges, pending_location, chunk, state)
+      {:error, error} -> raise "Split error: #{inspect(error)}"
+    end
+  end
+
+  defp finish(state) do
+    case ExPgQuery.Native.split_stream_finish(state.stream) do
+      {:ok, ranges} -> Enum.map_reduce(ranges, state, &take_statement(&1, <<>>, &2))
+      {:error, error} -> raise "Split error: #{inspect(error)}"
+    end
+  end
+
+  defp take_statements(ranges, pending_location, chunk, state) do
+    {statements, state} = Enum.map_reduce(ranges, state, &take_statement(&1, chunk, &2))
+
+    chunk_end = state.offset + byte_size(chunk)
+
+    state =
+      if pending_location >= state.offset do
+        # Nothing before this chunk can be part of a statement anymore, e.g.
+        # after skipping COPY data
+        rest = binary_part(chunk, pending_location - state.offset, chunk_end - pending_location)
+        %{state | pending: [rest], pending_start: pending_location}
+      else
+        rest_start = max(state.pending_start, state.offset)
+        rest = binary_part(chunk, rest_start - state.offset, chunk_end - rest_start)
+        %{state | pending: [rest | state.pending]}
+      end
+
+    {statements, %{state | offset: chunk_end}}
+  end
+
+  defp take_statement({location, length}, chunk, %{offset: offset} = state)
+       when location >= offset do
+    statement = binary_part(chunk, location - offset, length)
+    {statement, %{state | pending: [], pending_start: location + length + 1}}
+  end
+
+  defp take_statement({location, length}, chunk, %{offset: offset} = state) do
+    data =
+      IO.iodata_to_binary([
+        Enum.reverse(state.pending),
+        binary_part(chunk, 0, location + length - offset)
+      ])
+
+    statement = binary_part(data, location - state.pending_start, length)
+    {statement, %{state | pending: [], pending_start: location + length + 1}}
+  end
+end
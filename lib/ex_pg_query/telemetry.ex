@@ -0,0 +1,73 @@
+defmodule ExPgQuery.Telemetry do
+  @moduledoc """
+  Emits the runtime statistics of the NIF as `:telemetry` events.
+
+  The NIF keeps call counts, error counts, input and output sizes, memory
+  usage and latency histograms for every single-query function (see `ExPgQuery.Native.stats/0`),
+  and can sample slow queries (see `ExPgQuery.Native.take_slow_queries/0`).
+  `emit/0` turns a snapshot of those into events, and is meant to be called
+  periodically, e.g. by `:telemetry_poller`:
+
+      {:telemetry_poller,
+       measurements: [{ExPgQuery.Telemetry, :emit, []}],
+       period: :timer.seconds(10)}
+
+  ## Events
+
+    * `[:ex_pg_query, :nif, :stats]` - Emitted once per function.
+      * Measurements: `:calls`, `:errors`, `:input_bytes`, `:output_bytes`,
+        `:duration` (native time in nanoseconds), `:peak_memory` and `:blocks`,
+        all cumulative since the NIF was loaded, and `:peak_memory_max`
+      * Metadata: `:function` and `:histogram` (see `ExPgQuery.Native.stats/0`)
+
+    * `[:ex_pg_query, :slow_query]` - Emitted for every query sampled since the
+      previous call. Only emitted when `:slow_query_threshold` is configured.
+      * Measurements: `:duration` (nanoseconds) and `:input_bytes`
+      * Metadata: `:function` and `:query` (truncated to 1024 bytes)
+
+    * `[:ex_pg_query, :slow_query, :dropped]` - Emitted when slow queries were
+      sampled faster than they were collected.
+      * Measurements: `:count`
+      * Metadata: none
+
+  """
+
+  alias ExPgQuery.Native
+
+  @doc """
+  Emits the current statistics and the sampled slow queries.
+
+  ## Examples
+
+      iex> ExPgQuery.Telemetry.emit()
+      :ok
+
+  """
+  def emit do
+    {:ok, stats} = Native.stats()
+
+    for {function, function_stats} <- stats do
+      :telemetry.execute(
+        [:ex_pg_query, :nif, :stats],
+        Map.drop(function_stats, [:histogram]),
+        %{function: function, histogram: function_stats.histogram}
+      )
+    end
+
+    {:ok, %{queries: queries, dropped: dropped}} = Native.take_slow_queries()
+
+    for query <- queries do
+      :telemetry.execute(
+        [:ex_pg_query, :slow_query],
+        %{duration: query.duration, input_bytes: query.input_bytes},
+        %{function: query.function, query: query.query}
+      )
+    end
+
+    if dropped > 0 do
+      :telemetry.execute([:ex_pg_query, :slow_query, :dropped], %{count: dropped}, %{})
+    end
+
+    :ok
+  end
+end
@@ -113,6 +113,175 @@ defmodule ExPgQuery.TreeUtils do
     end
   end
 
+  @doc """
+  Applies many updates to a nested structure in one pass.
+
+  Paths are the same as for `update_in_tree/3` and all refer to the original
+  tree. The edits are grouped by their common path prefixes, so every node
+  on the way to the updated values is rebuilt only once, and each list is
+  walked once no matter how many of its items are updated (instead of once
+  per edit, as with repeated `update_in_tree/3` calls).
+
+  When one path is a prefix of another, the update at the deeper path is
+  applied first, and the function at the shorter path receives its result.
+  Updates at the same path are applied in the order given.
+
+  ## Parameters
+
+    * `tree` - The root structure to update
+    * `edits` - A list of `{path, update_fn}` tuples
+
+  ## Returns
+
+    * `{:ok, tree}` on success
+    * `{:error, reason}` on failure, in which case no update is applied
+
+  ## Examples
+
+      iex> tree = %{a: %{b: 1, c: 2}, items: [1, 2, 3]}
+      iex> TreeUtils.update_many(tree, [
+      ...>   {[:a, :b], fn _ -> 10 end},
+      ...>   {[:a, :c], fn _ -> 20 end},
+      ...>   {[:items, 2], &(&1 * 100)},
+      ...>   {[:items, 0], &(&1 * 100)}
+      ...> ])
+      {:ok, %{a: %{b: 10, c: 20}, items: [100, 2, 300]}}
+
+      iex> TreeUtils.update_many(%{items: [1]}, [{[:items, 0], &(&1 + 1)}, {[:items, 3], &(&1 + 1)}])
+      {:error, "index 3 out of bounds"}
+
+  """
+  def update_many(tree, edits) when is_list(edits) do
+    apply_edits(tree, edits)
+  end
+
+  @doc """
+  Similar to update_many/2 but raises on error.
+
+  ## Parameters
+
+    * `tree` - The root structure to update
+    * `edits` - A list of `{path, update_fn}` tuples
+
+  ## Returns
+
+    * The updated tree on success
+
+  ## Raises
+
+    * `RuntimeError` with the error message on failure
+
+  ## Examples
+
+      iex> TreeUtils.update_many!(%{a: 1, b: 2}, [{[:a], &(&1 + 1)}, {[:b], &(&1 + 1)}])
+      %{a: 2, b: 3}
+
+  """
+  def update_many!(tree, edits) do
+    case update_many(tree, edits) do
+      {:ok, updated} -> updated
+      {:error, error} -> raise "Update error: #{inspect(error)}"
+    end
+  end
+
+  # Updates the children first, then applies the edits that end at this value
+  defp apply_edits(tree, edits) do
+    {here, below} = Enum.split_with(edits, fn {path, _update_fn} -> path == [] end)
+
+    with {:ok, updated} <- apply_child_edits(tree, below) do
+      {:ok, Enum.reduce(here, updated, fn {[], update_fn}, acc -> update_fn.(acc) end)}
+    end
+  end
+
+  defp apply_child_edits(tree, []), do: {:ok, tree}
+
+  defp apply_child_edits(%PgQuery.Node{node: {node_type, struct}}, edits) do
+    case Enum.find(edits, fn {[type | _rest], _update_fn} -> type != node_type end) do
+      nil ->
+        with {:ok, updated} <- apply_edits(struct, Enum.map(edits, &pop_step/1)) do
+          {:ok, %PgQuery.Node{node: {node_type, updated}}}
+        end
+
+      {[type | _rest], _update_fn} ->
+        {:error, "expected node type #{type} but found #{node_type}"}
+    end
+  end
+
+  defp apply_child_edits(list, edits) when is_list(list) do
+    case Enum.find(edits, fn {[index | _rest], _update_fn} -> not is_integer(index) end) do
+      nil ->
+        # Negative indices count from the end, like with Enum.at/2
+        list_length =
+          if Enum.any?(edits, fn {[index | _rest], _update_fn} -> index < 0 end),
+            do: length(list)
+
+        edits
+        |> Enum.group_by(
+          fn {[index | _rest], _update_fn} ->
+            if index < 0, do: index + list_length, else: index
+          end,
+          &pop_step/1
+        )
+        |> Enum.sort_by(fn {index, _edits} -> index end)
+        |> update_list(list, 0, [])
+
+      {[key | _rest], _update_fn} ->
+        {:error, "expected an index but found #{key}"}
+    end
+  end
+
+  defp apply_child_edits(tree, edits) when is_map(tree) do
+    edits
+    |> Enum.group_by(fn {[key | _rest], _update_fn} -> key end, &pop_step/1)
+    |> Enum.reduce_while({:ok, tree}, fn {key, key_edits}, {:ok, acc} ->
+      case Map.fetch(acc, key) do
+        {:ok, {oneof_type, struct}} when is_atom(oneof_type) ->
+          case apply_edits(struct, key_edits) do
+            {:ok, updated} -> {:cont, {:ok, Map.put(acc, key, {oneof_type, updated})}}
+            {:error, reason} -> {:halt, {:error, reason}}
+          end
+
+        {:ok, value} ->
+          case apply_edits(value, key_edits) do
+            {:ok, updated} -> {:cont, {:ok, Map.put(acc, key, updated)}}
+            {:error, reason} -> {:halt, {:error, reason}}
+          end
+
+        :error ->
+          {:halt, {:error, "key #{key} not found"}}
+      end
+    end)
+  end
+
+  defp apply_child_edits(_value, [{[key | _rest], _update_fn} | _edits]) do
+    {:error, "key #{key} not found"}
+  end
+
+  defp pop_step({[_step | rest], update_fn}), do: {rest, update_fn}
+
+  # Walks the list once, updating the items at the given (ascending) indices
+  # and keeping the tail after the last one as is
+  defp update_list([], rest, _position, acc), do: {:ok, Enum.reverse(acc, rest)}
+
+  defp update_list([{index, _edits} | _groups], [], _position, _acc) do
+    {:error, "index #{index} out of bounds"}
+  end
+
+  defp update_list([{index, edits} | groups] = all, [item | rest], position, acc) do
+    cond do
+      position < index ->
+        update_list(all, rest, position + 1, [item | acc])
+
+      index < 0 or is_nil(item) ->
+        {:error, "index #{index} out of bounds"}
+
+      true ->
+        with {:ok, updated} <- apply_edits(item, edits) do
+          update_list(groups, rest, position + 1, [updated | acc])
+        end
+    end
+  end
+
   @doc """
   Convenience function for setting a value directly in a nested structure.
 
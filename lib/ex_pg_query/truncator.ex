@@ -220,16 +220,8 @@ defmodule ExPgQuery.Truncator do
 
   # Calculates the length of a SELECT target list when rendered.
   defp select_target_list_length(node) do
-    with {:ok, query} <-
-           Protobuf.stmt_to_sql(%PgQuery.SelectStmt{
-             target_list: node,
-             op: :SETOP_NONE
-           }) do
-      {:ok,
-       query
-       |> String.replace_leading("SELECT", "")
-       |> String.trim_leading()
-       |> String.length()}
+    with {:ok, target_list} <- Protobuf.node_to_sql(node) do
+      {:ok, String.length(target_list)}
     end
   end
 
@@ -249,16 +241,8 @@ defmodule ExPgQuery.Truncator do
   end
 
   defp group_clause_length(node) do
-    with {:ok, query} <-
-           Protobuf.stmt_to_sql(%PgQuery.SelectStmt{
-             op: :SETOP_NONE,
-             group_clause: node
-           }) do
-      {:ok,
-       query
-       |> String.replace_leading("SELECT GROUP BY", "")
-       |> String.trim_leading()
-       |> String.length()}
+    with {:ok, group_clause} <- Protobuf.node_to_sql(node) do
+      {:ok, String.length(group_clause)}
     end
   end
 
@@ -1,9 +1,17 @@
 #ifndef PG_QUERY_H
 #define PG_QUERY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <sys/types.h>
 
+typedef enum {
+	PG_QUERY_ERROR_DEFAULT = 0, // any error not listed below, see message
+	PG_QUERY_ERROR_MEMORY_LIMIT, // PgQueryParseLimits.max_memory was exceeded
+	PG_QUERY_ERROR_NODE_LIMIT, // PgQueryParseLimits.max_nodes was exceeded
+	PG_QUERY_ERROR_DEPTH_LIMIT // PgQueryParseLimits.max_depth was exceeded
+} PgQueryErrorCode;
+
 typedef struct {
 	char* message; // exception message
 	char* funcname; // source function of exception (e.g. SearchSysCache)
@@ -11,6 +19,7 @@ typedef struct {
 	int lineno; // source of exception (e.g. 104)
 	int cursorpos; // char in query at which exception occurred
 	char* context; // additional context (optional, can be NULL)
+	PgQueryErrorCode code;
 } PgQueryError;
 
 typedef struct {
@@ -48,16 +57,56 @@ typedef struct {
   PgQueryError* error;
 } PgQuerySplitResult;
 
+typedef struct {
+  uint64_t stmt_location; // position in the whole stream, not in the chunk
+  uint64_t stmt_len;
+} PgQuerySplitStreamStmt;
+
+typedef struct {
+  PgQuerySplitStreamStmt* stmts; // owned by the stream, valid until its next call
+  int n_stmts;
+  uint64_t pending_location; // input before this isn't part of any later statement
+  PgQueryError* error; // owned by the stream
+} PgQuerySplitStreamResult;
+
+typedef struct PgQuerySplitStream PgQuerySplitStream;
+
 typedef struct {
   char* query;
   PgQueryError* error;
 } PgQueryDeparseResult;
 
 typedef struct {
-  char* plpgsql_funcs;
+  size_t offset; // of the function's JSON object in plpgsql_funcs
+  size_t len;
+} PgQueryPlpgsqlFunc;
+
+typedef struct {
+  char* plpgsql_funcs; // JSON array of all functions
   PgQueryError* error;
+  PgQueryPlpgsqlFunc* funcs; // where each function is in plpgsql_funcs, so they can be taken apart without decoding the JSON
+  int n_funcs;
 } PgQueryPlpgsqlParseResult;
 
+typedef struct {
+  char* name; // as written, e.g. "public.users"
+  const char* type; // "select", "dml" or "ddl" for tables, "call" or "ddl" for functions (static string, not freed)
+} PgQueryPlpgsqlRef;
+
+typedef struct {
+  char* name; // of the created function as written, NULL for DO blocks
+  PgQueryPlpgsqlRef* tables; // each name and type once, in the order they are first referenced
+  int n_tables;
+  PgQueryPlpgsqlRef* functions;
+  int n_functions;
+} PgQueryPlpgsqlDeps;
+
+typedef struct {
+  PgQueryPlpgsqlDeps* funcs; // one per CREATE FUNCTION/PROCEDURE and DO statement
+  int n_funcs;
+  PgQueryError* error;
+} PgQueryPlpgsqlDepsResult;
+
 typedef struct {
   uint64_t fingerprint;
   char* fingerprint_str;
@@ -65,11 +114,59 @@ typedef struct {
   PgQueryError* error;
 } PgQueryFingerprintResult;
 
+typedef struct {
+  const char* node_type; // "SelectStmt", "CommonTableExpr", "SubLink" or "RangeSubselect" (static string, not freed)
+  int location; // char in query at which the node starts, -1 if the node doesn't record its location
+  int parent; // index of the enclosing subtree, -1 for subtrees that are not nested in another one
+  uint64_t fingerprint;
+} PgQueryFingerprintSubtree;
+
+typedef struct {
+  uint64_t fingerprint;
+  char* fingerprint_str;
+  PgQueryFingerprintSubtree* subtrees; // in the order the subtrees start in the tree
+  int n_subtrees;
+  char* stderr_buffer;
+  PgQueryError* error;
+} PgQueryFingerprintSubtreesResult;
+
 typedef struct {
   char* normalized_query;
   PgQueryError* error;
 } PgQueryNormalizeResult;
 
+typedef struct {
+  int location; // of the "$n", or of the type name when it comes first, e.g. in "INTERVAL $1"
+  int length; // of the "$n", up to and including it when the location is that of the type name
+  char** type_names; // names of the type the param ref is cast to, e.g. "pg_catalog" and "interval", NULL if it isn't cast
+  int n_type_names;
+} PgQueryParamRef;
+
+typedef struct {
+  PgQueryParamRef* param_refs; // in the order they appear in the query
+  int n_param_refs;
+  PgQueryError* error;
+} PgQueryParamRefsResult;
+
+typedef struct {
+  const char* stmt_type; // name of the statement's field in the protobuf Node message, e.g. "select_stmt" (static string, not freed)
+  bool read_only; // doesn't write data or change the schema, so it could run in a read-only transaction (functions it calls aren't looked at)
+} PgQueryClassifiedStmt;
+
+typedef struct {
+  PgQueryClassifiedStmt* stmts;
+  int n_stmts;
+  bool parsed; // whether the input had to be parsed, because its tokens didn't settle every statement
+  char* stderr_buffer;
+  PgQueryError* error;
+} PgQueryClassifyResult;
+
+typedef struct {
+  size_t mem_allocated; // bytes held by the call's memory context when it was released
+  size_t peak_mem_allocated; // highest number of bytes held by the call's memory contexts at any point
+  size_t n_blocks; // number of blocks the call's memory contexts obtained from malloc
+} PgQueryMemoryStats;
+
 // Postgres parser options (parse mode and GUCs that affect parsing)
 
 typedef enum
@@ -91,6 +188,60 @@ typedef enum
 #define PG_QUERY_DISABLE_STANDARD_CONFORMING_STRINGS 32 // standard_conforming_strings = off (default is on)
 #define PG_QUERY_DISABLE_ESCAPE_STRING_WARNING 64 // escape_string_warning = off (default is on)
 
+// Collapses IN lists, ARRAY[...] and VALUES lists of more than n constants
+// (0 < n < 32768) into a single IntList holding the number of items and the
+// location and length of their source text, so that huge literal lists don't
+// blow up the parse tree output. VALUES lists keep one row holding the IntList.
+// Fingerprints stay the same, but the collapsed tree can't be deparsed.
+#define PG_QUERY_COLLAPSE_LISTS_SHIFT 16
+#define PG_QUERY_COLLAPSE_LISTS(n) ((n) << PG_QUERY_COLLAPSE_LISTS_SHIFT)
+
+// Limits enforced while parsing, so that pathological inputs fail early with
+// a PgQueryError instead of using up memory or stack. 0 means no limit.
+typedef struct {
+	size_t max_memory; // bytes the parser may allocate
+	size_t max_nodes; // parse tree nodes the parser may create
+	int max_depth; // levels of nodes nested in each other in the parse tree
+} PgQueryParseLimits;
+
+// Changes pg_query_rewrite makes to the parse tree before deparsing it
+
+// Relations named relname (and schemaname, NULL only matches unqualified
+// references) are renamed to new_relname (NULL keeps the name) in schema
+// new_schemaname (NULL keeps the schema)
+typedef struct {
+	const char* schemaname;
+	const char* relname;
+	const char* new_schemaname;
+	const char* new_relname;
+} PgQueryRewriteRelation;
+
+#define PG_QUERY_REWRITE_SELECT 1
+#define PG_QUERY_REWRITE_UPDATE 2
+#define PG_QUERY_REWRITE_DELETE 4
+
+typedef struct {
+	const PgQueryRewriteRelation* relations;
+	int n_relations;
+	const char* schemaname; // set on unqualified relations that don't refer to a CTE, NULL to leave them unqualified
+	const char* where; // SQL expression AND-ed into the WHERE clause of top-level statements and of UPDATEs/DELETEs in WITH clauses, NULL for none
+	int where_stmts; // PG_QUERY_REWRITE_* flags of the statements that get the WHERE expression
+	int limit; // LIMIT set on top-level SELECTs, -1 to leave it alone
+	int max_limit; // LIMIT top-level SELECTs are capped to (added where missing), -1 for no cap
+} PgQueryRewrite;
+
+// Allocates the output buffers of results: the protobuf data of parse and scan
+// results, and the JSON parse tree, normalized and deparsed query strings.
+// They are malloc-ed by default; callers that want to hand the output on
+// without copying it (e.g. as a buffer owned by a language runtime) can pass
+// their own functions. free is called by the pg_query_free_*_result functions
+// for buffers the caller didn't take over (set the result field to NULL for
+// those), and never with NULL.
+typedef struct {
+	void *(*alloc)(size_t size);
+	void (*free)(void *ptr);
+} PgQueryOutputAllocator;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -107,6 +258,13 @@ PgQueryPlpgsqlParseResult pg_query_parse_plpgsql(const char* input);
 PgQueryFingerprintResult pg_query_fingerprint(const char* input);
 PgQueryFingerprintResult pg_query_fingerprint_opts(const char* input, int parser_options);
 
+// Same as pg_query_fingerprint, but additionally returns the fingerprints of
+// every SelectStmt, CommonTableExpr, SubLink and RangeSubselect in the tree,
+// computed in the same pass. A subtree's fingerprint only depends on the
+// subtree itself, so it can be used to group subqueries/CTEs across statements.
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees(const char* input);
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_opts(const char* input, int parser_options);
+
 // Use pg_query_split_with_scanner when you need to split statements that may
 // contain parse errors, otherwise pg_query_split_with_parser is recommended
 // for improved accuracy due the parser adding additional token handling.
@@ -117,7 +275,71 @@ PgQueryFingerprintResult pg_query_fingerprint_opts(const char* input, int parser
 PgQuerySplitResult pg_query_split_with_scanner(const char *input);
 PgQuerySplitResult pg_query_split_with_parser(const char *input);
 
+// Same as the functions above, but take the length of the input instead of
+// relying on it being NUL-terminated, so callers that hold the query in a
+// length-delimited buffer don't need to copy it first. As with the other
+// functions, the scanner stops at a NUL byte inside the input.
+PgQueryNormalizeResult pg_query_normalize_n(const char* input, size_t len);
+PgQueryNormalizeResult pg_query_normalize_utility_n(const char* input, size_t len);
+PgQueryScanResult pg_query_scan_n(const char* input, size_t len);
+PgQueryParseResult pg_query_parse_n(const char* input, size_t len);
+PgQueryParseResult pg_query_parse_opts_n(const char* input, size_t len, int parser_options);
+PgQueryProtobufParseResult pg_query_parse_protobuf_n(const char* input, size_t len);
+PgQueryProtobufParseResult pg_query_parse_protobuf_opts_n(const char* input, size_t len, int parser_options);
+PgQueryFingerprintResult pg_query_fingerprint_n(const char* input, size_t len);
+PgQueryFingerprintResult pg_query_fingerprint_opts_n(const char* input, size_t len, int parser_options);
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_n(const char* input, size_t len);
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_opts_n(const char* input, size_t len, int parser_options);
+PgQuerySplitResult pg_query_split_with_scanner_n(const char *input, size_t len);
+PgQuerySplitResult pg_query_split_with_parser_n(const char *input, size_t len);
+PgQueryPlpgsqlParseResult pg_query_parse_plpgsql_n(const char* input, size_t len);
+
+// Tables and functions referenced by the SQL in the bodies of the functions
+// and DO blocks in the input, LANGUAGE sql functions included
+PgQueryPlpgsqlDepsResult pg_query_plpgsql_deps(const char* input);
+PgQueryPlpgsqlDepsResult pg_query_plpgsql_deps_n(const char* input, size_t len);
+
+// Splits input that arrives in chunks (e.g. a dump file too large to hold in
+// memory), returning the statements that end in each chunk as soon as they
+// are complete. Lexer state such as open string literals, dollar quotes,
+// comments and parentheses carries over between chunks. Statements are
+// delimited like with pg_query_split_with_scanner, except that only those
+// made up of whitespace and comments are left out, and semicolons inside the
+// BEGIN ... END body of a function don't end the statement.
+//
+// Feed the input with pg_query_split_stream_feed, then call
+// pg_query_split_stream_finish once to get the last statement (or an error if
+// the input ends inside a string or comment).
+PgQuerySplitStream* pg_query_split_stream_new(void);
+PgQuerySplitStreamResult pg_query_split_stream_feed(PgQuerySplitStream* stream, const char* chunk, size_t len);
+PgQuerySplitStreamResult pg_query_split_stream_finish(PgQuerySplitStream* stream);
+void pg_query_split_stream_free(PgQuerySplitStream* stream);
+
+// Returns the type of each statement and whether it is read-only. Statements
+// are classified from their leading tokens where that is unambiguous, and
+// only parsed when it isn't (e.g. most DDL other than CREATE/DROP/ALTER
+// TABLE and friends), so this is much cheaper than pg_query_parse_protobuf
+// for typical workloads.
+PgQueryClassifyResult pg_query_classify(const char* input);
+PgQueryClassifyResult pg_query_classify_n(const char* input, size_t len);
+
 PgQueryDeparseResult pg_query_deparse_protobuf(PgQueryProtobuf parse_tree);
+// Deparses a single protobuf-encoded Node: a statement, an expression, a type
+// name, a relation, a target list or a list of expressions
+PgQueryDeparseResult pg_query_deparse_node_protobuf(PgQueryProtobuf node);
+
+// Parses the input, makes the changes described by rewrite to each statement
+// and deparses the result, in one call
+PgQueryDeparseResult pg_query_rewrite(const char* input, const PgQueryRewrite* rewrite);
+PgQueryDeparseResult pg_query_rewrite_n(const char* input, size_t len, const PgQueryRewrite* rewrite);
+
+// Locations of the param refs (e.g. "$1") in the input, as
+// found by the same tree walk that normalizes constants, without building
+// the parse tree output. Besides queries, the walk covers PREPARE, EXECUTE,
+// CREATE TABLE [AS], ALTER TABLE, CREATE VIEW and CALL; param refs in other
+// utility statements (e.g. an index predicate) are not reported
+PgQueryParamRefsResult pg_query_param_refs(const char* input);
+PgQueryParamRefsResult pg_query_param_refs_n(const char* input, size_t len);
 
 void pg_query_free_normalize_result(PgQueryNormalizeResult result);
 void pg_query_free_scan_result(PgQueryScanResult result);
@@ -126,11 +348,28 @@ void pg_query_free_split_result(PgQuerySplitResult result);
 void pg_query_free_deparse_result(PgQueryDeparseResult result);
 void pg_query_free_protobuf_parse_result(PgQueryProtobufParseResult result);
 void pg_query_free_plpgsql_parse_result(PgQueryPlpgsqlParseResult result);
+void pg_query_free_plpgsql_deps_result(PgQueryPlpgsqlDepsResult result);
 void pg_query_free_fingerprint_result(PgQueryFingerprintResult result);
+void pg_query_free_fingerprint_subtrees_result(PgQueryFingerprintSubtreesResult result);
+void pg_query_free_classify_result(PgQueryClassifyResult result);
+void pg_query_free_param_refs_result(PgQueryParamRefsResult result);
 
 // Optional, cleans up the top-level memory context (automatically done for threads that exit)
 void pg_query_exit(void);
 
+// Memory usage of the most recent call on the current thread, or all zeros
+// after pg_query_reset_memory_stats (e.g. to tell apart calls that were
+// answered without calling into libpg_query)
+PgQueryMemoryStats pg_query_last_memory_stats(void);
+void pg_query_reset_memory_stats(void);
+
+// Applies to all later calls on the current thread that parse SQL
+void pg_query_set_parse_limits(PgQueryParseLimits limits);
+
+// Applies to all threads, set it before any results are created. NULL goes
+// back to malloc and free.
+void pg_query_set_output_allocator(const PgQueryOutputAllocator *allocator);
+
 // Postgres version information
 #define PG_MAJORVERSION "17"
 #define PG_VERSION "17.0"
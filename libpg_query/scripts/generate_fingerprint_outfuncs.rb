@@ -15,8 +15,8 @@ class Generator
   end
 
   FINGERPRINT_RES_TARGET_NAME = <<-EOL
-  if (node->name != NULL && (field_name == NULL || parent == NULL || !IsA(parent, SelectStmt) || strcmp(field_name, "targetList") != 0)) {
-    _fingerprintString(ctx, "name");
+  if (node->name != NULL && (field != FINGERPRINT_FIELD_TARGET_LIST || parent == NULL || !IsA(parent, SelectStmt))) {
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -38,8 +38,8 @@ class Generator
       }
     }
     *p = 0;
-    _fingerprintString(ctx, "relname");
-    _fingerprintString(ctx, r);
+    _fingerprintLiteral(ctx, "relname");
+    _fingerprintStringLen(ctx, r, p - r);
     pfree(r);
   }
 
@@ -47,11 +47,12 @@ class Generator
 
   FINGERPRINT_A_EXPR_KIND = <<-EOL
   if (true) {
-    _fingerprintString(ctx, "kind");
-    if (node->kind == AEXPR_OP_ANY || node->kind == AEXPR_IN)
-      _fingerprintString(ctx, "AEXPR_OP");
-    else
+    if (node->kind == AEXPR_OP_ANY || node->kind == AEXPR_IN) {
+      _fingerprintLiteralPair(ctx, "kind", "AEXPR_OP");
+    } else {
+      _fingerprintLiteral(ctx, "kind");
       _fingerprintString(ctx, _enumToStringA_Expr_Kind(node->kind));
+    }
   }
 
   EOL
@@ -62,15 +63,12 @@ class Generator
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, %<cast>s&node->%<name>s, node, "%<name>s", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, %<cast>s&node->%<name>s, node, %<field>s, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("%<name>s") - 1);
     XXH3_freeState(prev);
   }
 
@@ -82,15 +80,12 @@ class Generator
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, %<cast>snode->%<name>s, node, "%<name>s", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, %<cast>snode->%<name>s, node, %<field>s, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("%<name>s") - 1);
     XXH3_freeState(prev);
   }
 
@@ -102,15 +97,12 @@ class Generator
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprint%<typename>s(ctx, node->%<name>s, node, "%<name>s", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprint%<typename>s(ctx, node->%<name>s, node, %<field>s, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("%<name>s") - 1);
     XXH3_freeState(prev);
   }
 
@@ -122,45 +114,36 @@ class Generator
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->%<name>s, node, "%<name>s", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->%<name>s) == 1 && linitial(node->%<name>s) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->%<name>s, node, %<field>s, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->%<name>s) == 1 && linitial(node->%<name>s) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("%<name>s") - 1);
     XXH3_freeState(prev);
   }
   EOL
 
   FINGERPRINT_INT = <<-EOL
   if (node->%<name>s != 0) {
-    char buffer[50];
-    sprintf(buffer, "%%d", node->%<name>s);
-    _fingerprintString(ctx, "%<name>s");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "%<name>s");
+    _fingerprintInt64(ctx, node->%<name>s);
   }
 
   EOL
 
   FINGERPRINT_LONG_INT = <<-EOL
   if (node->%<name>s != 0) {
-    char buffer[50];
-    sprintf(buffer, "%%ld", node->%<name>s);
-    _fingerprintString(ctx, "%<name>s");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "%<name>s");
+    _fingerprintInt64(ctx, node->%<name>s);
   }
 
   EOL
 
   FINGERPRINT_UINT64 = <<-EOL
   if (node->%<name>s != 0) {
-    char buffer[50];
-    sprintf(buffer, UINT64_FORMAT, node->%<name>s);
-    _fingerprintString(ctx, "%<name>s");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "%<name>s");
+    _fingerprintUInt64(ctx, node->%<name>s);
   }
 
   EOL
@@ -169,7 +152,7 @@ class Generator
   if (node->%<name>s != 0) {
     char buffer[50];
     sprintf(buffer, "%%f", node->%<name>s);
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
     _fingerprintString(ctx, buffer);
   }
 
@@ -177,24 +160,23 @@ class Generator
 
   FINGERPRINT_CHAR = <<-EOL
   if (node->%<name>s != 0) {
-    char buffer[2] = {node->%<name>s, '\\0'};
-    _fingerprintString(ctx, "%<name>s");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "%<name>s");
+    _fingerprintStringLen(ctx, &node->%<name>s, 1);
   }
 
   EOL
 
   FINGERPRINT_CHAR_PTR = <<-EOL
   if (node->%<name>s != NULL) {
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
     _fingerprintString(ctx, node->%<name>s);
   }
 
   EOL
 
   FINGERPRINT_STRING = <<-EOL
-  if (strlen(node->%<name>s->sval) > 0) {
-    _fingerprintString(ctx, "%<name>s");
+  if (node->%<name>s->sval[0] != '\\0') {
+    _fingerprintLiteral(ctx, "%<name>s");
     _fingerprintString(ctx, node->%<name>s->sval);
   }
 
@@ -202,8 +184,7 @@ class Generator
 
   FINGERPRINT_BOOL = <<-EOL
   if (node->%<name>s) {
-    _fingerprintString(ctx, "%<name>s");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "%<name>s", "true");
   }
 
   EOL
@@ -213,12 +194,10 @@ class Generator
     int x = -1;
     Bitmapset	*bms = bms_copy(node->%<name>s);
 
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
@@ -228,7 +207,7 @@ class Generator
 
   FINGERPRINT_ENUM = <<-EOL
   if (true) {
-    _fingerprintString(ctx, "%<name>s");
+    _fingerprintLiteral(ctx, "%<name>s");
     _fingerprintString(ctx, _enumToString%<typename>s(node->%<name>s));
   }
 
@@ -278,6 +257,21 @@ class Generator
 
   IGNORE_FOR_GENERATOR = ['Integer', 'Float', 'String', 'BitString', 'List']
 
+  # Fields the fingerprinter makes decisions on (see FingerprintField in
+  # pg_query_fingerprint.c), all other fields are passed as FINGERPRINT_FIELD_OTHER
+  FINGERPRINT_FIELD_IDS = {
+    'args' => 'FINGERPRINT_FIELD_ARGS',
+    'cols' => 'FINGERPRINT_FIELD_COLS',
+    'fromClause' => 'FINGERPRINT_FIELD_FROM_CLAUSE',
+    'rexpr' => 'FINGERPRINT_FIELD_REXPR',
+    'targetList' => 'FINGERPRINT_FIELD_TARGET_LIST',
+    'valuesLists' => 'FINGERPRINT_FIELD_VALUES_LISTS',
+  }
+
+  def field_id(name)
+    FINGERPRINT_FIELD_IDS.fetch(name, 'FINGERPRINT_FIELD_OTHER')
+  end
+
   def generate_fingerprint_defs!
     @fingerprint_defs = {}
 
@@ -309,18 +303,18 @@ class Generator
             # when '[]Node'
             #  fingerprint_def += format(FINGERPRINT_NODE_ARRAY, name: name)
             when 'Node'
-              fingerprint_def += format(FINGERPRINT_NODE, name: name, cast: '')
+              fingerprint_def += format(FINGERPRINT_NODE, name: name, field: field_id(name), cast: '')
             when 'Node*', 'Expr*'
-              fingerprint_def += format(FINGERPRINT_NODE_PTR, name: name, cast: '')
+              fingerprint_def += format(FINGERPRINT_NODE_PTR, name: name, field: field_id(name), cast: '')
             when 'JsonTablePlan'
-              fingerprint_def += format(FINGERPRINT_NODE, name: name, cast: '(Node*)')
+              fingerprint_def += format(FINGERPRINT_NODE, name: name, field: field_id(name), cast: '(Node*)')
             when 'JsonTablePlan*'
-              fingerprint_def += format(FINGERPRINT_NODE_PTR, name: name, cast: '(Node*)')
+              fingerprint_def += format(FINGERPRINT_NODE_PTR, name: name, field: field_id(name), cast: '(Node*)')
             when 'List*'
-              fingerprint_def += format(FINGERPRINT_LIST, name: name)
+              fingerprint_def += format(FINGERPRINT_LIST, name: name, field: field_id(name))
             when 'CreateStmt'
-              fingerprint_def += format("  _fingerprintString(ctx, \"%s\");\n", name)
-              fingerprint_def += format("  _fingerprintCreateStmt(ctx, (const CreateStmt*) &node->%s, node, \"%s\", depth);\n", name, name)
+              fingerprint_def += format("  _fingerprintLiteral(ctx, \"%s\");\n", name)
+              fingerprint_def += format("  _fingerprintCreateStmt(ctx, (const CreateStmt*) &node->%s, node, %s, depth);\n", name, field_id(name))
             when 'char'
               fingerprint_def += format(FINGERPRINT_CHAR, name: name)
             when 'char*'
@@ -344,7 +338,7 @@ class Generator
             else
               if field_type.end_with?('*') && @nodetypes.include?(field_type[0..-2])
                 typename = field_type[0..-2]
-                fingerprint_def += format(FINGERPRINT_SPECIFIC_NODE_PTR, name: name, typename: typename)
+                fingerprint_def += format(FINGERPRINT_SPECIFIC_NODE_PTR, name: name, field: field_id(name), typename: typename)
               elsif @all_known_enums.include?(field_type)
                 fingerprint_def += format(FINGERPRINT_ENUM, name: name, typename: field_type)
               else
@@ -372,7 +366,7 @@ class Generator
     @nodetypes.each do |type|
       fingerprint_def = @fingerprint_defs[type]
       next unless fingerprint_def
-      defs += format("static void _fingerprint%s(FingerprintContext *ctx, const %s *node, const void *parent, const char *field_name, unsigned int depth);\n", type, type)
+      defs += format("static void _fingerprint%s(FingerprintContext *ctx, const %s *node, const void *parent, FingerprintField field, unsigned int depth);\n", type, type)
     end
     defs += "\n\n"
 
@@ -382,7 +376,7 @@ class Generator
       next unless fingerprint_def
 
       defs += "static void\n"
-      defs += format("_fingerprint%s(FingerprintContext *ctx, const %s *node, const void *parent, const char *field_name, unsigned int depth)\n", type, type)
+      defs += format("_fingerprint%s(FingerprintContext *ctx, const %s *node, const void *parent, FingerprintField field, unsigned int depth)\n", type, type)
       defs += "{\n"
       defs += fingerprint_def
       defs += "}\n"
@@ -393,8 +387,8 @@ class Generator
         conds += format("  // Intentionally ignoring for fingerprinting\n")
       else
         conds += format("  if (!IsA(castNode(TypeCast, (void*) obj)->arg, A_Const) && !IsA(castNode(TypeCast, (void*) obj)->arg, ParamRef))\n  {\n") if type == 'TypeCast'
-        conds += format("  _fingerprintString(ctx, \"%s\");\n", type)
-        conds += format("  _fingerprint%s(ctx, obj, parent, field_name, depth);\n", type)
+        conds += format("  _fingerprintLiteral(ctx, \"%s\");\n", type)
+        conds += format("  _fingerprint%s(ctx, obj, parent, field, depth);\n", type)
         conds += "  }\n" if type == 'TypeCast'
       end
       conds += "  break;\n"
@@ -41,6 +41,8 @@ class Generator
     @enum_to_strings = {}
     @enum_to_ints = {}
     @int_to_enums = {}
+    @read_field_names = []
+    @read_enum_values = []
 
     ['nodes/parsenodes', 'nodes/primnodes'].each do |group|
       @struct_defs[group].each do |node_type, struct_def|
@@ -61,6 +63,8 @@ class Generator
           outname = OUTNAME_OVERRIDES[[node_type, name]] || underscore(name)
           outname_json = name
 
+          @read_field_names << outname unless type == :skip || type == 'NodeTag'
+
           if type == :skip
             # Ignore
           elsif type == 'NodeTag'
@@ -180,6 +184,7 @@ class Generator
         # We intentionally add a dummy field for the zero value, that actually is not used in practice
         # - this ensures that the JSON output always includes the enum value (and doesn't skip it because its the zero value)
         @protobuf_enums[enum_type] += format("  %s_UNDEFINED = 0;\n", underscore(enum_type).upcase)
+        @read_enum_values << format("READ_ENUM_VALUE(%s, %s_UNDEFINED, 0)\n", enum_type, underscore(enum_type).upcase)
         protobuf_field = 1
 
         enum_def['values'].each do |value|
@@ -189,6 +194,7 @@ class Generator
           @enum_to_strings[enum_type] += format("    case %s: return \"%s\";\n", value['name'], value['name'])
           @enum_to_ints[enum_type] += format("    case %s: return %d;\n", value['name'], protobuf_field)
           @int_to_enums[enum_type] += format("    case %d: return %s;\n", protobuf_field, value['name'])
+          @read_enum_values << format("READ_ENUM_VALUE(%s, %s, %d)\n", enum_type, value['name'], protobuf_field)
           protobuf_field += 1
         end
 
@@ -321,6 +327,13 @@ case T_A_Const:
 
     File.write('./src/include/pg_query_readfuncs_conds.c', "// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb\n\n" + read_conds)
 
+    # Field names and enum values as they appear in the protobuf messages, for readers that look them up by name
+    File.write('./src/include/pg_query_readfuncs_fields.c', "// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb\n\n" +
+      @read_field_names.uniq.sort.map { |name| format("READ_FIELD_NAME(%s)\n", name) }.join)
+
+    File.write('./src/include/pg_query_readfuncs_enum_values.c', "// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb\n\n" +
+      @read_enum_values.join)
+
     protobuf = "// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb
 
 syntax = \"proto3\";
@@ -1,297 +1,293 @@
-static void _fingerprintAlias(FingerprintContext *ctx, const Alias *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeVar(FingerprintContext *ctx, const RangeVar *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintVar(FingerprintContext *ctx, const Var *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintConst(FingerprintContext *ctx, const Const *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintParam(FingerprintContext *ctx, const Param *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWindowFuncRunCondition(FingerprintContext *ctx, const WindowFuncRunCondition *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMergeSupportFunc(FingerprintContext *ctx, const MergeSupportFunc *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFuncExpr(FingerprintContext *ctx, const FuncExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintNamedArgExpr(FingerprintContext *ctx, const NamedArgExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintOpExpr(FingerprintContext *ctx, const OpExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintScalarArrayOpExpr(FingerprintContext *ctx, const ScalarArrayOpExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintBoolExpr(FingerprintContext *ctx, const BoolExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlternativeSubPlan(FingerprintContext *ctx, const AlternativeSubPlan *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFieldSelect(FingerprintContext *ctx, const FieldSelect *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRelabelType(FingerprintContext *ctx, const RelabelType *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCoerceViaIO(FingerprintContext *ctx, const CoerceViaIO *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintArrayCoerceExpr(FingerprintContext *ctx, const ArrayCoerceExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintConvertRowtypeExpr(FingerprintContext *ctx, const ConvertRowtypeExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCollateExpr(FingerprintContext *ctx, const CollateExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCaseWhen(FingerprintContext *ctx, const CaseWhen *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCaseTestExpr(FingerprintContext *ctx, const CaseTestExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintArrayExpr(FingerprintContext *ctx, const ArrayExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRowExpr(FingerprintContext *ctx, const RowExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCoalesceExpr(FingerprintContext *ctx, const CoalesceExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMinMaxExpr(FingerprintContext *ctx, const MinMaxExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSQLValueFunction(FingerprintContext *ctx, const SQLValueFunction *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonFormat(FingerprintContext *ctx, const JsonFormat *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonReturning(FingerprintContext *ctx, const JsonReturning *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonIsPredicate(FingerprintContext *ctx, const JsonIsPredicate *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTablePath(FingerprintContext *ctx, const JsonTablePath *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSiblingJoin *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintNullTest(FingerprintContext *ctx, const NullTest *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintBooleanTest(FingerprintContext *ctx, const BooleanTest *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCoerceToDomain(FingerprintContext *ctx, const CoerceToDomain *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCoerceToDomainValue(FingerprintContext *ctx, const CoerceToDomainValue *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSetToDefault(FingerprintContext *ctx, const SetToDefault *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCurrentOfExpr(FingerprintContext *ctx, const CurrentOfExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintNextValueExpr(FingerprintContext *ctx, const NextValueExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintInferenceElem(FingerprintContext *ctx, const InferenceElem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTargetEntry(FingerprintContext *ctx, const TargetEntry *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTblRef(FingerprintContext *ctx, const RangeTblRef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFromExpr(FingerprintContext *ctx, const FromExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintColumnRef(FingerprintContext *ctx, const ColumnRef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintParamRef(FingerprintContext *ctx, const ParamRef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTypeCast(FingerprintContext *ctx, const TypeCast *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRoleSpec(FingerprintContext *ctx, const RoleSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintA_Star(FingerprintContext *ctx, const A_Star *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintA_Indirection(FingerprintContext *ctx, const A_Indirection *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintA_ArrayExpr(FingerprintContext *ctx, const A_ArrayExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintResTarget(FingerprintContext *ctx, const ResTarget *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMultiAssignRef(FingerprintContext *ctx, const MultiAssignRef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeSubselect(FingerprintContext *ctx, const RangeSubselect *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTableLikeClause(FingerprintContext *ctx, const TableLikeClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDefElem(FingerprintContext *ctx, const DefElem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintLockingClause(FingerprintContext *ctx, const LockingClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintXmlSerialize(FingerprintContext *ctx, const XmlSerialize *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPartitionSpec(FingerprintContext *ctx, const PartitionSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPartitionRangeDatum(FingerprintContext *ctx, const PartitionRangeDatum *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSinglePartitionSpec(FingerprintContext *ctx, const SinglePartitionSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPartitionCmd(FingerprintContext *ctx, const PartitionCmd *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTableSampleClause(FingerprintContext *ctx, const TableSampleClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWithCheckOption(FingerprintContext *ctx, const WithCheckOption *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSortGroupClause(FingerprintContext *ctx, const SortGroupClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintGroupingSet(FingerprintContext *ctx, const GroupingSet *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRowMarkClause(FingerprintContext *ctx, const RowMarkClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintWithClause(FingerprintContext *ctx, const WithClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCTESearchClause(FingerprintContext *ctx, const CTESearchClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTriggerTransition(FingerprintContext *ctx, const TriggerTransition *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonOutput(FingerprintContext *ctx, const JsonOutput *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonArgument(FingerprintContext *ctx, const JsonArgument *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTablePathSpec(FingerprintContext *ctx, const JsonTablePathSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonKeyValue(FingerprintContext *ctx, const JsonKeyValue *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonParseExpr(FingerprintContext *ctx, const JsonParseExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonScalarExpr(FingerprintContext *ctx, const JsonScalarExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonSerializeExpr(FingerprintContext *ctx, const JsonSerializeExpr *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConstructor *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstructor *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQueryConstructor *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRawStmt(FingerprintContext *ctx, const RawStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintReturnStmt(FingerprintContext *ctx, const ReturnStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPLAssignStmt(FingerprintContext *ctx, const PLAssignStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateSchemaStmt(FingerprintContext *ctx, const CreateSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTableStmt(FingerprintContext *ctx, const AlterTableStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintReplicaIdentityStmt(FingerprintContext *ctx, const ReplicaIdentityStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterCollationStmt(FingerprintContext *ctx, const AlterCollationStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAccessPriv(FingerprintContext *ctx, const AccessPriv *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterDefaultPrivilegesStmt(FingerprintContext *ctx, const AlterDefaultPrivilegesStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintVariableSetStmt(FingerprintContext *ctx, const VariableSetStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintVariableShowStmt(FingerprintContext *ctx, const VariableShowStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpaceStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropTableSpaceStmt(FingerprintContext *ctx, const DropTableSpaceStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTableSpaceOptionsStmt(FingerprintContext *ctx, const AlterTableSpaceOptionsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTableMoveAllStmt(FingerprintContext *ctx, const AlterTableMoveAllStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateExtensionStmt(FingerprintContext *ctx, const CreateExtensionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterExtensionStmt(FingerprintContext *ctx, const AlterExtensionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterExtensionContentsStmt(FingerprintContext *ctx, const AlterExtensionContentsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateForeignServerStmt(FingerprintContext *ctx, const CreateForeignServerStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterForeignServerStmt(FingerprintContext *ctx, const AlterForeignServerStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateForeignTableStmt(FingerprintContext *ctx, const CreateForeignTableStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterUserMappingStmt(FingerprintContext *ctx, const AlterUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropUserMappingStmt(FingerprintContext *ctx, const DropUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeignSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateAmStmt(FingerprintContext *ctx, const CreateAmStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterEventTrigStmt(FingerprintContext *ctx, const AlterEventTrigStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateRoleStmt(FingerprintContext *ctx, const CreateRoleStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropRoleStmt(FingerprintContext *ctx, const DropRoleStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateOpFamilyStmt(FingerprintContext *ctx, const CreateOpFamilyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropStmt(FingerprintContext *ctx, const DropStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTruncateStmt(FingerprintContext *ctx, const TruncateStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCommentStmt(FingerprintContext *ctx, const CommentStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintSecLabelStmt(FingerprintContext *ctx, const SecLabelStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDeclareCursorStmt(FingerprintContext *ctx, const DeclareCursorStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintClosePortalStmt(FingerprintContext *ctx, const ClosePortalStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFetchStmt(FingerprintContext *ctx, const FetchStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintStatsElem(FingerprintContext *ctx, const StatsElem *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterStatsStmt(FingerprintContext *ctx, const AlterStatsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterFunctionStmt(FingerprintContext *ctx, const AlterFunctionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDoStmt(FingerprintContext *ctx, const DoStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintInlineCodeBlock(FingerprintContext *ctx, const InlineCodeBlock *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCallContext(FingerprintContext *ctx, const CallContext *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDependsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterOperatorStmt(FingerprintContext *ctx, const AlterOperatorStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTypeStmt(FingerprintContext *ctx, const AlterTypeStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintNotifyStmt(FingerprintContext *ctx, const NotifyStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintListenStmt(FingerprintContext *ctx, const ListenStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintUnlistenStmt(FingerprintContext *ctx, const UnlistenStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintTransactionStmt(FingerprintContext *ctx, const TransactionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCompositeTypeStmt(FingerprintContext *ctx, const CompositeTypeStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateEnumStmt(FingerprintContext *ctx, const CreateEnumStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateRangeStmt(FingerprintContext *ctx, const CreateRangeStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterEnumStmt(FingerprintContext *ctx, const AlterEnumStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintLoadStmt(FingerprintContext *ctx, const LoadStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreatedbStmt(FingerprintContext *ctx, const CreatedbStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterDatabaseStmt(FingerprintContext *ctx, const AlterDatabaseStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterDatabaseRefreshCollStmt(FingerprintContext *ctx, const AlterDatabaseRefreshCollStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterDatabaseSetStmt(FingerprintContext *ctx, const AlterDatabaseSetStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropdbStmt(FingerprintContext *ctx, const DropdbStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterSystemStmt(FingerprintContext *ctx, const AlterSystemStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintExplainStmt(FingerprintContext *ctx, const ExplainStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintRefreshMatViewStmt(FingerprintContext *ctx, const RefreshMatViewStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCheckPointStmt(FingerprintContext *ctx, const CheckPointStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDiscardStmt(FingerprintContext *ctx, const DiscardStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintLockStmt(FingerprintContext *ctx, const LockStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintConstraintsSetStmt(FingerprintContext *ctx, const ConstraintsSetStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateConversionStmt(FingerprintContext *ctx, const CreateConversionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPrepareStmt(FingerprintContext *ctx, const PrepareStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintExecuteStmt(FingerprintContext *ctx, const ExecuteStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDeallocateStmt(FingerprintContext *ctx, const DeallocateStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropOwnedStmt(FingerprintContext *ctx, const DropOwnedStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintReassignOwnedStmt(FingerprintContext *ctx, const ReassignOwnedStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTSDictionaryStmt(FingerprintContext *ctx, const AlterTSDictionaryStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfigurationStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintPublicationObjSpec(FingerprintContext *ctx, const PublicationObjSpec *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicationStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublicationStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-static void _fingerprintDropSubscriptionStmt(FingerprintContext *ctx, const DropSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth);
-
-
-static void
-_fingerprintAlias(FingerprintContext *ctx, const Alias *node, const void *parent, const char *field_name, unsigned int depth)
+static void _fingerprintAlias(FingerprintContext *ctx, const Alias *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeVar(FingerprintContext *ctx, const RangeVar *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintVar(FingerprintContext *ctx, const Var *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintConst(FingerprintContext *ctx, const Const *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintParam(FingerprintContext *ctx, const Param *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWindowFuncRunCondition(FingerprintContext *ctx, const WindowFuncRunCondition *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMergeSupportFunc(FingerprintContext *ctx, const MergeSupportFunc *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFuncExpr(FingerprintContext *ctx, const FuncExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintNamedArgExpr(FingerprintContext *ctx, const NamedArgExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintOpExpr(FingerprintContext *ctx, const OpExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintScalarArrayOpExpr(FingerprintContext *ctx, const ScalarArrayOpExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintBoolExpr(FingerprintContext *ctx, const BoolExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlternativeSubPlan(FingerprintContext *ctx, const AlternativeSubPlan *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFieldSelect(FingerprintContext *ctx, const FieldSelect *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRelabelType(FingerprintContext *ctx, const RelabelType *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCoerceViaIO(FingerprintContext *ctx, const CoerceViaIO *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintArrayCoerceExpr(FingerprintContext *ctx, const ArrayCoerceExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintConvertRowtypeExpr(FingerprintContext *ctx, const ConvertRowtypeExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCollateExpr(FingerprintContext *ctx, const CollateExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCaseWhen(FingerprintContext *ctx, const CaseWhen *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCaseTestExpr(FingerprintContext *ctx, const CaseTestExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintArrayExpr(FingerprintContext *ctx, const ArrayExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRowExpr(FingerprintContext *ctx, const RowExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCoalesceExpr(FingerprintContext *ctx, const CoalesceExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMinMaxExpr(FingerprintContext *ctx, const MinMaxExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSQLValueFunction(FingerprintContext *ctx, const SQLValueFunction *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonFormat(FingerprintContext *ctx, const JsonFormat *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonReturning(FingerprintContext *ctx, const JsonReturning *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonIsPredicate(FingerprintContext *ctx, const JsonIsPredicate *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTablePath(FingerprintContext *ctx, const JsonTablePath *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSiblingJoin *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintNullTest(FingerprintContext *ctx, const NullTest *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintBooleanTest(FingerprintContext *ctx, const BooleanTest *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCoerceToDomain(FingerprintContext *ctx, const CoerceToDomain *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCoerceToDomainValue(FingerprintContext *ctx, const CoerceToDomainValue *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSetToDefault(FingerprintContext *ctx, const SetToDefault *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCurrentOfExpr(FingerprintContext *ctx, const CurrentOfExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintNextValueExpr(FingerprintContext *ctx, const NextValueExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintInferenceElem(FingerprintContext *ctx, const InferenceElem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTargetEntry(FingerprintContext *ctx, const TargetEntry *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTblRef(FingerprintContext *ctx, const RangeTblRef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFromExpr(FingerprintContext *ctx, const FromExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintColumnRef(FingerprintContext *ctx, const ColumnRef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintParamRef(FingerprintContext *ctx, const ParamRef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTypeCast(FingerprintContext *ctx, const TypeCast *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRoleSpec(FingerprintContext *ctx, const RoleSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintA_Star(FingerprintContext *ctx, const A_Star *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintA_Indirection(FingerprintContext *ctx, const A_Indirection *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintA_ArrayExpr(FingerprintContext *ctx, const A_ArrayExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintResTarget(FingerprintContext *ctx, const ResTarget *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMultiAssignRef(FingerprintContext *ctx, const MultiAssignRef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeSubselect(FingerprintContext *ctx, const RangeSubselect *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTableLikeClause(FingerprintContext *ctx, const TableLikeClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDefElem(FingerprintContext *ctx, const DefElem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintLockingClause(FingerprintContext *ctx, const LockingClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintXmlSerialize(FingerprintContext *ctx, const XmlSerialize *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPartitionSpec(FingerprintContext *ctx, const PartitionSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPartitionRangeDatum(FingerprintContext *ctx, const PartitionRangeDatum *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSinglePartitionSpec(FingerprintContext *ctx, const SinglePartitionSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPartitionCmd(FingerprintContext *ctx, const PartitionCmd *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTableSampleClause(FingerprintContext *ctx, const TableSampleClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWithCheckOption(FingerprintContext *ctx, const WithCheckOption *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSortGroupClause(FingerprintContext *ctx, const SortGroupClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintGroupingSet(FingerprintContext *ctx, const GroupingSet *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRowMarkClause(FingerprintContext *ctx, const RowMarkClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintWithClause(FingerprintContext *ctx, const WithClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCTESearchClause(FingerprintContext *ctx, const CTESearchClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTriggerTransition(FingerprintContext *ctx, const TriggerTransition *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonOutput(FingerprintContext *ctx, const JsonOutput *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonArgument(FingerprintContext *ctx, const JsonArgument *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTablePathSpec(FingerprintContext *ctx, const JsonTablePathSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonKeyValue(FingerprintContext *ctx, const JsonKeyValue *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonParseExpr(FingerprintContext *ctx, const JsonParseExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonScalarExpr(FingerprintContext *ctx, const JsonScalarExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonSerializeExpr(FingerprintContext *ctx, const JsonSerializeExpr *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConstructor *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstructor *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQueryConstructor *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRawStmt(FingerprintContext *ctx, const RawStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintReturnStmt(FingerprintContext *ctx, const ReturnStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPLAssignStmt(FingerprintContext *ctx, const PLAssignStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateSchemaStmt(FingerprintContext *ctx, const CreateSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTableStmt(FingerprintContext *ctx, const AlterTableStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintReplicaIdentityStmt(FingerprintContext *ctx, const ReplicaIdentityStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterCollationStmt(FingerprintContext *ctx, const AlterCollationStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAccessPriv(FingerprintContext *ctx, const AccessPriv *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterDefaultPrivilegesStmt(FingerprintContext *ctx, const AlterDefaultPrivilegesStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintVariableSetStmt(FingerprintContext *ctx, const VariableSetStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintVariableShowStmt(FingerprintContext *ctx, const VariableShowStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpaceStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropTableSpaceStmt(FingerprintContext *ctx, const DropTableSpaceStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTableSpaceOptionsStmt(FingerprintContext *ctx, const AlterTableSpaceOptionsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTableMoveAllStmt(FingerprintContext *ctx, const AlterTableMoveAllStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateExtensionStmt(FingerprintContext *ctx, const CreateExtensionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterExtensionStmt(FingerprintContext *ctx, const AlterExtensionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterExtensionContentsStmt(FingerprintContext *ctx, const AlterExtensionContentsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateForeignServerStmt(FingerprintContext *ctx, const CreateForeignServerStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterForeignServerStmt(FingerprintContext *ctx, const AlterForeignServerStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateForeignTableStmt(FingerprintContext *ctx, const CreateForeignTableStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterUserMappingStmt(FingerprintContext *ctx, const AlterUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropUserMappingStmt(FingerprintContext *ctx, const DropUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeignSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateAmStmt(FingerprintContext *ctx, const CreateAmStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterEventTrigStmt(FingerprintContext *ctx, const AlterEventTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateRoleStmt(FingerprintContext *ctx, const CreateRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropRoleStmt(FingerprintContext *ctx, const DropRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateOpFamilyStmt(FingerprintContext *ctx, const CreateOpFamilyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropStmt(FingerprintContext *ctx, const DropStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTruncateStmt(FingerprintContext *ctx, const TruncateStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCommentStmt(FingerprintContext *ctx, const CommentStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintSecLabelStmt(FingerprintContext *ctx, const SecLabelStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDeclareCursorStmt(FingerprintContext *ctx, const DeclareCursorStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintClosePortalStmt(FingerprintContext *ctx, const ClosePortalStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFetchStmt(FingerprintContext *ctx, const FetchStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintStatsElem(FingerprintContext *ctx, const StatsElem *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterStatsStmt(FingerprintContext *ctx, const AlterStatsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterFunctionStmt(FingerprintContext *ctx, const AlterFunctionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDoStmt(FingerprintContext *ctx, const DoStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintInlineCodeBlock(FingerprintContext *ctx, const InlineCodeBlock *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCallContext(FingerprintContext *ctx, const CallContext *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDependsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterOperatorStmt(FingerprintContext *ctx, const AlterOperatorStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTypeStmt(FingerprintContext *ctx, const AlterTypeStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintNotifyStmt(FingerprintContext *ctx, const NotifyStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintListenStmt(FingerprintContext *ctx, const ListenStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintUnlistenStmt(FingerprintContext *ctx, const UnlistenStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintTransactionStmt(FingerprintContext *ctx, const TransactionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCompositeTypeStmt(FingerprintContext *ctx, const CompositeTypeStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateEnumStmt(FingerprintContext *ctx, const CreateEnumStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateRangeStmt(FingerprintContext *ctx, const CreateRangeStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterEnumStmt(FingerprintContext *ctx, const AlterEnumStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintLoadStmt(FingerprintContext *ctx, const LoadStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreatedbStmt(FingerprintContext *ctx, const CreatedbStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterDatabaseStmt(FingerprintContext *ctx, const AlterDatabaseStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterDatabaseRefreshCollStmt(FingerprintContext *ctx, const AlterDatabaseRefreshCollStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterDatabaseSetStmt(FingerprintContext *ctx, const AlterDatabaseSetStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropdbStmt(FingerprintContext *ctx, const DropdbStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterSystemStmt(FingerprintContext *ctx, const AlterSystemStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintExplainStmt(FingerprintContext *ctx, const ExplainStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintRefreshMatViewStmt(FingerprintContext *ctx, const RefreshMatViewStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCheckPointStmt(FingerprintContext *ctx, const CheckPointStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDiscardStmt(FingerprintContext *ctx, const DiscardStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintLockStmt(FingerprintContext *ctx, const LockStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintConstraintsSetStmt(FingerprintContext *ctx, const ConstraintsSetStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateConversionStmt(FingerprintContext *ctx, const CreateConversionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPrepareStmt(FingerprintContext *ctx, const PrepareStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintExecuteStmt(FingerprintContext *ctx, const ExecuteStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDeallocateStmt(FingerprintContext *ctx, const DeallocateStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropOwnedStmt(FingerprintContext *ctx, const DropOwnedStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintReassignOwnedStmt(FingerprintContext *ctx, const ReassignOwnedStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTSDictionaryStmt(FingerprintContext *ctx, const AlterTSDictionaryStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfigurationStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintPublicationObjSpec(FingerprintContext *ctx, const PublicationObjSpec *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicationStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublicationStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+static void _fingerprintDropSubscriptionStmt(FingerprintContext *ctx, const DropSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth);
+
+
+static void
+_fingerprintAlias(FingerprintContext *ctx, const Alias *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring all fields for fingerprinting
 }
 
 static void
-_fingerprintRangeVar(FingerprintContext *ctx, const RangeVar *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeVar(FingerprintContext *ctx, const RangeVar *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->catalogname != NULL) {
-    _fingerprintString(ctx, "catalogname");
+    _fingerprintLiteral(ctx, "catalogname");
     _fingerprintString(ctx, node->catalogname);
   }
 
   if (node->inh) {
-    _fingerprintString(ctx, "inh");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inh", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -311,41 +307,37 @@ _fingerprintRangeVar(FingerprintContext *ctx, const RangeVar *node, const void *
       }
     }
     *p = 0;
-    _fingerprintString(ctx, "relname");
-    _fingerprintString(ctx, r);
+    _fingerprintLiteral(ctx, "relname");
+    _fingerprintStringLen(ctx, r, p - r);
     pfree(r);
   }
 
   if (node->relpersistence != 0) {
-    char buffer[2] = {node->relpersistence, '\0'};
-    _fingerprintString(ctx, "relpersistence");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "relpersistence");
+    _fingerprintStringLen(ctx, &node->relpersistence, 1);
   }
 
   if (node->schemaname != NULL) {
-    _fingerprintString(ctx, "schemaname");
+    _fingerprintLiteral(ctx, "schemaname");
     _fingerprintString(ctx, node->schemaname);
   }
 
 }
 
 static void
-_fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->colcollations != NULL && node->colcollations->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colcollations");
+    _fingerprintLiteral(ctx, "colcollations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colcollations, node, "colcollations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colcollations) == 1 && linitial(node->colcollations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colcollations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colcollations) == 1 && linitial(node->colcollations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colcollations") - 1);
     XXH3_freeState(prev);
   }
   if (node->coldefexprs != NULL && node->coldefexprs->length > 0) {
@@ -353,15 +345,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coldefexprs");
+    _fingerprintLiteral(ctx, "coldefexprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coldefexprs, node, "coldefexprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldefexprs) == 1 && linitial(node->coldefexprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coldefexprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldefexprs) == 1 && linitial(node->coldefexprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coldefexprs") - 1);
     XXH3_freeState(prev);
   }
   if (node->colexprs != NULL && node->colexprs->length > 0) {
@@ -369,15 +358,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colexprs");
+    _fingerprintLiteral(ctx, "colexprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colexprs, node, "colexprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colexprs) == 1 && linitial(node->colexprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colexprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colexprs) == 1 && linitial(node->colexprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colexprs") - 1);
     XXH3_freeState(prev);
   }
   if (node->colnames != NULL && node->colnames->length > 0) {
@@ -385,15 +371,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colnames");
+    _fingerprintLiteral(ctx, "colnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colnames, node, "colnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colnames) == 1 && linitial(node->colnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colnames) == 1 && linitial(node->colnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->coltypes != NULL && node->coltypes->length > 0) {
@@ -401,15 +384,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coltypes");
+    _fingerprintLiteral(ctx, "coltypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coltypes, node, "coltypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypes) == 1 && linitial(node->coltypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coltypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypes) == 1 && linitial(node->coltypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coltypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->coltypmods != NULL && node->coltypmods->length > 0) {
@@ -417,15 +397,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coltypmods");
+    _fingerprintLiteral(ctx, "coltypmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coltypmods, node, "coltypmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypmods) == 1 && linitial(node->coltypmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coltypmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypmods) == 1 && linitial(node->coltypmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coltypmods") - 1);
     XXH3_freeState(prev);
   }
   if (node->colvalexprs != NULL && node->colvalexprs->length > 0) {
@@ -433,15 +410,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colvalexprs");
+    _fingerprintLiteral(ctx, "colvalexprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colvalexprs, node, "colvalexprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colvalexprs) == 1 && linitial(node->colvalexprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colvalexprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colvalexprs) == 1 && linitial(node->colvalexprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colvalexprs") - 1);
     XXH3_freeState(prev);
   }
   if (node->docexpr != NULL) {
@@ -449,20 +423,17 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "docexpr");
+    _fingerprintLiteral(ctx, "docexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->docexpr, node, "docexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->docexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("docexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "functype");
+    _fingerprintLiteral(ctx, "functype");
     _fingerprintString(ctx, _enumToStringTableFuncType(node->functype));
   }
 
@@ -472,12 +443,10 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     int x = -1;
     Bitmapset	*bms = bms_copy(node->notnulls);
 
-    _fingerprintString(ctx, "notnulls");
+    _fingerprintLiteral(ctx, "notnulls");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
@@ -488,15 +457,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ns_names");
+    _fingerprintLiteral(ctx, "ns_names");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ns_names, node, "ns_names", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ns_names) == 1 && linitial(node->ns_names) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ns_names, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ns_names) == 1 && linitial(node->ns_names) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ns_names") - 1);
     XXH3_freeState(prev);
   }
   if (node->ns_uris != NULL && node->ns_uris->length > 0) {
@@ -504,22 +470,17 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ns_uris");
+    _fingerprintLiteral(ctx, "ns_uris");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ns_uris, node, "ns_uris", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ns_uris) == 1 && linitial(node->ns_uris) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ns_uris, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ns_uris) == 1 && linitial(node->ns_uris) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ns_uris") - 1);
     XXH3_freeState(prev);
   }
   if (node->ordinalitycol != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->ordinalitycol);
-    _fingerprintString(ctx, "ordinalitycol");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "ordinalitycol");
+    _fingerprintInt64(ctx, node->ordinalitycol);
   }
 
   if (node->passingvalexprs != NULL && node->passingvalexprs->length > 0) {
@@ -527,15 +488,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "passingvalexprs");
+    _fingerprintLiteral(ctx, "passingvalexprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->passingvalexprs, node, "passingvalexprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passingvalexprs) == 1 && linitial(node->passingvalexprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->passingvalexprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passingvalexprs) == 1 && linitial(node->passingvalexprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("passingvalexprs") - 1);
     XXH3_freeState(prev);
   }
   if (node->plan != NULL) {
@@ -543,15 +501,12 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plan");
+    _fingerprintLiteral(ctx, "plan");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->plan, node, "plan", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->plan, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plan") - 1);
     XXH3_freeState(prev);
   }
 
@@ -560,25 +515,22 @@ _fingerprintTableFunc(FingerprintContext *ctx, const TableFunc *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rowexpr");
+    _fingerprintLiteral(ctx, "rowexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rowexpr, node, "rowexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rowexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rowexpr") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->accessMethod != NULL) {
-    _fingerprintString(ctx, "accessMethod");
+    _fingerprintLiteral(ctx, "accessMethod");
     _fingerprintString(ctx, node->accessMethod);
   }
 
@@ -587,19 +539,16 @@ _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colNames");
+    _fingerprintLiteral(ctx, "colNames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colNames, node, "colNames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colNames) == 1 && linitial(node->colNames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colNames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colNames) == 1 && linitial(node->colNames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colNames") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "onCommit");
+    _fingerprintLiteral(ctx, "onCommit");
     _fingerprintString(ctx, _enumToStringOnCommitAction(node->onCommit));
   }
 
@@ -608,15 +557,12 @@ _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->rel != NULL) {
@@ -624,25 +570,21 @@ _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rel");
+    _fingerprintLiteral(ctx, "rel");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->rel, node, "rel", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->rel, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rel") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->skipData) {
-    _fingerprintString(ctx, "skipData");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "skipData", "true");
   }
 
   if (node->tableSpaceName != NULL) {
-    _fingerprintString(ctx, "tableSpaceName");
+    _fingerprintLiteral(ctx, "tableSpaceName");
     _fingerprintString(ctx, node->tableSpaceName);
   }
 
@@ -651,123 +593,96 @@ _fingerprintIntoClause(FingerprintContext *ctx, const IntoClause *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "viewQuery");
+    _fingerprintLiteral(ctx, "viewQuery");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->viewQuery, node, "viewQuery", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->viewQuery, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("viewQuery") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintVar(FingerprintContext *ctx, const Var *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintVar(FingerprintContext *ctx, const Var *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->varattno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->varattno);
-    _fingerprintString(ctx, "varattno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "varattno");
+    _fingerprintInt64(ctx, node->varattno);
   }
 
   if (node->varcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->varcollid);
-    _fingerprintString(ctx, "varcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "varcollid");
+    _fingerprintInt64(ctx, node->varcollid);
   }
 
   if (node->varlevelsup != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->varlevelsup);
-    _fingerprintString(ctx, "varlevelsup");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "varlevelsup");
+    _fingerprintInt64(ctx, node->varlevelsup);
   }
 
   if (node->varno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->varno);
-    _fingerprintString(ctx, "varno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "varno");
+    _fingerprintInt64(ctx, node->varno);
   }
 
   if (true) {
     int x = -1;
     Bitmapset	*bms = bms_copy(node->varnullingrels);
 
-    _fingerprintString(ctx, "varnullingrels");
+    _fingerprintLiteral(ctx, "varnullingrels");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
   }
 
   if (node->vartype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->vartype);
-    _fingerprintString(ctx, "vartype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "vartype");
+    _fingerprintInt64(ctx, node->vartype);
   }
 
   if (node->vartypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->vartypmod);
-    _fingerprintString(ctx, "vartypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "vartypmod");
+    _fingerprintInt64(ctx, node->vartypmod);
   }
 
 }
 
 static void
-_fingerprintConst(FingerprintContext *ctx, const Const *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintConst(FingerprintContext *ctx, const Const *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->constbyval) {
-    _fingerprintString(ctx, "constbyval");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "constbyval", "true");
   }
 
   if (node->constcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->constcollid);
-    _fingerprintString(ctx, "constcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "constcollid");
+    _fingerprintInt64(ctx, node->constcollid);
   }
 
   if (node->constisnull) {
-    _fingerprintString(ctx, "constisnull");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "constisnull", "true");
   }
 
   if (node->constlen != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->constlen);
-    _fingerprintString(ctx, "constlen");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "constlen");
+    _fingerprintInt64(ctx, node->constlen);
   }
 
   if (node->consttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->consttype);
-    _fingerprintString(ctx, "consttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "consttype");
+    _fingerprintInt64(ctx, node->consttype);
   }
 
   if (node->consttypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->consttypmod);
-    _fingerprintString(ctx, "consttypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "consttypmod");
+    _fingerprintInt64(ctx, node->consttypmod);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -775,69 +690,56 @@ _fingerprintConst(FingerprintContext *ctx, const Const *node, const void *parent
 }
 
 static void
-_fingerprintParam(FingerprintContext *ctx, const Param *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintParam(FingerprintContext *ctx, const Param *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->paramcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->paramcollid);
-    _fingerprintString(ctx, "paramcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "paramcollid");
+    _fingerprintInt64(ctx, node->paramcollid);
   }
 
   if (node->paramid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->paramid);
-    _fingerprintString(ctx, "paramid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "paramid");
+    _fingerprintInt64(ctx, node->paramid);
   }
 
   if (true) {
-    _fingerprintString(ctx, "paramkind");
+    _fingerprintLiteral(ctx, "paramkind");
     _fingerprintString(ctx, _enumToStringParamKind(node->paramkind));
   }
 
   if (node->paramtype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->paramtype);
-    _fingerprintString(ctx, "paramtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "paramtype");
+    _fingerprintInt64(ctx, node->paramtype);
   }
 
   if (node->paramtypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->paramtypmod);
-    _fingerprintString(ctx, "paramtypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "paramtypmod");
+    _fingerprintInt64(ctx, node->paramtypmod);
   }
 
 }
 
 static void
-_fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->aggargtypes != NULL && node->aggargtypes->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggargtypes");
+    _fingerprintLiteral(ctx, "aggargtypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggargtypes, node, "aggargtypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggargtypes) == 1 && linitial(node->aggargtypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggargtypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggargtypes) == 1 && linitial(node->aggargtypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggargtypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->aggcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->aggcollid);
-    _fingerprintString(ctx, "aggcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggcollid");
+    _fingerprintInt64(ctx, node->aggcollid);
   }
 
   if (node->aggdirectargs != NULL && node->aggdirectargs->length > 0) {
@@ -845,15 +747,12 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggdirectargs");
+    _fingerprintLiteral(ctx, "aggdirectargs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggdirectargs, node, "aggdirectargs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggdirectargs) == 1 && linitial(node->aggdirectargs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggdirectargs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggdirectargs) == 1 && linitial(node->aggdirectargs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggdirectargs") - 1);
     XXH3_freeState(prev);
   }
   if (node->aggdistinct != NULL && node->aggdistinct->length > 0) {
@@ -861,15 +760,12 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggdistinct");
+    _fingerprintLiteral(ctx, "aggdistinct");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggdistinct, node, "aggdistinct", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggdistinct) == 1 && linitial(node->aggdistinct) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggdistinct, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggdistinct) == 1 && linitial(node->aggdistinct) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggdistinct") - 1);
     XXH3_freeState(prev);
   }
   if (node->aggfilter != NULL) {
@@ -877,43 +773,33 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggfilter");
+    _fingerprintLiteral(ctx, "aggfilter");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggfilter, node, "aggfilter", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggfilter, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggfilter") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->aggfnoid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->aggfnoid);
-    _fingerprintString(ctx, "aggfnoid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggfnoid");
+    _fingerprintInt64(ctx, node->aggfnoid);
   }
 
   if (node->aggkind != 0) {
-    char buffer[2] = {node->aggkind, '\0'};
-    _fingerprintString(ctx, "aggkind");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggkind");
+    _fingerprintStringLen(ctx, &node->aggkind, 1);
   }
 
   if (node->agglevelsup != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->agglevelsup);
-    _fingerprintString(ctx, "agglevelsup");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "agglevelsup");
+    _fingerprintInt64(ctx, node->agglevelsup);
   }
 
   if (node->aggno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->aggno);
-    _fingerprintString(ctx, "aggno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggno");
+    _fingerprintInt64(ctx, node->aggno);
   }
 
   if (node->aggorder != NULL && node->aggorder->length > 0) {
@@ -921,44 +807,35 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggorder");
+    _fingerprintLiteral(ctx, "aggorder");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggorder, node, "aggorder", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggorder) == 1 && linitial(node->aggorder) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggorder, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aggorder) == 1 && linitial(node->aggorder) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggorder") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "aggsplit");
+    _fingerprintLiteral(ctx, "aggsplit");
     _fingerprintString(ctx, _enumToStringAggSplit(node->aggsplit));
   }
 
   if (node->aggstar) {
-    _fingerprintString(ctx, "aggstar");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "aggstar", "true");
   }
 
   if (node->aggtransno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->aggtransno);
-    _fingerprintString(ctx, "aggtransno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggtransno");
+    _fingerprintInt64(ctx, node->aggtransno);
   }
 
   if (node->aggtype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->aggtype);
-    _fingerprintString(ctx, "aggtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "aggtype");
+    _fingerprintInt64(ctx, node->aggtype);
   }
 
   if (node->aggvariadic) {
-    _fingerprintString(ctx, "aggvariadic");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "aggvariadic", "true");
   }
 
   if (node->args != NULL && node->args->length > 0) {
@@ -966,22 +843,17 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -989,13 +861,11 @@ _fingerprintAggref(FingerprintContext *ctx, const Aggref *node, const void *pare
 }
 
 static void
-_fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->agglevelsup != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->agglevelsup);
-    _fingerprintString(ctx, "agglevelsup");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "agglevelsup");
+    _fingerprintInt64(ctx, node->agglevelsup);
   }
 
   if (node->args != NULL && node->args->length > 0) {
@@ -1003,15 +873,12 @@ _fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -1021,36 +888,30 @@ _fingerprintGroupingFunc(FingerprintContext *ctx, const GroupingFunc *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "refs");
+    _fingerprintLiteral(ctx, "refs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->refs, node, "refs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->refs) == 1 && linitial(node->refs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->refs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->refs) == 1 && linitial(node->refs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("refs") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->aggfilter != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aggfilter");
+    _fingerprintLiteral(ctx, "aggfilter");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aggfilter, node, "aggfilter", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aggfilter, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aggfilter") - 1);
     XXH3_freeState(prev);
   }
 
@@ -1059,22 +920,17 @@ _fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -1084,158 +940,124 @@ _fingerprintWindowFunc(FingerprintContext *ctx, const WindowFunc *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "runCondition");
+    _fingerprintLiteral(ctx, "runCondition");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->runCondition, node, "runCondition", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->runCondition) == 1 && linitial(node->runCondition) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->runCondition, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->runCondition) == 1 && linitial(node->runCondition) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("runCondition") - 1);
     XXH3_freeState(prev);
   }
   if (node->winagg) {
-    _fingerprintString(ctx, "winagg");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "winagg", "true");
   }
 
   if (node->wincollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->wincollid);
-    _fingerprintString(ctx, "wincollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "wincollid");
+    _fingerprintInt64(ctx, node->wincollid);
   }
 
   if (node->winfnoid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->winfnoid);
-    _fingerprintString(ctx, "winfnoid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "winfnoid");
+    _fingerprintInt64(ctx, node->winfnoid);
   }
 
   if (node->winref != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->winref);
-    _fingerprintString(ctx, "winref");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "winref");
+    _fingerprintInt64(ctx, node->winref);
   }
 
   if (node->winstar) {
-    _fingerprintString(ctx, "winstar");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "winstar", "true");
   }
 
   if (node->wintype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->wintype);
-    _fingerprintString(ctx, "wintype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "wintype");
+    _fingerprintInt64(ctx, node->wintype);
   }
 
 }
 
 static void
-_fingerprintWindowFuncRunCondition(FingerprintContext *ctx, const WindowFuncRunCondition *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWindowFuncRunCondition(FingerprintContext *ctx, const WindowFuncRunCondition *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   if (node->opno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->opno);
-    _fingerprintString(ctx, "opno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "opno");
+    _fingerprintInt64(ctx, node->opno);
   }
 
   if (node->wfunc_left) {
-    _fingerprintString(ctx, "wfunc_left");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "wfunc_left", "true");
   }
 
 }
 
 static void
-_fingerprintMergeSupportFunc(FingerprintContext *ctx, const MergeSupportFunc *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMergeSupportFunc(FingerprintContext *ctx, const MergeSupportFunc *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->msfcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->msfcollid);
-    _fingerprintString(ctx, "msfcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "msfcollid");
+    _fingerprintInt64(ctx, node->msfcollid);
   }
 
   if (node->msftype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->msftype);
-    _fingerprintString(ctx, "msftype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "msftype");
+    _fingerprintInt64(ctx, node->msftype);
   }
 
 }
 
 static void
-_fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->refassgnexpr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "refassgnexpr");
+    _fingerprintLiteral(ctx, "refassgnexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->refassgnexpr, node, "refassgnexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->refassgnexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("refassgnexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->refcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->refcollid);
-    _fingerprintString(ctx, "refcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "refcollid");
+    _fingerprintInt64(ctx, node->refcollid);
   }
 
   if (node->refcontainertype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->refcontainertype);
-    _fingerprintString(ctx, "refcontainertype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "refcontainertype");
+    _fingerprintInt64(ctx, node->refcontainertype);
   }
 
   if (node->refelemtype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->refelemtype);
-    _fingerprintString(ctx, "refelemtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "refelemtype");
+    _fingerprintInt64(ctx, node->refelemtype);
   }
 
   if (node->refexpr != NULL) {
@@ -1243,15 +1065,12 @@ _fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "refexpr");
+    _fingerprintLiteral(ctx, "refexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->refexpr, node, "refexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->refexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("refexpr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -1260,29 +1079,22 @@ _fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "reflowerindexpr");
+    _fingerprintLiteral(ctx, "reflowerindexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->reflowerindexpr, node, "reflowerindexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->reflowerindexpr) == 1 && linitial(node->reflowerindexpr) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->reflowerindexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->reflowerindexpr) == 1 && linitial(node->reflowerindexpr) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("reflowerindexpr") - 1);
     XXH3_freeState(prev);
   }
   if (node->refrestype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->refrestype);
-    _fingerprintString(ctx, "refrestype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "refrestype");
+    _fingerprintInt64(ctx, node->refrestype);
   }
 
   if (node->reftypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->reftypmod);
-    _fingerprintString(ctx, "reftypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "reftypmod");
+    _fingerprintInt64(ctx, node->reftypmod);
   }
 
   if (node->refupperindexpr != NULL && node->refupperindexpr->length > 0) {
@@ -1290,79 +1102,63 @@ _fingerprintSubscriptingRef(FingerprintContext *ctx, const SubscriptingRef *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "refupperindexpr");
+    _fingerprintLiteral(ctx, "refupperindexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->refupperindexpr, node, "refupperindexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->refupperindexpr) == 1 && linitial(node->refupperindexpr) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->refupperindexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->refupperindexpr) == 1 && linitial(node->refupperindexpr) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("refupperindexpr") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintFuncExpr(FingerprintContext *ctx, const FuncExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFuncExpr(FingerprintContext *ctx, const FuncExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->funccollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->funccollid);
-    _fingerprintString(ctx, "funccollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "funccollid");
+    _fingerprintInt64(ctx, node->funccollid);
   }
 
   if (true) {
-    _fingerprintString(ctx, "funcformat");
+    _fingerprintLiteral(ctx, "funcformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->funcformat));
   }
 
   if (node->funcid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->funcid);
-    _fingerprintString(ctx, "funcid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "funcid");
+    _fingerprintInt64(ctx, node->funcid);
   }
 
   if (node->funcresulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->funcresulttype);
-    _fingerprintString(ctx, "funcresulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "funcresulttype");
+    _fingerprintInt64(ctx, node->funcresulttype);
   }
 
   if (node->funcretset) {
-    _fingerprintString(ctx, "funcretset");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "funcretset", "true");
   }
 
   if (node->funcvariadic) {
-    _fingerprintString(ctx, "funcvariadic");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "funcvariadic", "true");
   }
 
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -1370,160 +1166,132 @@ _fingerprintFuncExpr(FingerprintContext *ctx, const FuncExpr *node, const void *
 }
 
 static void
-_fingerprintNamedArgExpr(FingerprintContext *ctx, const NamedArgExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintNamedArgExpr(FingerprintContext *ctx, const NamedArgExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->argnumber != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->argnumber);
-    _fingerprintString(ctx, "argnumber");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "argnumber");
+    _fingerprintInt64(ctx, node->argnumber);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintOpExpr(FingerprintContext *ctx, const OpExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintOpExpr(FingerprintContext *ctx, const OpExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->opcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->opcollid);
-    _fingerprintString(ctx, "opcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "opcollid");
+    _fingerprintInt64(ctx, node->opcollid);
   }
 
   if (node->opno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->opno);
-    _fingerprintString(ctx, "opno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "opno");
+    _fingerprintInt64(ctx, node->opno);
   }
 
   if (node->opresulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->opresulttype);
-    _fingerprintString(ctx, "opresulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "opresulttype");
+    _fingerprintInt64(ctx, node->opresulttype);
   }
 
   if (node->opretset) {
-    _fingerprintString(ctx, "opretset");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "opretset", "true");
   }
 
 }
 
 static void
-_fingerprintScalarArrayOpExpr(FingerprintContext *ctx, const ScalarArrayOpExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintScalarArrayOpExpr(FingerprintContext *ctx, const ScalarArrayOpExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->opno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->opno);
-    _fingerprintString(ctx, "opno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "opno");
+    _fingerprintInt64(ctx, node->opno);
   }
 
   if (node->useOr) {
-    _fingerprintString(ctx, "useOr");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "useOr", "true");
   }
 
 }
 
 static void
-_fingerprintBoolExpr(FingerprintContext *ctx, const BoolExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintBoolExpr(FingerprintContext *ctx, const BoolExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "boolop");
+    _fingerprintLiteral(ctx, "boolop");
     _fingerprintString(ctx, _enumToStringBoolExprType(node->boolop));
   }
 
@@ -1532,7 +1300,7 @@ _fingerprintBoolExpr(FingerprintContext *ctx, const BoolExpr *node, const void *
 }
 
 static void
-_fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
@@ -1541,26 +1309,21 @@ _fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "operName");
+    _fingerprintLiteral(ctx, "operName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->operName, node, "operName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->operName) == 1 && linitial(node->operName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->operName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->operName) == 1 && linitial(node->operName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("operName") - 1);
     XXH3_freeState(prev);
   }
   if (node->subLinkId != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->subLinkId);
-    _fingerprintString(ctx, "subLinkId");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "subLinkId");
+    _fingerprintInt64(ctx, node->subLinkId);
   }
 
   if (true) {
-    _fingerprintString(ctx, "subLinkType");
+    _fingerprintLiteral(ctx, "subLinkType");
     _fingerprintString(ctx, _enumToStringSubLinkType(node->subLinkType));
   }
 
@@ -1569,15 +1332,12 @@ _fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "subselect");
+    _fingerprintLiteral(ctx, "subselect");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->subselect, node, "subselect", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->subselect, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("subselect") - 1);
     XXH3_freeState(prev);
   }
 
@@ -1586,58 +1346,46 @@ _fingerprintSubLink(FingerprintContext *ctx, const SubLink *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "testexpr");
+    _fingerprintLiteral(ctx, "testexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->testexpr, node, "testexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->testexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("testexpr") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->firstColCollation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->firstColCollation);
-    _fingerprintString(ctx, "firstColCollation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "firstColCollation");
+    _fingerprintInt64(ctx, node->firstColCollation);
   }
 
   if (node->firstColType != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->firstColType);
-    _fingerprintString(ctx, "firstColType");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "firstColType");
+    _fingerprintInt64(ctx, node->firstColType);
   }
 
   if (node->firstColTypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->firstColTypmod);
-    _fingerprintString(ctx, "firstColTypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "firstColTypmod");
+    _fingerprintInt64(ctx, node->firstColTypmod);
   }
 
   if (node->parParam != NULL && node->parParam->length > 0) {
@@ -1645,20 +1393,16 @@ _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "parParam");
+    _fingerprintLiteral(ctx, "parParam");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->parParam, node, "parParam", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->parParam) == 1 && linitial(node->parParam) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->parParam, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->parParam) == 1 && linitial(node->parParam) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("parParam") - 1);
     XXH3_freeState(prev);
   }
   if (node->parallel_safe) {
-    _fingerprintString(ctx, "parallel_safe");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "parallel_safe", "true");
   }
 
   if (node->paramIds != NULL && node->paramIds->length > 0) {
@@ -1666,33 +1410,28 @@ _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "paramIds");
+    _fingerprintLiteral(ctx, "paramIds");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->paramIds, node, "paramIds", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->paramIds) == 1 && linitial(node->paramIds) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->paramIds, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->paramIds) == 1 && linitial(node->paramIds) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("paramIds") - 1);
     XXH3_freeState(prev);
   }
   if (node->per_call_cost != 0) {
     char buffer[50];
     sprintf(buffer, "%f", node->per_call_cost);
-    _fingerprintString(ctx, "per_call_cost");
+    _fingerprintLiteral(ctx, "per_call_cost");
     _fingerprintString(ctx, buffer);
   }
 
   if (node->plan_id != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->plan_id);
-    _fingerprintString(ctx, "plan_id");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "plan_id");
+    _fingerprintInt64(ctx, node->plan_id);
   }
 
   if (node->plan_name != NULL) {
-    _fingerprintString(ctx, "plan_name");
+    _fingerprintLiteral(ctx, "plan_name");
     _fingerprintString(ctx, node->plan_name);
   }
 
@@ -1701,26 +1440,23 @@ _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "setParam");
+    _fingerprintLiteral(ctx, "setParam");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->setParam, node, "setParam", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->setParam) == 1 && linitial(node->setParam) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->setParam, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->setParam) == 1 && linitial(node->setParam) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("setParam") - 1);
     XXH3_freeState(prev);
   }
   if (node->startup_cost != 0) {
     char buffer[50];
     sprintf(buffer, "%f", node->startup_cost);
-    _fingerprintString(ctx, "startup_cost");
+    _fingerprintLiteral(ctx, "startup_cost");
     _fingerprintString(ctx, buffer);
   }
 
   if (true) {
-    _fingerprintString(ctx, "subLinkType");
+    _fingerprintLiteral(ctx, "subLinkType");
     _fingerprintString(ctx, _enumToStringSubLinkType(node->subLinkType));
   }
 
@@ -1729,118 +1465,96 @@ _fingerprintSubPlan(FingerprintContext *ctx, const SubPlan *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "testexpr");
+    _fingerprintLiteral(ctx, "testexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->testexpr, node, "testexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->testexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("testexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->unknownEqFalse) {
-    _fingerprintString(ctx, "unknownEqFalse");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unknownEqFalse", "true");
   }
 
   if (node->useHashTable) {
-    _fingerprintString(ctx, "useHashTable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "useHashTable", "true");
   }
 
 }
 
 static void
-_fingerprintAlternativeSubPlan(FingerprintContext *ctx, const AlternativeSubPlan *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlternativeSubPlan(FingerprintContext *ctx, const AlternativeSubPlan *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->subplans != NULL && node->subplans->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "subplans");
+    _fingerprintLiteral(ctx, "subplans");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->subplans, node, "subplans", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->subplans) == 1 && linitial(node->subplans) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->subplans, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->subplans) == 1 && linitial(node->subplans) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("subplans") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintFieldSelect(FingerprintContext *ctx, const FieldSelect *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFieldSelect(FingerprintContext *ctx, const FieldSelect *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->fieldnum != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->fieldnum);
-    _fingerprintString(ctx, "fieldnum");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "fieldnum");
+    _fingerprintInt64(ctx, node->fieldnum);
   }
 
   if (node->resultcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultcollid);
-    _fingerprintString(ctx, "resultcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultcollid");
+    _fingerprintInt64(ctx, node->resultcollid);
   }
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
   if (node->resulttypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttypmod);
-    _fingerprintString(ctx, "resulttypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttypmod");
+    _fingerprintInt64(ctx, node->resulttypmod);
   }
 
 }
 
 static void
-_fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -1849,15 +1563,12 @@ _fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fieldnums");
+    _fingerprintLiteral(ctx, "fieldnums");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fieldnums, node, "fieldnums", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fieldnums) == 1 && linitial(node->fieldnums) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fieldnums, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fieldnums) == 1 && linitial(node->fieldnums) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fieldnums") - 1);
     XXH3_freeState(prev);
   }
   if (node->newvals != NULL && node->newvals->length > 0) {
@@ -1865,141 +1576,117 @@ _fingerprintFieldStore(FingerprintContext *ctx, const FieldStore *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "newvals");
+    _fingerprintLiteral(ctx, "newvals");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->newvals, node, "newvals", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->newvals) == 1 && linitial(node->newvals) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->newvals, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->newvals) == 1 && linitial(node->newvals) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("newvals") - 1);
     XXH3_freeState(prev);
   }
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
 }
 
 static void
-_fingerprintRelabelType(FingerprintContext *ctx, const RelabelType *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRelabelType(FingerprintContext *ctx, const RelabelType *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (true) {
-    _fingerprintString(ctx, "relabelformat");
+    _fingerprintLiteral(ctx, "relabelformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->relabelformat));
   }
 
   if (node->resultcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultcollid);
-    _fingerprintString(ctx, "resultcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultcollid");
+    _fingerprintInt64(ctx, node->resultcollid);
   }
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
   if (node->resulttypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttypmod);
-    _fingerprintString(ctx, "resulttypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttypmod");
+    _fingerprintInt64(ctx, node->resulttypmod);
   }
 
 }
 
 static void
-_fingerprintCoerceViaIO(FingerprintContext *ctx, const CoerceViaIO *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCoerceViaIO(FingerprintContext *ctx, const CoerceViaIO *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "coerceformat");
+    _fingerprintLiteral(ctx, "coerceformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->coerceformat));
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->resultcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultcollid);
-    _fingerprintString(ctx, "resultcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultcollid");
+    _fingerprintInt64(ctx, node->resultcollid);
   }
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
 }
 
 static void
-_fingerprintArrayCoerceExpr(FingerprintContext *ctx, const ArrayCoerceExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintArrayCoerceExpr(FingerprintContext *ctx, const ArrayCoerceExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "coerceformat");
+    _fingerprintLiteral(ctx, "coerceformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->coerceformat));
   }
 
@@ -2008,104 +1695,85 @@ _fingerprintArrayCoerceExpr(FingerprintContext *ctx, const ArrayCoerceExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "elemexpr");
+    _fingerprintLiteral(ctx, "elemexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->elemexpr, node, "elemexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->elemexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("elemexpr") - 1);
     XXH3_freeState(prev);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->resultcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultcollid);
-    _fingerprintString(ctx, "resultcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultcollid");
+    _fingerprintInt64(ctx, node->resultcollid);
   }
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
   if (node->resulttypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttypmod);
-    _fingerprintString(ctx, "resulttypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttypmod");
+    _fingerprintInt64(ctx, node->resulttypmod);
   }
 
 }
 
 static void
-_fingerprintConvertRowtypeExpr(FingerprintContext *ctx, const ConvertRowtypeExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintConvertRowtypeExpr(FingerprintContext *ctx, const ConvertRowtypeExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "convertformat");
+    _fingerprintLiteral(ctx, "convertformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->convertformat));
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
 }
 
 static void
-_fingerprintCollateExpr(FingerprintContext *ctx, const CollateExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCollateExpr(FingerprintContext *ctx, const CollateExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->collOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->collOid);
-    _fingerprintString(ctx, "collOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "collOid");
+    _fingerprintInt64(ctx, node->collOid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -2113,22 +1781,19 @@ _fingerprintCollateExpr(FingerprintContext *ctx, const CollateExpr *node, const
 }
 
 static void
-_fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2137,29 +1802,22 @@ _fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->casecollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->casecollid);
-    _fingerprintString(ctx, "casecollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "casecollid");
+    _fingerprintInt64(ctx, node->casecollid);
   }
 
   if (node->casetype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->casetype);
-    _fingerprintString(ctx, "casetype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "casetype");
+    _fingerprintInt64(ctx, node->casetype);
   }
 
   if (node->defresult != NULL) {
@@ -2167,15 +1825,12 @@ _fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "defresult");
+    _fingerprintLiteral(ctx, "defresult");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->defresult, node, "defresult", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->defresult, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("defresult") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2184,22 +1839,19 @@ _fingerprintCaseExpr(FingerprintContext *ctx, const CaseExpr *node, const void *
 }
 
 static void
-_fingerprintCaseWhen(FingerprintContext *ctx, const CaseWhen *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCaseWhen(FingerprintContext *ctx, const CaseWhen *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2210,68 +1862,53 @@ _fingerprintCaseWhen(FingerprintContext *ctx, const CaseWhen *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "result");
+    _fingerprintLiteral(ctx, "result");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->result, node, "result", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->result, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("result") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCaseTestExpr(FingerprintContext *ctx, const CaseTestExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCaseTestExpr(FingerprintContext *ctx, const CaseTestExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->collation);
-    _fingerprintString(ctx, "collation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "collation");
+    _fingerprintInt64(ctx, node->collation);
   }
 
   if (node->typeId != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeId);
-    _fingerprintString(ctx, "typeId");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeId");
+    _fingerprintInt64(ctx, node->typeId);
   }
 
   if (node->typeMod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeMod);
-    _fingerprintString(ctx, "typeMod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeMod");
+    _fingerprintInt64(ctx, node->typeMod);
   }
 
 }
 
 static void
-_fingerprintArrayExpr(FingerprintContext *ctx, const ArrayExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintArrayExpr(FingerprintContext *ctx, const ArrayExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->array_collid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->array_collid);
-    _fingerprintString(ctx, "array_collid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "array_collid");
+    _fingerprintInt64(ctx, node->array_collid);
   }
 
   if (node->array_typeid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->array_typeid);
-    _fingerprintString(ctx, "array_typeid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "array_typeid");
+    _fingerprintInt64(ctx, node->array_typeid);
   }
 
   if (node->element_typeid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->element_typeid);
-    _fingerprintString(ctx, "element_typeid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "element_typeid");
+    _fingerprintInt64(ctx, node->element_typeid);
   }
 
   if (node->elements != NULL && node->elements->length > 0) {
@@ -2279,43 +1916,36 @@ _fingerprintArrayExpr(FingerprintContext *ctx, const ArrayExpr *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "elements");
+    _fingerprintLiteral(ctx, "elements");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->elements, node, "elements", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->elements) == 1 && linitial(node->elements) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->elements, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->elements) == 1 && linitial(node->elements) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("elements") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->multidims) {
-    _fingerprintString(ctx, "multidims");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "multidims", "true");
   }
 
 }
 
 static void
-_fingerprintRowExpr(FingerprintContext *ctx, const RowExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRowExpr(FingerprintContext *ctx, const RowExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->colnames != NULL && node->colnames->length > 0) {
@@ -2323,50 +1953,42 @@ _fingerprintRowExpr(FingerprintContext *ctx, const RowExpr *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colnames");
+    _fingerprintLiteral(ctx, "colnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colnames, node, "colnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colnames) == 1 && linitial(node->colnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colnames) == 1 && linitial(node->colnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colnames") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
   if (true) {
-    _fingerprintString(ctx, "row_format");
+    _fingerprintLiteral(ctx, "row_format");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->row_format));
   }
 
   if (node->row_typeid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->row_typeid);
-    _fingerprintString(ctx, "row_typeid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "row_typeid");
+    _fingerprintInt64(ctx, node->row_typeid);
   }
 
 }
 
 static void
-_fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->inputcollids != NULL && node->inputcollids->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "inputcollids");
+    _fingerprintLiteral(ctx, "inputcollids");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->inputcollids, node, "inputcollids", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->inputcollids) == 1 && linitial(node->inputcollids) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->inputcollids, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->inputcollids) == 1 && linitial(node->inputcollids) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("inputcollids") - 1);
     XXH3_freeState(prev);
   }
   if (node->largs != NULL && node->largs->length > 0) {
@@ -2374,15 +1996,12 @@ _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "largs");
+    _fingerprintLiteral(ctx, "largs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->largs, node, "largs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->largs) == 1 && linitial(node->largs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->largs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->largs) == 1 && linitial(node->largs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("largs") - 1);
     XXH3_freeState(prev);
   }
   if (node->opfamilies != NULL && node->opfamilies->length > 0) {
@@ -2390,15 +2009,12 @@ _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opfamilies");
+    _fingerprintLiteral(ctx, "opfamilies");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opfamilies, node, "opfamilies", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilies) == 1 && linitial(node->opfamilies) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opfamilies, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilies) == 1 && linitial(node->opfamilies) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opfamilies") - 1);
     XXH3_freeState(prev);
   }
   if (node->opnos != NULL && node->opnos->length > 0) {
@@ -2406,15 +2022,12 @@ _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opnos");
+    _fingerprintLiteral(ctx, "opnos");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opnos, node, "opnos", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opnos) == 1 && linitial(node->opnos) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opnos, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opnos) == 1 && linitial(node->opnos) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opnos") - 1);
     XXH3_freeState(prev);
   }
   if (node->rargs != NULL && node->rargs->length > 0) {
@@ -2422,55 +2035,45 @@ _fingerprintRowCompareExpr(FingerprintContext *ctx, const RowCompareExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rargs");
+    _fingerprintLiteral(ctx, "rargs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rargs, node, "rargs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rargs) == 1 && linitial(node->rargs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rargs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rargs) == 1 && linitial(node->rargs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rargs") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "rctype");
+    _fingerprintLiteral(ctx, "rctype");
     _fingerprintString(ctx, _enumToStringRowCompareType(node->rctype));
   }
 
 }
 
 static void
-_fingerprintCoalesceExpr(FingerprintContext *ctx, const CoalesceExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCoalesceExpr(FingerprintContext *ctx, const CoalesceExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->coalescecollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->coalescecollid);
-    _fingerprintString(ctx, "coalescecollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "coalescecollid");
+    _fingerprintInt64(ctx, node->coalescecollid);
   }
 
   if (node->coalescetype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->coalescetype);
-    _fingerprintString(ctx, "coalescetype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "coalescetype");
+    _fingerprintInt64(ctx, node->coalescetype);
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -2478,97 +2081,81 @@ _fingerprintCoalesceExpr(FingerprintContext *ctx, const CoalesceExpr *node, cons
 }
 
 static void
-_fingerprintMinMaxExpr(FingerprintContext *ctx, const MinMaxExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMinMaxExpr(FingerprintContext *ctx, const MinMaxExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->inputcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inputcollid);
-    _fingerprintString(ctx, "inputcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inputcollid");
+    _fingerprintInt64(ctx, node->inputcollid);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->minmaxcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->minmaxcollid);
-    _fingerprintString(ctx, "minmaxcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "minmaxcollid");
+    _fingerprintInt64(ctx, node->minmaxcollid);
   }
 
   if (node->minmaxtype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->minmaxtype);
-    _fingerprintString(ctx, "minmaxtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "minmaxtype");
+    _fingerprintInt64(ctx, node->minmaxtype);
   }
 
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringMinMaxOp(node->op));
   }
 
 }
 
 static void
-_fingerprintSQLValueFunction(FingerprintContext *ctx, const SQLValueFunction *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSQLValueFunction(FingerprintContext *ctx, const SQLValueFunction *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringSQLValueFunctionOp(node->op));
   }
 
   if (node->type != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->type);
-    _fingerprintString(ctx, "type");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "type");
+    _fingerprintInt64(ctx, node->type);
   }
 
   if (node->typmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typmod);
-    _fingerprintString(ctx, "typmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typmod");
+    _fingerprintInt64(ctx, node->typmod);
   }
 
 }
 
 static void
-_fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg_names != NULL && node->arg_names->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg_names");
+    _fingerprintLiteral(ctx, "arg_names");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg_names, node, "arg_names", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arg_names) == 1 && linitial(node->arg_names) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg_names, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arg_names) == 1 && linitial(node->arg_names) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg_names") - 1);
     XXH3_freeState(prev);
   }
   if (node->args != NULL && node->args->length > 0) {
@@ -2576,26 +2163,22 @@ _fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->indent) {
-    _fingerprintString(ctx, "indent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "indent", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -2604,53 +2187,46 @@ _fingerprintXmlExpr(FingerprintContext *ctx, const XmlExpr *node, const void *pa
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "named_args");
+    _fingerprintLiteral(ctx, "named_args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->named_args, node, "named_args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->named_args) == 1 && linitial(node->named_args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->named_args, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->named_args) == 1 && linitial(node->named_args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("named_args") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringXmlExprOp(node->op));
   }
 
   if (node->type != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->type);
-    _fingerprintString(ctx, "type");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "type");
+    _fingerprintInt64(ctx, node->type);
   }
 
   if (node->typmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typmod);
-    _fingerprintString(ctx, "typmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typmod");
+    _fingerprintInt64(ctx, node->typmod);
   }
 
   if (true) {
-    _fingerprintString(ctx, "xmloption");
+    _fingerprintLiteral(ctx, "xmloption");
     _fingerprintString(ctx, _enumToStringXmlOptionType(node->xmloption));
   }
 
 }
 
 static void
-_fingerprintJsonFormat(FingerprintContext *ctx, const JsonFormat *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonFormat(FingerprintContext *ctx, const JsonFormat *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "encoding");
+    _fingerprintLiteral(ctx, "encoding");
     _fingerprintString(ctx, _enumToStringJsonEncoding(node->encoding));
   }
 
   if (true) {
-    _fingerprintString(ctx, "format_type");
+    _fingerprintLiteral(ctx, "format_type");
     _fingerprintString(ctx, _enumToStringJsonFormatType(node->format_type));
   }
 
@@ -2659,58 +2235,48 @@ _fingerprintJsonFormat(FingerprintContext *ctx, const JsonFormat *node, const vo
 }
 
 static void
-_fingerprintJsonReturning(FingerprintContext *ctx, const JsonReturning *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonReturning(FingerprintContext *ctx, const JsonReturning *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->format != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->typid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typid);
-    _fingerprintString(ctx, "typid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typid");
+    _fingerprintInt64(ctx, node->typid);
   }
 
   if (node->typmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typmod);
-    _fingerprintString(ctx, "typmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typmod");
+    _fingerprintInt64(ctx, node->typmod);
   }
 
 }
 
 static void
-_fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->format != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2719,15 +2285,12 @@ _fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "formatted_expr");
+    _fingerprintLiteral(ctx, "formatted_expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->formatted_expr, node, "formatted_expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->formatted_expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("formatted_expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2736,26 +2299,22 @@ _fingerprintJsonValueExpr(FingerprintContext *ctx, const JsonValueExpr *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "raw_expr");
+    _fingerprintLiteral(ctx, "raw_expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->raw_expr, node, "raw_expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->raw_expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("raw_expr") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->args != NULL && node->args->length > 0) {
@@ -2763,15 +2322,12 @@ _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorEx
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->coercion != NULL) {
@@ -2779,15 +2335,12 @@ _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorEx
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coercion");
+    _fingerprintLiteral(ctx, "coercion");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coercion, node, "coercion", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coercion, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coercion") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2796,15 +2349,12 @@ _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorEx
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func");
+    _fingerprintLiteral(ctx, "func");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->func, node, "func", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->func, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2815,47 +2365,40 @@ _fingerprintJsonConstructorExpr(FingerprintContext *ctx, const JsonConstructorEx
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returning");
+    _fingerprintLiteral(ctx, "returning");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonReturning(ctx, node->returning, node, "returning", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonReturning(ctx, node->returning, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returning") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "type");
+    _fingerprintLiteral(ctx, "type");
     _fingerprintString(ctx, _enumToStringJsonConstructorType(node->type));
   }
 
   if (node->unique) {
-    _fingerprintString(ctx, "unique");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique", "true");
   }
 
 }
 
 static void
-_fingerprintJsonIsPredicate(FingerprintContext *ctx, const JsonIsPredicate *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonIsPredicate(FingerprintContext *ctx, const JsonIsPredicate *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2864,43 +2407,38 @@ _fingerprintJsonIsPredicate(FingerprintContext *ctx, const JsonIsPredicate *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "item_type");
+    _fingerprintLiteral(ctx, "item_type");
     _fingerprintString(ctx, _enumToStringJsonValueType(node->item_type));
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->unique_keys) {
-    _fingerprintString(ctx, "unique_keys");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique_keys", "true");
   }
 
 }
 
 static void
-_fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "btype");
+    _fingerprintLiteral(ctx, "btype");
     _fingerprintString(ctx, _enumToStringJsonBehaviorType(node->btype));
   }
 
   if (node->coerce) {
-    _fingerprintString(ctx, "coerce");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "coerce", "true");
   }
 
   if (node->expr != NULL) {
@@ -2908,15 +2446,12 @@ _fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2925,17 +2460,15 @@ _fingerprintJsonBehavior(FingerprintContext *ctx, const JsonBehavior *node, cons
 }
 
 static void
-_fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->collation);
-    _fingerprintString(ctx, "collation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "collation");
+    _fingerprintInt64(ctx, node->collation);
   }
 
   if (node->column_name != NULL) {
-    _fingerprintString(ctx, "column_name");
+    _fingerprintLiteral(ctx, "column_name");
     _fingerprintString(ctx, node->column_name);
   }
 
@@ -2944,15 +2477,12 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
@@ -2961,23 +2491,19 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "formatted_expr");
+    _fingerprintLiteral(ctx, "formatted_expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->formatted_expr, node, "formatted_expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->formatted_expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("formatted_expr") - 1);
     XXH3_freeState(prev);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->omit_quotes) {
-    _fingerprintString(ctx, "omit_quotes");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "omit_quotes", "true");
   }
 
   if (node->on_empty != NULL) {
@@ -2985,15 +2511,12 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_empty");
+    _fingerprintLiteral(ctx, "on_empty");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_empty, node, "on_empty", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_empty, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_empty") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3002,20 +2525,17 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_error");
+    _fingerprintLiteral(ctx, "on_error");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_error, node, "on_error", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_error, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_error") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringJsonExprOp(node->op));
   }
 
@@ -3024,15 +2544,12 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "passing_names");
+    _fingerprintLiteral(ctx, "passing_names");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->passing_names, node, "passing_names", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing_names) == 1 && linitial(node->passing_names) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->passing_names, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing_names) == 1 && linitial(node->passing_names) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("passing_names") - 1);
     XXH3_freeState(prev);
   }
   if (node->passing_values != NULL && node->passing_values->length > 0) {
@@ -3040,15 +2557,12 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "passing_values");
+    _fingerprintLiteral(ctx, "passing_values");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->passing_values, node, "passing_values", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing_values) == 1 && linitial(node->passing_values) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->passing_values, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing_values) == 1 && linitial(node->passing_values) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("passing_values") - 1);
     XXH3_freeState(prev);
   }
   if (node->path_spec != NULL) {
@@ -3056,15 +2570,12 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "path_spec");
+    _fingerprintLiteral(ctx, "path_spec");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->path_spec, node, "path_spec", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->path_spec, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("path_spec") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3073,40 +2584,35 @@ _fingerprintJsonExpr(FingerprintContext *ctx, const JsonExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returning");
+    _fingerprintLiteral(ctx, "returning");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonReturning(ctx, node->returning, node, "returning", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonReturning(ctx, node->returning, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returning") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->use_io_coercion) {
-    _fingerprintString(ctx, "use_io_coercion");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "use_io_coercion", "true");
   }
 
   if (node->use_json_coercion) {
-    _fingerprintString(ctx, "use_json_coercion");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "use_json_coercion", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "wrapper");
+    _fingerprintLiteral(ctx, "wrapper");
     _fingerprintString(ctx, _enumToStringJsonWrapper(node->wrapper));
   }
 
 }
 
 static void
-_fingerprintJsonTablePath(FingerprintContext *ctx, const JsonTablePath *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTablePath(FingerprintContext *ctx, const JsonTablePath *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -3115,42 +2621,34 @@ _fingerprintJsonTablePath(FingerprintContext *ctx, const JsonTablePath *node, co
 }
 
 static void
-_fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->child != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "child");
+    _fingerprintLiteral(ctx, "child");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, (Node*)node->child, node, "child", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, (Node*)node->child, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("child") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->colMax != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->colMax);
-    _fingerprintString(ctx, "colMax");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "colMax");
+    _fingerprintInt64(ctx, node->colMax);
   }
 
   if (node->colMin != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->colMin);
-    _fingerprintString(ctx, "colMin");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "colMin");
+    _fingerprintInt64(ctx, node->colMin);
   }
 
   if (node->errorOnError) {
-    _fingerprintString(ctx, "errorOnError");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "errorOnError", "true");
   }
 
   if (node->path != NULL) {
@@ -3158,15 +2656,12 @@ _fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "path");
+    _fingerprintLiteral(ctx, "path");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonTablePath(ctx, node->path, node, "path", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonTablePath(ctx, node->path, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("path") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3175,37 +2670,31 @@ _fingerprintJsonTablePathScan(FingerprintContext *ctx, const JsonTablePathScan *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plan");
+    _fingerprintLiteral(ctx, "plan");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, (Node*)&node->plan, node, "plan", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, (Node*)&node->plan, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plan") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSiblingJoin *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSiblingJoin *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->lplan != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lplan");
+    _fingerprintLiteral(ctx, "lplan");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, (Node*)node->lplan, node, "lplan", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, (Node*)node->lplan, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lplan") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3214,15 +2703,12 @@ _fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSibling
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plan");
+    _fingerprintLiteral(ctx, "plan");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, (Node*)&node->plan, node, "plan", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, (Node*)&node->plan, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plan") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3231,76 +2717,66 @@ _fingerprintJsonTableSiblingJoin(FingerprintContext *ctx, const JsonTableSibling
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rplan");
+    _fingerprintLiteral(ctx, "rplan");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, (Node*)node->rplan, node, "rplan", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, (Node*)node->rplan, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rplan") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintNullTest(FingerprintContext *ctx, const NullTest *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintNullTest(FingerprintContext *ctx, const NullTest *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->argisrow) {
-    _fingerprintString(ctx, "argisrow");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "argisrow", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (true) {
-    _fingerprintString(ctx, "nulltesttype");
+    _fingerprintLiteral(ctx, "nulltesttype");
     _fingerprintString(ctx, _enumToStringNullTestType(node->nulltesttype));
   }
 
 }
 
 static void
-_fingerprintBooleanTest(FingerprintContext *ctx, const BooleanTest *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintBooleanTest(FingerprintContext *ctx, const BooleanTest *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "booltesttype");
+    _fingerprintLiteral(ctx, "booltesttype");
     _fingerprintString(ctx, _enumToStringBoolTestType(node->booltesttype));
   }
 
@@ -3309,20 +2785,20 @@ _fingerprintBooleanTest(FingerprintContext *ctx, const BooleanTest *node, const
 }
 
 static void
-_fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "commandType");
+    _fingerprintLiteral(ctx, "commandType");
     _fingerprintString(ctx, _enumToStringCmdType(node->commandType));
   }
 
   if (true) {
-    _fingerprintString(ctx, "matchKind");
+    _fingerprintLiteral(ctx, "matchKind");
     _fingerprintString(ctx, _enumToStringMergeMatchKind(node->matchKind));
   }
 
   if (true) {
-    _fingerprintString(ctx, "override");
+    _fingerprintLiteral(ctx, "override");
     _fingerprintString(ctx, _enumToStringOverridingKind(node->override));
   }
 
@@ -3331,15 +2807,12 @@ _fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "qual");
+    _fingerprintLiteral(ctx, "qual");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->qual, node, "qual", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->qual, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("qual") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3348,15 +2821,12 @@ _fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->updateColnos != NULL && node->updateColnos->length > 0) {
@@ -3364,277 +2834,226 @@ _fingerprintMergeAction(FingerprintContext *ctx, const MergeAction *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "updateColnos");
+    _fingerprintLiteral(ctx, "updateColnos");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->updateColnos, node, "updateColnos", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->updateColnos) == 1 && linitial(node->updateColnos) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->updateColnos, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->updateColnos) == 1 && linitial(node->updateColnos) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("updateColnos") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCoerceToDomain(FingerprintContext *ctx, const CoerceToDomain *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCoerceToDomain(FingerprintContext *ctx, const CoerceToDomain *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "coercionformat");
+    _fingerprintLiteral(ctx, "coercionformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->coercionformat));
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->resultcollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultcollid);
-    _fingerprintString(ctx, "resultcollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultcollid");
+    _fingerprintInt64(ctx, node->resultcollid);
   }
 
   if (node->resulttype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttype);
-    _fingerprintString(ctx, "resulttype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttype");
+    _fingerprintInt64(ctx, node->resulttype);
   }
 
   if (node->resulttypmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resulttypmod);
-    _fingerprintString(ctx, "resulttypmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resulttypmod");
+    _fingerprintInt64(ctx, node->resulttypmod);
   }
 
 }
 
 static void
-_fingerprintCoerceToDomainValue(FingerprintContext *ctx, const CoerceToDomainValue *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCoerceToDomainValue(FingerprintContext *ctx, const CoerceToDomainValue *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->collation);
-    _fingerprintString(ctx, "collation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "collation");
+    _fingerprintInt64(ctx, node->collation);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->typeId != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeId);
-    _fingerprintString(ctx, "typeId");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeId");
+    _fingerprintInt64(ctx, node->typeId);
   }
 
   if (node->typeMod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeMod);
-    _fingerprintString(ctx, "typeMod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeMod");
+    _fingerprintInt64(ctx, node->typeMod);
   }
 
 }
 
 static void
-_fingerprintSetToDefault(FingerprintContext *ctx, const SetToDefault *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSetToDefault(FingerprintContext *ctx, const SetToDefault *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring all fields for fingerprinting
 }
 
 static void
-_fingerprintCurrentOfExpr(FingerprintContext *ctx, const CurrentOfExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCurrentOfExpr(FingerprintContext *ctx, const CurrentOfExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cursor_name != NULL) {
-    _fingerprintString(ctx, "cursor_name");
+    _fingerprintLiteral(ctx, "cursor_name");
     _fingerprintString(ctx, node->cursor_name);
   }
 
   if (node->cursor_param != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cursor_param);
-    _fingerprintString(ctx, "cursor_param");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cursor_param");
+    _fingerprintInt64(ctx, node->cursor_param);
   }
 
   if (node->cvarno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cvarno);
-    _fingerprintString(ctx, "cvarno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cvarno");
+    _fingerprintInt64(ctx, node->cvarno);
   }
 
 }
 
 static void
-_fingerprintNextValueExpr(FingerprintContext *ctx, const NextValueExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintNextValueExpr(FingerprintContext *ctx, const NextValueExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->seqid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->seqid);
-    _fingerprintString(ctx, "seqid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "seqid");
+    _fingerprintInt64(ctx, node->seqid);
   }
 
   if (node->typeId != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeId);
-    _fingerprintString(ctx, "typeId");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeId");
+    _fingerprintInt64(ctx, node->typeId);
   }
 
 }
 
 static void
-_fingerprintInferenceElem(FingerprintContext *ctx, const InferenceElem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintInferenceElem(FingerprintContext *ctx, const InferenceElem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->infercollid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->infercollid);
-    _fingerprintString(ctx, "infercollid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "infercollid");
+    _fingerprintInt64(ctx, node->infercollid);
   }
 
   if (node->inferopclass != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inferopclass);
-    _fingerprintString(ctx, "inferopclass");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inferopclass");
+    _fingerprintInt64(ctx, node->inferopclass);
   }
 
 }
 
 static void
-_fingerprintTargetEntry(FingerprintContext *ctx, const TargetEntry *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTargetEntry(FingerprintContext *ctx, const TargetEntry *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->resjunk) {
-    _fingerprintString(ctx, "resjunk");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "resjunk", "true");
   }
 
   if (node->resname != NULL) {
-    _fingerprintString(ctx, "resname");
+    _fingerprintLiteral(ctx, "resname");
     _fingerprintString(ctx, node->resname);
   }
 
   if (node->resno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resno);
-    _fingerprintString(ctx, "resno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resno");
+    _fingerprintInt64(ctx, node->resno);
   }
 
   if (node->resorigcol != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resorigcol);
-    _fingerprintString(ctx, "resorigcol");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resorigcol");
+    _fingerprintInt64(ctx, node->resorigcol);
   }
 
   if (node->resorigtbl != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resorigtbl);
-    _fingerprintString(ctx, "resorigtbl");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resorigtbl");
+    _fingerprintInt64(ctx, node->resorigtbl);
   }
 
   if (node->ressortgroupref != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->ressortgroupref);
-    _fingerprintString(ctx, "ressortgroupref");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "ressortgroupref");
+    _fingerprintInt64(ctx, node->ressortgroupref);
   }
 
 }
 
 static void
-_fingerprintRangeTblRef(FingerprintContext *ctx, const RangeTblRef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTblRef(FingerprintContext *ctx, const RangeTblRef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->rtindex != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->rtindex);
-    _fingerprintString(ctx, "rtindex");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "rtindex");
+    _fingerprintInt64(ctx, node->rtindex);
   }
 
 }
 
 static void
-_fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->isNatural) {
-    _fingerprintString(ctx, "isNatural");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isNatural", "true");
   }
 
   if (node->join_using_alias != NULL) {
@@ -3642,20 +3061,17 @@ _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "join_using_alias");
+    _fingerprintLiteral(ctx, "join_using_alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->join_using_alias, node, "join_using_alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->join_using_alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("join_using_alias") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "jointype");
+    _fingerprintLiteral(ctx, "jointype");
     _fingerprintString(ctx, _enumToStringJoinType(node->jointype));
   }
 
@@ -3664,15 +3080,12 @@ _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "larg");
+    _fingerprintLiteral(ctx, "larg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->larg, node, "larg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->larg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("larg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3681,15 +3094,12 @@ _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "quals");
+    _fingerprintLiteral(ctx, "quals");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->quals, node, "quals", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->quals, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("quals") - 1);
     XXH3_freeState(prev);
   }
 
@@ -3698,23 +3108,18 @@ _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rarg");
+    _fingerprintLiteral(ctx, "rarg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rarg, node, "rarg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rarg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rarg") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->rtindex != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->rtindex);
-    _fingerprintString(ctx, "rtindex");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "rtindex");
+    _fingerprintInt64(ctx, node->rtindex);
   }
 
   if (node->usingClause != NULL && node->usingClause->length > 0) {
@@ -3722,36 +3127,30 @@ _fingerprintJoinExpr(FingerprintContext *ctx, const JoinExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "usingClause");
+    _fingerprintLiteral(ctx, "usingClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->usingClause, node, "usingClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->usingClause) == 1 && linitial(node->usingClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->usingClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->usingClause) == 1 && linitial(node->usingClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("usingClause") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintFromExpr(FingerprintContext *ctx, const FromExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFromExpr(FingerprintContext *ctx, const FromExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fromlist != NULL && node->fromlist->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fromlist");
+    _fingerprintLiteral(ctx, "fromlist");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fromlist, node, "fromlist", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromlist) == 1 && linitial(node->fromlist) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fromlist, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromlist) == 1 && linitial(node->fromlist) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fromlist") - 1);
     XXH3_freeState(prev);
   }
   if (node->quals != NULL) {
@@ -3759,25 +3158,22 @@ _fingerprintFromExpr(FingerprintContext *ctx, const FromExpr *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "quals");
+    _fingerprintLiteral(ctx, "quals");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->quals, node, "quals", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->quals, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("quals") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "action");
+    _fingerprintLiteral(ctx, "action");
     _fingerprintString(ctx, _enumToStringOnConflictAction(node->action));
   }
 
@@ -3786,15 +3182,12 @@ _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arbiterElems");
+    _fingerprintLiteral(ctx, "arbiterElems");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arbiterElems, node, "arbiterElems", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arbiterElems) == 1 && linitial(node->arbiterElems) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arbiterElems, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arbiterElems) == 1 && linitial(node->arbiterElems) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arbiterElems") - 1);
     XXH3_freeState(prev);
   }
   if (node->arbiterWhere != NULL) {
@@ -3802,30 +3195,23 @@ _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arbiterWhere");
+    _fingerprintLiteral(ctx, "arbiterWhere");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arbiterWhere, node, "arbiterWhere", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arbiterWhere, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arbiterWhere") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->constraint != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->constraint);
-    _fingerprintString(ctx, "constraint");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "constraint");
+    _fingerprintInt64(ctx, node->constraint);
   }
 
   if (node->exclRelIndex != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->exclRelIndex);
-    _fingerprintString(ctx, "exclRelIndex");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "exclRelIndex");
+    _fingerprintInt64(ctx, node->exclRelIndex);
   }
 
   if (node->exclRelTlist != NULL && node->exclRelTlist->length > 0) {
@@ -3833,15 +3219,12 @@ _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "exclRelTlist");
+    _fingerprintLiteral(ctx, "exclRelTlist");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->exclRelTlist, node, "exclRelTlist", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exclRelTlist) == 1 && linitial(node->exclRelTlist) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->exclRelTlist, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exclRelTlist) == 1 && linitial(node->exclRelTlist) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("exclRelTlist") - 1);
     XXH3_freeState(prev);
   }
   if (node->onConflictSet != NULL && node->onConflictSet->length > 0) {
@@ -3849,15 +3232,12 @@ _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "onConflictSet");
+    _fingerprintLiteral(ctx, "onConflictSet");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->onConflictSet, node, "onConflictSet", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->onConflictSet) == 1 && linitial(node->onConflictSet) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->onConflictSet, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->onConflictSet) == 1 && linitial(node->onConflictSet) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("onConflictSet") - 1);
     XXH3_freeState(prev);
   }
   if (node->onConflictWhere != NULL) {
@@ -3865,30 +3245,26 @@ _fingerprintOnConflictExpr(FingerprintContext *ctx, const OnConflictExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "onConflictWhere");
+    _fingerprintLiteral(ctx, "onConflictWhere");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->onConflictWhere, node, "onConflictWhere", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->onConflictWhere, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("onConflictWhere") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->canSetTag) {
-    _fingerprintString(ctx, "canSetTag");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "canSetTag", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "commandType");
+    _fingerprintLiteral(ctx, "commandType");
     _fingerprintString(ctx, _enumToStringCmdType(node->commandType));
   }
 
@@ -3897,15 +3273,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constraintDeps");
+    _fingerprintLiteral(ctx, "constraintDeps");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->constraintDeps, node, "constraintDeps", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraintDeps) == 1 && linitial(node->constraintDeps) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->constraintDeps, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraintDeps) == 1 && linitial(node->constraintDeps) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constraintDeps") - 1);
     XXH3_freeState(prev);
   }
   if (node->cteList != NULL && node->cteList->length > 0) {
@@ -3913,15 +3286,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cteList");
+    _fingerprintLiteral(ctx, "cteList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cteList, node, "cteList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cteList) == 1 && linitial(node->cteList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cteList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cteList) == 1 && linitial(node->cteList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cteList") - 1);
     XXH3_freeState(prev);
   }
   if (node->distinctClause != NULL && node->distinctClause->length > 0) {
@@ -3929,15 +3299,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "distinctClause");
+    _fingerprintLiteral(ctx, "distinctClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->distinctClause, node, "distinctClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->distinctClause) == 1 && linitial(node->distinctClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->distinctClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->distinctClause) == 1 && linitial(node->distinctClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("distinctClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->groupClause != NULL && node->groupClause->length > 0) {
@@ -3945,20 +3312,16 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "groupClause");
+    _fingerprintLiteral(ctx, "groupClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->groupClause, node, "groupClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClause) == 1 && linitial(node->groupClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->groupClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClause) == 1 && linitial(node->groupClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("groupClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->groupDistinct) {
-    _fingerprintString(ctx, "groupDistinct");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "groupDistinct", "true");
   }
 
   if (node->groupingSets != NULL && node->groupingSets->length > 0) {
@@ -3966,60 +3329,48 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "groupingSets");
+    _fingerprintLiteral(ctx, "groupingSets");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->groupingSets, node, "groupingSets", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupingSets) == 1 && linitial(node->groupingSets) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->groupingSets, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupingSets) == 1 && linitial(node->groupingSets) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("groupingSets") - 1);
     XXH3_freeState(prev);
   }
   if (node->hasAggs) {
-    _fingerprintString(ctx, "hasAggs");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasAggs", "true");
   }
 
   if (node->hasDistinctOn) {
-    _fingerprintString(ctx, "hasDistinctOn");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasDistinctOn", "true");
   }
 
   if (node->hasForUpdate) {
-    _fingerprintString(ctx, "hasForUpdate");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasForUpdate", "true");
   }
 
   if (node->hasModifyingCTE) {
-    _fingerprintString(ctx, "hasModifyingCTE");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasModifyingCTE", "true");
   }
 
   if (node->hasRecursive) {
-    _fingerprintString(ctx, "hasRecursive");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasRecursive", "true");
   }
 
   if (node->hasRowSecurity) {
-    _fingerprintString(ctx, "hasRowSecurity");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasRowSecurity", "true");
   }
 
   if (node->hasSubLinks) {
-    _fingerprintString(ctx, "hasSubLinks");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasSubLinks", "true");
   }
 
   if (node->hasTargetSRFs) {
-    _fingerprintString(ctx, "hasTargetSRFs");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasTargetSRFs", "true");
   }
 
   if (node->hasWindowFuncs) {
-    _fingerprintString(ctx, "hasWindowFuncs");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hasWindowFuncs", "true");
   }
 
   if (node->havingQual != NULL) {
@@ -4027,21 +3378,17 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "havingQual");
+    _fingerprintLiteral(ctx, "havingQual");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->havingQual, node, "havingQual", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->havingQual, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("havingQual") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->isReturn) {
-    _fingerprintString(ctx, "isReturn");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isReturn", "true");
   }
 
   if (node->jointree != NULL) {
@@ -4049,15 +3396,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "jointree");
+    _fingerprintLiteral(ctx, "jointree");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintFromExpr(ctx, node->jointree, node, "jointree", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintFromExpr(ctx, node->jointree, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("jointree") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4066,15 +3410,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "limitCount");
+    _fingerprintLiteral(ctx, "limitCount");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->limitCount, node, "limitCount", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->limitCount, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("limitCount") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4083,20 +3424,17 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "limitOffset");
+    _fingerprintLiteral(ctx, "limitOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->limitOffset, node, "limitOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->limitOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("limitOffset") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "limitOption");
+    _fingerprintLiteral(ctx, "limitOption");
     _fingerprintString(ctx, _enumToStringLimitOption(node->limitOption));
   }
 
@@ -4105,15 +3443,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "mergeActionList");
+    _fingerprintLiteral(ctx, "mergeActionList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->mergeActionList, node, "mergeActionList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->mergeActionList) == 1 && linitial(node->mergeActionList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->mergeActionList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->mergeActionList) == 1 && linitial(node->mergeActionList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("mergeActionList") - 1);
     XXH3_freeState(prev);
   }
   if (node->mergeJoinCondition != NULL) {
@@ -4121,23 +3456,18 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "mergeJoinCondition");
+    _fingerprintLiteral(ctx, "mergeJoinCondition");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->mergeJoinCondition, node, "mergeJoinCondition", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->mergeJoinCondition, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("mergeJoinCondition") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->mergeTargetRelation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->mergeTargetRelation);
-    _fingerprintString(ctx, "mergeTargetRelation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "mergeTargetRelation");
+    _fingerprintInt64(ctx, node->mergeTargetRelation);
   }
 
   if (node->onConflict != NULL) {
@@ -4145,33 +3475,28 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "onConflict");
+    _fingerprintLiteral(ctx, "onConflict");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintOnConflictExpr(ctx, node->onConflict, node, "onConflict", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintOnConflictExpr(ctx, node->onConflict, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("onConflict") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "override");
+    _fingerprintLiteral(ctx, "override");
     _fingerprintString(ctx, _enumToStringOverridingKind(node->override));
   }
 
   if (true) {
-    _fingerprintString(ctx, "querySource");
+    _fingerprintLiteral(ctx, "querySource");
     _fingerprintString(ctx, _enumToStringQuerySource(node->querySource));
   }
 
   if (node->resultRelation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->resultRelation);
-    _fingerprintString(ctx, "resultRelation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "resultRelation");
+    _fingerprintInt64(ctx, node->resultRelation);
   }
 
   if (node->returningList != NULL && node->returningList->length > 0) {
@@ -4179,15 +3504,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returningList");
+    _fingerprintLiteral(ctx, "returningList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returningList, node, "returningList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returningList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returningList") - 1);
     XXH3_freeState(prev);
   }
   if (node->rowMarks != NULL && node->rowMarks->length > 0) {
@@ -4195,15 +3517,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rowMarks");
+    _fingerprintLiteral(ctx, "rowMarks");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rowMarks, node, "rowMarks", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rowMarks) == 1 && linitial(node->rowMarks) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rowMarks, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rowMarks) == 1 && linitial(node->rowMarks) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rowMarks") - 1);
     XXH3_freeState(prev);
   }
   if (node->rtable != NULL && node->rtable->length > 0) {
@@ -4211,15 +3530,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rtable");
+    _fingerprintLiteral(ctx, "rtable");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rtable, node, "rtable", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rtable) == 1 && linitial(node->rtable) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rtable, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rtable) == 1 && linitial(node->rtable) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rtable") - 1);
     XXH3_freeState(prev);
   }
   if (node->rteperminfos != NULL && node->rteperminfos->length > 0) {
@@ -4227,15 +3543,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rteperminfos");
+    _fingerprintLiteral(ctx, "rteperminfos");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rteperminfos, node, "rteperminfos", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rteperminfos) == 1 && linitial(node->rteperminfos) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rteperminfos, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rteperminfos) == 1 && linitial(node->rteperminfos) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rteperminfos") - 1);
     XXH3_freeState(prev);
   }
   if (node->setOperations != NULL) {
@@ -4243,15 +3556,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "setOperations");
+    _fingerprintLiteral(ctx, "setOperations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->setOperations, node, "setOperations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->setOperations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("setOperations") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4260,29 +3570,22 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sortClause");
+    _fingerprintLiteral(ctx, "sortClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->sortClause, node, "sortClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->sortClause) == 1 && linitial(node->sortClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->sortClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->sortClause) == 1 && linitial(node->sortClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sortClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->stmt_len != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->stmt_len);
-    _fingerprintString(ctx, "stmt_len");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "stmt_len");
+    _fingerprintInt64(ctx, node->stmt_len);
   }
 
   if (node->stmt_location != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->stmt_location);
-    _fingerprintString(ctx, "stmt_location");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "stmt_location");
+    _fingerprintInt64(ctx, node->stmt_location);
   }
 
   if (node->targetList != NULL && node->targetList->length > 0) {
@@ -4290,15 +3593,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->utilityStmt != NULL) {
@@ -4306,15 +3606,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "utilityStmt");
+    _fingerprintLiteral(ctx, "utilityStmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->utilityStmt, node, "utilityStmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->utilityStmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("utilityStmt") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4323,15 +3620,12 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "windowClause");
+    _fingerprintLiteral(ctx, "windowClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->windowClause, node, "windowClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->windowClause) == 1 && linitial(node->windowClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->windowClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->windowClause) == 1 && linitial(node->windowClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("windowClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->withCheckOptions != NULL && node->withCheckOptions->length > 0) {
@@ -4339,36 +3633,30 @@ _fingerprintQuery(FingerprintContext *ctx, const Query *node, const void *parent
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withCheckOptions");
+    _fingerprintLiteral(ctx, "withCheckOptions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->withCheckOptions, node, "withCheckOptions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->withCheckOptions) == 1 && linitial(node->withCheckOptions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->withCheckOptions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->withCheckOptions) == 1 && linitial(node->withCheckOptions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withCheckOptions") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arrayBounds != NULL && node->arrayBounds->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arrayBounds");
+    _fingerprintLiteral(ctx, "arrayBounds");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arrayBounds, node, "arrayBounds", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arrayBounds) == 1 && linitial(node->arrayBounds) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arrayBounds, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->arrayBounds) == 1 && linitial(node->arrayBounds) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arrayBounds") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -4378,39 +3666,30 @@ _fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "names");
+    _fingerprintLiteral(ctx, "names");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->names, node, "names", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->names) == 1 && linitial(node->names) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->names, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->names) == 1 && linitial(node->names) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("names") - 1);
     XXH3_freeState(prev);
   }
   if (node->pct_type) {
-    _fingerprintString(ctx, "pct_type");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "pct_type", "true");
   }
 
   if (node->setof) {
-    _fingerprintString(ctx, "setof");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "setof", "true");
   }
 
   if (node->typeOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typeOid);
-    _fingerprintString(ctx, "typeOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typeOid");
+    _fingerprintInt64(ctx, node->typeOid);
   }
 
   if (node->typemod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->typemod);
-    _fingerprintString(ctx, "typemod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "typemod");
+    _fingerprintInt64(ctx, node->typemod);
   }
 
   if (node->typmods != NULL && node->typmods->length > 0) {
@@ -4418,36 +3697,30 @@ _fingerprintTypeName(FingerprintContext *ctx, const TypeName *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typmods");
+    _fingerprintLiteral(ctx, "typmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typmods, node, "typmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typmods) == 1 && linitial(node->typmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typmods) == 1 && linitial(node->typmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typmods") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintColumnRef(FingerprintContext *ctx, const ColumnRef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintColumnRef(FingerprintContext *ctx, const ColumnRef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fields != NULL && node->fields->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fields");
+    _fingerprintLiteral(ctx, "fields");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fields, node, "fields", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fields) == 1 && linitial(node->fields) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fields, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fields) == 1 && linitial(node->fields) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fields") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -4455,20 +3728,21 @@ _fingerprintColumnRef(FingerprintContext *ctx, const ColumnRef *node, const void
 }
 
 static void
-_fingerprintParamRef(FingerprintContext *ctx, const ParamRef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintParamRef(FingerprintContext *ctx, const ParamRef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring all fields for fingerprinting
 }
 
 static void
-_fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "kind");
-    if (node->kind == AEXPR_OP_ANY || node->kind == AEXPR_IN)
-      _fingerprintString(ctx, "AEXPR_OP");
-    else
+    if (node->kind == AEXPR_OP_ANY || node->kind == AEXPR_IN) {
+      _fingerprintLiteralPair(ctx, "kind", "AEXPR_OP");
+    } else {
+      _fingerprintLiteral(ctx, "kind");
       _fingerprintString(ctx, _enumToStringA_Expr_Kind(node->kind));
+    }
   }
 
   if (node->lexpr != NULL) {
@@ -4476,15 +3750,12 @@ _fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lexpr");
+    _fingerprintLiteral(ctx, "lexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->lexpr, node, "lexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->lexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lexpr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4495,15 +3766,12 @@ _fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->name, node, "name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->name) == 1 && linitial(node->name) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->name) == 1 && linitial(node->name) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("name") - 1);
     XXH3_freeState(prev);
   }
   if (node->rexpr != NULL) {
@@ -4511,37 +3779,31 @@ _fingerprintA_Expr(FingerprintContext *ctx, const A_Expr *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rexpr");
+    _fingerprintLiteral(ctx, "rexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rexpr, node, "rexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rexpr, node, FINGERPRINT_FIELD_REXPR, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rexpr") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintTypeCast(FingerprintContext *ctx, const TypeCast *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTypeCast(FingerprintContext *ctx, const TypeCast *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4552,37 +3814,31 @@ _fingerprintTypeCast(FingerprintContext *ctx, const TypeCast *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4591,15 +3847,12 @@ _fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collname");
+    _fingerprintLiteral(ctx, "collname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->collname, node, "collname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collname) == 1 && linitial(node->collname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->collname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collname) == 1 && linitial(node->collname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collname") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -4607,28 +3860,27 @@ _fingerprintCollateClause(FingerprintContext *ctx, const CollateClause *node, co
 }
 
 static void
-_fingerprintRoleSpec(FingerprintContext *ctx, const RoleSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRoleSpec(FingerprintContext *ctx, const RoleSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->rolename != NULL) {
-    _fingerprintString(ctx, "rolename");
+    _fingerprintLiteral(ctx, "rolename");
     _fingerprintString(ctx, node->rolename);
   }
 
   if (true) {
-    _fingerprintString(ctx, "roletype");
+    _fingerprintLiteral(ctx, "roletype");
     _fingerprintString(ctx, _enumToStringRoleSpecType(node->roletype));
   }
 
 }
 
 static void
-_fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->agg_distinct) {
-    _fingerprintString(ctx, "agg_distinct");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "agg_distinct", "true");
   }
 
   if (node->agg_filter != NULL) {
@@ -4636,15 +3888,12 @@ _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "agg_filter");
+    _fingerprintLiteral(ctx, "agg_filter");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->agg_filter, node, "agg_filter", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->agg_filter, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("agg_filter") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4653,25 +3902,20 @@ _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "agg_order");
+    _fingerprintLiteral(ctx, "agg_order");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->agg_order, node, "agg_order", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->agg_order) == 1 && linitial(node->agg_order) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->agg_order, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->agg_order) == 1 && linitial(node->agg_order) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("agg_order") - 1);
     XXH3_freeState(prev);
   }
   if (node->agg_star) {
-    _fingerprintString(ctx, "agg_star");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "agg_star", "true");
   }
 
   if (node->agg_within_group) {
-    _fingerprintString(ctx, "agg_within_group");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "agg_within_group", "true");
   }
 
   if (node->args != NULL && node->args->length > 0) {
@@ -4679,24 +3923,20 @@ _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->func_variadic) {
-    _fingerprintString(ctx, "func_variadic");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "func_variadic", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "funcformat");
+    _fingerprintLiteral(ctx, "funcformat");
     _fingerprintString(ctx, _enumToStringCoercionForm(node->funcformat));
   }
 
@@ -4705,15 +3945,12 @@ _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcname");
+    _fingerprintLiteral(ctx, "funcname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funcname, node, "funcname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funcname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcname") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -4723,31 +3960,27 @@ _fingerprintFuncCall(FingerprintContext *ctx, const FuncCall *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "over");
+    _fingerprintLiteral(ctx, "over");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWindowDef(ctx, node->over, node, "over", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWindowDef(ctx, node->over, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("over") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintA_Star(FingerprintContext *ctx, const A_Star *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintA_Star(FingerprintContext *ctx, const A_Star *node, const void *parent, FingerprintField field, unsigned int depth)
 {
 }
 
 static void
-_fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->is_slice) {
-    _fingerprintString(ctx, "is_slice");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_slice", "true");
   }
 
   if (node->lidx != NULL) {
@@ -4755,15 +3988,12 @@ _fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lidx");
+    _fingerprintLiteral(ctx, "lidx");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->lidx, node, "lidx", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->lidx, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lidx") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4772,37 +4002,31 @@ _fingerprintA_Indices(FingerprintContext *ctx, const A_Indices *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "uidx");
+    _fingerprintLiteral(ctx, "uidx");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->uidx, node, "uidx", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->uidx, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("uidx") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintA_Indirection(FingerprintContext *ctx, const A_Indirection *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintA_Indirection(FingerprintContext *ctx, const A_Indirection *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -4811,36 +4035,30 @@ _fingerprintA_Indirection(FingerprintContext *ctx, const A_Indirection *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indirection");
+    _fingerprintLiteral(ctx, "indirection");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indirection, node, "indirection", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indirection, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indirection") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintA_ArrayExpr(FingerprintContext *ctx, const A_ArrayExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintA_ArrayExpr(FingerprintContext *ctx, const A_ArrayExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->elements != NULL && node->elements->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "elements");
+    _fingerprintLiteral(ctx, "elements");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->elements, node, "elements", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->elements) == 1 && linitial(node->elements) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->elements, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->elements) == 1 && linitial(node->elements) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("elements") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -4848,28 +4066,25 @@ _fingerprintA_ArrayExpr(FingerprintContext *ctx, const A_ArrayExpr *node, const
 }
 
 static void
-_fingerprintResTarget(FingerprintContext *ctx, const ResTarget *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintResTarget(FingerprintContext *ctx, const ResTarget *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->indirection != NULL && node->indirection->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indirection");
+    _fingerprintLiteral(ctx, "indirection");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indirection, node, "indirection", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indirection, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indirection") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
-  if (node->name != NULL && (field_name == NULL || parent == NULL || !IsA(parent, SelectStmt) || strcmp(field_name, "targetList") != 0)) {
-    _fingerprintString(ctx, "name");
+  if (node->name != NULL && (field != FINGERPRINT_FIELD_TARGET_LIST || parent == NULL || !IsA(parent, SelectStmt))) {
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -4878,35 +4093,28 @@ _fingerprintResTarget(FingerprintContext *ctx, const ResTarget *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "val");
+    _fingerprintLiteral(ctx, "val");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->val, node, "val", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->val, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("val") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintMultiAssignRef(FingerprintContext *ctx, const MultiAssignRef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMultiAssignRef(FingerprintContext *ctx, const MultiAssignRef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->colno != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->colno);
-    _fingerprintString(ctx, "colno");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "colno");
+    _fingerprintInt64(ctx, node->colno);
   }
 
   if (node->ncolumns != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->ncolumns);
-    _fingerprintString(ctx, "ncolumns");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "ncolumns");
+    _fingerprintInt64(ctx, node->ncolumns);
   }
 
   if (node->source != NULL) {
@@ -4914,22 +4122,19 @@ _fingerprintMultiAssignRef(FingerprintContext *ctx, const MultiAssignRef *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "source");
+    _fingerprintLiteral(ctx, "source");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->source, node, "source", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->source, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("source") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
@@ -4938,25 +4143,22 @@ _fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "node");
+    _fingerprintLiteral(ctx, "node");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->node, node, "node", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->node, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("node") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "sortby_dir");
+    _fingerprintLiteral(ctx, "sortby_dir");
     _fingerprintString(ctx, _enumToStringSortByDir(node->sortby_dir));
   }
 
   if (true) {
-    _fingerprintString(ctx, "sortby_nulls");
+    _fingerprintLiteral(ctx, "sortby_nulls");
     _fingerprintString(ctx, _enumToStringSortByNulls(node->sortby_nulls));
   }
 
@@ -4965,50 +4167,42 @@ _fingerprintSortBy(FingerprintContext *ctx, const SortBy *node, const void *pare
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "useOp");
+    _fingerprintLiteral(ctx, "useOp");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->useOp, node, "useOp", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->useOp) == 1 && linitial(node->useOp) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->useOp, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->useOp) == 1 && linitial(node->useOp) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("useOp") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->endOffset != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "endOffset");
+    _fingerprintLiteral(ctx, "endOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->endOffset, node, "endOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->endOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("endOffset") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->frameOptions != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->frameOptions);
-    _fingerprintString(ctx, "frameOptions");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "frameOptions");
+    _fingerprintInt64(ctx, node->frameOptions);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -5017,15 +4211,12 @@ _fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "orderClause");
+    _fingerprintLiteral(ctx, "orderClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->orderClause, node, "orderClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->orderClause) == 1 && linitial(node->orderClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->orderClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->orderClause) == 1 && linitial(node->orderClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("orderClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->partitionClause != NULL && node->partitionClause->length > 0) {
@@ -5033,19 +4224,16 @@ _fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "partitionClause");
+    _fingerprintLiteral(ctx, "partitionClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->partitionClause, node, "partitionClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partitionClause) == 1 && linitial(node->partitionClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->partitionClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partitionClause) == 1 && linitial(node->partitionClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("partitionClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->refname != NULL) {
-    _fingerprintString(ctx, "refname");
+    _fingerprintLiteral(ctx, "refname");
     _fingerprintString(ctx, node->refname);
   }
 
@@ -5054,43 +4242,36 @@ _fingerprintWindowDef(FingerprintContext *ctx, const WindowDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "startOffset");
+    _fingerprintLiteral(ctx, "startOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->startOffset, node, "startOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->startOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("startOffset") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRangeSubselect(FingerprintContext *ctx, const RangeSubselect *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeSubselect(FingerprintContext *ctx, const RangeSubselect *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->lateral) {
-    _fingerprintString(ctx, "lateral");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "lateral", "true");
   }
 
   if (node->subquery != NULL) {
@@ -5098,37 +4279,31 @@ _fingerprintRangeSubselect(FingerprintContext *ctx, const RangeSubselect *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "subquery");
+    _fingerprintLiteral(ctx, "subquery");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->subquery, node, "subquery", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->subquery, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("subquery") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
@@ -5137,15 +4312,12 @@ _fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coldeflist");
+    _fingerprintLiteral(ctx, "coldeflist");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coldeflist, node, "coldeflist", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldeflist) == 1 && linitial(node->coldeflist) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coldeflist, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldeflist) == 1 && linitial(node->coldeflist) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coldeflist") - 1);
     XXH3_freeState(prev);
   }
   if (node->functions != NULL && node->functions->length > 0) {
@@ -5153,51 +4325,42 @@ _fingerprintRangeFunction(FingerprintContext *ctx, const RangeFunction *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "functions");
+    _fingerprintLiteral(ctx, "functions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->functions, node, "functions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->functions) == 1 && linitial(node->functions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->functions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->functions) == 1 && linitial(node->functions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("functions") - 1);
     XXH3_freeState(prev);
   }
   if (node->is_rowsfrom) {
-    _fingerprintString(ctx, "is_rowsfrom");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_rowsfrom", "true");
   }
 
   if (node->lateral) {
-    _fingerprintString(ctx, "lateral");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "lateral", "true");
   }
 
   if (node->ordinality) {
-    _fingerprintString(ctx, "ordinality");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "ordinality", "true");
   }
 
 }
 
 static void
-_fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
@@ -5206,15 +4369,12 @@ _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "columns");
+    _fingerprintLiteral(ctx, "columns");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->columns, node, "columns", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->columns, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("columns") - 1);
     XXH3_freeState(prev);
   }
   if (node->docexpr != NULL) {
@@ -5222,21 +4382,17 @@ _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "docexpr");
+    _fingerprintLiteral(ctx, "docexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->docexpr, node, "docexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->docexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("docexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->lateral) {
-    _fingerprintString(ctx, "lateral");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "lateral", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -5246,15 +4402,12 @@ _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "namespaces");
+    _fingerprintLiteral(ctx, "namespaces");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->namespaces, node, "namespaces", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->namespaces) == 1 && linitial(node->namespaces) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->namespaces, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->namespaces) == 1 && linitial(node->namespaces) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("namespaces") - 1);
     XXH3_freeState(prev);
   }
   if (node->rowexpr != NULL) {
@@ -5262,37 +4415,31 @@ _fingerprintRangeTableFunc(FingerprintContext *ctx, const RangeTableFunc *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rowexpr");
+    _fingerprintLiteral(ctx, "rowexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rowexpr, node, "rowexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rowexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rowexpr") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->coldefexpr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coldefexpr");
+    _fingerprintLiteral(ctx, "coldefexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coldefexpr, node, "coldefexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coldefexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coldefexpr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -5301,31 +4448,26 @@ _fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colexpr");
+    _fingerprintLiteral(ctx, "colexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colexpr, node, "colexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->colname != NULL) {
-    _fingerprintString(ctx, "colname");
+    _fingerprintLiteral(ctx, "colname");
     _fingerprintString(ctx, node->colname);
   }
 
   if (node->for_ordinality) {
-    _fingerprintString(ctx, "for_ordinality");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "for_ordinality", "true");
   }
 
   if (node->is_not_null) {
-    _fingerprintString(ctx, "is_not_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_not_null", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -5335,37 +4477,31 @@ _fingerprintRangeTableFuncCol(FingerprintContext *ctx, const RangeTableFuncCol *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -5375,15 +4511,12 @@ _fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "method");
+    _fingerprintLiteral(ctx, "method");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->method, node, "method", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->method) == 1 && linitial(node->method) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->method, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->method) == 1 && linitial(node->method) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("method") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -5391,15 +4524,12 @@ _fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -5408,54 +4538,46 @@ _fingerprintRangeTableSample(FingerprintContext *ctx, const RangeTableSample *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "repeatable");
+    _fingerprintLiteral(ctx, "repeatable");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->repeatable, node, "repeatable", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->repeatable, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("repeatable") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collClause != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collClause");
+    _fingerprintLiteral(ctx, "collClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintCollateClause(ctx, node->collClause, node, "collClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintCollateClause(ctx, node->collClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collClause") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->collOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->collOid);
-    _fingerprintString(ctx, "collOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "collOid");
+    _fingerprintInt64(ctx, node->collOid);
   }
 
   if (node->colname != NULL) {
-    _fingerprintString(ctx, "colname");
+    _fingerprintLiteral(ctx, "colname");
     _fingerprintString(ctx, node->colname);
   }
 
   if (node->compression != NULL) {
-    _fingerprintString(ctx, "compression");
+    _fingerprintLiteral(ctx, "compression");
     _fingerprintString(ctx, node->compression);
   }
 
@@ -5464,15 +4586,12 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constraints");
+    _fingerprintLiteral(ctx, "constraints");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->constraints, node, "constraints", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->constraints, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constraints") - 1);
     XXH3_freeState(prev);
   }
   if (node->cooked_default != NULL) {
@@ -5480,15 +4599,12 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cooked_default");
+    _fingerprintLiteral(ctx, "cooked_default");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cooked_default, node, "cooked_default", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cooked_default, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cooked_default") - 1);
     XXH3_freeState(prev);
   }
 
@@ -5497,27 +4613,22 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fdwoptions");
+    _fingerprintLiteral(ctx, "fdwoptions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fdwoptions, node, "fdwoptions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fdwoptions) == 1 && linitial(node->fdwoptions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fdwoptions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fdwoptions) == 1 && linitial(node->fdwoptions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fdwoptions") - 1);
     XXH3_freeState(prev);
   }
   if (node->generated != 0) {
-    char buffer[2] = {node->generated, '\0'};
-    _fingerprintString(ctx, "generated");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "generated");
+    _fingerprintStringLen(ctx, &node->generated, 1);
   }
 
   if (node->identity != 0) {
-    char buffer[2] = {node->identity, '\0'};
-    _fingerprintString(ctx, "identity");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "identity");
+    _fingerprintStringLen(ctx, &node->identity, 1);
   }
 
   if (node->identitySequence != NULL) {
@@ -5525,38 +4636,30 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "identitySequence");
+    _fingerprintLiteral(ctx, "identitySequence");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->identitySequence, node, "identitySequence", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->identitySequence, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("identitySequence") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->inhcount != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inhcount);
-    _fingerprintString(ctx, "inhcount");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inhcount");
+    _fingerprintInt64(ctx, node->inhcount);
   }
 
   if (node->is_from_type) {
-    _fingerprintString(ctx, "is_from_type");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_from_type", "true");
   }
 
   if (node->is_local) {
-    _fingerprintString(ctx, "is_local");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_local", "true");
   }
 
   if (node->is_not_null) {
-    _fingerprintString(ctx, "is_not_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_not_null", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -5566,26 +4669,22 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "raw_default");
+    _fingerprintLiteral(ctx, "raw_default");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->raw_default, node, "raw_default", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->raw_default, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("raw_default") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->storage != 0) {
-    char buffer[2] = {node->storage, '\0'};
-    _fingerprintString(ctx, "storage");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "storage");
+    _fingerprintStringLen(ctx, &node->storage, 1);
   }
 
   if (node->storage_name != NULL) {
-    _fingerprintString(ctx, "storage_name");
+    _fingerprintLiteral(ctx, "storage_name");
     _fingerprintString(ctx, node->storage_name);
   }
 
@@ -5594,28 +4693,23 @@ _fingerprintColumnDef(FingerprintContext *ctx, const ColumnDef *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintTableLikeClause(FingerprintContext *ctx, const TableLikeClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTableLikeClause(FingerprintContext *ctx, const TableLikeClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->options);
-    _fingerprintString(ctx, "options");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "options");
+    _fingerprintInt64(ctx, node->options);
   }
 
   if (node->relation != NULL) {
@@ -5623,44 +4717,36 @@ _fingerprintTableLikeClause(FingerprintContext *ctx, const TableLikeClause *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->relationOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->relationOid);
-    _fingerprintString(ctx, "relationOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "relationOid");
+    _fingerprintInt64(ctx, node->relationOid);
   }
 
 }
 
 static void
-_fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collation != NULL && node->collation->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collation");
+    _fingerprintLiteral(ctx, "collation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->collation, node, "collation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collation) == 1 && linitial(node->collation) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->collation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collation) == 1 && linitial(node->collation) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collation") - 1);
     XXH3_freeState(prev);
   }
   if (node->expr != NULL) {
@@ -5668,30 +4754,27 @@ _fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->indexcolname != NULL) {
-    _fingerprintString(ctx, "indexcolname");
+    _fingerprintLiteral(ctx, "indexcolname");
     _fingerprintString(ctx, node->indexcolname);
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
   if (true) {
-    _fingerprintString(ctx, "nulls_ordering");
+    _fingerprintLiteral(ctx, "nulls_ordering");
     _fingerprintString(ctx, _enumToStringSortByNulls(node->nulls_ordering));
   }
 
@@ -5700,15 +4783,12 @@ _fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opclass");
+    _fingerprintLiteral(ctx, "opclass");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opclass, node, "opclass", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclass) == 1 && linitial(node->opclass) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opclass, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclass) == 1 && linitial(node->opclass) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opclass") - 1);
     XXH3_freeState(prev);
   }
   if (node->opclassopts != NULL && node->opclassopts->length > 0) {
@@ -5716,56 +4796,50 @@ _fingerprintIndexElem(FingerprintContext *ctx, const IndexElem *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opclassopts");
+    _fingerprintLiteral(ctx, "opclassopts");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opclassopts, node, "opclassopts", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclassopts) == 1 && linitial(node->opclassopts) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opclassopts, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclassopts) == 1 && linitial(node->opclassopts) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opclassopts") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "ordering");
+    _fingerprintLiteral(ctx, "ordering");
     _fingerprintString(ctx, _enumToStringSortByDir(node->ordering));
   }
 
 }
 
 static void
-_fingerprintDefElem(FingerprintContext *ctx, const DefElem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDefElem(FingerprintContext *ctx, const DefElem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->arg != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "defaction");
+    _fingerprintLiteral(ctx, "defaction");
     _fingerprintString(ctx, _enumToStringDefElemAction(node->defaction));
   }
 
   if (node->defname != NULL) {
-    _fingerprintString(ctx, "defname");
+    _fingerprintLiteral(ctx, "defname");
     _fingerprintString(ctx, node->defname);
   }
 
   if (node->defnamespace != NULL) {
-    _fingerprintString(ctx, "defnamespace");
+    _fingerprintLiteral(ctx, "defnamespace");
     _fingerprintString(ctx, node->defnamespace);
   }
 
@@ -5774,59 +4848,52 @@ _fingerprintDefElem(FingerprintContext *ctx, const DefElem *node, const void *pa
 }
 
 static void
-_fingerprintLockingClause(FingerprintContext *ctx, const LockingClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintLockingClause(FingerprintContext *ctx, const LockingClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->lockedRels != NULL && node->lockedRels->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lockedRels");
+    _fingerprintLiteral(ctx, "lockedRels");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->lockedRels, node, "lockedRels", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lockedRels) == 1 && linitial(node->lockedRels) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->lockedRels, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lockedRels) == 1 && linitial(node->lockedRels) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lockedRels") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "strength");
+    _fingerprintLiteral(ctx, "strength");
     _fingerprintString(ctx, _enumToStringLockClauseStrength(node->strength));
   }
 
   if (true) {
-    _fingerprintString(ctx, "waitPolicy");
+    _fingerprintLiteral(ctx, "waitPolicy");
     _fingerprintString(ctx, _enumToStringLockWaitPolicy(node->waitPolicy));
   }
 
 }
 
 static void
-_fingerprintXmlSerialize(FingerprintContext *ctx, const XmlSerialize *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintXmlSerialize(FingerprintContext *ctx, const XmlSerialize *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->indent) {
-    _fingerprintString(ctx, "indent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "indent", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -5836,42 +4903,36 @@ _fingerprintXmlSerialize(FingerprintContext *ctx, const XmlSerialize *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "xmloption");
+    _fingerprintLiteral(ctx, "xmloption");
     _fingerprintString(ctx, _enumToStringXmlOptionType(node->xmloption));
   }
 
 }
 
 static void
-_fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collation != NULL && node->collation->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collation");
+    _fingerprintLiteral(ctx, "collation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->collation, node, "collation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collation) == 1 && linitial(node->collation) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->collation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collation) == 1 && linitial(node->collation) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collation") - 1);
     XXH3_freeState(prev);
   }
   if (node->expr != NULL) {
@@ -5879,22 +4940,19 @@ _fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -5903,21 +4961,18 @@ _fingerprintPartitionElem(FingerprintContext *ctx, const PartitionElem *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opclass");
+    _fingerprintLiteral(ctx, "opclass");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opclass, node, "opclass", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclass) == 1 && linitial(node->opclass) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opclass, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclass) == 1 && linitial(node->opclass) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opclass") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintPartitionSpec(FingerprintContext *ctx, const PartitionSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPartitionSpec(FingerprintContext *ctx, const PartitionSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
@@ -5926,30 +4981,26 @@ _fingerprintPartitionSpec(FingerprintContext *ctx, const PartitionSpec *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "partParams");
+    _fingerprintLiteral(ctx, "partParams");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->partParams, node, "partParams", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partParams) == 1 && linitial(node->partParams) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->partParams, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partParams) == 1 && linitial(node->partParams) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("partParams") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "strategy");
+    _fingerprintLiteral(ctx, "strategy");
     _fingerprintString(ctx, _enumToStringPartitionStrategy(node->strategy));
   }
 
 }
 
 static void
-_fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->is_default) {
-    _fingerprintString(ctx, "is_default");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_default", "true");
   }
 
   if (node->listdatums != NULL && node->listdatums->length > 0) {
@@ -5957,15 +5008,12 @@ _fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "listdatums");
+    _fingerprintLiteral(ctx, "listdatums");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->listdatums, node, "listdatums", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->listdatums) == 1 && linitial(node->listdatums) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->listdatums, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->listdatums) == 1 && linitial(node->listdatums) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("listdatums") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -5975,35 +5023,27 @@ _fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lowerdatums");
+    _fingerprintLiteral(ctx, "lowerdatums");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->lowerdatums, node, "lowerdatums", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lowerdatums) == 1 && linitial(node->lowerdatums) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->lowerdatums, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lowerdatums) == 1 && linitial(node->lowerdatums) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lowerdatums") - 1);
     XXH3_freeState(prev);
   }
   if (node->modulus != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->modulus);
-    _fingerprintString(ctx, "modulus");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "modulus");
+    _fingerprintInt64(ctx, node->modulus);
   }
 
   if (node->remainder != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->remainder);
-    _fingerprintString(ctx, "remainder");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "remainder");
+    _fingerprintInt64(ctx, node->remainder);
   }
 
   if (node->strategy != 0) {
-    char buffer[2] = {node->strategy, '\0'};
-    _fingerprintString(ctx, "strategy");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "strategy");
+    _fingerprintStringLen(ctx, &node->strategy, 1);
   }
 
   if (node->upperdatums != NULL && node->upperdatums->length > 0) {
@@ -6011,24 +5051,21 @@ _fingerprintPartitionBoundSpec(FingerprintContext *ctx, const PartitionBoundSpec
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "upperdatums");
+    _fingerprintLiteral(ctx, "upperdatums");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->upperdatums, node, "upperdatums", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->upperdatums) == 1 && linitial(node->upperdatums) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->upperdatums, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->upperdatums) == 1 && linitial(node->upperdatums) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("upperdatums") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintPartitionRangeDatum(FingerprintContext *ctx, const PartitionRangeDatum *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPartitionRangeDatum(FingerprintContext *ctx, const PartitionRangeDatum *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringPartitionRangeDatumKind(node->kind));
   }
 
@@ -6039,48 +5076,41 @@ _fingerprintPartitionRangeDatum(FingerprintContext *ctx, const PartitionRangeDat
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "value");
+    _fingerprintLiteral(ctx, "value");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->value, node, "value", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->value, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("value") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintSinglePartitionSpec(FingerprintContext *ctx, const SinglePartitionSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSinglePartitionSpec(FingerprintContext *ctx, const SinglePartitionSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
 }
 
 static void
-_fingerprintPartitionCmd(FingerprintContext *ctx, const PartitionCmd *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPartitionCmd(FingerprintContext *ctx, const PartitionCmd *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->bound != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "bound");
+    _fingerprintLiteral(ctx, "bound");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintPartitionBoundSpec(ctx, node->bound, node, "bound", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintPartitionBoundSpec(ctx, node->bound, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("bound") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->concurrent) {
-    _fingerprintString(ctx, "concurrent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "concurrent", "true");
   }
 
   if (node->name != NULL) {
@@ -6088,37 +5118,31 @@ _fingerprintPartitionCmd(FingerprintContext *ctx, const PartitionCmd *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->name, node, "name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("name") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6127,15 +5151,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colcollations");
+    _fingerprintLiteral(ctx, "colcollations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colcollations, node, "colcollations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colcollations) == 1 && linitial(node->colcollations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colcollations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colcollations) == 1 && linitial(node->colcollations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colcollations") - 1);
     XXH3_freeState(prev);
   }
   if (node->coltypes != NULL && node->coltypes->length > 0) {
@@ -6143,15 +5164,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coltypes");
+    _fingerprintLiteral(ctx, "coltypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coltypes, node, "coltypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypes) == 1 && linitial(node->coltypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coltypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypes) == 1 && linitial(node->coltypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coltypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->coltypmods != NULL && node->coltypmods->length > 0) {
@@ -6159,38 +5177,33 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coltypmods");
+    _fingerprintLiteral(ctx, "coltypmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coltypmods, node, "coltypmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypmods) == 1 && linitial(node->coltypmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coltypmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coltypmods) == 1 && linitial(node->coltypmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coltypmods") - 1);
     XXH3_freeState(prev);
   }
   if (node->ctelevelsup != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->ctelevelsup);
-    _fingerprintString(ctx, "ctelevelsup");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "ctelevelsup");
+    _fingerprintInt64(ctx, node->ctelevelsup);
   }
 
   if (node->ctename != NULL) {
-    _fingerprintString(ctx, "ctename");
+    _fingerprintLiteral(ctx, "ctename");
     _fingerprintString(ctx, node->ctename);
   }
 
   if (node->enrname != NULL) {
-    _fingerprintString(ctx, "enrname");
+    _fingerprintLiteral(ctx, "enrname");
     _fingerprintString(ctx, node->enrname);
   }
 
   if (node->enrtuples != 0) {
     char buffer[50];
     sprintf(buffer, "%f", node->enrtuples);
-    _fingerprintString(ctx, "enrtuples");
+    _fingerprintLiteral(ctx, "enrtuples");
     _fingerprintString(ctx, buffer);
   }
 
@@ -6199,21 +5212,17 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "eref");
+    _fingerprintLiteral(ctx, "eref");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->eref, node, "eref", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->eref, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("eref") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->funcordinality) {
-    _fingerprintString(ctx, "funcordinality");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "funcordinality", "true");
   }
 
   if (node->functions != NULL && node->functions->length > 0) {
@@ -6221,25 +5230,20 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "functions");
+    _fingerprintLiteral(ctx, "functions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->functions, node, "functions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->functions) == 1 && linitial(node->functions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->functions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->functions) == 1 && linitial(node->functions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("functions") - 1);
     XXH3_freeState(prev);
   }
   if (node->inFromCl) {
-    _fingerprintString(ctx, "inFromCl");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inFromCl", "true");
   }
 
   if (node->inh) {
-    _fingerprintString(ctx, "inh");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inh", "true");
   }
 
   if (node->join_using_alias != NULL) {
@@ -6247,15 +5251,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "join_using_alias");
+    _fingerprintLiteral(ctx, "join_using_alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->join_using_alias, node, "join_using_alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->join_using_alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("join_using_alias") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6264,15 +5265,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "joinaliasvars");
+    _fingerprintLiteral(ctx, "joinaliasvars");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->joinaliasvars, node, "joinaliasvars", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinaliasvars) == 1 && linitial(node->joinaliasvars) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->joinaliasvars, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinaliasvars) == 1 && linitial(node->joinaliasvars) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("joinaliasvars") - 1);
     XXH3_freeState(prev);
   }
   if (node->joinleftcols != NULL && node->joinleftcols->length > 0) {
@@ -6280,22 +5278,17 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "joinleftcols");
+    _fingerprintLiteral(ctx, "joinleftcols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->joinleftcols, node, "joinleftcols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinleftcols) == 1 && linitial(node->joinleftcols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->joinleftcols, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinleftcols) == 1 && linitial(node->joinleftcols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("joinleftcols") - 1);
     XXH3_freeState(prev);
   }
   if (node->joinmergedcols != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->joinmergedcols);
-    _fingerprintString(ctx, "joinmergedcols");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "joinmergedcols");
+    _fingerprintInt64(ctx, node->joinmergedcols);
   }
 
   if (node->joinrightcols != NULL && node->joinrightcols->length > 0) {
@@ -6303,56 +5296,45 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "joinrightcols");
+    _fingerprintLiteral(ctx, "joinrightcols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->joinrightcols, node, "joinrightcols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinrightcols) == 1 && linitial(node->joinrightcols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->joinrightcols, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->joinrightcols) == 1 && linitial(node->joinrightcols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("joinrightcols") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "jointype");
+    _fingerprintLiteral(ctx, "jointype");
     _fingerprintString(ctx, _enumToStringJoinType(node->jointype));
   }
 
   if (node->lateral) {
-    _fingerprintString(ctx, "lateral");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "lateral", "true");
   }
 
   if (node->perminfoindex != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->perminfoindex);
-    _fingerprintString(ctx, "perminfoindex");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "perminfoindex");
+    _fingerprintInt64(ctx, node->perminfoindex);
   }
 
   if (node->relid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->relid);
-    _fingerprintString(ctx, "relid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "relid");
+    _fingerprintInt64(ctx, node->relid);
   }
 
   if (node->relkind != 0) {
-    char buffer[2] = {node->relkind, '\0'};
-    _fingerprintString(ctx, "relkind");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "relkind");
+    _fingerprintStringLen(ctx, &node->relkind, 1);
   }
 
   if (node->rellockmode != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->rellockmode);
-    _fingerprintString(ctx, "rellockmode");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "rellockmode");
+    _fingerprintInt64(ctx, node->rellockmode);
   }
 
   if (true) {
-    _fingerprintString(ctx, "rtekind");
+    _fingerprintLiteral(ctx, "rtekind");
     _fingerprintString(ctx, _enumToStringRTEKind(node->rtekind));
   }
 
@@ -6361,25 +5343,20 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "securityQuals");
+    _fingerprintLiteral(ctx, "securityQuals");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->securityQuals, node, "securityQuals", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->securityQuals) == 1 && linitial(node->securityQuals) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->securityQuals, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->securityQuals) == 1 && linitial(node->securityQuals) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("securityQuals") - 1);
     XXH3_freeState(prev);
   }
   if (node->security_barrier) {
-    _fingerprintString(ctx, "security_barrier");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "security_barrier", "true");
   }
 
   if (node->self_reference) {
-    _fingerprintString(ctx, "self_reference");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "self_reference", "true");
   }
 
   if (node->subquery != NULL) {
@@ -6387,15 +5364,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "subquery");
+    _fingerprintLiteral(ctx, "subquery");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintQuery(ctx, node->subquery, node, "subquery", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintQuery(ctx, node->subquery, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("subquery") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6404,15 +5378,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "tablefunc");
+    _fingerprintLiteral(ctx, "tablefunc");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTableFunc(ctx, node->tablefunc, node, "tablefunc", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTableFunc(ctx, node->tablefunc, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("tablefunc") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6421,15 +5392,12 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "tablesample");
+    _fingerprintLiteral(ctx, "tablesample");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTableSampleClause(ctx, node->tablesample, node, "tablesample", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTableSampleClause(ctx, node->tablesample, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("tablesample") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6438,73 +5406,59 @@ _fingerprintRangeTblEntry(FingerprintContext *ctx, const RangeTblEntry *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "values_lists");
+    _fingerprintLiteral(ctx, "values_lists");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->values_lists, node, "values_lists", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->values_lists) == 1 && linitial(node->values_lists) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->values_lists, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->values_lists) == 1 && linitial(node->values_lists) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("values_lists") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->checkAsUser != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->checkAsUser);
-    _fingerprintString(ctx, "checkAsUser");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "checkAsUser");
+    _fingerprintInt64(ctx, node->checkAsUser);
   }
 
   if (node->inh) {
-    _fingerprintString(ctx, "inh");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inh", "true");
   }
 
   if (true) {
     int x = -1;
     Bitmapset	*bms = bms_copy(node->insertedCols);
 
-    _fingerprintString(ctx, "insertedCols");
+    _fingerprintLiteral(ctx, "insertedCols");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
   }
 
   if (node->relid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->relid);
-    _fingerprintString(ctx, "relid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "relid");
+    _fingerprintInt64(ctx, node->relid);
   }
 
   if (node->requiredPerms != 0) {
-    char buffer[50];
-    sprintf(buffer, UINT64_FORMAT, node->requiredPerms);
-    _fingerprintString(ctx, "requiredPerms");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "requiredPerms");
+    _fingerprintUInt64(ctx, node->requiredPerms);
   }
 
   if (true) {
     int x = -1;
     Bitmapset	*bms = bms_copy(node->selectedCols);
 
-    _fingerprintString(ctx, "selectedCols");
+    _fingerprintLiteral(ctx, "selectedCols");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
@@ -6514,12 +5468,10 @@ _fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *
     int x = -1;
     Bitmapset	*bms = bms_copy(node->updatedCols);
 
-    _fingerprintString(ctx, "updatedCols");
+    _fingerprintLiteral(ctx, "updatedCols");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
@@ -6528,29 +5480,24 @@ _fingerprintRTEPermissionInfo(FingerprintContext *ctx, const RTEPermissionInfo *
 }
 
 static void
-_fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->funccolcollations != NULL && node->funccolcollations->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funccolcollations");
+    _fingerprintLiteral(ctx, "funccolcollations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funccolcollations, node, "funccolcollations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccolcollations) == 1 && linitial(node->funccolcollations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funccolcollations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccolcollations) == 1 && linitial(node->funccolcollations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funccolcollations") - 1);
     XXH3_freeState(prev);
   }
   if (node->funccolcount != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->funccolcount);
-    _fingerprintString(ctx, "funccolcount");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "funccolcount");
+    _fingerprintInt64(ctx, node->funccolcount);
   }
 
   if (node->funccolnames != NULL && node->funccolnames->length > 0) {
@@ -6558,15 +5505,12 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funccolnames");
+    _fingerprintLiteral(ctx, "funccolnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funccolnames, node, "funccolnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccolnames) == 1 && linitial(node->funccolnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funccolnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccolnames) == 1 && linitial(node->funccolnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funccolnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->funccoltypes != NULL && node->funccoltypes->length > 0) {
@@ -6574,15 +5518,12 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funccoltypes");
+    _fingerprintLiteral(ctx, "funccoltypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funccoltypes, node, "funccoltypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccoltypes) == 1 && linitial(node->funccoltypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funccoltypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccoltypes) == 1 && linitial(node->funccoltypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funccoltypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->funccoltypmods != NULL && node->funccoltypmods->length > 0) {
@@ -6590,15 +5531,12 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funccoltypmods");
+    _fingerprintLiteral(ctx, "funccoltypmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funccoltypmods, node, "funccoltypmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccoltypmods) == 1 && linitial(node->funccoltypmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funccoltypmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funccoltypmods) == 1 && linitial(node->funccoltypmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funccoltypmods") - 1);
     XXH3_freeState(prev);
   }
   if (node->funcexpr != NULL) {
@@ -6606,15 +5544,12 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcexpr");
+    _fingerprintLiteral(ctx, "funcexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funcexpr, node, "funcexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funcexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcexpr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -6622,12 +5557,10 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
     int x = -1;
     Bitmapset	*bms = bms_copy(node->funcparams);
 
-    _fingerprintString(ctx, "funcparams");
+    _fingerprintLiteral(ctx, "funcparams");
 
   	while ((x = bms_next_member(bms, x)) >= 0) {
-      char buffer[50];
-      sprintf(buffer, "%d", x);
-      _fingerprintString(ctx, buffer);
+      _fingerprintInt64(ctx, x);
     }
 
     bms_free(bms);
@@ -6636,22 +5569,19 @@ _fingerprintRangeTblFunction(FingerprintContext *ctx, const RangeTblFunction *no
 }
 
 static void
-_fingerprintTableSampleClause(FingerprintContext *ctx, const TableSampleClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTableSampleClause(FingerprintContext *ctx, const TableSampleClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->repeatable != NULL) {
@@ -6659,42 +5589,36 @@ _fingerprintTableSampleClause(FingerprintContext *ctx, const TableSampleClause *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "repeatable");
+    _fingerprintLiteral(ctx, "repeatable");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->repeatable, node, "repeatable", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->repeatable, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("repeatable") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->tsmhandler != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->tsmhandler);
-    _fingerprintString(ctx, "tsmhandler");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "tsmhandler");
+    _fingerprintInt64(ctx, node->tsmhandler);
   }
 
 }
 
 static void
-_fingerprintWithCheckOption(FingerprintContext *ctx, const WithCheckOption *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWithCheckOption(FingerprintContext *ctx, const WithCheckOption *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cascaded) {
-    _fingerprintString(ctx, "cascaded");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "cascaded", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringWCOKind(node->kind));
   }
 
   if (node->polname != NULL) {
-    _fingerprintString(ctx, "polname");
+    _fingerprintLiteral(ctx, "polname");
     _fingerprintString(ctx, node->polname);
   }
 
@@ -6703,82 +5627,68 @@ _fingerprintWithCheckOption(FingerprintContext *ctx, const WithCheckOption *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "qual");
+    _fingerprintLiteral(ctx, "qual");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->qual, node, "qual", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->qual, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("qual") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->relname != NULL) {
-    _fingerprintString(ctx, "relname");
+    _fingerprintLiteral(ctx, "relname");
     _fingerprintString(ctx, node->relname);
   }
 
 }
 
 static void
-_fingerprintSortGroupClause(FingerprintContext *ctx, const SortGroupClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSortGroupClause(FingerprintContext *ctx, const SortGroupClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->eqop != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->eqop);
-    _fingerprintString(ctx, "eqop");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "eqop");
+    _fingerprintInt64(ctx, node->eqop);
   }
 
   if (node->hashable) {
-    _fingerprintString(ctx, "hashable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "hashable", "true");
   }
 
   if (node->nulls_first) {
-    _fingerprintString(ctx, "nulls_first");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "nulls_first", "true");
   }
 
   if (node->sortop != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->sortop);
-    _fingerprintString(ctx, "sortop");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "sortop");
+    _fingerprintInt64(ctx, node->sortop);
   }
 
   if (node->tleSortGroupRef != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->tleSortGroupRef);
-    _fingerprintString(ctx, "tleSortGroupRef");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "tleSortGroupRef");
+    _fingerprintInt64(ctx, node->tleSortGroupRef);
   }
 
 }
 
 static void
-_fingerprintGroupingSet(FingerprintContext *ctx, const GroupingSet *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintGroupingSet(FingerprintContext *ctx, const GroupingSet *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->content != NULL && node->content->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "content");
+    _fingerprintLiteral(ctx, "content");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->content, node, "content", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->content) == 1 && linitial(node->content) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->content, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->content) == 1 && linitial(node->content) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("content") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringGroupingSetKind(node->kind));
   }
 
@@ -6787,18 +5697,15 @@ _fingerprintGroupingSet(FingerprintContext *ctx, const GroupingSet *node, const
 }
 
 static void
-_fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->copiedOrder) {
-    _fingerprintString(ctx, "copiedOrder");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "copiedOrder", "true");
   }
 
   if (node->endInRangeFunc != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->endInRangeFunc);
-    _fingerprintString(ctx, "endInRangeFunc");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "endInRangeFunc");
+    _fingerprintInt64(ctx, node->endInRangeFunc);
   }
 
   if (node->endOffset != NULL) {
@@ -6806,44 +5713,35 @@ _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "endOffset");
+    _fingerprintLiteral(ctx, "endOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->endOffset, node, "endOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->endOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("endOffset") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->frameOptions != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->frameOptions);
-    _fingerprintString(ctx, "frameOptions");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "frameOptions");
+    _fingerprintInt64(ctx, node->frameOptions);
   }
 
   if (node->inRangeAsc) {
-    _fingerprintString(ctx, "inRangeAsc");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inRangeAsc", "true");
   }
 
   if (node->inRangeColl != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inRangeColl);
-    _fingerprintString(ctx, "inRangeColl");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inRangeColl");
+    _fingerprintInt64(ctx, node->inRangeColl);
   }
 
   if (node->inRangeNullsFirst) {
-    _fingerprintString(ctx, "inRangeNullsFirst");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inRangeNullsFirst", "true");
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -6852,15 +5750,12 @@ _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "orderClause");
+    _fingerprintLiteral(ctx, "orderClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->orderClause, node, "orderClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->orderClause) == 1 && linitial(node->orderClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->orderClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->orderClause) == 1 && linitial(node->orderClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("orderClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->partitionClause != NULL && node->partitionClause->length > 0) {
@@ -6868,27 +5763,22 @@ _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "partitionClause");
+    _fingerprintLiteral(ctx, "partitionClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->partitionClause, node, "partitionClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partitionClause) == 1 && linitial(node->partitionClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->partitionClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->partitionClause) == 1 && linitial(node->partitionClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("partitionClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->refname != NULL) {
-    _fingerprintString(ctx, "refname");
+    _fingerprintLiteral(ctx, "refname");
     _fingerprintString(ctx, node->refname);
   }
 
   if (node->startInRangeFunc != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->startInRangeFunc);
-    _fingerprintString(ctx, "startInRangeFunc");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "startInRangeFunc");
+    _fingerprintInt64(ctx, node->startInRangeFunc);
   }
 
   if (node->startOffset != NULL) {
@@ -6896,87 +5786,75 @@ _fingerprintWindowClause(FingerprintContext *ctx, const WindowClause *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "startOffset");
+    _fingerprintLiteral(ctx, "startOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->startOffset, node, "startOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->startOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("startOffset") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->winref != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->winref);
-    _fingerprintString(ctx, "winref");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "winref");
+    _fingerprintInt64(ctx, node->winref);
   }
 
 }
 
 static void
-_fingerprintRowMarkClause(FingerprintContext *ctx, const RowMarkClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRowMarkClause(FingerprintContext *ctx, const RowMarkClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->pushedDown) {
-    _fingerprintString(ctx, "pushedDown");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "pushedDown", "true");
   }
 
   if (node->rti != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->rti);
-    _fingerprintString(ctx, "rti");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "rti");
+    _fingerprintInt64(ctx, node->rti);
   }
 
   if (true) {
-    _fingerprintString(ctx, "strength");
+    _fingerprintLiteral(ctx, "strength");
     _fingerprintString(ctx, _enumToStringLockClauseStrength(node->strength));
   }
 
   if (true) {
-    _fingerprintString(ctx, "waitPolicy");
+    _fingerprintLiteral(ctx, "waitPolicy");
     _fingerprintString(ctx, _enumToStringLockWaitPolicy(node->waitPolicy));
   }
 
 }
 
 static void
-_fingerprintWithClause(FingerprintContext *ctx, const WithClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintWithClause(FingerprintContext *ctx, const WithClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->ctes != NULL && node->ctes->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctes");
+    _fingerprintLiteral(ctx, "ctes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctes, node, "ctes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctes) == 1 && linitial(node->ctes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctes) == 1 && linitial(node->ctes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctes") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->recursive) {
-    _fingerprintString(ctx, "recursive");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "recursive", "true");
   }
 
 }
 
 static void
-_fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->conname != NULL) {
-    _fingerprintString(ctx, "conname");
+    _fingerprintLiteral(ctx, "conname");
     _fingerprintString(ctx, node->conname);
   }
 
@@ -6985,15 +5863,12 @@ _fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indexElems");
+    _fingerprintLiteral(ctx, "indexElems");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indexElems, node, "indexElems", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexElems) == 1 && linitial(node->indexElems) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indexElems, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexElems) == 1 && linitial(node->indexElems) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indexElems") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -7003,25 +5878,22 @@ _fingerprintInferClause(FingerprintContext *ctx, const InferClause *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "action");
+    _fingerprintLiteral(ctx, "action");
     _fingerprintString(ctx, _enumToStringOnConflictAction(node->action));
   }
 
@@ -7030,15 +5902,12 @@ _fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "infer");
+    _fingerprintLiteral(ctx, "infer");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintInferClause(ctx, node->infer, node, "infer", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintInferClause(ctx, node->infer, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("infer") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7049,15 +5918,12 @@ _fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->whereClause != NULL) {
@@ -7065,28 +5931,24 @@ _fingerprintOnConflictClause(FingerprintContext *ctx, const OnConflictClause *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCTESearchClause(FingerprintContext *ctx, const CTESearchClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCTESearchClause(FingerprintContext *ctx, const CTESearchClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->search_breadth_first) {
-    _fingerprintString(ctx, "search_breadth_first");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "search_breadth_first", "true");
   }
 
   if (node->search_col_list != NULL && node->search_col_list->length > 0) {
@@ -7094,52 +5956,44 @@ _fingerprintCTESearchClause(FingerprintContext *ctx, const CTESearchClause *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "search_col_list");
+    _fingerprintLiteral(ctx, "search_col_list");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->search_col_list, node, "search_col_list", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->search_col_list) == 1 && linitial(node->search_col_list) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->search_col_list, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->search_col_list) == 1 && linitial(node->search_col_list) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("search_col_list") - 1);
     XXH3_freeState(prev);
   }
   if (node->search_seq_column != NULL) {
-    _fingerprintString(ctx, "search_seq_column");
+    _fingerprintLiteral(ctx, "search_seq_column");
     _fingerprintString(ctx, node->search_seq_column);
   }
 
 }
 
 static void
-_fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cycle_col_list != NULL && node->cycle_col_list->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cycle_col_list");
+    _fingerprintLiteral(ctx, "cycle_col_list");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cycle_col_list, node, "cycle_col_list", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cycle_col_list) == 1 && linitial(node->cycle_col_list) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cycle_col_list, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cycle_col_list) == 1 && linitial(node->cycle_col_list) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cycle_col_list") - 1);
     XXH3_freeState(prev);
   }
   if (node->cycle_mark_collation != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cycle_mark_collation);
-    _fingerprintString(ctx, "cycle_mark_collation");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cycle_mark_collation");
+    _fingerprintInt64(ctx, node->cycle_mark_collation);
   }
 
   if (node->cycle_mark_column != NULL) {
-    _fingerprintString(ctx, "cycle_mark_column");
+    _fingerprintLiteral(ctx, "cycle_mark_column");
     _fingerprintString(ctx, node->cycle_mark_column);
   }
 
@@ -7148,37 +6002,28 @@ _fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cycle_mark_default");
+    _fingerprintLiteral(ctx, "cycle_mark_default");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cycle_mark_default, node, "cycle_mark_default", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cycle_mark_default, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cycle_mark_default") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->cycle_mark_neop != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cycle_mark_neop);
-    _fingerprintString(ctx, "cycle_mark_neop");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cycle_mark_neop");
+    _fingerprintInt64(ctx, node->cycle_mark_neop);
   }
 
   if (node->cycle_mark_type != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cycle_mark_type);
-    _fingerprintString(ctx, "cycle_mark_type");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cycle_mark_type");
+    _fingerprintInt64(ctx, node->cycle_mark_type);
   }
 
   if (node->cycle_mark_typmod != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cycle_mark_typmod);
-    _fingerprintString(ctx, "cycle_mark_typmod");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cycle_mark_typmod");
+    _fingerprintInt64(ctx, node->cycle_mark_typmod);
   }
 
   if (node->cycle_mark_value != NULL) {
@@ -7186,20 +6031,17 @@ _fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cycle_mark_value");
+    _fingerprintLiteral(ctx, "cycle_mark_value");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cycle_mark_value, node, "cycle_mark_value", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cycle_mark_value, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cycle_mark_value") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->cycle_path_column != NULL) {
-    _fingerprintString(ctx, "cycle_path_column");
+    _fingerprintLiteral(ctx, "cycle_path_column");
     _fingerprintString(ctx, node->cycle_path_column);
   }
 
@@ -7208,22 +6050,19 @@ _fingerprintCTECycleClause(FingerprintContext *ctx, const CTECycleClause *node,
 }
 
 static void
-_fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->aliascolnames != NULL && node->aliascolnames->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aliascolnames");
+    _fingerprintLiteral(ctx, "aliascolnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aliascolnames, node, "aliascolnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aliascolnames) == 1 && linitial(node->aliascolnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aliascolnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aliascolnames) == 1 && linitial(node->aliascolnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aliascolnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->ctecolcollations != NULL && node->ctecolcollations->length > 0) {
@@ -7231,15 +6070,12 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctecolcollations");
+    _fingerprintLiteral(ctx, "ctecolcollations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctecolcollations, node, "ctecolcollations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecolcollations) == 1 && linitial(node->ctecolcollations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctecolcollations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecolcollations) == 1 && linitial(node->ctecolcollations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctecolcollations") - 1);
     XXH3_freeState(prev);
   }
   if (node->ctecolnames != NULL && node->ctecolnames->length > 0) {
@@ -7247,15 +6083,12 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctecolnames");
+    _fingerprintLiteral(ctx, "ctecolnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctecolnames, node, "ctecolnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecolnames) == 1 && linitial(node->ctecolnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctecolnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecolnames) == 1 && linitial(node->ctecolnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctecolnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->ctecoltypes != NULL && node->ctecoltypes->length > 0) {
@@ -7263,15 +6096,12 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctecoltypes");
+    _fingerprintLiteral(ctx, "ctecoltypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctecoltypes, node, "ctecoltypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecoltypes) == 1 && linitial(node->ctecoltypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctecoltypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecoltypes) == 1 && linitial(node->ctecoltypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctecoltypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->ctecoltypmods != NULL && node->ctecoltypmods->length > 0) {
@@ -7279,24 +6109,21 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctecoltypmods");
+    _fingerprintLiteral(ctx, "ctecoltypmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctecoltypmods, node, "ctecoltypmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecoltypmods) == 1 && linitial(node->ctecoltypmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctecoltypmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->ctecoltypmods) == 1 && linitial(node->ctecoltypmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctecoltypmods") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "ctematerialized");
+    _fingerprintLiteral(ctx, "ctematerialized");
     _fingerprintString(ctx, _enumToStringCTEMaterialize(node->ctematerialized));
   }
 
   if (node->ctename != NULL) {
-    _fingerprintString(ctx, "ctename");
+    _fingerprintLiteral(ctx, "ctename");
     _fingerprintString(ctx, node->ctename);
   }
 
@@ -7305,28 +6132,22 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ctequery");
+    _fingerprintLiteral(ctx, "ctequery");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->ctequery, node, "ctequery", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->ctequery, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ctequery") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->cterecursive) {
-    _fingerprintString(ctx, "cterecursive");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "cterecursive", "true");
   }
 
   if (node->cterefcount != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->cterefcount);
-    _fingerprintString(ctx, "cterefcount");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "cterefcount");
+    _fingerprintInt64(ctx, node->cterefcount);
   }
 
   if (node->cycle_clause != NULL) {
@@ -7334,15 +6155,12 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cycle_clause");
+    _fingerprintLiteral(ctx, "cycle_clause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintCTECycleClause(ctx, node->cycle_clause, node, "cycle_clause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintCTECycleClause(ctx, node->cycle_clause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cycle_clause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7353,25 +6171,22 @@ _fingerprintCommonTableExpr(FingerprintContext *ctx, const CommonTableExpr *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "search_clause");
+    _fingerprintLiteral(ctx, "search_clause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintCTESearchClause(ctx, node->search_clause, node, "search_clause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintCTESearchClause(ctx, node->search_clause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("search_clause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "commandType");
+    _fingerprintLiteral(ctx, "commandType");
     _fingerprintString(ctx, _enumToStringCmdType(node->commandType));
   }
 
@@ -7380,25 +6195,22 @@ _fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "condition");
+    _fingerprintLiteral(ctx, "condition");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->condition, node, "condition", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->condition, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("condition") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "matchKind");
+    _fingerprintLiteral(ctx, "matchKind");
     _fingerprintString(ctx, _enumToStringMergeMatchKind(node->matchKind));
   }
 
   if (true) {
-    _fingerprintString(ctx, "override");
+    _fingerprintLiteral(ctx, "override");
     _fingerprintString(ctx, _enumToStringOverridingKind(node->override));
   }
 
@@ -7407,15 +6219,12 @@ _fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->values != NULL && node->values->length > 0) {
@@ -7423,56 +6232,48 @@ _fingerprintMergeWhenClause(FingerprintContext *ctx, const MergeWhenClause *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "values");
+    _fingerprintLiteral(ctx, "values");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->values, node, "values", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->values) == 1 && linitial(node->values) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->values, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->values) == 1 && linitial(node->values) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("values") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintTriggerTransition(FingerprintContext *ctx, const TriggerTransition *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTriggerTransition(FingerprintContext *ctx, const TriggerTransition *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->isNew) {
-    _fingerprintString(ctx, "isNew");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isNew", "true");
   }
 
   if (node->isTable) {
-    _fingerprintString(ctx, "isTable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isTable", "true");
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintJsonOutput(FingerprintContext *ctx, const JsonOutput *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonOutput(FingerprintContext *ctx, const JsonOutput *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->returning != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returning");
+    _fingerprintLiteral(ctx, "returning");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonReturning(ctx, node->returning, node, "returning", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonReturning(ctx, node->returning, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returning") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7481,25 +6282,22 @@ _fingerprintJsonOutput(FingerprintContext *ctx, const JsonOutput *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonArgument(FingerprintContext *ctx, const JsonArgument *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonArgument(FingerprintContext *ctx, const JsonArgument *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -7508,25 +6306,22 @@ _fingerprintJsonArgument(FingerprintContext *ctx, const JsonArgument *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "val");
+    _fingerprintLiteral(ctx, "val");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->val, node, "val", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->val, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("val") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->column_name != NULL) {
-    _fingerprintString(ctx, "column_name");
+    _fingerprintLiteral(ctx, "column_name");
     _fingerprintString(ctx, node->column_name);
   }
 
@@ -7535,15 +6330,12 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "context_item");
+    _fingerprintLiteral(ctx, "context_item");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->context_item, node, "context_item", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->context_item, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("context_item") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7554,15 +6346,12 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_empty");
+    _fingerprintLiteral(ctx, "on_empty");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_empty, node, "on_empty", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_empty, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_empty") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7571,20 +6360,17 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_error");
+    _fingerprintLiteral(ctx, "on_error");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_error, node, "on_error", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_error, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_error") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringJsonExprOp(node->op));
   }
 
@@ -7593,15 +6379,12 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7610,15 +6393,12 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "passing");
+    _fingerprintLiteral(ctx, "passing");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->passing, node, "passing", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing) == 1 && linitial(node->passing) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->passing, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing) == 1 && linitial(node->passing) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("passing") - 1);
     XXH3_freeState(prev);
   }
   if (node->pathspec != NULL) {
@@ -7626,37 +6406,34 @@ _fingerprintJsonFuncExpr(FingerprintContext *ctx, const JsonFuncExpr *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pathspec");
+    _fingerprintLiteral(ctx, "pathspec");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->pathspec, node, "pathspec", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->pathspec, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pathspec") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "quotes");
+    _fingerprintLiteral(ctx, "quotes");
     _fingerprintString(ctx, _enumToStringJsonQuotes(node->quotes));
   }
 
   if (true) {
-    _fingerprintString(ctx, "wrapper");
+    _fingerprintLiteral(ctx, "wrapper");
     _fingerprintString(ctx, _enumToStringJsonWrapper(node->wrapper));
   }
 
 }
 
 static void
-_fingerprintJsonTablePathSpec(FingerprintContext *ctx, const JsonTablePathSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTablePathSpec(FingerprintContext *ctx, const JsonTablePathSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -7667,37 +6444,31 @@ _fingerprintJsonTablePathSpec(FingerprintContext *ctx, const JsonTablePathSpec *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "string");
+    _fingerprintLiteral(ctx, "string");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->string, node, "string", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->string, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("string") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->alias != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "alias");
+    _fingerprintLiteral(ctx, "alias");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintAlias(ctx, node->alias, node, "alias", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintAlias(ctx, node->alias, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("alias") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7706,15 +6477,12 @@ _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "columns");
+    _fingerprintLiteral(ctx, "columns");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->columns, node, "columns", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->columns, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("columns") - 1);
     XXH3_freeState(prev);
   }
   if (node->context_item != NULL) {
@@ -7722,21 +6490,17 @@ _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "context_item");
+    _fingerprintLiteral(ctx, "context_item");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->context_item, node, "context_item", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->context_item, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("context_item") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->lateral) {
-    _fingerprintString(ctx, "lateral");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "lateral", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -7746,15 +6510,12 @@ _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_error");
+    _fingerprintLiteral(ctx, "on_error");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_error, node, "on_error", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_error, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_error") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7763,15 +6524,12 @@ _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "passing");
+    _fingerprintLiteral(ctx, "passing");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->passing, node, "passing", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing) == 1 && linitial(node->passing) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->passing, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->passing) == 1 && linitial(node->passing) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("passing") - 1);
     XXH3_freeState(prev);
   }
   if (node->pathspec != NULL) {
@@ -7779,25 +6537,22 @@ _fingerprintJsonTable(FingerprintContext *ctx, const JsonTable *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pathspec");
+    _fingerprintLiteral(ctx, "pathspec");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonTablePathSpec(ctx, node->pathspec, node, "pathspec", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonTablePathSpec(ctx, node->pathspec, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pathspec") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "coltype");
+    _fingerprintLiteral(ctx, "coltype");
     _fingerprintString(ctx, _enumToStringJsonTableColumnType(node->coltype));
   }
 
@@ -7806,15 +6561,12 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "columns");
+    _fingerprintLiteral(ctx, "columns");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->columns, node, "columns", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->columns, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("columns") - 1);
     XXH3_freeState(prev);
   }
   if (node->format != NULL) {
@@ -7822,22 +6574,19 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -7846,15 +6595,12 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_empty");
+    _fingerprintLiteral(ctx, "on_empty");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_empty, node, "on_empty", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_empty, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_empty") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7863,15 +6609,12 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "on_error");
+    _fingerprintLiteral(ctx, "on_error");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonBehavior(ctx, node->on_error, node, "on_error", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonBehavior(ctx, node->on_error, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("on_error") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7880,20 +6623,17 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pathspec");
+    _fingerprintLiteral(ctx, "pathspec");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonTablePathSpec(ctx, node->pathspec, node, "pathspec", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonTablePathSpec(ctx, node->pathspec, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pathspec") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "quotes");
+    _fingerprintLiteral(ctx, "quotes");
     _fingerprintString(ctx, _enumToStringJsonQuotes(node->quotes));
   }
 
@@ -7902,42 +6642,36 @@ _fingerprintJsonTableColumn(FingerprintContext *ctx, const JsonTableColumn *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "wrapper");
+    _fingerprintLiteral(ctx, "wrapper");
     _fingerprintString(ctx, _enumToStringJsonWrapper(node->wrapper));
   }
 
 }
 
 static void
-_fingerprintJsonKeyValue(FingerprintContext *ctx, const JsonKeyValue *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonKeyValue(FingerprintContext *ctx, const JsonKeyValue *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->key != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "key");
+    _fingerprintLiteral(ctx, "key");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->key, node, "key", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->key, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("key") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7946,37 +6680,31 @@ _fingerprintJsonKeyValue(FingerprintContext *ctx, const JsonKeyValue *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "value");
+    _fingerprintLiteral(ctx, "value");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->value, node, "value", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->value, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("value") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonParseExpr(FingerprintContext *ctx, const JsonParseExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonParseExpr(FingerprintContext *ctx, const JsonParseExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -7987,42 +6715,35 @@ _fingerprintJsonParseExpr(FingerprintContext *ctx, const JsonParseExpr *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->unique_keys) {
-    _fingerprintString(ctx, "unique_keys");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique_keys", "true");
   }
 
 }
 
 static void
-_fingerprintJsonScalarExpr(FingerprintContext *ctx, const JsonScalarExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonScalarExpr(FingerprintContext *ctx, const JsonScalarExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8033,37 +6754,31 @@ _fingerprintJsonScalarExpr(FingerprintContext *ctx, const JsonScalarExpr *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonSerializeExpr(FingerprintContext *ctx, const JsonSerializeExpr *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonSerializeExpr(FingerprintContext *ctx, const JsonSerializeExpr *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8074,26 +6789,22 @@ _fingerprintJsonSerializeExpr(FingerprintContext *ctx, const JsonSerializeExpr *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConstructor *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConstructor *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->exprs != NULL && node->exprs->length > 0) {
@@ -8101,15 +6812,12 @@ _fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConst
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "exprs");
+    _fingerprintLiteral(ctx, "exprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->exprs, node, "exprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->exprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("exprs") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -8119,31 +6827,26 @@ _fingerprintJsonObjectConstructor(FingerprintContext *ctx, const JsonObjectConst
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->unique) {
-    _fingerprintString(ctx, "unique");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique", "true");
   }
 
 }
 
 static void
-_fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstructor *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstructor *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->exprs != NULL && node->exprs->length > 0) {
@@ -8151,15 +6854,12 @@ _fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstru
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "exprs");
+    _fingerprintLiteral(ctx, "exprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->exprs, node, "exprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->exprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("exprs") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -8169,26 +6869,22 @@ _fingerprintJsonArrayConstructor(FingerprintContext *ctx, const JsonArrayConstru
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQueryConstructor *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQueryConstructor *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->format != NULL) {
@@ -8196,15 +6892,12 @@ _fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQu
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "format");
+    _fingerprintLiteral(ctx, "format");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonFormat(ctx, node->format, node, "format", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonFormat(ctx, node->format, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("format") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8215,15 +6908,12 @@ _fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQu
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8232,37 +6922,31 @@ _fingerprintJsonArrayQueryConstructor(FingerprintContext *ctx, const JsonArrayQu
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->agg_filter != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "agg_filter");
+    _fingerprintLiteral(ctx, "agg_filter");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->agg_filter, node, "agg_filter", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->agg_filter, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("agg_filter") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8271,15 +6955,12 @@ _fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "agg_order");
+    _fingerprintLiteral(ctx, "agg_order");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->agg_order, node, "agg_order", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->agg_order) == 1 && linitial(node->agg_order) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->agg_order, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->agg_order) == 1 && linitial(node->agg_order) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("agg_order") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
@@ -8289,15 +6970,12 @@ _fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "output");
+    _fingerprintLiteral(ctx, "output");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonOutput(ctx, node->output, node, "output", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonOutput(ctx, node->output, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("output") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8306,26 +6984,22 @@ _fingerprintJsonAggConstructor(FingerprintContext *ctx, const JsonAggConstructor
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "over");
+    _fingerprintLiteral(ctx, "over");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWindowDef(ctx, node->over, node, "over", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWindowDef(ctx, node->over, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("over") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->arg != NULL) {
@@ -8333,15 +7007,12 @@ _fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonKeyValue(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonKeyValue(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8350,31 +7021,26 @@ _fingerprintJsonObjectAgg(FingerprintContext *ctx, const JsonObjectAgg *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constructor");
+    _fingerprintLiteral(ctx, "constructor");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonAggConstructor(ctx, node->constructor, node, "constructor", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonAggConstructor(ctx, node->constructor, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constructor") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->unique) {
-    _fingerprintString(ctx, "unique");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique", "true");
   }
 
 }
 
 static void
-_fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->absent_on_null) {
-    _fingerprintString(ctx, "absent_on_null");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "absent_on_null", "true");
   }
 
   if (node->arg != NULL) {
@@ -8382,15 +7048,12 @@ _fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "arg");
+    _fingerprintLiteral(ctx, "arg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonValueExpr(ctx, node->arg, node, "arg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonValueExpr(ctx, node->arg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("arg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8399,37 +7062,31 @@ _fingerprintJsonArrayAgg(FingerprintContext *ctx, const JsonArrayAgg *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constructor");
+    _fingerprintLiteral(ctx, "constructor");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintJsonAggConstructor(ctx, node->constructor, node, "constructor", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintJsonAggConstructor(ctx, node->constructor, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constructor") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRawStmt(FingerprintContext *ctx, const RawStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRawStmt(FingerprintContext *ctx, const RawStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->stmt != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "stmt");
+    _fingerprintLiteral(ctx, "stmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->stmt, node, "stmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->stmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("stmt") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8440,22 +7097,19 @@ _fingerprintRawStmt(FingerprintContext *ctx, const RawStmt *node, const void *pa
 }
 
 static void
-_fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cols != NULL && node->cols->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cols");
+    _fingerprintLiteral(ctx, "cols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cols, node, "cols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cols) == 1 && linitial(node->cols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cols, node, FINGERPRINT_FIELD_COLS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cols) == 1 && linitial(node->cols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cols") - 1);
     XXH3_freeState(prev);
   }
   if (node->onConflictClause != NULL) {
@@ -8463,20 +7117,17 @@ _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "onConflictClause");
+    _fingerprintLiteral(ctx, "onConflictClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintOnConflictClause(ctx, node->onConflictClause, node, "onConflictClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintOnConflictClause(ctx, node->onConflictClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("onConflictClause") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "override");
+    _fingerprintLiteral(ctx, "override");
     _fingerprintString(ctx, _enumToStringOverridingKind(node->override));
   }
 
@@ -8485,15 +7136,12 @@ _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8502,15 +7150,12 @@ _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returningList");
+    _fingerprintLiteral(ctx, "returningList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returningList, node, "returningList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returningList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returningList") - 1);
     XXH3_freeState(prev);
   }
   if (node->selectStmt != NULL) {
@@ -8518,15 +7163,12 @@ _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "selectStmt");
+    _fingerprintLiteral(ctx, "selectStmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->selectStmt, node, "selectStmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->selectStmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("selectStmt") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8535,37 +7177,31 @@ _fingerprintInsertStmt(FingerprintContext *ctx, const InsertStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withClause");
+    _fingerprintLiteral(ctx, "withClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWithClause(ctx, node->withClause, node, "withClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWithClause(ctx, node->withClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->relation != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8574,15 +7210,12 @@ _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returningList");
+    _fingerprintLiteral(ctx, "returningList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returningList, node, "returningList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returningList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returningList") - 1);
     XXH3_freeState(prev);
   }
   if (node->usingClause != NULL && node->usingClause->length > 0) {
@@ -8590,15 +7223,12 @@ _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "usingClause");
+    _fingerprintLiteral(ctx, "usingClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->usingClause, node, "usingClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->usingClause) == 1 && linitial(node->usingClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->usingClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->usingClause) == 1 && linitial(node->usingClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("usingClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->whereClause != NULL) {
@@ -8606,15 +7236,12 @@ _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8623,37 +7250,31 @@ _fingerprintDeleteStmt(FingerprintContext *ctx, const DeleteStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withClause");
+    _fingerprintLiteral(ctx, "withClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWithClause(ctx, node->withClause, node, "withClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWithClause(ctx, node->withClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fromClause != NULL && node->fromClause->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fromClause");
+    _fingerprintLiteral(ctx, "fromClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fromClause, node, "fromClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromClause) == 1 && linitial(node->fromClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fromClause, node, FINGERPRINT_FIELD_FROM_CLAUSE, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromClause) == 1 && linitial(node->fromClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fromClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -8661,15 +7282,12 @@ _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8678,15 +7296,12 @@ _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returningList");
+    _fingerprintLiteral(ctx, "returningList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returningList, node, "returningList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returningList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returningList") - 1);
     XXH3_freeState(prev);
   }
   if (node->targetList != NULL && node->targetList->length > 0) {
@@ -8694,15 +7309,12 @@ _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->whereClause != NULL) {
@@ -8710,15 +7322,12 @@ _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8727,37 +7336,31 @@ _fingerprintUpdateStmt(FingerprintContext *ctx, const UpdateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withClause");
+    _fingerprintLiteral(ctx, "withClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWithClause(ctx, node->withClause, node, "withClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWithClause(ctx, node->withClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->joinCondition != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "joinCondition");
+    _fingerprintLiteral(ctx, "joinCondition");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->joinCondition, node, "joinCondition", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->joinCondition, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("joinCondition") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8766,15 +7369,12 @@ _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "mergeWhenClauses");
+    _fingerprintLiteral(ctx, "mergeWhenClauses");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->mergeWhenClauses, node, "mergeWhenClauses", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->mergeWhenClauses) == 1 && linitial(node->mergeWhenClauses) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->mergeWhenClauses, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->mergeWhenClauses) == 1 && linitial(node->mergeWhenClauses) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("mergeWhenClauses") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -8782,15 +7382,12 @@ _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8799,15 +7396,12 @@ _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returningList");
+    _fingerprintLiteral(ctx, "returningList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returningList, node, "returningList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returningList, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->returningList) == 1 && linitial(node->returningList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returningList") - 1);
     XXH3_freeState(prev);
   }
   if (node->sourceRelation != NULL) {
@@ -8815,15 +7409,12 @@ _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sourceRelation");
+    _fingerprintLiteral(ctx, "sourceRelation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->sourceRelation, node, "sourceRelation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->sourceRelation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sourceRelation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8832,26 +7423,22 @@ _fingerprintMergeStmt(FingerprintContext *ctx, const MergeStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withClause");
+    _fingerprintLiteral(ctx, "withClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWithClause(ctx, node->withClause, node, "withClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWithClause(ctx, node->withClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->all) {
-    _fingerprintString(ctx, "all");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "all", "true");
   }
 
   if (node->distinctClause != NULL && node->distinctClause->length > 0) {
@@ -8859,15 +7446,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "distinctClause");
+    _fingerprintLiteral(ctx, "distinctClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->distinctClause, node, "distinctClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->distinctClause) == 1 && linitial(node->distinctClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->distinctClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->distinctClause) == 1 && linitial(node->distinctClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("distinctClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->fromClause != NULL && node->fromClause->length > 0) {
@@ -8875,15 +7459,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fromClause");
+    _fingerprintLiteral(ctx, "fromClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fromClause, node, "fromClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromClause) == 1 && linitial(node->fromClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fromClause, node, FINGERPRINT_FIELD_FROM_CLAUSE, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fromClause) == 1 && linitial(node->fromClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fromClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->groupClause != NULL && node->groupClause->length > 0) {
@@ -8891,20 +7472,16 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "groupClause");
+    _fingerprintLiteral(ctx, "groupClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->groupClause, node, "groupClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClause) == 1 && linitial(node->groupClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->groupClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClause) == 1 && linitial(node->groupClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("groupClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->groupDistinct) {
-    _fingerprintString(ctx, "groupDistinct");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "groupDistinct", "true");
   }
 
   if (node->havingClause != NULL) {
@@ -8912,15 +7489,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "havingClause");
+    _fingerprintLiteral(ctx, "havingClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->havingClause, node, "havingClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->havingClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("havingClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8929,15 +7503,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "intoClause");
+    _fingerprintLiteral(ctx, "intoClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintIntoClause(ctx, node->intoClause, node, "intoClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintIntoClause(ctx, node->intoClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("intoClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8946,15 +7517,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "larg");
+    _fingerprintLiteral(ctx, "larg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintSelectStmt(ctx, node->larg, node, "larg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintSelectStmt(ctx, node->larg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("larg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8963,15 +7531,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "limitCount");
+    _fingerprintLiteral(ctx, "limitCount");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->limitCount, node, "limitCount", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->limitCount, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("limitCount") - 1);
     XXH3_freeState(prev);
   }
 
@@ -8980,20 +7545,17 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "limitOffset");
+    _fingerprintLiteral(ctx, "limitOffset");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->limitOffset, node, "limitOffset", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->limitOffset, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("limitOffset") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "limitOption");
+    _fingerprintLiteral(ctx, "limitOption");
     _fingerprintString(ctx, _enumToStringLimitOption(node->limitOption));
   }
 
@@ -9002,19 +7564,16 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "lockingClause");
+    _fingerprintLiteral(ctx, "lockingClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->lockingClause, node, "lockingClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lockingClause) == 1 && linitial(node->lockingClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->lockingClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->lockingClause) == 1 && linitial(node->lockingClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("lockingClause") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringSetOperation(node->op));
   }
 
@@ -9023,15 +7582,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rarg");
+    _fingerprintLiteral(ctx, "rarg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintSelectStmt(ctx, node->rarg, node, "rarg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintSelectStmt(ctx, node->rarg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rarg") - 1);
     XXH3_freeState(prev);
   }
 
@@ -9040,15 +7596,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sortClause");
+    _fingerprintLiteral(ctx, "sortClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->sortClause, node, "sortClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->sortClause) == 1 && linitial(node->sortClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->sortClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->sortClause) == 1 && linitial(node->sortClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sortClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->targetList != NULL && node->targetList->length > 0) {
@@ -9056,15 +7609,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targetList");
+    _fingerprintLiteral(ctx, "targetList");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->targetList, node, "targetList", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->targetList, node, FINGERPRINT_FIELD_TARGET_LIST, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->targetList) == 1 && linitial(node->targetList) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targetList") - 1);
     XXH3_freeState(prev);
   }
   if (node->valuesLists != NULL && node->valuesLists->length > 0) {
@@ -9072,15 +7622,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "valuesLists");
+    _fingerprintLiteral(ctx, "valuesLists");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->valuesLists, node, "valuesLists", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->valuesLists) == 1 && linitial(node->valuesLists) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->valuesLists, node, FINGERPRINT_FIELD_VALUES_LISTS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->valuesLists) == 1 && linitial(node->valuesLists) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("valuesLists") - 1);
     XXH3_freeState(prev);
   }
   if (node->whereClause != NULL) {
@@ -9088,15 +7635,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -9105,15 +7649,12 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "windowClause");
+    _fingerprintLiteral(ctx, "windowClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->windowClause, node, "windowClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->windowClause) == 1 && linitial(node->windowClause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->windowClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->windowClause) == 1 && linitial(node->windowClause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("windowClause") - 1);
     XXH3_freeState(prev);
   }
   if (node->withClause != NULL) {
@@ -9121,26 +7662,22 @@ _fingerprintSelectStmt(FingerprintContext *ctx, const SelectStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "withClause");
+    _fingerprintLiteral(ctx, "withClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintWithClause(ctx, node->withClause, node, "withClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintWithClause(ctx, node->withClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("withClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->all) {
-    _fingerprintString(ctx, "all");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "all", "true");
   }
 
   if (node->colCollations != NULL && node->colCollations->length > 0) {
@@ -9148,15 +7685,12 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colCollations");
+    _fingerprintLiteral(ctx, "colCollations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colCollations, node, "colCollations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colCollations) == 1 && linitial(node->colCollations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colCollations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colCollations) == 1 && linitial(node->colCollations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colCollations") - 1);
     XXH3_freeState(prev);
   }
   if (node->colTypes != NULL && node->colTypes->length > 0) {
@@ -9164,15 +7698,12 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colTypes");
+    _fingerprintLiteral(ctx, "colTypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colTypes, node, "colTypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colTypes) == 1 && linitial(node->colTypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colTypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colTypes) == 1 && linitial(node->colTypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colTypes") - 1);
     XXH3_freeState(prev);
   }
   if (node->colTypmods != NULL && node->colTypmods->length > 0) {
@@ -9180,15 +7711,12 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "colTypmods");
+    _fingerprintLiteral(ctx, "colTypmods");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->colTypmods, node, "colTypmods", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colTypmods) == 1 && linitial(node->colTypmods) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->colTypmods, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->colTypmods) == 1 && linitial(node->colTypmods) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("colTypmods") - 1);
     XXH3_freeState(prev);
   }
   if (node->groupClauses != NULL && node->groupClauses->length > 0) {
@@ -9196,15 +7724,12 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "groupClauses");
+    _fingerprintLiteral(ctx, "groupClauses");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->groupClauses, node, "groupClauses", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClauses) == 1 && linitial(node->groupClauses) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->groupClauses, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->groupClauses) == 1 && linitial(node->groupClauses) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("groupClauses") - 1);
     XXH3_freeState(prev);
   }
   if (node->larg != NULL) {
@@ -9212,20 +7737,17 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "larg");
+    _fingerprintLiteral(ctx, "larg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->larg, node, "larg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->larg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("larg") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "op");
+    _fingerprintLiteral(ctx, "op");
     _fingerprintString(ctx, _enumToStringSetOperation(node->op));
   }
 
@@ -9234,73 +7756,62 @@ _fingerprintSetOperationStmt(FingerprintContext *ctx, const SetOperationStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rarg");
+    _fingerprintLiteral(ctx, "rarg");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rarg, node, "rarg", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rarg, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rarg") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintReturnStmt(FingerprintContext *ctx, const ReturnStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintReturnStmt(FingerprintContext *ctx, const ReturnStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->returnval != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returnval");
+    _fingerprintLiteral(ctx, "returnval");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->returnval, node, "returnval", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->returnval, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returnval") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintPLAssignStmt(FingerprintContext *ctx, const PLAssignStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPLAssignStmt(FingerprintContext *ctx, const PLAssignStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->indirection != NULL && node->indirection->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indirection");
+    _fingerprintLiteral(ctx, "indirection");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indirection, node, "indirection", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indirection, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indirection) == 1 && linitial(node->indirection) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indirection") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
   if (node->nnames != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->nnames);
-    _fingerprintString(ctx, "nnames");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "nnames");
+    _fingerprintInt64(ctx, node->nnames);
   }
 
   if (node->val != NULL) {
@@ -9308,43 +7819,36 @@ _fingerprintPLAssignStmt(FingerprintContext *ctx, const PLAssignStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "val");
+    _fingerprintLiteral(ctx, "val");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintSelectStmt(ctx, node->val, node, "val", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintSelectStmt(ctx, node->val, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("val") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateSchemaStmt(FingerprintContext *ctx, const CreateSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateSchemaStmt(FingerprintContext *ctx, const CreateSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->authrole != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "authrole");
+    _fingerprintLiteral(ctx, "authrole");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->authrole, node, "authrole", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->authrole, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("authrole") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->schemaElts != NULL && node->schemaElts->length > 0) {
@@ -9352,50 +7856,43 @@ _fingerprintCreateSchemaStmt(FingerprintContext *ctx, const CreateSchemaStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "schemaElts");
+    _fingerprintLiteral(ctx, "schemaElts");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->schemaElts, node, "schemaElts", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->schemaElts) == 1 && linitial(node->schemaElts) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->schemaElts, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->schemaElts) == 1 && linitial(node->schemaElts) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("schemaElts") - 1);
     XXH3_freeState(prev);
   }
   if (node->schemaname != NULL) {
-    _fingerprintString(ctx, "schemaname");
+    _fingerprintLiteral(ctx, "schemaname");
     _fingerprintString(ctx, node->schemaname);
   }
 
 }
 
 static void
-_fingerprintAlterTableStmt(FingerprintContext *ctx, const AlterTableStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTableStmt(FingerprintContext *ctx, const AlterTableStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cmds != NULL && node->cmds->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cmds");
+    _fingerprintLiteral(ctx, "cmds");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cmds, node, "cmds", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cmds) == 1 && linitial(node->cmds) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cmds, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cmds) == 1 && linitial(node->cmds) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cmds") - 1);
     XXH3_freeState(prev);
   }
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
@@ -9404,41 +7901,37 @@ _fingerprintAlterTableStmt(FingerprintContext *ctx, const AlterTableStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintReplicaIdentityStmt(FingerprintContext *ctx, const ReplicaIdentityStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintReplicaIdentityStmt(FingerprintContext *ctx, const ReplicaIdentityStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->identity_type != 0) {
-    char buffer[2] = {node->identity_type, '\0'};
-    _fingerprintString(ctx, "identity_type");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "identity_type");
+    _fingerprintStringLen(ctx, &node->identity_type, 1);
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
@@ -9447,25 +7940,21 @@ _fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "def");
+    _fingerprintLiteral(ctx, "def");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->def, node, "def", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->def, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("def") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -9474,63 +7963,54 @@ _fingerprintAlterTableCmd(FingerprintContext *ctx, const AlterTableCmd *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "newowner");
+    _fingerprintLiteral(ctx, "newowner");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->newowner, node, "newowner", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->newowner, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("newowner") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->num != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->num);
-    _fingerprintString(ctx, "num");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "num");
+    _fingerprintInt64(ctx, node->num);
   }
 
   if (node->recurse) {
-    _fingerprintString(ctx, "recurse");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "recurse", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "subtype");
+    _fingerprintLiteral(ctx, "subtype");
     _fingerprintString(ctx, _enumToStringAlterTableType(node->subtype));
   }
 
 }
 
 static void
-_fingerprintAlterCollationStmt(FingerprintContext *ctx, const AlterCollationStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterCollationStmt(FingerprintContext *ctx, const AlterCollationStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collname != NULL && node->collname->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collname");
+    _fingerprintLiteral(ctx, "collname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->collname, node, "collname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collname) == 1 && linitial(node->collname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->collname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->collname) == 1 && linitial(node->collname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collname") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
@@ -9539,32 +8019,27 @@ _fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "def");
+    _fingerprintLiteral(ctx, "def");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->def, node, "def", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->def, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("def") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
   if (node->subtype != 0) {
-    char buffer[2] = {node->subtype, '\0'};
-    _fingerprintString(ctx, "subtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "subtype");
+    _fingerprintStringLen(ctx, &node->subtype, 1);
   }
 
   if (node->typeName != NULL && node->typeName->length > 0) {
@@ -9572,30 +8047,26 @@ _fingerprintAlterDomainStmt(FingerprintContext *ctx, const AlterDomainStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
   if (node->grant_option) {
-    _fingerprintString(ctx, "grant_option");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "grant_option", "true");
   }
 
   if (node->grantees != NULL && node->grantees->length > 0) {
@@ -9603,15 +8074,12 @@ _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "grantees");
+    _fingerprintLiteral(ctx, "grantees");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->grantees, node, "grantees", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->grantees) == 1 && linitial(node->grantees) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->grantees, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->grantees) == 1 && linitial(node->grantees) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("grantees") - 1);
     XXH3_freeState(prev);
   }
   if (node->grantor != NULL) {
@@ -9619,21 +8087,17 @@ _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "grantor");
+    _fingerprintLiteral(ctx, "grantor");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->grantor, node, "grantor", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->grantor, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("grantor") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->is_grant) {
-    _fingerprintString(ctx, "is_grant");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_grant", "true");
   }
 
   if (node->objects != NULL && node->objects->length > 0) {
@@ -9641,19 +8105,16 @@ _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "objects");
+    _fingerprintLiteral(ctx, "objects");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->objects, node, "objects", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objects) == 1 && linitial(node->objects) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->objects, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objects) == 1 && linitial(node->objects) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("objects") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
@@ -9662,30 +8123,26 @@ _fingerprintGrantStmt(FingerprintContext *ctx, const GrantStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "privileges");
+    _fingerprintLiteral(ctx, "privileges");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->privileges, node, "privileges", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->privileges) == 1 && linitial(node->privileges) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->privileges, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->privileges) == 1 && linitial(node->privileges) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("privileges") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "targtype");
+    _fingerprintLiteral(ctx, "targtype");
     _fingerprintString(ctx, _enumToStringGrantTargetType(node->targtype));
   }
 
 }
 
 static void
-_fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args_unspecified) {
-    _fingerprintString(ctx, "args_unspecified");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "args_unspecified", "true");
   }
 
   if (node->objargs != NULL && node->objargs->length > 0) {
@@ -9693,15 +8150,12 @@ _fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "objargs");
+    _fingerprintLiteral(ctx, "objargs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->objargs, node, "objargs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objargs) == 1 && linitial(node->objargs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->objargs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objargs) == 1 && linitial(node->objargs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("objargs") - 1);
     XXH3_freeState(prev);
   }
   if (node->objfuncargs != NULL && node->objfuncargs->length > 0) {
@@ -9709,15 +8163,12 @@ _fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "objfuncargs");
+    _fingerprintLiteral(ctx, "objfuncargs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->objfuncargs, node, "objfuncargs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objfuncargs) == 1 && linitial(node->objfuncargs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->objfuncargs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objfuncargs) == 1 && linitial(node->objfuncargs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("objfuncargs") - 1);
     XXH3_freeState(prev);
   }
   if (node->objname != NULL && node->objname->length > 0) {
@@ -9725,50 +8176,44 @@ _fingerprintObjectWithArgs(FingerprintContext *ctx, const ObjectWithArgs *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "objname");
+    _fingerprintLiteral(ctx, "objname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->objname, node, "objname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objname) == 1 && linitial(node->objname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->objname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objname) == 1 && linitial(node->objname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("objname") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAccessPriv(FingerprintContext *ctx, const AccessPriv *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAccessPriv(FingerprintContext *ctx, const AccessPriv *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cols != NULL && node->cols->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cols");
+    _fingerprintLiteral(ctx, "cols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cols, node, "cols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cols) == 1 && linitial(node->cols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cols, node, FINGERPRINT_FIELD_COLS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cols) == 1 && linitial(node->cols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cols") - 1);
     XXH3_freeState(prev);
   }
   if (node->priv_name != NULL) {
-    _fingerprintString(ctx, "priv_name");
+    _fingerprintLiteral(ctx, "priv_name");
     _fingerprintString(ctx, node->priv_name);
   }
 
 }
 
 static void
-_fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
@@ -9777,15 +8222,12 @@ _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "granted_roles");
+    _fingerprintLiteral(ctx, "granted_roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->granted_roles, node, "granted_roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->granted_roles) == 1 && linitial(node->granted_roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->granted_roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->granted_roles) == 1 && linitial(node->granted_roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("granted_roles") - 1);
     XXH3_freeState(prev);
   }
   if (node->grantee_roles != NULL && node->grantee_roles->length > 0) {
@@ -9793,15 +8235,12 @@ _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "grantee_roles");
+    _fingerprintLiteral(ctx, "grantee_roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->grantee_roles, node, "grantee_roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->grantee_roles) == 1 && linitial(node->grantee_roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->grantee_roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->grantee_roles) == 1 && linitial(node->grantee_roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("grantee_roles") - 1);
     XXH3_freeState(prev);
   }
   if (node->grantor != NULL) {
@@ -9809,21 +8248,17 @@ _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "grantor");
+    _fingerprintLiteral(ctx, "grantor");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->grantor, node, "grantor", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->grantor, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("grantor") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->is_grant) {
-    _fingerprintString(ctx, "is_grant");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_grant", "true");
   }
 
   if (node->opt != NULL && node->opt->length > 0) {
@@ -9831,36 +8266,30 @@ _fingerprintGrantRoleStmt(FingerprintContext *ctx, const GrantRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opt");
+    _fingerprintLiteral(ctx, "opt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opt, node, "opt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opt) == 1 && linitial(node->opt) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opt) == 1 && linitial(node->opt) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opt") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterDefaultPrivilegesStmt(FingerprintContext *ctx, const AlterDefaultPrivilegesStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterDefaultPrivilegesStmt(FingerprintContext *ctx, const AlterDefaultPrivilegesStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->action != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "action");
+    _fingerprintLiteral(ctx, "action");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintGrantStmt(ctx, node->action, node, "action", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintGrantStmt(ctx, node->action, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("action") - 1);
     XXH3_freeState(prev);
   }
 
@@ -9869,51 +8298,43 @@ _fingerprintAlterDefaultPrivilegesStmt(FingerprintContext *ctx, const AlterDefau
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->attlist != NULL && node->attlist->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "attlist");
+    _fingerprintLiteral(ctx, "attlist");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->attlist, node, "attlist", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->attlist) == 1 && linitial(node->attlist) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->attlist, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->attlist) == 1 && linitial(node->attlist) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("attlist") - 1);
     XXH3_freeState(prev);
   }
   if (node->filename != NULL) {
-    _fingerprintString(ctx, "filename");
+    _fingerprintLiteral(ctx, "filename");
     _fingerprintString(ctx, node->filename);
   }
 
   if (node->is_from) {
-    _fingerprintString(ctx, "is_from");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_from", "true");
   }
 
   if (node->is_program) {
-    _fingerprintString(ctx, "is_program");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_program", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -9921,15 +8342,12 @@ _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->query != NULL) {
@@ -9937,15 +8355,12 @@ _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
@@ -9954,15 +8369,12 @@ _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -9971,71 +8383,64 @@ _fingerprintCopyStmt(FingerprintContext *ctx, const CopyStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintVariableSetStmt(FingerprintContext *ctx, const VariableSetStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintVariableSetStmt(FingerprintContext *ctx, const VariableSetStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->is_local) {
-    _fingerprintString(ctx, "is_local");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_local", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringVariableSetKind(node->kind));
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintVariableShowStmt(FingerprintContext *ctx, const VariableShowStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintVariableShowStmt(FingerprintContext *ctx, const VariableShowStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->accessMethod != NULL) {
-    _fingerprintString(ctx, "accessMethod");
+    _fingerprintLiteral(ctx, "accessMethod");
     _fingerprintString(ctx, node->accessMethod);
   }
 
@@ -10044,20 +8449,16 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constraints");
+    _fingerprintLiteral(ctx, "constraints");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->constraints, node, "constraints", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->constraints, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constraints") - 1);
     XXH3_freeState(prev);
   }
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->inhRelations != NULL && node->inhRelations->length > 0) {
@@ -10065,15 +8466,12 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "inhRelations");
+    _fingerprintLiteral(ctx, "inhRelations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->inhRelations, node, "inhRelations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->inhRelations) == 1 && linitial(node->inhRelations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->inhRelations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->inhRelations) == 1 && linitial(node->inhRelations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("inhRelations") - 1);
     XXH3_freeState(prev);
   }
   if (node->ofTypename != NULL) {
@@ -10081,20 +8479,17 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "ofTypename");
+    _fingerprintLiteral(ctx, "ofTypename");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->ofTypename, node, "ofTypename", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->ofTypename, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("ofTypename") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "oncommit");
+    _fingerprintLiteral(ctx, "oncommit");
     _fingerprintString(ctx, _enumToStringOnCommitAction(node->oncommit));
   }
 
@@ -10103,15 +8498,12 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->partbound != NULL) {
@@ -10119,15 +8511,12 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "partbound");
+    _fingerprintLiteral(ctx, "partbound");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintPartitionBoundSpec(ctx, node->partbound, node, "partbound", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintPartitionBoundSpec(ctx, node->partbound, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("partbound") - 1);
     XXH3_freeState(prev);
   }
 
@@ -10136,15 +8525,12 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "partspec");
+    _fingerprintLiteral(ctx, "partspec");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintPartitionSpec(ctx, node->partspec, node, "partspec", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintPartitionSpec(ctx, node->partspec, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("partspec") - 1);
     XXH3_freeState(prev);
   }
 
@@ -10153,15 +8539,12 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -10170,50 +8553,46 @@ _fingerprintCreateStmt(FingerprintContext *ctx, const CreateStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "tableElts");
+    _fingerprintLiteral(ctx, "tableElts");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->tableElts, node, "tableElts", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->tableElts) == 1 && linitial(node->tableElts) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->tableElts, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->tableElts) == 1 && linitial(node->tableElts) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("tableElts") - 1);
     XXH3_freeState(prev);
   }
   if (node->tablespacename != NULL) {
-    _fingerprintString(ctx, "tablespacename");
+    _fingerprintLiteral(ctx, "tablespacename");
     _fingerprintString(ctx, node->tablespacename);
   }
 
 }
 
 static void
-_fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->access_method != NULL) {
-    _fingerprintString(ctx, "access_method");
+    _fingerprintLiteral(ctx, "access_method");
     _fingerprintString(ctx, node->access_method);
   }
 
   if (node->conname != NULL) {
-    _fingerprintString(ctx, "conname");
+    _fingerprintLiteral(ctx, "conname");
     _fingerprintString(ctx, node->conname);
   }
 
   if (true) {
-    _fingerprintString(ctx, "contype");
+    _fingerprintLiteral(ctx, "contype");
     _fingerprintString(ctx, _enumToStringConstrType(node->contype));
   }
 
   if (node->cooked_expr != NULL) {
-    _fingerprintString(ctx, "cooked_expr");
+    _fingerprintLiteral(ctx, "cooked_expr");
     _fingerprintString(ctx, node->cooked_expr);
   }
 
   if (node->deferrable) {
-    _fingerprintString(ctx, "deferrable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "deferrable", "true");
   }
 
   if (node->exclusions != NULL && node->exclusions->length > 0) {
@@ -10221,15 +8600,12 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "exclusions");
+    _fingerprintLiteral(ctx, "exclusions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->exclusions, node, "exclusions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exclusions) == 1 && linitial(node->exclusions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->exclusions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exclusions) == 1 && linitial(node->exclusions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("exclusions") - 1);
     XXH3_freeState(prev);
   }
   if (node->fk_attrs != NULL && node->fk_attrs->length > 0) {
@@ -10237,21 +8613,17 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fk_attrs");
+    _fingerprintLiteral(ctx, "fk_attrs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fk_attrs, node, "fk_attrs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fk_attrs) == 1 && linitial(node->fk_attrs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fk_attrs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fk_attrs) == 1 && linitial(node->fk_attrs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fk_attrs") - 1);
     XXH3_freeState(prev);
   }
   if (node->fk_del_action != 0) {
-    char buffer[2] = {node->fk_del_action, '\0'};
-    _fingerprintString(ctx, "fk_del_action");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "fk_del_action");
+    _fingerprintStringLen(ctx, &node->fk_del_action, 1);
   }
 
   if (node->fk_del_set_cols != NULL && node->fk_del_set_cols->length > 0) {
@@ -10259,33 +8631,27 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fk_del_set_cols");
+    _fingerprintLiteral(ctx, "fk_del_set_cols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->fk_del_set_cols, node, "fk_del_set_cols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fk_del_set_cols) == 1 && linitial(node->fk_del_set_cols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->fk_del_set_cols, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->fk_del_set_cols) == 1 && linitial(node->fk_del_set_cols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fk_del_set_cols") - 1);
     XXH3_freeState(prev);
   }
   if (node->fk_matchtype != 0) {
-    char buffer[2] = {node->fk_matchtype, '\0'};
-    _fingerprintString(ctx, "fk_matchtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "fk_matchtype");
+    _fingerprintStringLen(ctx, &node->fk_matchtype, 1);
   }
 
   if (node->fk_upd_action != 0) {
-    char buffer[2] = {node->fk_upd_action, '\0'};
-    _fingerprintString(ctx, "fk_upd_action");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "fk_upd_action");
+    _fingerprintStringLen(ctx, &node->fk_upd_action, 1);
   }
 
   if (node->generated_when != 0) {
-    char buffer[2] = {node->generated_when, '\0'};
-    _fingerprintString(ctx, "generated_when");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "generated_when");
+    _fingerprintStringLen(ctx, &node->generated_when, 1);
   }
 
   if (node->including != NULL && node->including->length > 0) {
@@ -10293,47 +8659,39 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "including");
+    _fingerprintLiteral(ctx, "including");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->including, node, "including", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->including) == 1 && linitial(node->including) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->including, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->including) == 1 && linitial(node->including) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("including") - 1);
     XXH3_freeState(prev);
   }
   if (node->indexname != NULL) {
-    _fingerprintString(ctx, "indexname");
+    _fingerprintLiteral(ctx, "indexname");
     _fingerprintString(ctx, node->indexname);
   }
 
   if (node->indexspace != NULL) {
-    _fingerprintString(ctx, "indexspace");
+    _fingerprintLiteral(ctx, "indexspace");
     _fingerprintString(ctx, node->indexspace);
   }
 
   if (node->inhcount != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->inhcount);
-    _fingerprintString(ctx, "inhcount");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "inhcount");
+    _fingerprintInt64(ctx, node->inhcount);
   }
 
   if (node->initdeferred) {
-    _fingerprintString(ctx, "initdeferred");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "initdeferred", "true");
   }
 
   if (node->initially_valid) {
-    _fingerprintString(ctx, "initially_valid");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "initially_valid", "true");
   }
 
   if (node->is_no_inherit) {
-    _fingerprintString(ctx, "is_no_inherit");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_no_inherit", "true");
   }
 
   if (node->keys != NULL && node->keys->length > 0) {
@@ -10341,22 +8699,18 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "keys");
+    _fingerprintLiteral(ctx, "keys");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->keys, node, "keys", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->keys) == 1 && linitial(node->keys) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->keys, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->keys) == 1 && linitial(node->keys) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("keys") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->nulls_not_distinct) {
-    _fingerprintString(ctx, "nulls_not_distinct");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "nulls_not_distinct", "true");
   }
 
   if (node->old_conpfeqop != NULL && node->old_conpfeqop->length > 0) {
@@ -10364,22 +8718,17 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "old_conpfeqop");
+    _fingerprintLiteral(ctx, "old_conpfeqop");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->old_conpfeqop, node, "old_conpfeqop", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->old_conpfeqop) == 1 && linitial(node->old_conpfeqop) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->old_conpfeqop, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->old_conpfeqop) == 1 && linitial(node->old_conpfeqop) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("old_conpfeqop") - 1);
     XXH3_freeState(prev);
   }
   if (node->old_pktable_oid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->old_pktable_oid);
-    _fingerprintString(ctx, "old_pktable_oid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "old_pktable_oid");
+    _fingerprintInt64(ctx, node->old_pktable_oid);
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10387,15 +8736,12 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->pk_attrs != NULL && node->pk_attrs->length > 0) {
@@ -10403,15 +8749,12 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pk_attrs");
+    _fingerprintLiteral(ctx, "pk_attrs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->pk_attrs, node, "pk_attrs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pk_attrs) == 1 && linitial(node->pk_attrs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->pk_attrs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pk_attrs) == 1 && linitial(node->pk_attrs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pk_attrs") - 1);
     XXH3_freeState(prev);
   }
   if (node->pktable != NULL) {
@@ -10419,15 +8762,12 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pktable");
+    _fingerprintLiteral(ctx, "pktable");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->pktable, node, "pktable", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->pktable, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pktable") - 1);
     XXH3_freeState(prev);
   }
 
@@ -10436,26 +8776,21 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "raw_expr");
+    _fingerprintLiteral(ctx, "raw_expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->raw_expr, node, "raw_expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->raw_expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("raw_expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->reset_default_tblspc) {
-    _fingerprintString(ctx, "reset_default_tblspc");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "reset_default_tblspc", "true");
   }
 
   if (node->skip_validation) {
-    _fingerprintString(ctx, "skip_validation");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "skip_validation", "true");
   }
 
   if (node->where_clause != NULL) {
@@ -10463,22 +8798,19 @@ _fingerprintConstraint(FingerprintContext *ctx, const Constraint *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "where_clause");
+    _fingerprintLiteral(ctx, "where_clause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->where_clause, node, "where_clause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->where_clause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("where_clause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpaceStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpaceStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
@@ -10487,15 +8819,12 @@ _fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpace
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->owner != NULL) {
@@ -10503,46 +8832,41 @@ _fingerprintCreateTableSpaceStmt(FingerprintContext *ctx, const CreateTableSpace
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "owner");
+    _fingerprintLiteral(ctx, "owner");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->owner, node, "owner", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->owner, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("owner") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->tablespacename != NULL) {
-    _fingerprintString(ctx, "tablespacename");
+    _fingerprintLiteral(ctx, "tablespacename");
     _fingerprintString(ctx, node->tablespacename);
   }
 
 }
 
 static void
-_fingerprintDropTableSpaceStmt(FingerprintContext *ctx, const DropTableSpaceStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropTableSpaceStmt(FingerprintContext *ctx, const DropTableSpaceStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->tablespacename != NULL) {
-    _fingerprintString(ctx, "tablespacename");
+    _fingerprintLiteral(ctx, "tablespacename");
     _fingerprintString(ctx, node->tablespacename);
   }
 
 }
 
 static void
-_fingerprintAlterTableSpaceOptionsStmt(FingerprintContext *ctx, const AlterTableSpaceOptionsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTableSpaceOptionsStmt(FingerprintContext *ctx, const AlterTableSpaceOptionsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->isReset) {
-    _fingerprintString(ctx, "isReset");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isReset", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10550,44 +8874,40 @@ _fingerprintAlterTableSpaceOptionsStmt(FingerprintContext *ctx, const AlterTable
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->tablespacename != NULL) {
-    _fingerprintString(ctx, "tablespacename");
+    _fingerprintLiteral(ctx, "tablespacename");
     _fingerprintString(ctx, node->tablespacename);
   }
 
 }
 
 static void
-_fingerprintAlterTableMoveAllStmt(FingerprintContext *ctx, const AlterTableMoveAllStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTableMoveAllStmt(FingerprintContext *ctx, const AlterTableMoveAllStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->new_tablespacename != NULL) {
-    _fingerprintString(ctx, "new_tablespacename");
+    _fingerprintLiteral(ctx, "new_tablespacename");
     _fingerprintString(ctx, node->new_tablespacename);
   }
 
   if (node->nowait) {
-    _fingerprintString(ctx, "nowait");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "nowait", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
   if (node->orig_tablespacename != NULL) {
-    _fingerprintString(ctx, "orig_tablespacename");
+    _fingerprintLiteral(ctx, "orig_tablespacename");
     _fingerprintString(ctx, node->orig_tablespacename);
   }
 
@@ -10596,30 +8916,26 @@ _fingerprintAlterTableMoveAllStmt(FingerprintContext *ctx, const AlterTableMoveA
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateExtensionStmt(FingerprintContext *ctx, const CreateExtensionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateExtensionStmt(FingerprintContext *ctx, const CreateExtensionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->extname != NULL) {
-    _fingerprintString(ctx, "extname");
+    _fingerprintLiteral(ctx, "extname");
     _fingerprintString(ctx, node->extname);
   }
 
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10627,24 +8943,21 @@ _fingerprintCreateExtensionStmt(FingerprintContext *ctx, const CreateExtensionSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterExtensionStmt(FingerprintContext *ctx, const AlterExtensionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterExtensionStmt(FingerprintContext *ctx, const AlterExtensionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->extname != NULL) {
-    _fingerprintString(ctx, "extname");
+    _fingerprintLiteral(ctx, "extname");
     _fingerprintString(ctx, node->extname);
   }
 
@@ -10653,31 +8966,26 @@ _fingerprintAlterExtensionStmt(FingerprintContext *ctx, const AlterExtensionStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterExtensionContentsStmt(FingerprintContext *ctx, const AlterExtensionContentsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterExtensionContentsStmt(FingerprintContext *ctx, const AlterExtensionContentsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->action != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->action);
-    _fingerprintString(ctx, "action");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "action");
+    _fingerprintInt64(ctx, node->action);
   }
 
   if (node->extname != NULL) {
-    _fingerprintString(ctx, "extname");
+    _fingerprintLiteral(ctx, "extname");
     _fingerprintString(ctx, node->extname);
   }
 
@@ -10686,30 +8994,27 @@ _fingerprintAlterExtensionContentsStmt(FingerprintContext *ctx, const AlterExten
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
 }
 
 static void
-_fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fdwname != NULL) {
-    _fingerprintString(ctx, "fdwname");
+    _fingerprintLiteral(ctx, "fdwname");
     _fingerprintString(ctx, node->fdwname);
   }
 
@@ -10718,15 +9023,12 @@ _fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func_options");
+    _fingerprintLiteral(ctx, "func_options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->func_options, node, "func_options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_options) == 1 && linitial(node->func_options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->func_options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_options) == 1 && linitial(node->func_options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func_options") - 1);
     XXH3_freeState(prev);
   }
   if (node->options != NULL && node->options->length > 0) {
@@ -10734,24 +9036,21 @@ _fingerprintCreateFdwStmt(FingerprintContext *ctx, const CreateFdwStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fdwname != NULL) {
-    _fingerprintString(ctx, "fdwname");
+    _fingerprintLiteral(ctx, "fdwname");
     _fingerprintString(ctx, node->fdwname);
   }
 
@@ -10760,15 +9059,12 @@ _fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func_options");
+    _fingerprintLiteral(ctx, "func_options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->func_options, node, "func_options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_options) == 1 && linitial(node->func_options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->func_options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_options) == 1 && linitial(node->func_options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func_options") - 1);
     XXH3_freeState(prev);
   }
   if (node->options != NULL && node->options->length > 0) {
@@ -10776,30 +9072,26 @@ _fingerprintAlterFdwStmt(FingerprintContext *ctx, const AlterFdwStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateForeignServerStmt(FingerprintContext *ctx, const CreateForeignServerStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateForeignServerStmt(FingerprintContext *ctx, const CreateForeignServerStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fdwname != NULL) {
-    _fingerprintString(ctx, "fdwname");
+    _fingerprintLiteral(ctx, "fdwname");
     _fingerprintString(ctx, node->fdwname);
   }
 
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10807,40 +9099,36 @@ _fingerprintCreateForeignServerStmt(FingerprintContext *ctx, const CreateForeign
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
   if (node->servertype != NULL) {
-    _fingerprintString(ctx, "servertype");
+    _fingerprintLiteral(ctx, "servertype");
     _fingerprintString(ctx, node->servertype);
   }
 
   if (node->version != NULL) {
-    _fingerprintString(ctx, "version");
+    _fingerprintLiteral(ctx, "version");
     _fingerprintString(ctx, node->version);
   }
 
 }
 
 static void
-_fingerprintAlterForeignServerStmt(FingerprintContext *ctx, const AlterForeignServerStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterForeignServerStmt(FingerprintContext *ctx, const AlterForeignServerStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->has_version) {
-    _fingerprintString(ctx, "has_version");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "has_version", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10848,63 +9136,56 @@ _fingerprintAlterForeignServerStmt(FingerprintContext *ctx, const AlterForeignSe
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
   if (node->version != NULL) {
-    _fingerprintString(ctx, "version");
+    _fingerprintLiteral(ctx, "version");
     _fingerprintString(ctx, node->version);
   }
 
 }
 
 static void
-_fingerprintCreateForeignTableStmt(FingerprintContext *ctx, const CreateForeignTableStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateForeignTableStmt(FingerprintContext *ctx, const CreateForeignTableStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
-  _fingerprintString(ctx, "base");
-  _fingerprintCreateStmt(ctx, (const CreateStmt*) &node->base, node, "base", depth);
+  _fingerprintLiteral(ctx, "base");
+  _fingerprintCreateStmt(ctx, (const CreateStmt*) &node->base, node, FINGERPRINT_FIELD_OTHER, depth);
   if (node->options != NULL && node->options->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
 }
 
 static void
-_fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -10912,19 +9193,16 @@ _fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappi
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
@@ -10933,41 +9211,35 @@ _fingerprintCreateUserMappingStmt(FingerprintContext *ctx, const CreateUserMappi
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "user");
+    _fingerprintLiteral(ctx, "user");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->user, node, "user", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->user, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("user") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterUserMappingStmt(FingerprintContext *ctx, const AlterUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterUserMappingStmt(FingerprintContext *ctx, const AlterUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != NULL && node->options->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
@@ -10976,30 +9248,26 @@ _fingerprintAlterUserMappingStmt(FingerprintContext *ctx, const AlterUserMapping
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "user");
+    _fingerprintLiteral(ctx, "user");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->user, node, "user", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->user, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("user") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintDropUserMappingStmt(FingerprintContext *ctx, const DropUserMappingStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropUserMappingStmt(FingerprintContext *ctx, const DropUserMappingStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->servername != NULL) {
-    _fingerprintString(ctx, "servername");
+    _fingerprintLiteral(ctx, "servername");
     _fingerprintString(ctx, node->servername);
   }
 
@@ -11008,30 +9276,27 @@ _fingerprintDropUserMappingStmt(FingerprintContext *ctx, const DropUserMappingSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "user");
+    _fingerprintLiteral(ctx, "user");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->user, node, "user", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->user, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("user") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeignSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeignSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "list_type");
+    _fingerprintLiteral(ctx, "list_type");
     _fingerprintString(ctx, _enumToStringImportForeignSchemaType(node->list_type));
   }
 
   if (node->local_schema != NULL) {
-    _fingerprintString(ctx, "local_schema");
+    _fingerprintLiteral(ctx, "local_schema");
     _fingerprintString(ctx, node->local_schema);
   }
 
@@ -11040,24 +9305,21 @@ _fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeign
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->remote_schema != NULL) {
-    _fingerprintString(ctx, "remote_schema");
+    _fingerprintLiteral(ctx, "remote_schema");
     _fingerprintString(ctx, node->remote_schema);
   }
 
   if (node->server_name != NULL) {
-    _fingerprintString(ctx, "server_name");
+    _fingerprintLiteral(ctx, "server_name");
     _fingerprintString(ctx, node->server_name);
   }
 
@@ -11066,34 +9328,30 @@ _fingerprintImportForeignSchemaStmt(FingerprintContext *ctx, const ImportForeign
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "table_list");
+    _fingerprintLiteral(ctx, "table_list");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->table_list, node, "table_list", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->table_list) == 1 && linitial(node->table_list) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->table_list, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->table_list) == 1 && linitial(node->table_list) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("table_list") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cmd_name != NULL) {
-    _fingerprintString(ctx, "cmd_name");
+    _fingerprintLiteral(ctx, "cmd_name");
     _fingerprintString(ctx, node->cmd_name);
   }
 
   if (node->permissive) {
-    _fingerprintString(ctx, "permissive");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "permissive", "true");
   }
 
   if (node->policy_name != NULL) {
-    _fingerprintString(ctx, "policy_name");
+    _fingerprintLiteral(ctx, "policy_name");
     _fingerprintString(ctx, node->policy_name);
   }
 
@@ -11102,15 +9360,12 @@ _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "qual");
+    _fingerprintLiteral(ctx, "qual");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->qual, node, "qual", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->qual, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("qual") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11119,15 +9374,12 @@ _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
   if (node->table != NULL) {
@@ -11135,15 +9387,12 @@ _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "table");
+    _fingerprintLiteral(ctx, "table");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->table, node, "table", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->table, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("table") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11152,25 +9401,22 @@ _fingerprintCreatePolicyStmt(FingerprintContext *ctx, const CreatePolicyStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "with_check");
+    _fingerprintLiteral(ctx, "with_check");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->with_check, node, "with_check", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->with_check, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("with_check") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->policy_name != NULL) {
-    _fingerprintString(ctx, "policy_name");
+    _fingerprintLiteral(ctx, "policy_name");
     _fingerprintString(ctx, node->policy_name);
   }
 
@@ -11179,15 +9425,12 @@ _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "qual");
+    _fingerprintLiteral(ctx, "qual");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->qual, node, "qual", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->qual, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("qual") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11196,15 +9439,12 @@ _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
   if (node->table != NULL) {
@@ -11212,15 +9452,12 @@ _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "table");
+    _fingerprintLiteral(ctx, "table");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->table, node, "table", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->table, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("table") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11229,32 +9466,28 @@ _fingerprintAlterPolicyStmt(FingerprintContext *ctx, const AlterPolicyStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "with_check");
+    _fingerprintLiteral(ctx, "with_check");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->with_check, node, "with_check", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->with_check, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("with_check") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateAmStmt(FingerprintContext *ctx, const CreateAmStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateAmStmt(FingerprintContext *ctx, const CreateAmStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->amname != NULL) {
-    _fingerprintString(ctx, "amname");
+    _fingerprintLiteral(ctx, "amname");
     _fingerprintString(ctx, node->amname);
   }
 
   if (node->amtype != 0) {
-    char buffer[2] = {node->amtype, '\0'};
-    _fingerprintString(ctx, "amtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "amtype");
+    _fingerprintStringLen(ctx, &node->amtype, 1);
   }
 
   if (node->handler_name != NULL && node->handler_name->length > 0) {
@@ -11262,36 +9495,30 @@ _fingerprintCreateAmStmt(FingerprintContext *ctx, const CreateAmStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "handler_name");
+    _fingerprintLiteral(ctx, "handler_name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->handler_name, node, "handler_name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->handler_name) == 1 && linitial(node->handler_name) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->handler_name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->handler_name) == 1 && linitial(node->handler_name) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("handler_name") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->columns != NULL && node->columns->length > 0) {
@@ -11299,15 +9526,12 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "columns");
+    _fingerprintLiteral(ctx, "columns");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->columns, node, "columns", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->columns, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("columns") - 1);
     XXH3_freeState(prev);
   }
   if (node->constrrel != NULL) {
@@ -11315,28 +9539,22 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constrrel");
+    _fingerprintLiteral(ctx, "constrrel");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->constrrel, node, "constrrel", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->constrrel, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constrrel") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->deferrable) {
-    _fingerprintString(ctx, "deferrable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "deferrable", "true");
   }
 
   if (node->events != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->events);
-    _fingerprintString(ctx, "events");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "events");
+    _fingerprintInt64(ctx, node->events);
   }
 
   if (node->funcname != NULL && node->funcname->length > 0) {
@@ -11344,25 +9562,20 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcname");
+    _fingerprintLiteral(ctx, "funcname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funcname, node, "funcname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funcname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcname") - 1);
     XXH3_freeState(prev);
   }
   if (node->initdeferred) {
-    _fingerprintString(ctx, "initdeferred");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "initdeferred", "true");
   }
 
   if (node->isconstraint) {
-    _fingerprintString(ctx, "isconstraint");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isconstraint", "true");
   }
 
   if (node->relation != NULL) {
@@ -11370,33 +9583,26 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->row) {
-    _fingerprintString(ctx, "row");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "row", "true");
   }
 
   if (node->timing != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->timing);
-    _fingerprintString(ctx, "timing");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "timing");
+    _fingerprintInt64(ctx, node->timing);
   }
 
   if (node->transitionRels != NULL && node->transitionRels->length > 0) {
@@ -11404,19 +9610,16 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "transitionRels");
+    _fingerprintLiteral(ctx, "transitionRels");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->transitionRels, node, "transitionRels", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->transitionRels) == 1 && linitial(node->transitionRels) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->transitionRels, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->transitionRels) == 1 && linitial(node->transitionRels) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("transitionRels") - 1);
     XXH3_freeState(prev);
   }
   if (node->trigname != NULL) {
-    _fingerprintString(ctx, "trigname");
+    _fingerprintLiteral(ctx, "trigname");
     _fingerprintString(ctx, node->trigname);
   }
 
@@ -11425,25 +9628,22 @@ _fingerprintCreateTrigStmt(FingerprintContext *ctx, const CreateTrigStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whenClause");
+    _fingerprintLiteral(ctx, "whenClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whenClause, node, "whenClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whenClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whenClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->eventname != NULL) {
-    _fingerprintString(ctx, "eventname");
+    _fingerprintLiteral(ctx, "eventname");
     _fingerprintString(ctx, node->eventname);
   }
 
@@ -11452,19 +9652,16 @@ _fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcname");
+    _fingerprintLiteral(ctx, "funcname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funcname, node, "funcname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funcname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcname") - 1);
     XXH3_freeState(prev);
   }
   if (node->trigname != NULL) {
-    _fingerprintString(ctx, "trigname");
+    _fingerprintLiteral(ctx, "trigname");
     _fingerprintString(ctx, node->trigname);
   }
 
@@ -11473,52 +9670,45 @@ _fingerprintCreateEventTrigStmt(FingerprintContext *ctx, const CreateEventTrigSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whenclause");
+    _fingerprintLiteral(ctx, "whenclause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whenclause, node, "whenclause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->whenclause) == 1 && linitial(node->whenclause) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whenclause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->whenclause) == 1 && linitial(node->whenclause) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whenclause") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterEventTrigStmt(FingerprintContext *ctx, const AlterEventTrigStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterEventTrigStmt(FingerprintContext *ctx, const AlterEventTrigStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->tgenabled != 0) {
-    char buffer[2] = {node->tgenabled, '\0'};
-    _fingerprintString(ctx, "tgenabled");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "tgenabled");
+    _fingerprintStringLen(ctx, &node->tgenabled, 1);
   }
 
   if (node->trigname != NULL) {
-    _fingerprintString(ctx, "trigname");
+    _fingerprintLiteral(ctx, "trigname");
     _fingerprintString(ctx, node->trigname);
   }
 
 }
 
 static void
-_fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->plhandler != NULL && node->plhandler->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plhandler");
+    _fingerprintLiteral(ctx, "plhandler");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->plhandler, node, "plhandler", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plhandler) == 1 && linitial(node->plhandler) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->plhandler, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plhandler) == 1 && linitial(node->plhandler) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plhandler") - 1);
     XXH3_freeState(prev);
   }
   if (node->plinline != NULL && node->plinline->length > 0) {
@@ -11526,25 +9716,21 @@ _fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plinline");
+    _fingerprintLiteral(ctx, "plinline");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->plinline, node, "plinline", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plinline) == 1 && linitial(node->plinline) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->plinline, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plinline) == 1 && linitial(node->plinline) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plinline") - 1);
     XXH3_freeState(prev);
   }
   if (node->plname != NULL) {
-    _fingerprintString(ctx, "plname");
+    _fingerprintLiteral(ctx, "plname");
     _fingerprintString(ctx, node->plname);
   }
 
   if (node->pltrusted) {
-    _fingerprintString(ctx, "pltrusted");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "pltrusted", "true");
   }
 
   if (node->plvalidator != NULL && node->plvalidator->length > 0) {
@@ -11552,63 +9738,54 @@ _fingerprintCreatePLangStmt(FingerprintContext *ctx, const CreatePLangStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "plvalidator");
+    _fingerprintLiteral(ctx, "plvalidator");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->plvalidator, node, "plvalidator", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plvalidator) == 1 && linitial(node->plvalidator) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->plvalidator, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->plvalidator) == 1 && linitial(node->plvalidator) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("plvalidator") - 1);
     XXH3_freeState(prev);
   }
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
 }
 
 static void
-_fingerprintCreateRoleStmt(FingerprintContext *ctx, const CreateRoleStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateRoleStmt(FingerprintContext *ctx, const CreateRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != NULL && node->options->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->role != NULL) {
-    _fingerprintString(ctx, "role");
+    _fingerprintLiteral(ctx, "role");
     _fingerprintString(ctx, node->role);
   }
 
   if (true) {
-    _fingerprintString(ctx, "stmt_type");
+    _fingerprintLiteral(ctx, "stmt_type");
     _fingerprintString(ctx, _enumToStringRoleStmtType(node->stmt_type));
   }
 
 }
 
 static void
-_fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->action != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->action);
-    _fingerprintString(ctx, "action");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "action");
+    _fingerprintInt64(ctx, node->action);
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -11616,15 +9793,12 @@ _fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->role != NULL) {
@@ -11632,25 +9806,22 @@ _fingerprintAlterRoleStmt(FingerprintContext *ctx, const AlterRoleStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "role");
+    _fingerprintLiteral(ctx, "role");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->role, node, "role", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->role, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("role") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->database != NULL) {
-    _fingerprintString(ctx, "database");
+    _fingerprintLiteral(ctx, "database");
     _fingerprintString(ctx, node->database);
   }
 
@@ -11659,15 +9830,12 @@ _fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "role");
+    _fingerprintLiteral(ctx, "role");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->role, node, "role", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->role, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("role") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11676,26 +9844,22 @@ _fingerprintAlterRoleSetStmt(FingerprintContext *ctx, const AlterRoleSetStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "setstmt");
+    _fingerprintLiteral(ctx, "setstmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintVariableSetStmt(ctx, node->setstmt, node, "setstmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintVariableSetStmt(ctx, node->setstmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("setstmt") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintDropRoleStmt(FingerprintContext *ctx, const DropRoleStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropRoleStmt(FingerprintContext *ctx, const DropRoleStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->roles != NULL && node->roles->length > 0) {
@@ -11703,30 +9867,25 @@ _fingerprintDropRoleStmt(FingerprintContext *ctx, const DropRoleStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->for_identity) {
-    _fingerprintString(ctx, "for_identity");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "for_identity", "true");
   }
 
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -11734,22 +9893,17 @@ _fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->ownerId != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->ownerId);
-    _fingerprintString(ctx, "ownerId");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "ownerId");
+    _fingerprintInt64(ctx, node->ownerId);
   }
 
   if (node->sequence != NULL) {
@@ -11757,31 +9911,26 @@ _fingerprintCreateSeqStmt(FingerprintContext *ctx, const CreateSeqStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sequence");
+    _fingerprintLiteral(ctx, "sequence");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->sequence, node, "sequence", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->sequence, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sequence") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->for_identity) {
-    _fingerprintString(ctx, "for_identity");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "for_identity", "true");
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -11789,15 +9938,12 @@ _fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->sequence != NULL) {
@@ -11805,37 +9951,31 @@ _fingerprintAlterSeqStmt(FingerprintContext *ctx, const AlterSeqStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sequence");
+    _fingerprintLiteral(ctx, "sequence");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->sequence, node, "sequence", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->sequence, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sequence") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->args != NULL && node->args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "args");
+    _fingerprintLiteral(ctx, "args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->args, node, "args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->args, node, FINGERPRINT_FIELD_ARGS, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->args) == 1 && linitial(node->args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("args") - 1);
     XXH3_freeState(prev);
   }
   if (node->definition != NULL && node->definition->length > 0) {
@@ -11843,15 +9983,12 @@ _fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "definition");
+    _fingerprintLiteral(ctx, "definition");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->definition, node, "definition", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->definition) == 1 && linitial(node->definition) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->definition, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->definition) == 1 && linitial(node->definition) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("definition") - 1);
     XXH3_freeState(prev);
   }
   if (node->defnames != NULL && node->defnames->length > 0) {
@@ -11859,56 +9996,47 @@ _fingerprintDefineStmt(FingerprintContext *ctx, const DefineStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "defnames");
+    _fingerprintLiteral(ctx, "defnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->defnames, node, "defnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->defnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("defnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringObjectType(node->kind));
   }
 
   if (node->oldstyle) {
-    _fingerprintString(ctx, "oldstyle");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "oldstyle", "true");
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
 }
 
 static void
-_fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->collClause != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "collClause");
+    _fingerprintLiteral(ctx, "collClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintCollateClause(ctx, node->collClause, node, "collClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintCollateClause(ctx, node->collClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("collClause") - 1);
     XXH3_freeState(prev);
   }
 
@@ -11917,15 +10045,12 @@ _fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constraints");
+    _fingerprintLiteral(ctx, "constraints");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->constraints, node, "constraints", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->constraints, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constraints") - 1);
     XXH3_freeState(prev);
   }
   if (node->domainname != NULL && node->domainname->length > 0) {
@@ -11933,15 +10058,12 @@ _fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "domainname");
+    _fingerprintLiteral(ctx, "domainname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->domainname, node, "domainname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->domainname) == 1 && linitial(node->domainname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->domainname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->domainname) == 1 && linitial(node->domainname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("domainname") - 1);
     XXH3_freeState(prev);
   }
   if (node->typeName != NULL) {
@@ -11949,25 +10071,22 @@ _fingerprintCreateDomainStmt(FingerprintContext *ctx, const CreateDomainStmt *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->amname != NULL) {
-    _fingerprintString(ctx, "amname");
+    _fingerprintLiteral(ctx, "amname");
     _fingerprintString(ctx, node->amname);
   }
 
@@ -11976,21 +10095,17 @@ _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "datatype");
+    _fingerprintLiteral(ctx, "datatype");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->datatype, node, "datatype", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->datatype, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("datatype") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->isDefault) {
-    _fingerprintString(ctx, "isDefault");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isDefault", "true");
   }
 
   if (node->items != NULL && node->items->length > 0) {
@@ -11998,15 +10113,12 @@ _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "items");
+    _fingerprintLiteral(ctx, "items");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->items, node, "items", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->items) == 1 && linitial(node->items) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->items, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->items) == 1 && linitial(node->items) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("items") - 1);
     XXH3_freeState(prev);
   }
   if (node->opclassname != NULL && node->opclassname->length > 0) {
@@ -12014,15 +10126,12 @@ _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opclassname");
+    _fingerprintLiteral(ctx, "opclassname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opclassname, node, "opclassname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclassname) == 1 && linitial(node->opclassname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opclassname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opclassname) == 1 && linitial(node->opclassname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opclassname") - 1);
     XXH3_freeState(prev);
   }
   if (node->opfamilyname != NULL && node->opfamilyname->length > 0) {
@@ -12030,43 +10139,35 @@ _fingerprintCreateOpClassStmt(FingerprintContext *ctx, const CreateOpClassStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opfamilyname");
+    _fingerprintLiteral(ctx, "opfamilyname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opfamilyname, node, "opfamilyname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opfamilyname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opfamilyname") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->class_args != NULL && node->class_args->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "class_args");
+    _fingerprintLiteral(ctx, "class_args");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->class_args, node, "class_args", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->class_args) == 1 && linitial(node->class_args) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->class_args, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->class_args) == 1 && linitial(node->class_args) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("class_args") - 1);
     XXH3_freeState(prev);
   }
   if (node->itemtype != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->itemtype);
-    _fingerprintString(ctx, "itemtype");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "itemtype");
+    _fingerprintInt64(ctx, node->itemtype);
   }
 
   if (node->name != NULL) {
@@ -12074,23 +10175,18 @@ _fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->name, node, "name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("name") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->number != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->number);
-    _fingerprintString(ctx, "number");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "number");
+    _fingerprintInt64(ctx, node->number);
   }
 
   if (node->order_family != NULL && node->order_family->length > 0) {
@@ -12098,15 +10194,12 @@ _fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "order_family");
+    _fingerprintLiteral(ctx, "order_family");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->order_family, node, "order_family", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->order_family) == 1 && linitial(node->order_family) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->order_family, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->order_family) == 1 && linitial(node->order_family) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("order_family") - 1);
     XXH3_freeState(prev);
   }
   if (node->storedtype != NULL) {
@@ -12114,25 +10207,22 @@ _fingerprintCreateOpClassItem(FingerprintContext *ctx, const CreateOpClassItem *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "storedtype");
+    _fingerprintLiteral(ctx, "storedtype");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->storedtype, node, "storedtype", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->storedtype, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("storedtype") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateOpFamilyStmt(FingerprintContext *ctx, const CreateOpFamilyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateOpFamilyStmt(FingerprintContext *ctx, const CreateOpFamilyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->amname != NULL) {
-    _fingerprintString(ctx, "amname");
+    _fingerprintLiteral(ctx, "amname");
     _fingerprintString(ctx, node->amname);
   }
 
@@ -12141,30 +10231,26 @@ _fingerprintCreateOpFamilyStmt(FingerprintContext *ctx, const CreateOpFamilyStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opfamilyname");
+    _fingerprintLiteral(ctx, "opfamilyname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opfamilyname, node, "opfamilyname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opfamilyname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opfamilyname") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->amname != NULL) {
-    _fingerprintString(ctx, "amname");
+    _fingerprintLiteral(ctx, "amname");
     _fingerprintString(ctx, node->amname);
   }
 
   if (node->isDrop) {
-    _fingerprintString(ctx, "isDrop");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isDrop", "true");
   }
 
   if (node->items != NULL && node->items->length > 0) {
@@ -12172,15 +10258,12 @@ _fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "items");
+    _fingerprintLiteral(ctx, "items");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->items, node, "items", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->items) == 1 && linitial(node->items) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->items, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->items) == 1 && linitial(node->items) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("items") - 1);
     XXH3_freeState(prev);
   }
   if (node->opfamilyname != NULL && node->opfamilyname->length > 0) {
@@ -12188,35 +10271,30 @@ _fingerprintAlterOpFamilyStmt(FingerprintContext *ctx, const AlterOpFamilyStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opfamilyname");
+    _fingerprintLiteral(ctx, "opfamilyname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->opfamilyname, node, "opfamilyname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->opfamilyname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->opfamilyname) == 1 && linitial(node->opfamilyname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opfamilyname") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintDropStmt(FingerprintContext *ctx, const DropStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropStmt(FingerprintContext *ctx, const DropStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
   if (node->concurrent) {
-    _fingerprintString(ctx, "concurrent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "concurrent", "true");
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->objects != NULL && node->objects->length > 0) {
@@ -12224,29 +10302,26 @@ _fingerprintDropStmt(FingerprintContext *ctx, const DropStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "objects");
+    _fingerprintLiteral(ctx, "objects");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->objects, node, "objects", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objects) == 1 && linitial(node->objects) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->objects, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->objects) == 1 && linitial(node->objects) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("objects") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "removeType");
+    _fingerprintLiteral(ctx, "removeType");
     _fingerprintString(ctx, _enumToStringObjectType(node->removeType));
   }
 
 }
 
 static void
-_fingerprintTruncateStmt(FingerprintContext *ctx, const TruncateStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTruncateStmt(FingerprintContext *ctx, const TruncateStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
@@ -12255,29 +10330,25 @@ _fingerprintTruncateStmt(FingerprintContext *ctx, const TruncateStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relations");
+    _fingerprintLiteral(ctx, "relations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->relations, node, "relations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->relations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relations") - 1);
     XXH3_freeState(prev);
   }
   if (node->restart_seqs) {
-    _fingerprintString(ctx, "restart_seqs");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "restart_seqs", "true");
   }
 
 }
 
 static void
-_fingerprintCommentStmt(FingerprintContext *ctx, const CommentStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCommentStmt(FingerprintContext *ctx, const CommentStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->comment != NULL) {
-    _fingerprintString(ctx, "comment");
+    _fingerprintLiteral(ctx, "comment");
     _fingerprintString(ctx, node->comment);
   }
 
@@ -12286,30 +10357,27 @@ _fingerprintCommentStmt(FingerprintContext *ctx, const CommentStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
 }
 
 static void
-_fingerprintSecLabelStmt(FingerprintContext *ctx, const SecLabelStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintSecLabelStmt(FingerprintContext *ctx, const SecLabelStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->label != NULL) {
-    _fingerprintString(ctx, "label");
+    _fingerprintLiteral(ctx, "label");
     _fingerprintString(ctx, node->label);
   }
 
@@ -12318,38 +10386,33 @@ _fingerprintSecLabelStmt(FingerprintContext *ctx, const SecLabelStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
   if (node->provider != NULL) {
-    _fingerprintString(ctx, "provider");
+    _fingerprintLiteral(ctx, "provider");
     _fingerprintString(ctx, node->provider);
   }
 
 }
 
 static void
-_fingerprintDeclareCursorStmt(FingerprintContext *ctx, const DeclareCursorStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDeclareCursorStmt(FingerprintContext *ctx, const DeclareCursorStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->options);
-    _fingerprintString(ctx, "options");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "options");
+    _fingerprintInt64(ctx, node->options);
   }
 
   // Intentionally ignoring node->portalname for fingerprinting
@@ -12359,45 +10422,39 @@ _fingerprintDeclareCursorStmt(FingerprintContext *ctx, const DeclareCursorStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintClosePortalStmt(FingerprintContext *ctx, const ClosePortalStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintClosePortalStmt(FingerprintContext *ctx, const ClosePortalStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->portalname for fingerprinting
 
 }
 
 static void
-_fingerprintFetchStmt(FingerprintContext *ctx, const FetchStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFetchStmt(FingerprintContext *ctx, const FetchStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "direction");
+    _fingerprintLiteral(ctx, "direction");
     _fingerprintString(ctx, _enumToStringFetchDirection(node->direction));
   }
 
   if (node->howMany != 0) {
-    char buffer[50];
-    sprintf(buffer, "%ld", node->howMany);
-    _fingerprintString(ctx, "howMany");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "howMany");
+    _fingerprintInt64(ctx, node->howMany);
   }
 
   if (node->ismove) {
-    _fingerprintString(ctx, "ismove");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "ismove", "true");
   }
 
   // Intentionally ignoring node->portalname for fingerprinting
@@ -12405,21 +10462,19 @@ _fingerprintFetchStmt(FingerprintContext *ctx, const FetchStmt *node, const void
 }
 
 static void
-_fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->accessMethod != NULL) {
-    _fingerprintString(ctx, "accessMethod");
+    _fingerprintLiteral(ctx, "accessMethod");
     _fingerprintString(ctx, node->accessMethod);
   }
 
   if (node->concurrent) {
-    _fingerprintString(ctx, "concurrent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "concurrent", "true");
   }
 
   if (node->deferrable) {
-    _fingerprintString(ctx, "deferrable");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "deferrable", "true");
   }
 
   if (node->excludeOpNames != NULL && node->excludeOpNames->length > 0) {
@@ -12427,30 +10482,26 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "excludeOpNames");
+    _fingerprintLiteral(ctx, "excludeOpNames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->excludeOpNames, node, "excludeOpNames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->excludeOpNames) == 1 && linitial(node->excludeOpNames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->excludeOpNames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->excludeOpNames) == 1 && linitial(node->excludeOpNames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("excludeOpNames") - 1);
     XXH3_freeState(prev);
   }
   if (node->idxcomment != NULL) {
-    _fingerprintString(ctx, "idxcomment");
+    _fingerprintLiteral(ctx, "idxcomment");
     _fingerprintString(ctx, node->idxcomment);
   }
 
   if (node->idxname != NULL) {
-    _fingerprintString(ctx, "idxname");
+    _fingerprintLiteral(ctx, "idxname");
     _fingerprintString(ctx, node->idxname);
   }
 
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->indexIncludingParams != NULL && node->indexIncludingParams->length > 0) {
@@ -12458,22 +10509,17 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indexIncludingParams");
+    _fingerprintLiteral(ctx, "indexIncludingParams");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indexIncludingParams, node, "indexIncludingParams", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexIncludingParams) == 1 && linitial(node->indexIncludingParams) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indexIncludingParams, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexIncludingParams) == 1 && linitial(node->indexIncludingParams) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indexIncludingParams") - 1);
     XXH3_freeState(prev);
   }
   if (node->indexOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->indexOid);
-    _fingerprintString(ctx, "indexOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "indexOid");
+    _fingerprintInt64(ctx, node->indexOid);
   }
 
   if (node->indexParams != NULL && node->indexParams->length > 0) {
@@ -12481,51 +10527,39 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "indexParams");
+    _fingerprintLiteral(ctx, "indexParams");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->indexParams, node, "indexParams", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexParams) == 1 && linitial(node->indexParams) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->indexParams, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->indexParams) == 1 && linitial(node->indexParams) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("indexParams") - 1);
     XXH3_freeState(prev);
   }
   if (node->initdeferred) {
-    _fingerprintString(ctx, "initdeferred");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "initdeferred", "true");
   }
 
   if (node->isconstraint) {
-    _fingerprintString(ctx, "isconstraint");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isconstraint", "true");
   }
 
   if (node->nulls_not_distinct) {
-    _fingerprintString(ctx, "nulls_not_distinct");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "nulls_not_distinct", "true");
   }
 
   if (node->oldCreateSubid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->oldCreateSubid);
-    _fingerprintString(ctx, "oldCreateSubid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "oldCreateSubid");
+    _fingerprintInt64(ctx, node->oldCreateSubid);
   }
 
   if (node->oldFirstRelfilelocatorSubid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->oldFirstRelfilelocatorSubid);
-    _fingerprintString(ctx, "oldFirstRelfilelocatorSubid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "oldFirstRelfilelocatorSubid");
+    _fingerprintInt64(ctx, node->oldFirstRelfilelocatorSubid);
   }
 
   if (node->oldNumber != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->oldNumber);
-    _fingerprintString(ctx, "oldNumber");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "oldNumber");
+    _fingerprintInt64(ctx, node->oldNumber);
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -12533,20 +10567,16 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->primary) {
-    _fingerprintString(ctx, "primary");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "primary", "true");
   }
 
   if (node->relation != NULL) {
@@ -12554,36 +10584,30 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->reset_default_tblspc) {
-    _fingerprintString(ctx, "reset_default_tblspc");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "reset_default_tblspc", "true");
   }
 
   if (node->tableSpace != NULL) {
-    _fingerprintString(ctx, "tableSpace");
+    _fingerprintLiteral(ctx, "tableSpace");
     _fingerprintString(ctx, node->tableSpace);
   }
 
   if (node->transformed) {
-    _fingerprintString(ctx, "transformed");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "transformed", "true");
   }
 
   if (node->unique) {
-    _fingerprintString(ctx, "unique");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "unique", "true");
   }
 
   if (node->whereClause != NULL) {
@@ -12591,37 +10615,31 @@ _fingerprintIndexStmt(FingerprintContext *ctx, const IndexStmt *node, const void
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->defnames != NULL && node->defnames->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "defnames");
+    _fingerprintLiteral(ctx, "defnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->defnames, node, "defnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->defnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("defnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->exprs != NULL && node->exprs->length > 0) {
@@ -12629,20 +10647,16 @@ _fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "exprs");
+    _fingerprintLiteral(ctx, "exprs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->exprs, node, "exprs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->exprs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->exprs) == 1 && linitial(node->exprs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("exprs") - 1);
     XXH3_freeState(prev);
   }
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->relations != NULL && node->relations->length > 0) {
@@ -12650,15 +10664,12 @@ _fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relations");
+    _fingerprintLiteral(ctx, "relations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->relations, node, "relations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->relations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relations") - 1);
     XXH3_freeState(prev);
   }
   if (node->stat_types != NULL && node->stat_types->length > 0) {
@@ -12666,78 +10677,67 @@ _fingerprintCreateStatsStmt(FingerprintContext *ctx, const CreateStatsStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "stat_types");
+    _fingerprintLiteral(ctx, "stat_types");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->stat_types, node, "stat_types", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->stat_types) == 1 && linitial(node->stat_types) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->stat_types, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->stat_types) == 1 && linitial(node->stat_types) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("stat_types") - 1);
     XXH3_freeState(prev);
   }
   if (node->stxcomment != NULL) {
-    _fingerprintString(ctx, "stxcomment");
+    _fingerprintLiteral(ctx, "stxcomment");
     _fingerprintString(ctx, node->stxcomment);
   }
 
   if (node->transformed) {
-    _fingerprintString(ctx, "transformed");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "transformed", "true");
   }
 
 }
 
 static void
-_fingerprintStatsElem(FingerprintContext *ctx, const StatsElem *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintStatsElem(FingerprintContext *ctx, const StatsElem *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->expr != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "expr");
+    _fingerprintLiteral(ctx, "expr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->expr, node, "expr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->expr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("expr") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
 }
 
 static void
-_fingerprintAlterStatsStmt(FingerprintContext *ctx, const AlterStatsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterStatsStmt(FingerprintContext *ctx, const AlterStatsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->defnames != NULL && node->defnames->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "defnames");
+    _fingerprintLiteral(ctx, "defnames");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->defnames, node, "defnames", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->defnames, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->defnames) == 1 && linitial(node->defnames) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("defnames") - 1);
     XXH3_freeState(prev);
   }
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->stxstattarget != NULL) {
@@ -12745,42 +10745,35 @@ _fingerprintAlterStatsStmt(FingerprintContext *ctx, const AlterStatsStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "stxstattarget");
+    _fingerprintLiteral(ctx, "stxstattarget");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->stxstattarget, node, "stxstattarget", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->stxstattarget, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("stxstattarget") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->funcname != NULL && node->funcname->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcname");
+    _fingerprintLiteral(ctx, "funcname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->funcname, node, "funcname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->funcname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->funcname) == 1 && linitial(node->funcname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcname") - 1);
     XXH3_freeState(prev);
   }
   if (node->is_procedure) {
-    _fingerprintString(ctx, "is_procedure");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_procedure", "true");
   }
 
   // Intentionally ignoring node->options for fingerprinting
@@ -12790,20 +10783,16 @@ _fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "parameters");
+    _fingerprintLiteral(ctx, "parameters");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->parameters, node, "parameters", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->parameters) == 1 && linitial(node->parameters) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->parameters, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->parameters) == 1 && linitial(node->parameters) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("parameters") - 1);
     XXH3_freeState(prev);
   }
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->returnType != NULL) {
@@ -12811,15 +10800,12 @@ _fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "returnType");
+    _fingerprintLiteral(ctx, "returnType");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->returnType, node, "returnType", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->returnType, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("returnType") - 1);
     XXH3_freeState(prev);
   }
 
@@ -12828,37 +10814,31 @@ _fingerprintCreateFunctionStmt(FingerprintContext *ctx, const CreateFunctionStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sql_body");
+    _fingerprintLiteral(ctx, "sql_body");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->sql_body, node, "sql_body", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->sql_body, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sql_body") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->argType != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "argType");
+    _fingerprintLiteral(ctx, "argType");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->argType, node, "argType", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->argType, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("argType") - 1);
     XXH3_freeState(prev);
   }
 
@@ -12867,20 +10847,17 @@ _fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "defexpr");
+    _fingerprintLiteral(ctx, "defexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->defexpr, node, "defexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->defexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("defexpr") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "mode");
+    _fingerprintLiteral(ctx, "mode");
     _fingerprintString(ctx, _enumToStringFunctionParameterMode(node->mode));
   }
 
@@ -12889,22 +10866,19 @@ _fingerprintFunctionParameter(FingerprintContext *ctx, const FunctionParameter *
 }
 
 static void
-_fingerprintAlterFunctionStmt(FingerprintContext *ctx, const AlterFunctionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterFunctionStmt(FingerprintContext *ctx, const AlterFunctionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->actions != NULL && node->actions->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "actions");
+    _fingerprintLiteral(ctx, "actions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->actions, node, "actions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->actions) == 1 && linitial(node->actions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->actions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->actions) == 1 && linitial(node->actions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("actions") - 1);
     XXH3_freeState(prev);
   }
   if (node->func != NULL) {
@@ -12912,76 +10886,66 @@ _fingerprintAlterFunctionStmt(FingerprintContext *ctx, const AlterFunctionStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func");
+    _fingerprintLiteral(ctx, "func");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->func, node, "func", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->func, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
 }
 
 static void
-_fingerprintDoStmt(FingerprintContext *ctx, const DoStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDoStmt(FingerprintContext *ctx, const DoStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->args for fingerprinting
 
 }
 
 static void
-_fingerprintInlineCodeBlock(FingerprintContext *ctx, const InlineCodeBlock *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintInlineCodeBlock(FingerprintContext *ctx, const InlineCodeBlock *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->atomic) {
-    _fingerprintString(ctx, "atomic");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "atomic", "true");
   }
 
   if (node->langIsTrusted) {
-    _fingerprintString(ctx, "langIsTrusted");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "langIsTrusted", "true");
   }
 
   if (node->langOid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->langOid);
-    _fingerprintString(ctx, "langOid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "langOid");
+    _fingerprintInt64(ctx, node->langOid);
   }
 
   if (node->source_text != NULL) {
-    _fingerprintString(ctx, "source_text");
+    _fingerprintLiteral(ctx, "source_text");
     _fingerprintString(ctx, node->source_text);
   }
 
 }
 
 static void
-_fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->funccall != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funccall");
+    _fingerprintLiteral(ctx, "funccall");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintFuncCall(ctx, node->funccall, node, "funccall", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintFuncCall(ctx, node->funccall, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funccall") - 1);
     XXH3_freeState(prev);
   }
 
@@ -12990,15 +10954,12 @@ _fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "funcexpr");
+    _fingerprintLiteral(ctx, "funcexpr");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintFuncExpr(ctx, node->funcexpr, node, "funcexpr", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintFuncExpr(ctx, node->funcexpr, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("funcexpr") - 1);
     XXH3_freeState(prev);
   }
 
@@ -13007,44 +10968,39 @@ _fingerprintCallStmt(FingerprintContext *ctx, const CallStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "outargs");
+    _fingerprintLiteral(ctx, "outargs");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->outargs, node, "outargs", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->outargs) == 1 && linitial(node->outargs) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->outargs, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->outargs) == 1 && linitial(node->outargs) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("outargs") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCallContext(FingerprintContext *ctx, const CallContext *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCallContext(FingerprintContext *ctx, const CallContext *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->atomic) {
-    _fingerprintString(ctx, "atomic");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "atomic", "true");
   }
 
 }
 
 static void
-_fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->newname != NULL) {
-    _fingerprintString(ctx, "newname");
+    _fingerprintLiteral(ctx, "newname");
     _fingerprintString(ctx, node->newname);
   }
 
@@ -13053,15 +11009,12 @@ _fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
@@ -13070,40 +11023,37 @@ _fingerprintRenameStmt(FingerprintContext *ctx, const RenameStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "relationType");
+    _fingerprintLiteral(ctx, "relationType");
     _fingerprintString(ctx, _enumToStringObjectType(node->relationType));
   }
 
   if (true) {
-    _fingerprintString(ctx, "renameType");
+    _fingerprintLiteral(ctx, "renameType");
     _fingerprintString(ctx, _enumToStringObjectType(node->renameType));
   }
 
   if (node->subname != NULL) {
-    _fingerprintString(ctx, "subname");
+    _fingerprintLiteral(ctx, "subname");
     _fingerprintString(ctx, node->subname);
   }
 
 }
 
 static void
-_fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDependsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDependsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
-  if (strlen(node->extname->sval) > 0) {
-    _fingerprintString(ctx, "extname");
+  if (node->extname->sval[0] != '\0') {
+    _fingerprintLiteral(ctx, "extname");
     _fingerprintString(ctx, node->extname->sval);
   }
 
@@ -13112,20 +11062,17 @@ _fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDep
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objectType");
+    _fingerprintLiteral(ctx, "objectType");
     _fingerprintString(ctx, _enumToStringObjectType(node->objectType));
   }
 
@@ -13134,35 +11081,30 @@ _fingerprintAlterObjectDependsStmt(FingerprintContext *ctx, const AlterObjectDep
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->remove) {
-    _fingerprintString(ctx, "remove");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "remove", "true");
   }
 
 }
 
 static void
-_fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSchemaStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSchemaStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->newschema != NULL) {
-    _fingerprintString(ctx, "newschema");
+    _fingerprintLiteral(ctx, "newschema");
     _fingerprintString(ctx, node->newschema);
   }
 
@@ -13171,20 +11113,17 @@ _fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSche
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objectType");
+    _fingerprintLiteral(ctx, "objectType");
     _fingerprintString(ctx, _enumToStringObjectType(node->objectType));
   }
 
@@ -13193,37 +11132,31 @@ _fingerprintAlterObjectSchemaStmt(FingerprintContext *ctx, const AlterObjectSche
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->newowner != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "newowner");
+    _fingerprintLiteral(ctx, "newowner");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->newowner, node, "newowner", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->newowner, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("newowner") - 1);
     XXH3_freeState(prev);
   }
 
@@ -13232,20 +11165,17 @@ _fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "object");
+    _fingerprintLiteral(ctx, "object");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->object, node, "object", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->object, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("object") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "objectType");
+    _fingerprintLiteral(ctx, "objectType");
     _fingerprintString(ctx, _enumToStringObjectType(node->objectType));
   }
 
@@ -13254,37 +11184,31 @@ _fingerprintAlterOwnerStmt(FingerprintContext *ctx, const AlterOwnerStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintAlterOperatorStmt(FingerprintContext *ctx, const AlterOperatorStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterOperatorStmt(FingerprintContext *ctx, const AlterOperatorStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->opername != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "opername");
+    _fingerprintLiteral(ctx, "opername");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->opername, node, "opername", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->opername, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("opername") - 1);
     XXH3_freeState(prev);
   }
 
@@ -13293,36 +11217,30 @@ _fingerprintAlterOperatorStmt(FingerprintContext *ctx, const AlterOperatorStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterTypeStmt(FingerprintContext *ctx, const AlterTypeStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTypeStmt(FingerprintContext *ctx, const AlterTypeStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != NULL && node->options->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->typeName != NULL && node->typeName->length > 0) {
@@ -13330,46 +11248,39 @@ _fingerprintAlterTypeStmt(FingerprintContext *ctx, const AlterTypeStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->actions != NULL && node->actions->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "actions");
+    _fingerprintLiteral(ctx, "actions");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->actions, node, "actions", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->actions) == 1 && linitial(node->actions) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->actions, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->actions) == 1 && linitial(node->actions) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("actions") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "event");
+    _fingerprintLiteral(ctx, "event");
     _fingerprintString(ctx, _enumToStringCmdType(node->event));
   }
 
   if (node->instead) {
-    _fingerprintString(ctx, "instead");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "instead", "true");
   }
 
   if (node->relation != NULL) {
@@ -13377,25 +11288,21 @@ _fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->rulename != NULL) {
-    _fingerprintString(ctx, "rulename");
+    _fingerprintLiteral(ctx, "rulename");
     _fingerprintString(ctx, node->rulename);
   }
 
@@ -13404,58 +11311,54 @@ _fingerprintRuleStmt(FingerprintContext *ctx, const RuleStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintNotifyStmt(FingerprintContext *ctx, const NotifyStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintNotifyStmt(FingerprintContext *ctx, const NotifyStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->conditionname for fingerprinting
 
   if (node->payload != NULL) {
-    _fingerprintString(ctx, "payload");
+    _fingerprintLiteral(ctx, "payload");
     _fingerprintString(ctx, node->payload);
   }
 
 }
 
 static void
-_fingerprintListenStmt(FingerprintContext *ctx, const ListenStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintListenStmt(FingerprintContext *ctx, const ListenStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->conditionname for fingerprinting
 
 }
 
 static void
-_fingerprintUnlistenStmt(FingerprintContext *ctx, const UnlistenStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintUnlistenStmt(FingerprintContext *ctx, const UnlistenStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->conditionname for fingerprinting
 
 }
 
 static void
-_fingerprintTransactionStmt(FingerprintContext *ctx, const TransactionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintTransactionStmt(FingerprintContext *ctx, const TransactionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->chain) {
-    _fingerprintString(ctx, "chain");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "chain", "true");
   }
 
   // Intentionally ignoring node->gid for fingerprinting
 
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringTransactionStmtKind(node->kind));
   }
 
@@ -13468,22 +11371,19 @@ _fingerprintTransactionStmt(FingerprintContext *ctx, const TransactionStmt *node
 }
 
 static void
-_fingerprintCompositeTypeStmt(FingerprintContext *ctx, const CompositeTypeStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCompositeTypeStmt(FingerprintContext *ctx, const CompositeTypeStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->coldeflist != NULL && node->coldeflist->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "coldeflist");
+    _fingerprintLiteral(ctx, "coldeflist");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->coldeflist, node, "coldeflist", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldeflist) == 1 && linitial(node->coldeflist) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->coldeflist, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->coldeflist) == 1 && linitial(node->coldeflist) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("coldeflist") - 1);
     XXH3_freeState(prev);
   }
   if (node->typevar != NULL) {
@@ -13491,37 +11391,31 @@ _fingerprintCompositeTypeStmt(FingerprintContext *ctx, const CompositeTypeStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typevar");
+    _fingerprintLiteral(ctx, "typevar");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->typevar, node, "typevar", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->typevar, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typevar") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateEnumStmt(FingerprintContext *ctx, const CreateEnumStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateEnumStmt(FingerprintContext *ctx, const CreateEnumStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->typeName != NULL && node->typeName->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
   if (node->vals != NULL && node->vals->length > 0) {
@@ -13529,36 +11423,30 @@ _fingerprintCreateEnumStmt(FingerprintContext *ctx, const CreateEnumStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "vals");
+    _fingerprintLiteral(ctx, "vals");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->vals, node, "vals", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->vals) == 1 && linitial(node->vals) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->vals, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->vals) == 1 && linitial(node->vals) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("vals") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateRangeStmt(FingerprintContext *ctx, const CreateRangeStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateRangeStmt(FingerprintContext *ctx, const CreateRangeStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->params != NULL && node->params->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "params");
+    _fingerprintLiteral(ctx, "params");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->params, node, "params", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->params, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("params") - 1);
     XXH3_freeState(prev);
   }
   if (node->typeName != NULL && node->typeName->length > 0) {
@@ -13566,45 +11454,40 @@ _fingerprintCreateRangeStmt(FingerprintContext *ctx, const CreateRangeStmt *node
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterEnumStmt(FingerprintContext *ctx, const AlterEnumStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterEnumStmt(FingerprintContext *ctx, const AlterEnumStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->newVal != NULL) {
-    _fingerprintString(ctx, "newVal");
+    _fingerprintLiteral(ctx, "newVal");
     _fingerprintString(ctx, node->newVal);
   }
 
   if (node->newValIsAfter) {
-    _fingerprintString(ctx, "newValIsAfter");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "newValIsAfter", "true");
   }
 
   if (node->newValNeighbor != NULL) {
-    _fingerprintString(ctx, "newValNeighbor");
+    _fingerprintLiteral(ctx, "newValNeighbor");
     _fingerprintString(ctx, node->newValNeighbor);
   }
 
   if (node->oldVal != NULL) {
-    _fingerprintString(ctx, "oldVal");
+    _fingerprintLiteral(ctx, "oldVal");
     _fingerprintString(ctx, node->oldVal);
   }
 
   if (node->skipIfNewValExists) {
-    _fingerprintString(ctx, "skipIfNewValExists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "skipIfNewValExists", "true");
   }
 
   if (node->typeName != NULL && node->typeName->length > 0) {
@@ -13612,36 +11495,30 @@ _fingerprintAlterEnumStmt(FingerprintContext *ctx, const AlterEnumStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "typeName");
+    _fingerprintLiteral(ctx, "typeName");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->typeName, node, "typeName", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->typeName, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->typeName) == 1 && linitial(node->typeName) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("typeName") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->aliases != NULL && node->aliases->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "aliases");
+    _fingerprintLiteral(ctx, "aliases");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->aliases, node, "aliases", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aliases) == 1 && linitial(node->aliases) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->aliases, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->aliases) == 1 && linitial(node->aliases) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("aliases") - 1);
     XXH3_freeState(prev);
   }
   if (node->options != NULL && node->options->length > 0) {
@@ -13649,15 +11526,12 @@ _fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->query != NULL) {
@@ -13665,21 +11539,17 @@ _fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->view != NULL) {
@@ -13687,40 +11557,37 @@ _fingerprintViewStmt(FingerprintContext *ctx, const ViewStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "view");
+    _fingerprintLiteral(ctx, "view");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->view, node, "view", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->view, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("view") - 1);
     XXH3_freeState(prev);
   }
 
   if (true) {
-    _fingerprintString(ctx, "withCheckOption");
+    _fingerprintLiteral(ctx, "withCheckOption");
     _fingerprintString(ctx, _enumToStringViewCheckOption(node->withCheckOption));
   }
 
 }
 
 static void
-_fingerprintLoadStmt(FingerprintContext *ctx, const LoadStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintLoadStmt(FingerprintContext *ctx, const LoadStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->filename != NULL) {
-    _fingerprintString(ctx, "filename");
+    _fingerprintLiteral(ctx, "filename");
     _fingerprintString(ctx, node->filename);
   }
 
 }
 
 static void
-_fingerprintCreatedbStmt(FingerprintContext *ctx, const CreatedbStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreatedbStmt(FingerprintContext *ctx, const CreatedbStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dbname != NULL) {
-    _fingerprintString(ctx, "dbname");
+    _fingerprintLiteral(ctx, "dbname");
     _fingerprintString(ctx, node->dbname);
   }
 
@@ -13729,24 +11596,21 @@ _fingerprintCreatedbStmt(FingerprintContext *ctx, const CreatedbStmt *node, cons
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterDatabaseStmt(FingerprintContext *ctx, const AlterDatabaseStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterDatabaseStmt(FingerprintContext *ctx, const AlterDatabaseStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dbname != NULL) {
-    _fingerprintString(ctx, "dbname");
+    _fingerprintLiteral(ctx, "dbname");
     _fingerprintString(ctx, node->dbname);
   }
 
@@ -13755,34 +11619,31 @@ _fingerprintAlterDatabaseStmt(FingerprintContext *ctx, const AlterDatabaseStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterDatabaseRefreshCollStmt(FingerprintContext *ctx, const AlterDatabaseRefreshCollStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterDatabaseRefreshCollStmt(FingerprintContext *ctx, const AlterDatabaseRefreshCollStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dbname != NULL) {
-    _fingerprintString(ctx, "dbname");
+    _fingerprintLiteral(ctx, "dbname");
     _fingerprintString(ctx, node->dbname);
   }
 
 }
 
 static void
-_fingerprintAlterDatabaseSetStmt(FingerprintContext *ctx, const AlterDatabaseSetStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterDatabaseSetStmt(FingerprintContext *ctx, const AlterDatabaseSetStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dbname != NULL) {
-    _fingerprintString(ctx, "dbname");
+    _fingerprintLiteral(ctx, "dbname");
     _fingerprintString(ctx, node->dbname);
   }
 
@@ -13791,31 +11652,27 @@ _fingerprintAlterDatabaseSetStmt(FingerprintContext *ctx, const AlterDatabaseSet
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "setstmt");
+    _fingerprintLiteral(ctx, "setstmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintVariableSetStmt(ctx, node->setstmt, node, "setstmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintVariableSetStmt(ctx, node->setstmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("setstmt") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintDropdbStmt(FingerprintContext *ctx, const DropdbStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropdbStmt(FingerprintContext *ctx, const DropdbStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dbname != NULL) {
-    _fingerprintString(ctx, "dbname");
+    _fingerprintLiteral(ctx, "dbname");
     _fingerprintString(ctx, node->dbname);
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -13823,46 +11680,40 @@ _fingerprintDropdbStmt(FingerprintContext *ctx, const DropdbStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterSystemStmt(FingerprintContext *ctx, const AlterSystemStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterSystemStmt(FingerprintContext *ctx, const AlterSystemStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->setstmt != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "setstmt");
+    _fingerprintLiteral(ctx, "setstmt");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintVariableSetStmt(ctx, node->setstmt, node, "setstmt", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintVariableSetStmt(ctx, node->setstmt, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("setstmt") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->indexname != NULL) {
-    _fingerprintString(ctx, "indexname");
+    _fingerprintLiteral(ctx, "indexname");
     _fingerprintString(ctx, node->indexname);
   }
 
@@ -13871,15 +11722,12 @@ _fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "params");
+    _fingerprintLiteral(ctx, "params");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->params, node, "params", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->params, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("params") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -13887,26 +11735,22 @@ _fingerprintClusterStmt(FingerprintContext *ctx, const ClusterStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->is_vacuumcmd) {
-    _fingerprintString(ctx, "is_vacuumcmd");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_vacuumcmd", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -13914,15 +11758,12 @@ _fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->rels != NULL && node->rels->length > 0) {
@@ -13930,27 +11771,22 @@ _fingerprintVacuumStmt(FingerprintContext *ctx, const VacuumStmt *node, const vo
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "rels");
+    _fingerprintLiteral(ctx, "rels");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->rels, node, "rels", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rels) == 1 && linitial(node->rels) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->rels, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->rels) == 1 && linitial(node->rels) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("rels") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->oid != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->oid);
-    _fingerprintString(ctx, "oid");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "oid");
+    _fingerprintInt64(ctx, node->oid);
   }
 
   if (node->relation != NULL) {
@@ -13958,15 +11794,12 @@ _fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -13975,36 +11808,30 @@ _fingerprintVacuumRelation(FingerprintContext *ctx, const VacuumRelation *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "va_cols");
+    _fingerprintLiteral(ctx, "va_cols");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->va_cols, node, "va_cols", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->va_cols) == 1 && linitial(node->va_cols) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->va_cols, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->va_cols) == 1 && linitial(node->va_cols) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("va_cols") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintExplainStmt(FingerprintContext *ctx, const ExplainStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintExplainStmt(FingerprintContext *ctx, const ExplainStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->options != NULL && node->options->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->query != NULL) {
@@ -14012,26 +11839,22 @@ _fingerprintExplainStmt(FingerprintContext *ctx, const ExplainStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->if_not_exists) {
-    _fingerprintString(ctx, "if_not_exists");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "if_not_exists", "true");
   }
 
   if (node->into != NULL) {
@@ -14039,25 +11862,21 @@ _fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "into");
+    _fingerprintLiteral(ctx, "into");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintIntoClause(ctx, node->into, node, "into", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintIntoClause(ctx, node->into, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("into") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->is_select_into) {
-    _fingerprintString(ctx, "is_select_into");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "is_select_into", "true");
   }
 
   if (true) {
-    _fingerprintString(ctx, "objtype");
+    _fingerprintLiteral(ctx, "objtype");
     _fingerprintString(ctx, _enumToStringObjectType(node->objtype));
   }
 
@@ -14066,26 +11885,22 @@ _fingerprintCreateTableAsStmt(FingerprintContext *ctx, const CreateTableAsStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintRefreshMatViewStmt(FingerprintContext *ctx, const RefreshMatViewStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintRefreshMatViewStmt(FingerprintContext *ctx, const RefreshMatViewStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->concurrent) {
-    _fingerprintString(ctx, "concurrent");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "concurrent", "true");
   }
 
   if (node->relation != NULL) {
@@ -14093,53 +11908,46 @@ _fingerprintRefreshMatViewStmt(FingerprintContext *ctx, const RefreshMatViewStmt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->skipData) {
-    _fingerprintString(ctx, "skipData");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "skipData", "true");
   }
 
 }
 
 static void
-_fingerprintCheckPointStmt(FingerprintContext *ctx, const CheckPointStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCheckPointStmt(FingerprintContext *ctx, const CheckPointStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
 }
 
 static void
-_fingerprintDiscardStmt(FingerprintContext *ctx, const DiscardStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDiscardStmt(FingerprintContext *ctx, const DiscardStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "target");
+    _fingerprintLiteral(ctx, "target");
     _fingerprintString(ctx, _enumToStringDiscardMode(node->target));
   }
 
 }
 
 static void
-_fingerprintLockStmt(FingerprintContext *ctx, const LockStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintLockStmt(FingerprintContext *ctx, const LockStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->mode != 0) {
-    char buffer[50];
-    sprintf(buffer, "%d", node->mode);
-    _fingerprintString(ctx, "mode");
-    _fingerprintString(ctx, buffer);
+    _fingerprintLiteral(ctx, "mode");
+    _fingerprintInt64(ctx, node->mode);
   }
 
   if (node->nowait) {
-    _fingerprintString(ctx, "nowait");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "nowait", "true");
   }
 
   if (node->relations != NULL && node->relations->length > 0) {
@@ -14147,55 +11955,48 @@ _fingerprintLockStmt(FingerprintContext *ctx, const LockStmt *node, const void *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relations");
+    _fingerprintLiteral(ctx, "relations");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->relations, node, "relations", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->relations, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->relations) == 1 && linitial(node->relations) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relations") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintConstraintsSetStmt(FingerprintContext *ctx, const ConstraintsSetStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintConstraintsSetStmt(FingerprintContext *ctx, const ConstraintsSetStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->constraints != NULL && node->constraints->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "constraints");
+    _fingerprintLiteral(ctx, "constraints");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->constraints, node, "constraints", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->constraints, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->constraints) == 1 && linitial(node->constraints) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("constraints") - 1);
     XXH3_freeState(prev);
   }
   if (node->deferred) {
-    _fingerprintString(ctx, "deferred");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "deferred", "true");
   }
 
 }
 
 static void
-_fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringReindexObjectType(node->kind));
   }
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
@@ -14204,15 +12005,12 @@ _fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "params");
+    _fingerprintLiteral(ctx, "params");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->params, node, "params", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->params, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("params") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -14220,46 +12018,39 @@ _fingerprintReindexStmt(FingerprintContext *ctx, const ReindexStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateConversionStmt(FingerprintContext *ctx, const CreateConversionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateConversionStmt(FingerprintContext *ctx, const CreateConversionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->conversion_name != NULL && node->conversion_name->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "conversion_name");
+    _fingerprintLiteral(ctx, "conversion_name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->conversion_name, node, "conversion_name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->conversion_name) == 1 && linitial(node->conversion_name) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->conversion_name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->conversion_name) == 1 && linitial(node->conversion_name) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("conversion_name") - 1);
     XXH3_freeState(prev);
   }
   if (node->def) {
-    _fingerprintString(ctx, "def");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "def", "true");
   }
 
   if (node->for_encoding_name != NULL) {
-    _fingerprintString(ctx, "for_encoding_name");
+    _fingerprintLiteral(ctx, "for_encoding_name");
     _fingerprintString(ctx, node->for_encoding_name);
   }
 
@@ -14268,29 +12059,26 @@ _fingerprintCreateConversionStmt(FingerprintContext *ctx, const CreateConversion
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func_name");
+    _fingerprintLiteral(ctx, "func_name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->func_name, node, "func_name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_name) == 1 && linitial(node->func_name) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->func_name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->func_name) == 1 && linitial(node->func_name) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func_name") - 1);
     XXH3_freeState(prev);
   }
   if (node->to_encoding_name != NULL) {
-    _fingerprintString(ctx, "to_encoding_name");
+    _fingerprintLiteral(ctx, "to_encoding_name");
     _fingerprintString(ctx, node->to_encoding_name);
   }
 
 }
 
 static void
-_fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "context");
+    _fingerprintLiteral(ctx, "context");
     _fingerprintString(ctx, _enumToStringCoercionContext(node->context));
   }
 
@@ -14299,21 +12087,17 @@ _fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "func");
+    _fingerprintLiteral(ctx, "func");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->func, node, "func", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->func, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("func") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->inout) {
-    _fingerprintString(ctx, "inout");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "inout", "true");
   }
 
   if (node->sourcetype != NULL) {
@@ -14321,15 +12105,12 @@ _fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "sourcetype");
+    _fingerprintLiteral(ctx, "sourcetype");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->sourcetype, node, "sourcetype", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->sourcetype, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("sourcetype") - 1);
     XXH3_freeState(prev);
   }
 
@@ -14338,48 +12119,41 @@ _fingerprintCreateCastStmt(FingerprintContext *ctx, const CreateCastStmt *node,
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "targettype");
+    _fingerprintLiteral(ctx, "targettype");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->targettype, node, "targettype", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->targettype, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("targettype") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->fromsql != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "fromsql");
+    _fingerprintLiteral(ctx, "fromsql");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->fromsql, node, "fromsql", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->fromsql, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("fromsql") - 1);
     XXH3_freeState(prev);
   }
 
   if (node->lang != NULL) {
-    _fingerprintString(ctx, "lang");
+    _fingerprintLiteral(ctx, "lang");
     _fingerprintString(ctx, node->lang);
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->tosql != NULL) {
@@ -14387,15 +12161,12 @@ _fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "tosql");
+    _fingerprintLiteral(ctx, "tosql");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintObjectWithArgs(ctx, node->tosql, node, "tosql", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintObjectWithArgs(ctx, node->tosql, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("tosql") - 1);
     XXH3_freeState(prev);
   }
 
@@ -14404,37 +12175,31 @@ _fingerprintCreateTransformStmt(FingerprintContext *ctx, const CreateTransformSt
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "type_name");
+    _fingerprintLiteral(ctx, "type_name");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintTypeName(ctx, node->type_name, node, "type_name", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintTypeName(ctx, node->type_name, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("type_name") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintPrepareStmt(FingerprintContext *ctx, const PrepareStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPrepareStmt(FingerprintContext *ctx, const PrepareStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->argtypes != NULL && node->argtypes->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "argtypes");
+    _fingerprintLiteral(ctx, "argtypes");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->argtypes, node, "argtypes", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->argtypes) == 1 && linitial(node->argtypes) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->argtypes, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->argtypes) == 1 && linitial(node->argtypes) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("argtypes") - 1);
     XXH3_freeState(prev);
   }
   // Intentionally ignoring node->name for fingerprinting
@@ -14444,22 +12209,19 @@ _fingerprintPrepareStmt(FingerprintContext *ctx, const PrepareStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "query");
+    _fingerprintLiteral(ctx, "query");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->query, node, "query", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->query, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("query") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintExecuteStmt(FingerprintContext *ctx, const ExecuteStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintExecuteStmt(FingerprintContext *ctx, const ExecuteStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->name for fingerprinting
 
@@ -14468,25 +12230,21 @@ _fingerprintExecuteStmt(FingerprintContext *ctx, const ExecuteStmt *node, const
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "params");
+    _fingerprintLiteral(ctx, "params");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->params, node, "params", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->params, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->params) == 1 && linitial(node->params) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("params") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintDeallocateStmt(FingerprintContext *ctx, const DeallocateStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDeallocateStmt(FingerprintContext *ctx, const DeallocateStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->isall) {
-    _fingerprintString(ctx, "isall");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "isall", "true");
   }
 
   // Intentionally ignoring node->location for fingerprinting
@@ -14496,10 +12254,10 @@ _fingerprintDeallocateStmt(FingerprintContext *ctx, const DeallocateStmt *node,
 }
 
 static void
-_fingerprintDropOwnedStmt(FingerprintContext *ctx, const DropOwnedStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropOwnedStmt(FingerprintContext *ctx, const DropOwnedStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
@@ -14508,36 +12266,30 @@ _fingerprintDropOwnedStmt(FingerprintContext *ctx, const DropOwnedStmt *node, co
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintReassignOwnedStmt(FingerprintContext *ctx, const ReassignOwnedStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintReassignOwnedStmt(FingerprintContext *ctx, const ReassignOwnedStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->newrole != NULL) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "newrole");
+    _fingerprintLiteral(ctx, "newrole");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRoleSpec(ctx, node->newrole, node, "newrole", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRoleSpec(ctx, node->newrole, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("newrole") - 1);
     XXH3_freeState(prev);
   }
 
@@ -14546,36 +12298,30 @@ _fingerprintReassignOwnedStmt(FingerprintContext *ctx, const ReassignOwnedStmt *
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "roles");
+    _fingerprintLiteral(ctx, "roles");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->roles, node, "roles", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->roles, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->roles) == 1 && linitial(node->roles) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("roles") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterTSDictionaryStmt(FingerprintContext *ctx, const AlterTSDictionaryStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTSDictionaryStmt(FingerprintContext *ctx, const AlterTSDictionaryStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->dictname != NULL && node->dictname->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "dictname");
+    _fingerprintLiteral(ctx, "dictname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->dictname, node, "dictname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->dictname) == 1 && linitial(node->dictname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->dictname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->dictname) == 1 && linitial(node->dictname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("dictname") - 1);
     XXH3_freeState(prev);
   }
   if (node->options != NULL && node->options->length > 0) {
@@ -14583,36 +12329,30 @@ _fingerprintAlterTSDictionaryStmt(FingerprintContext *ctx, const AlterTSDictiona
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfigurationStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfigurationStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->cfgname != NULL && node->cfgname->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "cfgname");
+    _fingerprintLiteral(ctx, "cfgname");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->cfgname, node, "cfgname", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cfgname) == 1 && linitial(node->cfgname) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->cfgname, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->cfgname) == 1 && linitial(node->cfgname) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("cfgname") - 1);
     XXH3_freeState(prev);
   }
   if (node->dicts != NULL && node->dicts->length > 0) {
@@ -14620,35 +12360,29 @@ _fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfi
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "dicts");
+    _fingerprintLiteral(ctx, "dicts");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->dicts, node, "dicts", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->dicts) == 1 && linitial(node->dicts) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->dicts, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->dicts) == 1 && linitial(node->dicts) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("dicts") - 1);
     XXH3_freeState(prev);
   }
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringAlterTSConfigType(node->kind));
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->override) {
-    _fingerprintString(ctx, "override");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "override", "true");
   }
 
   if (node->replace) {
-    _fingerprintString(ctx, "replace");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "replace", "true");
   }
 
   if (node->tokentype != NULL && node->tokentype->length > 0) {
@@ -14656,36 +12390,30 @@ _fingerprintAlterTSConfigurationStmt(FingerprintContext *ctx, const AlterTSConfi
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "tokentype");
+    _fingerprintLiteral(ctx, "tokentype");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->tokentype, node, "tokentype", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->tokentype) == 1 && linitial(node->tokentype) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->tokentype, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->tokentype) == 1 && linitial(node->tokentype) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("tokentype") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->columns != NULL && node->columns->length > 0) {
     XXH3_state_t* prev = XXH3_createState();
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "columns");
+    _fingerprintLiteral(ctx, "columns");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->columns, node, "columns", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->columns, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->columns) == 1 && linitial(node->columns) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("columns") - 1);
     XXH3_freeState(prev);
   }
   if (node->relation != NULL) {
@@ -14693,15 +12421,12 @@ _fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "relation");
+    _fingerprintLiteral(ctx, "relation");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintRangeVar(ctx, node->relation, node, "relation", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintRangeVar(ctx, node->relation, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("relation") - 1);
     XXH3_freeState(prev);
   }
 
@@ -14710,32 +12435,29 @@ _fingerprintPublicationTable(FingerprintContext *ctx, const PublicationTable *no
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "whereClause");
+    _fingerprintLiteral(ctx, "whereClause");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->whereClause, node, "whereClause", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->whereClause, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("whereClause") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintPublicationObjSpec(FingerprintContext *ctx, const PublicationObjSpec *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintPublicationObjSpec(FingerprintContext *ctx, const PublicationObjSpec *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   // Intentionally ignoring node->location for fingerprinting
 
   if (node->name != NULL) {
-    _fingerprintString(ctx, "name");
+    _fingerprintLiteral(ctx, "name");
     _fingerprintString(ctx, node->name);
   }
 
   if (true) {
-    _fingerprintString(ctx, "pubobjtype");
+    _fingerprintLiteral(ctx, "pubobjtype");
     _fingerprintString(ctx, _enumToStringPublicationObjSpecType(node->pubobjtype));
   }
 
@@ -14744,26 +12466,22 @@ _fingerprintPublicationObjSpec(FingerprintContext *ctx, const PublicationObjSpec
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pubtable");
+    _fingerprintLiteral(ctx, "pubtable");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintPublicationTable(ctx, node->pubtable, node, "pubtable", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintPublicationTable(ctx, node->pubtable, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pubtable") - 1);
     XXH3_freeState(prev);
   }
 
 }
 
 static void
-_fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicationStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicationStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->for_all_tables) {
-    _fingerprintString(ctx, "for_all_tables");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "for_all_tables", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -14771,19 +12489,16 @@ _fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicati
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->pubname != NULL) {
-    _fingerprintString(ctx, "pubname");
+    _fingerprintLiteral(ctx, "pubname");
     _fingerprintString(ctx, node->pubname);
   }
 
@@ -14792,30 +12507,26 @@ _fingerprintCreatePublicationStmt(FingerprintContext *ctx, const CreatePublicati
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pubobjects");
+    _fingerprintLiteral(ctx, "pubobjects");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->pubobjects, node, "pubobjects", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pubobjects) == 1 && linitial(node->pubobjects) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->pubobjects, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pubobjects) == 1 && linitial(node->pubobjects) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pubobjects") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublicationStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublicationStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "action");
+    _fingerprintLiteral(ctx, "action");
     _fingerprintString(ctx, _enumToStringAlterPublicationAction(node->action));
   }
 
   if (node->for_all_tables) {
-    _fingerprintString(ctx, "for_all_tables");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "for_all_tables", "true");
   }
 
   if (node->options != NULL && node->options->length > 0) {
@@ -14823,19 +12534,16 @@ _fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublication
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->pubname != NULL) {
-    _fingerprintString(ctx, "pubname");
+    _fingerprintLiteral(ctx, "pubname");
     _fingerprintString(ctx, node->pubname);
   }
 
@@ -14844,24 +12552,21 @@ _fingerprintAlterPublicationStmt(FingerprintContext *ctx, const AlterPublication
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "pubobjects");
+    _fingerprintLiteral(ctx, "pubobjects");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->pubobjects, node, "pubobjects", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pubobjects) == 1 && linitial(node->pubobjects) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->pubobjects, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->pubobjects) == 1 && linitial(node->pubobjects) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("pubobjects") - 1);
     XXH3_freeState(prev);
   }
 }
 
 static void
-_fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->conninfo != NULL) {
-    _fingerprintString(ctx, "conninfo");
+    _fingerprintLiteral(ctx, "conninfo");
     _fingerprintString(ctx, node->conninfo);
   }
 
@@ -14870,15 +12575,12 @@ _fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscrip
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->publication != NULL && node->publication->length > 0) {
@@ -14886,34 +12588,31 @@ _fingerprintCreateSubscriptionStmt(FingerprintContext *ctx, const CreateSubscrip
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "publication");
+    _fingerprintLiteral(ctx, "publication");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->publication, node, "publication", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->publication) == 1 && linitial(node->publication) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->publication, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->publication) == 1 && linitial(node->publication) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("publication") - 1);
     XXH3_freeState(prev);
   }
   if (node->subname != NULL) {
-    _fingerprintString(ctx, "subname");
+    _fingerprintLiteral(ctx, "subname");
     _fingerprintString(ctx, node->subname);
   }
 
 }
 
 static void
-_fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (node->conninfo != NULL) {
-    _fingerprintString(ctx, "conninfo");
+    _fingerprintLiteral(ctx, "conninfo");
     _fingerprintString(ctx, node->conninfo);
   }
 
   if (true) {
-    _fingerprintString(ctx, "kind");
+    _fingerprintLiteral(ctx, "kind");
     _fingerprintString(ctx, _enumToStringAlterSubscriptionType(node->kind));
   }
 
@@ -14922,15 +12621,12 @@ _fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscripti
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "options");
+    _fingerprintLiteral(ctx, "options");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->options, node, "options", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->options, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->options) == 1 && linitial(node->options) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("options") - 1);
     XXH3_freeState(prev);
   }
   if (node->publication != NULL && node->publication->length > 0) {
@@ -14938,39 +12634,35 @@ _fingerprintAlterSubscriptionStmt(FingerprintContext *ctx, const AlterSubscripti
     XXH64_hash_t hash;
 
     XXH3_copyState(prev, ctx->xxh_state);
-    _fingerprintString(ctx, "publication");
+    _fingerprintLiteral(ctx, "publication");
 
     hash = XXH3_64bits_digest(ctx->xxh_state);
-    _fingerprintNode(ctx, node->publication, node, "publication", depth + 1);
-    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->publication) == 1 && linitial(node->publication) == NIL)) {
-      XXH3_copyState(ctx->xxh_state, prev);
-      if (ctx->write_tokens)
-        dlist_delete(dlist_tail_node(&ctx->tokens));
-    }
+    _fingerprintNode(ctx, node->publication, node, FINGERPRINT_FIELD_OTHER, depth + 1);
+    if (hash == XXH3_64bits_digest(ctx->xxh_state) && !(list_length(node->publication) == 1 && linitial(node->publication) == NIL))
+      _fingerprintDiscardFieldName(ctx, prev, sizeof("publication") - 1);
     XXH3_freeState(prev);
   }
   if (node->subname != NULL) {
-    _fingerprintString(ctx, "subname");
+    _fingerprintLiteral(ctx, "subname");
     _fingerprintString(ctx, node->subname);
   }
 
 }
 
 static void
-_fingerprintDropSubscriptionStmt(FingerprintContext *ctx, const DropSubscriptionStmt *node, const void *parent, const char *field_name, unsigned int depth)
+_fingerprintDropSubscriptionStmt(FingerprintContext *ctx, const DropSubscriptionStmt *node, const void *parent, FingerprintField field, unsigned int depth)
 {
   if (true) {
-    _fingerprintString(ctx, "behavior");
+    _fingerprintLiteral(ctx, "behavior");
     _fingerprintString(ctx, _enumToStringDropBehavior(node->behavior));
   }
 
   if (node->missing_ok) {
-    _fingerprintString(ctx, "missing_ok");
-    _fingerprintString(ctx, "true");
+    _fingerprintLiteralPair(ctx, "missing_ok", "true");
   }
 
   if (node->subname != NULL) {
-    _fingerprintString(ctx, "subname");
+    _fingerprintLiteral(ctx, "subname");
     _fingerprintString(ctx, node->subname);
   }
 
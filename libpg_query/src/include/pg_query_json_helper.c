@@ -20,12 +20,20 @@ _outToken(StringInfo buf, const char *str)
 		return;
 	}
 
-	// copied directly from https://github.com/postgres/postgres/blob/master/src/backend/utils/adt/json.c#L2428
+	// based on https://github.com/postgres/postgres/blob/master/src/backend/utils/adt/json.c#L2428,
+	// but copies the runs of characters that need no escaping in one go
 	const char *p;
+	const char *run = str;
 
 	appendStringInfoCharMacro(buf, '"');
 	for (p = str; *p; p++)
 	{
+		if ((unsigned char) *p >= ' ' && *p != '"' && *p != '\\' && *p != '<' && *p != '>')
+			continue;
+
+		appendBinaryStringInfo(buf, run, p - run);
+		run = p + 1;
+
 		switch (*p)
 		{
 			case '\b':
@@ -50,12 +58,10 @@ _outToken(StringInfo buf, const char *str)
 				appendStringInfoString(buf, "\\\\");
 				break;
 			default:
-				if ((unsigned char) *p < ' ' || *p == '<' || *p == '>')
-					appendStringInfo(buf, "\\u%04x", (int) *p);
-				else
-					appendStringInfoCharMacro(buf, *p);
+				appendStringInfo(buf, "\\u%04x", (int) *p);
 				break;
 		}
 	}
+	appendBinaryStringInfo(buf, run, p - run);
 	appendStringInfoCharMacro(buf, '"');
 }
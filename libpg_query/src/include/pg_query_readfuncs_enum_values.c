@@ -0,0 +1,521 @@
+// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb
+
+READ_ENUM_VALUE(QuerySource, QUERY_SOURCE_UNDEFINED, 0)
+READ_ENUM_VALUE(QuerySource, QSRC_ORIGINAL, 1)
+READ_ENUM_VALUE(QuerySource, QSRC_PARSER, 2)
+READ_ENUM_VALUE(QuerySource, QSRC_INSTEAD_RULE, 3)
+READ_ENUM_VALUE(QuerySource, QSRC_QUAL_INSTEAD_RULE, 4)
+READ_ENUM_VALUE(QuerySource, QSRC_NON_INSTEAD_RULE, 5)
+READ_ENUM_VALUE(SortByDir, SORT_BY_DIR_UNDEFINED, 0)
+READ_ENUM_VALUE(SortByDir, SORTBY_DEFAULT, 1)
+READ_ENUM_VALUE(SortByDir, SORTBY_ASC, 2)
+READ_ENUM_VALUE(SortByDir, SORTBY_DESC, 3)
+READ_ENUM_VALUE(SortByDir, SORTBY_USING, 4)
+READ_ENUM_VALUE(SortByNulls, SORT_BY_NULLS_UNDEFINED, 0)
+READ_ENUM_VALUE(SortByNulls, SORTBY_NULLS_DEFAULT, 1)
+READ_ENUM_VALUE(SortByNulls, SORTBY_NULLS_FIRST, 2)
+READ_ENUM_VALUE(SortByNulls, SORTBY_NULLS_LAST, 3)
+READ_ENUM_VALUE(SetQuantifier, SET_QUANTIFIER_UNDEFINED, 0)
+READ_ENUM_VALUE(SetQuantifier, SET_QUANTIFIER_DEFAULT, 1)
+READ_ENUM_VALUE(SetQuantifier, SET_QUANTIFIER_ALL, 2)
+READ_ENUM_VALUE(SetQuantifier, SET_QUANTIFIER_DISTINCT, 3)
+READ_ENUM_VALUE(A_Expr_Kind, A_EXPR_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_OP, 1)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_OP_ANY, 2)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_OP_ALL, 3)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_DISTINCT, 4)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_NOT_DISTINCT, 5)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_NULLIF, 6)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_IN, 7)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_LIKE, 8)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_ILIKE, 9)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_SIMILAR, 10)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_BETWEEN, 11)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_NOT_BETWEEN, 12)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_BETWEEN_SYM, 13)
+READ_ENUM_VALUE(A_Expr_Kind, AEXPR_NOT_BETWEEN_SYM, 14)
+READ_ENUM_VALUE(RoleSpecType, ROLE_SPEC_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(RoleSpecType, ROLESPEC_CSTRING, 1)
+READ_ENUM_VALUE(RoleSpecType, ROLESPEC_CURRENT_ROLE, 2)
+READ_ENUM_VALUE(RoleSpecType, ROLESPEC_CURRENT_USER, 3)
+READ_ENUM_VALUE(RoleSpecType, ROLESPEC_SESSION_USER, 4)
+READ_ENUM_VALUE(RoleSpecType, ROLESPEC_PUBLIC, 5)
+READ_ENUM_VALUE(TableLikeOption, TABLE_LIKE_OPTION_UNDEFINED, 0)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_COMMENTS, 1)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_COMPRESSION, 2)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_CONSTRAINTS, 3)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_DEFAULTS, 4)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_GENERATED, 5)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_IDENTITY, 6)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_INDEXES, 7)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_STATISTICS, 8)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_STORAGE, 9)
+READ_ENUM_VALUE(TableLikeOption, CREATE_TABLE_LIKE_ALL, 10)
+READ_ENUM_VALUE(DefElemAction, DEF_ELEM_ACTION_UNDEFINED, 0)
+READ_ENUM_VALUE(DefElemAction, DEFELEM_UNSPEC, 1)
+READ_ENUM_VALUE(DefElemAction, DEFELEM_SET, 2)
+READ_ENUM_VALUE(DefElemAction, DEFELEM_ADD, 3)
+READ_ENUM_VALUE(DefElemAction, DEFELEM_DROP, 4)
+READ_ENUM_VALUE(PartitionStrategy, PARTITION_STRATEGY_UNDEFINED, 0)
+READ_ENUM_VALUE(PartitionStrategy, PARTITION_STRATEGY_LIST, 1)
+READ_ENUM_VALUE(PartitionStrategy, PARTITION_STRATEGY_RANGE, 2)
+READ_ENUM_VALUE(PartitionStrategy, PARTITION_STRATEGY_HASH, 3)
+READ_ENUM_VALUE(PartitionRangeDatumKind, PARTITION_RANGE_DATUM_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(PartitionRangeDatumKind, PARTITION_RANGE_DATUM_MINVALUE, 1)
+READ_ENUM_VALUE(PartitionRangeDatumKind, PARTITION_RANGE_DATUM_VALUE, 2)
+READ_ENUM_VALUE(PartitionRangeDatumKind, PARTITION_RANGE_DATUM_MAXVALUE, 3)
+READ_ENUM_VALUE(RTEKind, RTEKIND_UNDEFINED, 0)
+READ_ENUM_VALUE(RTEKind, RTE_RELATION, 1)
+READ_ENUM_VALUE(RTEKind, RTE_SUBQUERY, 2)
+READ_ENUM_VALUE(RTEKind, RTE_JOIN, 3)
+READ_ENUM_VALUE(RTEKind, RTE_FUNCTION, 4)
+READ_ENUM_VALUE(RTEKind, RTE_TABLEFUNC, 5)
+READ_ENUM_VALUE(RTEKind, RTE_VALUES, 6)
+READ_ENUM_VALUE(RTEKind, RTE_CTE, 7)
+READ_ENUM_VALUE(RTEKind, RTE_NAMEDTUPLESTORE, 8)
+READ_ENUM_VALUE(RTEKind, RTE_RESULT, 9)
+READ_ENUM_VALUE(WCOKind, WCOKIND_UNDEFINED, 0)
+READ_ENUM_VALUE(WCOKind, WCO_VIEW_CHECK, 1)
+READ_ENUM_VALUE(WCOKind, WCO_RLS_INSERT_CHECK, 2)
+READ_ENUM_VALUE(WCOKind, WCO_RLS_UPDATE_CHECK, 3)
+READ_ENUM_VALUE(WCOKind, WCO_RLS_CONFLICT_CHECK, 4)
+READ_ENUM_VALUE(WCOKind, WCO_RLS_MERGE_UPDATE_CHECK, 5)
+READ_ENUM_VALUE(WCOKind, WCO_RLS_MERGE_DELETE_CHECK, 6)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_EMPTY, 1)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_SIMPLE, 2)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_ROLLUP, 3)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_CUBE, 4)
+READ_ENUM_VALUE(GroupingSetKind, GROUPING_SET_SETS, 5)
+READ_ENUM_VALUE(CTEMaterialize, CTEMATERIALIZE_UNDEFINED, 0)
+READ_ENUM_VALUE(CTEMaterialize, CTEMaterializeDefault, 1)
+READ_ENUM_VALUE(CTEMaterialize, CTEMaterializeAlways, 2)
+READ_ENUM_VALUE(CTEMaterialize, CTEMaterializeNever, 3)
+READ_ENUM_VALUE(JsonQuotes, JSON_QUOTES_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonQuotes, JS_QUOTES_UNSPEC, 1)
+READ_ENUM_VALUE(JsonQuotes, JS_QUOTES_KEEP, 2)
+READ_ENUM_VALUE(JsonQuotes, JS_QUOTES_OMIT, 3)
+READ_ENUM_VALUE(JsonTableColumnType, JSON_TABLE_COLUMN_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonTableColumnType, JTC_FOR_ORDINALITY, 1)
+READ_ENUM_VALUE(JsonTableColumnType, JTC_REGULAR, 2)
+READ_ENUM_VALUE(JsonTableColumnType, JTC_EXISTS, 3)
+READ_ENUM_VALUE(JsonTableColumnType, JTC_FORMATTED, 4)
+READ_ENUM_VALUE(JsonTableColumnType, JTC_NESTED, 5)
+READ_ENUM_VALUE(SetOperation, SET_OPERATION_UNDEFINED, 0)
+READ_ENUM_VALUE(SetOperation, SETOP_NONE, 1)
+READ_ENUM_VALUE(SetOperation, SETOP_UNION, 2)
+READ_ENUM_VALUE(SetOperation, SETOP_INTERSECT, 3)
+READ_ENUM_VALUE(SetOperation, SETOP_EXCEPT, 4)
+READ_ENUM_VALUE(ObjectType, OBJECT_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(ObjectType, OBJECT_ACCESS_METHOD, 1)
+READ_ENUM_VALUE(ObjectType, OBJECT_AGGREGATE, 2)
+READ_ENUM_VALUE(ObjectType, OBJECT_AMOP, 3)
+READ_ENUM_VALUE(ObjectType, OBJECT_AMPROC, 4)
+READ_ENUM_VALUE(ObjectType, OBJECT_ATTRIBUTE, 5)
+READ_ENUM_VALUE(ObjectType, OBJECT_CAST, 6)
+READ_ENUM_VALUE(ObjectType, OBJECT_COLUMN, 7)
+READ_ENUM_VALUE(ObjectType, OBJECT_COLLATION, 8)
+READ_ENUM_VALUE(ObjectType, OBJECT_CONVERSION, 9)
+READ_ENUM_VALUE(ObjectType, OBJECT_DATABASE, 10)
+READ_ENUM_VALUE(ObjectType, OBJECT_DEFAULT, 11)
+READ_ENUM_VALUE(ObjectType, OBJECT_DEFACL, 12)
+READ_ENUM_VALUE(ObjectType, OBJECT_DOMAIN, 13)
+READ_ENUM_VALUE(ObjectType, OBJECT_DOMCONSTRAINT, 14)
+READ_ENUM_VALUE(ObjectType, OBJECT_EVENT_TRIGGER, 15)
+READ_ENUM_VALUE(ObjectType, OBJECT_EXTENSION, 16)
+READ_ENUM_VALUE(ObjectType, OBJECT_FDW, 17)
+READ_ENUM_VALUE(ObjectType, OBJECT_FOREIGN_SERVER, 18)
+READ_ENUM_VALUE(ObjectType, OBJECT_FOREIGN_TABLE, 19)
+READ_ENUM_VALUE(ObjectType, OBJECT_FUNCTION, 20)
+READ_ENUM_VALUE(ObjectType, OBJECT_INDEX, 21)
+READ_ENUM_VALUE(ObjectType, OBJECT_LANGUAGE, 22)
+READ_ENUM_VALUE(ObjectType, OBJECT_LARGEOBJECT, 23)
+READ_ENUM_VALUE(ObjectType, OBJECT_MATVIEW, 24)
+READ_ENUM_VALUE(ObjectType, OBJECT_OPCLASS, 25)
+READ_ENUM_VALUE(ObjectType, OBJECT_OPERATOR, 26)
+READ_ENUM_VALUE(ObjectType, OBJECT_OPFAMILY, 27)
+READ_ENUM_VALUE(ObjectType, OBJECT_PARAMETER_ACL, 28)
+READ_ENUM_VALUE(ObjectType, OBJECT_POLICY, 29)
+READ_ENUM_VALUE(ObjectType, OBJECT_PROCEDURE, 30)
+READ_ENUM_VALUE(ObjectType, OBJECT_PUBLICATION, 31)
+READ_ENUM_VALUE(ObjectType, OBJECT_PUBLICATION_NAMESPACE, 32)
+READ_ENUM_VALUE(ObjectType, OBJECT_PUBLICATION_REL, 33)
+READ_ENUM_VALUE(ObjectType, OBJECT_ROLE, 34)
+READ_ENUM_VALUE(ObjectType, OBJECT_ROUTINE, 35)
+READ_ENUM_VALUE(ObjectType, OBJECT_RULE, 36)
+READ_ENUM_VALUE(ObjectType, OBJECT_SCHEMA, 37)
+READ_ENUM_VALUE(ObjectType, OBJECT_SEQUENCE, 38)
+READ_ENUM_VALUE(ObjectType, OBJECT_SUBSCRIPTION, 39)
+READ_ENUM_VALUE(ObjectType, OBJECT_STATISTIC_EXT, 40)
+READ_ENUM_VALUE(ObjectType, OBJECT_TABCONSTRAINT, 41)
+READ_ENUM_VALUE(ObjectType, OBJECT_TABLE, 42)
+READ_ENUM_VALUE(ObjectType, OBJECT_TABLESPACE, 43)
+READ_ENUM_VALUE(ObjectType, OBJECT_TRANSFORM, 44)
+READ_ENUM_VALUE(ObjectType, OBJECT_TRIGGER, 45)
+READ_ENUM_VALUE(ObjectType, OBJECT_TSCONFIGURATION, 46)
+READ_ENUM_VALUE(ObjectType, OBJECT_TSDICTIONARY, 47)
+READ_ENUM_VALUE(ObjectType, OBJECT_TSPARSER, 48)
+READ_ENUM_VALUE(ObjectType, OBJECT_TSTEMPLATE, 49)
+READ_ENUM_VALUE(ObjectType, OBJECT_TYPE, 50)
+READ_ENUM_VALUE(ObjectType, OBJECT_USER_MAPPING, 51)
+READ_ENUM_VALUE(ObjectType, OBJECT_VIEW, 52)
+READ_ENUM_VALUE(DropBehavior, DROP_BEHAVIOR_UNDEFINED, 0)
+READ_ENUM_VALUE(DropBehavior, DROP_RESTRICT, 1)
+READ_ENUM_VALUE(DropBehavior, DROP_CASCADE, 2)
+READ_ENUM_VALUE(AlterTableType, ALTER_TABLE_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(AlterTableType, AT_AddColumn, 1)
+READ_ENUM_VALUE(AlterTableType, AT_AddColumnToView, 2)
+READ_ENUM_VALUE(AlterTableType, AT_ColumnDefault, 3)
+READ_ENUM_VALUE(AlterTableType, AT_CookedColumnDefault, 4)
+READ_ENUM_VALUE(AlterTableType, AT_DropNotNull, 5)
+READ_ENUM_VALUE(AlterTableType, AT_SetNotNull, 6)
+READ_ENUM_VALUE(AlterTableType, AT_SetExpression, 7)
+READ_ENUM_VALUE(AlterTableType, AT_DropExpression, 8)
+READ_ENUM_VALUE(AlterTableType, AT_CheckNotNull, 9)
+READ_ENUM_VALUE(AlterTableType, AT_SetStatistics, 10)
+READ_ENUM_VALUE(AlterTableType, AT_SetOptions, 11)
+READ_ENUM_VALUE(AlterTableType, AT_ResetOptions, 12)
+READ_ENUM_VALUE(AlterTableType, AT_SetStorage, 13)
+READ_ENUM_VALUE(AlterTableType, AT_SetCompression, 14)
+READ_ENUM_VALUE(AlterTableType, AT_DropColumn, 15)
+READ_ENUM_VALUE(AlterTableType, AT_AddIndex, 16)
+READ_ENUM_VALUE(AlterTableType, AT_ReAddIndex, 17)
+READ_ENUM_VALUE(AlterTableType, AT_AddConstraint, 18)
+READ_ENUM_VALUE(AlterTableType, AT_ReAddConstraint, 19)
+READ_ENUM_VALUE(AlterTableType, AT_ReAddDomainConstraint, 20)
+READ_ENUM_VALUE(AlterTableType, AT_AlterConstraint, 21)
+READ_ENUM_VALUE(AlterTableType, AT_ValidateConstraint, 22)
+READ_ENUM_VALUE(AlterTableType, AT_AddIndexConstraint, 23)
+READ_ENUM_VALUE(AlterTableType, AT_DropConstraint, 24)
+READ_ENUM_VALUE(AlterTableType, AT_ReAddComment, 25)
+READ_ENUM_VALUE(AlterTableType, AT_AlterColumnType, 26)
+READ_ENUM_VALUE(AlterTableType, AT_AlterColumnGenericOptions, 27)
+READ_ENUM_VALUE(AlterTableType, AT_ChangeOwner, 28)
+READ_ENUM_VALUE(AlterTableType, AT_ClusterOn, 29)
+READ_ENUM_VALUE(AlterTableType, AT_DropCluster, 30)
+READ_ENUM_VALUE(AlterTableType, AT_SetLogged, 31)
+READ_ENUM_VALUE(AlterTableType, AT_SetUnLogged, 32)
+READ_ENUM_VALUE(AlterTableType, AT_DropOids, 33)
+READ_ENUM_VALUE(AlterTableType, AT_SetAccessMethod, 34)
+READ_ENUM_VALUE(AlterTableType, AT_SetTableSpace, 35)
+READ_ENUM_VALUE(AlterTableType, AT_SetRelOptions, 36)
+READ_ENUM_VALUE(AlterTableType, AT_ResetRelOptions, 37)
+READ_ENUM_VALUE(AlterTableType, AT_ReplaceRelOptions, 38)
+READ_ENUM_VALUE(AlterTableType, AT_EnableTrig, 39)
+READ_ENUM_VALUE(AlterTableType, AT_EnableAlwaysTrig, 40)
+READ_ENUM_VALUE(AlterTableType, AT_EnableReplicaTrig, 41)
+READ_ENUM_VALUE(AlterTableType, AT_DisableTrig, 42)
+READ_ENUM_VALUE(AlterTableType, AT_EnableTrigAll, 43)
+READ_ENUM_VALUE(AlterTableType, AT_DisableTrigAll, 44)
+READ_ENUM_VALUE(AlterTableType, AT_EnableTrigUser, 45)
+READ_ENUM_VALUE(AlterTableType, AT_DisableTrigUser, 46)
+READ_ENUM_VALUE(AlterTableType, AT_EnableRule, 47)
+READ_ENUM_VALUE(AlterTableType, AT_EnableAlwaysRule, 48)
+READ_ENUM_VALUE(AlterTableType, AT_EnableReplicaRule, 49)
+READ_ENUM_VALUE(AlterTableType, AT_DisableRule, 50)
+READ_ENUM_VALUE(AlterTableType, AT_AddInherit, 51)
+READ_ENUM_VALUE(AlterTableType, AT_DropInherit, 52)
+READ_ENUM_VALUE(AlterTableType, AT_AddOf, 53)
+READ_ENUM_VALUE(AlterTableType, AT_DropOf, 54)
+READ_ENUM_VALUE(AlterTableType, AT_ReplicaIdentity, 55)
+READ_ENUM_VALUE(AlterTableType, AT_EnableRowSecurity, 56)
+READ_ENUM_VALUE(AlterTableType, AT_DisableRowSecurity, 57)
+READ_ENUM_VALUE(AlterTableType, AT_ForceRowSecurity, 58)
+READ_ENUM_VALUE(AlterTableType, AT_NoForceRowSecurity, 59)
+READ_ENUM_VALUE(AlterTableType, AT_GenericOptions, 60)
+READ_ENUM_VALUE(AlterTableType, AT_AttachPartition, 61)
+READ_ENUM_VALUE(AlterTableType, AT_DetachPartition, 62)
+READ_ENUM_VALUE(AlterTableType, AT_DetachPartitionFinalize, 63)
+READ_ENUM_VALUE(AlterTableType, AT_AddIdentity, 64)
+READ_ENUM_VALUE(AlterTableType, AT_SetIdentity, 65)
+READ_ENUM_VALUE(AlterTableType, AT_DropIdentity, 66)
+READ_ENUM_VALUE(AlterTableType, AT_ReAddStatistics, 67)
+READ_ENUM_VALUE(GrantTargetType, GRANT_TARGET_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(GrantTargetType, ACL_TARGET_OBJECT, 1)
+READ_ENUM_VALUE(GrantTargetType, ACL_TARGET_ALL_IN_SCHEMA, 2)
+READ_ENUM_VALUE(GrantTargetType, ACL_TARGET_DEFAULTS, 3)
+READ_ENUM_VALUE(VariableSetKind, VARIABLE_SET_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(VariableSetKind, VAR_SET_VALUE, 1)
+READ_ENUM_VALUE(VariableSetKind, VAR_SET_DEFAULT, 2)
+READ_ENUM_VALUE(VariableSetKind, VAR_SET_CURRENT, 3)
+READ_ENUM_VALUE(VariableSetKind, VAR_SET_MULTI, 4)
+READ_ENUM_VALUE(VariableSetKind, VAR_RESET, 5)
+READ_ENUM_VALUE(VariableSetKind, VAR_RESET_ALL, 6)
+READ_ENUM_VALUE(ConstrType, CONSTR_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(ConstrType, CONSTR_NULL, 1)
+READ_ENUM_VALUE(ConstrType, CONSTR_NOTNULL, 2)
+READ_ENUM_VALUE(ConstrType, CONSTR_DEFAULT, 3)
+READ_ENUM_VALUE(ConstrType, CONSTR_IDENTITY, 4)
+READ_ENUM_VALUE(ConstrType, CONSTR_GENERATED, 5)
+READ_ENUM_VALUE(ConstrType, CONSTR_CHECK, 6)
+READ_ENUM_VALUE(ConstrType, CONSTR_PRIMARY, 7)
+READ_ENUM_VALUE(ConstrType, CONSTR_UNIQUE, 8)
+READ_ENUM_VALUE(ConstrType, CONSTR_EXCLUSION, 9)
+READ_ENUM_VALUE(ConstrType, CONSTR_FOREIGN, 10)
+READ_ENUM_VALUE(ConstrType, CONSTR_ATTR_DEFERRABLE, 11)
+READ_ENUM_VALUE(ConstrType, CONSTR_ATTR_NOT_DEFERRABLE, 12)
+READ_ENUM_VALUE(ConstrType, CONSTR_ATTR_DEFERRED, 13)
+READ_ENUM_VALUE(ConstrType, CONSTR_ATTR_IMMEDIATE, 14)
+READ_ENUM_VALUE(ImportForeignSchemaType, IMPORT_FOREIGN_SCHEMA_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(ImportForeignSchemaType, FDW_IMPORT_SCHEMA_ALL, 1)
+READ_ENUM_VALUE(ImportForeignSchemaType, FDW_IMPORT_SCHEMA_LIMIT_TO, 2)
+READ_ENUM_VALUE(ImportForeignSchemaType, FDW_IMPORT_SCHEMA_EXCEPT, 3)
+READ_ENUM_VALUE(RoleStmtType, ROLE_STMT_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(RoleStmtType, ROLESTMT_ROLE, 1)
+READ_ENUM_VALUE(RoleStmtType, ROLESTMT_USER, 2)
+READ_ENUM_VALUE(RoleStmtType, ROLESTMT_GROUP, 3)
+READ_ENUM_VALUE(FetchDirection, FETCH_DIRECTION_UNDEFINED, 0)
+READ_ENUM_VALUE(FetchDirection, FETCH_FORWARD, 1)
+READ_ENUM_VALUE(FetchDirection, FETCH_BACKWARD, 2)
+READ_ENUM_VALUE(FetchDirection, FETCH_ABSOLUTE, 3)
+READ_ENUM_VALUE(FetchDirection, FETCH_RELATIVE, 4)
+READ_ENUM_VALUE(FunctionParameterMode, FUNCTION_PARAMETER_MODE_UNDEFINED, 0)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_IN, 1)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_OUT, 2)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_INOUT, 3)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_VARIADIC, 4)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_TABLE, 5)
+READ_ENUM_VALUE(FunctionParameterMode, FUNC_PARAM_DEFAULT, 6)
+READ_ENUM_VALUE(TransactionStmtKind, TRANSACTION_STMT_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_BEGIN, 1)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_START, 2)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_COMMIT, 3)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_ROLLBACK, 4)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_SAVEPOINT, 5)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_RELEASE, 6)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_ROLLBACK_TO, 7)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_PREPARE, 8)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_COMMIT_PREPARED, 9)
+READ_ENUM_VALUE(TransactionStmtKind, TRANS_STMT_ROLLBACK_PREPARED, 10)
+READ_ENUM_VALUE(ViewCheckOption, VIEW_CHECK_OPTION_UNDEFINED, 0)
+READ_ENUM_VALUE(ViewCheckOption, NO_CHECK_OPTION, 1)
+READ_ENUM_VALUE(ViewCheckOption, LOCAL_CHECK_OPTION, 2)
+READ_ENUM_VALUE(ViewCheckOption, CASCADED_CHECK_OPTION, 3)
+READ_ENUM_VALUE(DiscardMode, DISCARD_MODE_UNDEFINED, 0)
+READ_ENUM_VALUE(DiscardMode, DISCARD_ALL, 1)
+READ_ENUM_VALUE(DiscardMode, DISCARD_PLANS, 2)
+READ_ENUM_VALUE(DiscardMode, DISCARD_SEQUENCES, 3)
+READ_ENUM_VALUE(DiscardMode, DISCARD_TEMP, 4)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_INDEX, 1)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_TABLE, 2)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_SCHEMA, 3)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_SYSTEM, 4)
+READ_ENUM_VALUE(ReindexObjectType, REINDEX_OBJECT_DATABASE, 5)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_ADD_MAPPING, 1)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_ALTER_MAPPING_FOR_TOKEN, 2)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_REPLACE_DICT, 3)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_REPLACE_DICT_FOR_TOKEN, 4)
+READ_ENUM_VALUE(AlterTSConfigType, ALTER_TSCONFIG_DROP_MAPPING, 5)
+READ_ENUM_VALUE(PublicationObjSpecType, PUBLICATION_OBJ_SPEC_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(PublicationObjSpecType, PUBLICATIONOBJ_TABLE, 1)
+READ_ENUM_VALUE(PublicationObjSpecType, PUBLICATIONOBJ_TABLES_IN_SCHEMA, 2)
+READ_ENUM_VALUE(PublicationObjSpecType, PUBLICATIONOBJ_TABLES_IN_CUR_SCHEMA, 3)
+READ_ENUM_VALUE(PublicationObjSpecType, PUBLICATIONOBJ_CONTINUATION, 4)
+READ_ENUM_VALUE(AlterPublicationAction, ALTER_PUBLICATION_ACTION_UNDEFINED, 0)
+READ_ENUM_VALUE(AlterPublicationAction, AP_AddObjects, 1)
+READ_ENUM_VALUE(AlterPublicationAction, AP_DropObjects, 2)
+READ_ENUM_VALUE(AlterPublicationAction, AP_SetObjects, 3)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_OPTIONS, 1)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_CONNECTION, 2)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_SET_PUBLICATION, 3)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_ADD_PUBLICATION, 4)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_DROP_PUBLICATION, 5)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_REFRESH, 6)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_ENABLED, 7)
+READ_ENUM_VALUE(AlterSubscriptionType, ALTER_SUBSCRIPTION_SKIP, 8)
+READ_ENUM_VALUE(OverridingKind, OVERRIDING_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(OverridingKind, OVERRIDING_NOT_SET, 1)
+READ_ENUM_VALUE(OverridingKind, OVERRIDING_USER_VALUE, 2)
+READ_ENUM_VALUE(OverridingKind, OVERRIDING_SYSTEM_VALUE, 3)
+READ_ENUM_VALUE(OnCommitAction, ON_COMMIT_ACTION_UNDEFINED, 0)
+READ_ENUM_VALUE(OnCommitAction, ONCOMMIT_NOOP, 1)
+READ_ENUM_VALUE(OnCommitAction, ONCOMMIT_PRESERVE_ROWS, 2)
+READ_ENUM_VALUE(OnCommitAction, ONCOMMIT_DELETE_ROWS, 3)
+READ_ENUM_VALUE(OnCommitAction, ONCOMMIT_DROP, 4)
+READ_ENUM_VALUE(TableFuncType, TABLE_FUNC_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(TableFuncType, TFT_XMLTABLE, 1)
+READ_ENUM_VALUE(TableFuncType, TFT_JSON_TABLE, 2)
+READ_ENUM_VALUE(ParamKind, PARAM_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(ParamKind, PARAM_EXTERN, 1)
+READ_ENUM_VALUE(ParamKind, PARAM_EXEC, 2)
+READ_ENUM_VALUE(ParamKind, PARAM_SUBLINK, 3)
+READ_ENUM_VALUE(ParamKind, PARAM_MULTIEXPR, 4)
+READ_ENUM_VALUE(CoercionContext, COERCION_CONTEXT_UNDEFINED, 0)
+READ_ENUM_VALUE(CoercionContext, COERCION_IMPLICIT, 1)
+READ_ENUM_VALUE(CoercionContext, COERCION_ASSIGNMENT, 2)
+READ_ENUM_VALUE(CoercionContext, COERCION_PLPGSQL, 3)
+READ_ENUM_VALUE(CoercionContext, COERCION_EXPLICIT, 4)
+READ_ENUM_VALUE(CoercionForm, COERCION_FORM_UNDEFINED, 0)
+READ_ENUM_VALUE(CoercionForm, COERCE_EXPLICIT_CALL, 1)
+READ_ENUM_VALUE(CoercionForm, COERCE_EXPLICIT_CAST, 2)
+READ_ENUM_VALUE(CoercionForm, COERCE_IMPLICIT_CAST, 3)
+READ_ENUM_VALUE(CoercionForm, COERCE_SQL_SYNTAX, 4)
+READ_ENUM_VALUE(BoolExprType, BOOL_EXPR_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(BoolExprType, AND_EXPR, 1)
+READ_ENUM_VALUE(BoolExprType, OR_EXPR, 2)
+READ_ENUM_VALUE(BoolExprType, NOT_EXPR, 3)
+READ_ENUM_VALUE(SubLinkType, SUB_LINK_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(SubLinkType, EXISTS_SUBLINK, 1)
+READ_ENUM_VALUE(SubLinkType, ALL_SUBLINK, 2)
+READ_ENUM_VALUE(SubLinkType, ANY_SUBLINK, 3)
+READ_ENUM_VALUE(SubLinkType, ROWCOMPARE_SUBLINK, 4)
+READ_ENUM_VALUE(SubLinkType, EXPR_SUBLINK, 5)
+READ_ENUM_VALUE(SubLinkType, MULTIEXPR_SUBLINK, 6)
+READ_ENUM_VALUE(SubLinkType, ARRAY_SUBLINK, 7)
+READ_ENUM_VALUE(SubLinkType, CTE_SUBLINK, 8)
+READ_ENUM_VALUE(RowCompareType, ROW_COMPARE_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_LT, 1)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_LE, 2)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_EQ, 3)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_GE, 4)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_GT, 5)
+READ_ENUM_VALUE(RowCompareType, ROWCOMPARE_NE, 6)
+READ_ENUM_VALUE(MinMaxOp, MIN_MAX_OP_UNDEFINED, 0)
+READ_ENUM_VALUE(MinMaxOp, IS_GREATEST, 1)
+READ_ENUM_VALUE(MinMaxOp, IS_LEAST, 2)
+READ_ENUM_VALUE(SQLValueFunctionOp, SQLVALUE_FUNCTION_OP_UNDEFINED, 0)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_DATE, 1)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_TIME, 2)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_TIME_N, 3)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_TIMESTAMP, 4)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_TIMESTAMP_N, 5)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_LOCALTIME, 6)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_LOCALTIME_N, 7)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_LOCALTIMESTAMP, 8)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_LOCALTIMESTAMP_N, 9)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_ROLE, 10)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_USER, 11)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_USER, 12)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_SESSION_USER, 13)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_CATALOG, 14)
+READ_ENUM_VALUE(SQLValueFunctionOp, SVFOP_CURRENT_SCHEMA, 15)
+READ_ENUM_VALUE(XmlExprOp, XML_EXPR_OP_UNDEFINED, 0)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLCONCAT, 1)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLELEMENT, 2)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLFOREST, 3)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLPARSE, 4)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLPI, 5)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLROOT, 6)
+READ_ENUM_VALUE(XmlExprOp, IS_XMLSERIALIZE, 7)
+READ_ENUM_VALUE(XmlExprOp, IS_DOCUMENT, 8)
+READ_ENUM_VALUE(XmlOptionType, XML_OPTION_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(XmlOptionType, XMLOPTION_DOCUMENT, 1)
+READ_ENUM_VALUE(XmlOptionType, XMLOPTION_CONTENT, 2)
+READ_ENUM_VALUE(JsonEncoding, JSON_ENCODING_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonEncoding, JS_ENC_DEFAULT, 1)
+READ_ENUM_VALUE(JsonEncoding, JS_ENC_UTF8, 2)
+READ_ENUM_VALUE(JsonEncoding, JS_ENC_UTF16, 3)
+READ_ENUM_VALUE(JsonEncoding, JS_ENC_UTF32, 4)
+READ_ENUM_VALUE(JsonFormatType, JSON_FORMAT_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonFormatType, JS_FORMAT_DEFAULT, 1)
+READ_ENUM_VALUE(JsonFormatType, JS_FORMAT_JSON, 2)
+READ_ENUM_VALUE(JsonFormatType, JS_FORMAT_JSONB, 3)
+READ_ENUM_VALUE(JsonConstructorType, JSON_CONSTRUCTOR_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_OBJECT, 1)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_ARRAY, 2)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_OBJECTAGG, 3)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_ARRAYAGG, 4)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_PARSE, 5)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_SCALAR, 6)
+READ_ENUM_VALUE(JsonConstructorType, JSCTOR_JSON_SERIALIZE, 7)
+READ_ENUM_VALUE(JsonValueType, JSON_VALUE_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonValueType, JS_TYPE_ANY, 1)
+READ_ENUM_VALUE(JsonValueType, JS_TYPE_OBJECT, 2)
+READ_ENUM_VALUE(JsonValueType, JS_TYPE_ARRAY, 3)
+READ_ENUM_VALUE(JsonValueType, JS_TYPE_SCALAR, 4)
+READ_ENUM_VALUE(JsonWrapper, JSON_WRAPPER_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonWrapper, JSW_UNSPEC, 1)
+READ_ENUM_VALUE(JsonWrapper, JSW_NONE, 2)
+READ_ENUM_VALUE(JsonWrapper, JSW_CONDITIONAL, 3)
+READ_ENUM_VALUE(JsonWrapper, JSW_UNCONDITIONAL, 4)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_NULL, 1)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_ERROR, 2)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_EMPTY, 3)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_TRUE, 4)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_FALSE, 5)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_UNKNOWN, 6)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_EMPTY_ARRAY, 7)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_EMPTY_OBJECT, 8)
+READ_ENUM_VALUE(JsonBehaviorType, JSON_BEHAVIOR_DEFAULT, 9)
+READ_ENUM_VALUE(JsonExprOp, JSON_EXPR_OP_UNDEFINED, 0)
+READ_ENUM_VALUE(JsonExprOp, JSON_EXISTS_OP, 1)
+READ_ENUM_VALUE(JsonExprOp, JSON_QUERY_OP, 2)
+READ_ENUM_VALUE(JsonExprOp, JSON_VALUE_OP, 3)
+READ_ENUM_VALUE(JsonExprOp, JSON_TABLE_OP, 4)
+READ_ENUM_VALUE(NullTestType, NULL_TEST_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(NullTestType, IS_NULL, 1)
+READ_ENUM_VALUE(NullTestType, IS_NOT_NULL, 2)
+READ_ENUM_VALUE(BoolTestType, BOOL_TEST_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(BoolTestType, IS_TRUE, 1)
+READ_ENUM_VALUE(BoolTestType, IS_NOT_TRUE, 2)
+READ_ENUM_VALUE(BoolTestType, IS_FALSE, 3)
+READ_ENUM_VALUE(BoolTestType, IS_NOT_FALSE, 4)
+READ_ENUM_VALUE(BoolTestType, IS_UNKNOWN, 5)
+READ_ENUM_VALUE(BoolTestType, IS_NOT_UNKNOWN, 6)
+READ_ENUM_VALUE(MergeMatchKind, MERGE_MATCH_KIND_UNDEFINED, 0)
+READ_ENUM_VALUE(MergeMatchKind, MERGE_WHEN_MATCHED, 1)
+READ_ENUM_VALUE(MergeMatchKind, MERGE_WHEN_NOT_MATCHED_BY_SOURCE, 2)
+READ_ENUM_VALUE(MergeMatchKind, MERGE_WHEN_NOT_MATCHED_BY_TARGET, 3)
+READ_ENUM_VALUE(CmdType, CMD_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(CmdType, CMD_UNKNOWN, 1)
+READ_ENUM_VALUE(CmdType, CMD_SELECT, 2)
+READ_ENUM_VALUE(CmdType, CMD_UPDATE, 3)
+READ_ENUM_VALUE(CmdType, CMD_INSERT, 4)
+READ_ENUM_VALUE(CmdType, CMD_DELETE, 5)
+READ_ENUM_VALUE(CmdType, CMD_MERGE, 6)
+READ_ENUM_VALUE(CmdType, CMD_UTILITY, 7)
+READ_ENUM_VALUE(CmdType, CMD_NOTHING, 8)
+READ_ENUM_VALUE(JoinType, JOIN_TYPE_UNDEFINED, 0)
+READ_ENUM_VALUE(JoinType, JOIN_INNER, 1)
+READ_ENUM_VALUE(JoinType, JOIN_LEFT, 2)
+READ_ENUM_VALUE(JoinType, JOIN_FULL, 3)
+READ_ENUM_VALUE(JoinType, JOIN_RIGHT, 4)
+READ_ENUM_VALUE(JoinType, JOIN_SEMI, 5)
+READ_ENUM_VALUE(JoinType, JOIN_ANTI, 6)
+READ_ENUM_VALUE(JoinType, JOIN_RIGHT_ANTI, 7)
+READ_ENUM_VALUE(JoinType, JOIN_UNIQUE_OUTER, 8)
+READ_ENUM_VALUE(JoinType, JOIN_UNIQUE_INNER, 9)
+READ_ENUM_VALUE(AggStrategy, AGG_STRATEGY_UNDEFINED, 0)
+READ_ENUM_VALUE(AggStrategy, AGG_PLAIN, 1)
+READ_ENUM_VALUE(AggStrategy, AGG_SORTED, 2)
+READ_ENUM_VALUE(AggStrategy, AGG_HASHED, 3)
+READ_ENUM_VALUE(AggStrategy, AGG_MIXED, 4)
+READ_ENUM_VALUE(AggSplit, AGG_SPLIT_UNDEFINED, 0)
+READ_ENUM_VALUE(AggSplit, AGGSPLIT_SIMPLE, 1)
+READ_ENUM_VALUE(AggSplit, AGGSPLIT_INITIAL_SERIAL, 2)
+READ_ENUM_VALUE(AggSplit, AGGSPLIT_FINAL_DESERIAL, 3)
+READ_ENUM_VALUE(SetOpCmd, SET_OP_CMD_UNDEFINED, 0)
+READ_ENUM_VALUE(SetOpCmd, SETOPCMD_INTERSECT, 1)
+READ_ENUM_VALUE(SetOpCmd, SETOPCMD_INTERSECT_ALL, 2)
+READ_ENUM_VALUE(SetOpCmd, SETOPCMD_EXCEPT, 3)
+READ_ENUM_VALUE(SetOpCmd, SETOPCMD_EXCEPT_ALL, 4)
+READ_ENUM_VALUE(SetOpStrategy, SET_OP_STRATEGY_UNDEFINED, 0)
+READ_ENUM_VALUE(SetOpStrategy, SETOP_SORTED, 1)
+READ_ENUM_VALUE(SetOpStrategy, SETOP_HASHED, 2)
+READ_ENUM_VALUE(OnConflictAction, ON_CONFLICT_ACTION_UNDEFINED, 0)
+READ_ENUM_VALUE(OnConflictAction, ONCONFLICT_NONE, 1)
+READ_ENUM_VALUE(OnConflictAction, ONCONFLICT_NOTHING, 2)
+READ_ENUM_VALUE(OnConflictAction, ONCONFLICT_UPDATE, 3)
+READ_ENUM_VALUE(LimitOption, LIMIT_OPTION_UNDEFINED, 0)
+READ_ENUM_VALUE(LimitOption, LIMIT_OPTION_DEFAULT, 1)
+READ_ENUM_VALUE(LimitOption, LIMIT_OPTION_COUNT, 2)
+READ_ENUM_VALUE(LimitOption, LIMIT_OPTION_WITH_TIES, 3)
+READ_ENUM_VALUE(LockClauseStrength, LOCK_CLAUSE_STRENGTH_UNDEFINED, 0)
+READ_ENUM_VALUE(LockClauseStrength, LCS_NONE, 1)
+READ_ENUM_VALUE(LockClauseStrength, LCS_FORKEYSHARE, 2)
+READ_ENUM_VALUE(LockClauseStrength, LCS_FORSHARE, 3)
+READ_ENUM_VALUE(LockClauseStrength, LCS_FORNOKEYUPDATE, 4)
+READ_ENUM_VALUE(LockClauseStrength, LCS_FORUPDATE, 5)
+READ_ENUM_VALUE(LockWaitPolicy, LOCK_WAIT_POLICY_UNDEFINED, 0)
+READ_ENUM_VALUE(LockWaitPolicy, LockWaitBlock, 1)
+READ_ENUM_VALUE(LockWaitPolicy, LockWaitSkip, 2)
+READ_ENUM_VALUE(LockWaitPolicy, LockWaitError, 3)
+READ_ENUM_VALUE(LockTupleMode, LOCK_TUPLE_MODE_UNDEFINED, 0)
+READ_ENUM_VALUE(LockTupleMode, LockTupleKeyShare, 1)
+READ_ENUM_VALUE(LockTupleMode, LockTupleShare, 2)
+READ_ENUM_VALUE(LockTupleMode, LockTupleNoKeyExclusive, 3)
+READ_ENUM_VALUE(LockTupleMode, LockTupleExclusive, 4)
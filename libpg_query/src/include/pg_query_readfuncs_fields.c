@@ -0,0 +1,717 @@
+// This file is autogenerated by ./scripts/generate_protobuf_and_funcs.rb
+
+READ_FIELD_NAME(absent_on_null)
+READ_FIELD_NAME(access_method)
+READ_FIELD_NAME(action)
+READ_FIELD_NAME(actions)
+READ_FIELD_NAME(agg_distinct)
+READ_FIELD_NAME(agg_filter)
+READ_FIELD_NAME(agg_order)
+READ_FIELD_NAME(agg_star)
+READ_FIELD_NAME(agg_within_group)
+READ_FIELD_NAME(aggargtypes)
+READ_FIELD_NAME(aggcollid)
+READ_FIELD_NAME(aggdirectargs)
+READ_FIELD_NAME(aggdistinct)
+READ_FIELD_NAME(aggfilter)
+READ_FIELD_NAME(aggfnoid)
+READ_FIELD_NAME(aggkind)
+READ_FIELD_NAME(agglevelsup)
+READ_FIELD_NAME(aggno)
+READ_FIELD_NAME(aggorder)
+READ_FIELD_NAME(aggsplit)
+READ_FIELD_NAME(aggstar)
+READ_FIELD_NAME(aggtransno)
+READ_FIELD_NAME(aggtype)
+READ_FIELD_NAME(aggvariadic)
+READ_FIELD_NAME(alias)
+READ_FIELD_NAME(aliascolnames)
+READ_FIELD_NAME(aliases)
+READ_FIELD_NAME(aliasname)
+READ_FIELD_NAME(all)
+READ_FIELD_NAME(amname)
+READ_FIELD_NAME(amtype)
+READ_FIELD_NAME(arbiter_elems)
+READ_FIELD_NAME(arbiter_where)
+READ_FIELD_NAME(arg)
+READ_FIELD_NAME(arg_names)
+READ_FIELD_NAME(arg_type)
+READ_FIELD_NAME(argisrow)
+READ_FIELD_NAME(argnumber)
+READ_FIELD_NAME(args)
+READ_FIELD_NAME(args_unspecified)
+READ_FIELD_NAME(argtypes)
+READ_FIELD_NAME(array_bounds)
+READ_FIELD_NAME(array_collid)
+READ_FIELD_NAME(array_typeid)
+READ_FIELD_NAME(atomic)
+READ_FIELD_NAME(attlist)
+READ_FIELD_NAME(authrole)
+READ_FIELD_NAME(base_stmt)
+READ_FIELD_NAME(behavior)
+READ_FIELD_NAME(boolop)
+READ_FIELD_NAME(booltesttype)
+READ_FIELD_NAME(bound)
+READ_FIELD_NAME(btype)
+READ_FIELD_NAME(can_set_tag)
+READ_FIELD_NAME(cascaded)
+READ_FIELD_NAME(casecollid)
+READ_FIELD_NAME(casetype)
+READ_FIELD_NAME(catalogname)
+READ_FIELD_NAME(cfgname)
+READ_FIELD_NAME(chain)
+READ_FIELD_NAME(check_as_user)
+READ_FIELD_NAME(child)
+READ_FIELD_NAME(class_args)
+READ_FIELD_NAME(cmd_name)
+READ_FIELD_NAME(cmds)
+READ_FIELD_NAME(coalescecollid)
+READ_FIELD_NAME(coalescetype)
+READ_FIELD_NAME(coerce)
+READ_FIELD_NAME(coerceformat)
+READ_FIELD_NAME(coercion)
+READ_FIELD_NAME(coercionformat)
+READ_FIELD_NAME(col_collations)
+READ_FIELD_NAME(col_max)
+READ_FIELD_NAME(col_min)
+READ_FIELD_NAME(col_names)
+READ_FIELD_NAME(col_types)
+READ_FIELD_NAME(col_typmods)
+READ_FIELD_NAME(colcollations)
+READ_FIELD_NAME(coldefexpr)
+READ_FIELD_NAME(coldefexprs)
+READ_FIELD_NAME(coldeflist)
+READ_FIELD_NAME(colexpr)
+READ_FIELD_NAME(colexprs)
+READ_FIELD_NAME(coll_clause)
+READ_FIELD_NAME(coll_oid)
+READ_FIELD_NAME(collation)
+READ_FIELD_NAME(collname)
+READ_FIELD_NAME(colname)
+READ_FIELD_NAME(colnames)
+READ_FIELD_NAME(colno)
+READ_FIELD_NAME(cols)
+READ_FIELD_NAME(coltype)
+READ_FIELD_NAME(coltypes)
+READ_FIELD_NAME(coltypmods)
+READ_FIELD_NAME(column_name)
+READ_FIELD_NAME(columns)
+READ_FIELD_NAME(colvalexprs)
+READ_FIELD_NAME(command_type)
+READ_FIELD_NAME(comment)
+READ_FIELD_NAME(compression)
+READ_FIELD_NAME(concurrent)
+READ_FIELD_NAME(condition)
+READ_FIELD_NAME(conditionname)
+READ_FIELD_NAME(conname)
+READ_FIELD_NAME(conninfo)
+READ_FIELD_NAME(constbyval)
+READ_FIELD_NAME(constcollid)
+READ_FIELD_NAME(constisnull)
+READ_FIELD_NAME(constlen)
+READ_FIELD_NAME(constraint)
+READ_FIELD_NAME(constraint_deps)
+READ_FIELD_NAME(constraints)
+READ_FIELD_NAME(constrrel)
+READ_FIELD_NAME(constructor)
+READ_FIELD_NAME(consttype)
+READ_FIELD_NAME(consttypmod)
+READ_FIELD_NAME(constvalue)
+READ_FIELD_NAME(content)
+READ_FIELD_NAME(context)
+READ_FIELD_NAME(context_item)
+READ_FIELD_NAME(contype)
+READ_FIELD_NAME(conversion_name)
+READ_FIELD_NAME(convertformat)
+READ_FIELD_NAME(cooked_default)
+READ_FIELD_NAME(cooked_expr)
+READ_FIELD_NAME(copied_order)
+READ_FIELD_NAME(cte_list)
+READ_FIELD_NAME(ctecolcollations)
+READ_FIELD_NAME(ctecolnames)
+READ_FIELD_NAME(ctecoltypes)
+READ_FIELD_NAME(ctecoltypmods)
+READ_FIELD_NAME(ctelevelsup)
+READ_FIELD_NAME(ctematerialized)
+READ_FIELD_NAME(ctename)
+READ_FIELD_NAME(ctequery)
+READ_FIELD_NAME(cterecursive)
+READ_FIELD_NAME(cterefcount)
+READ_FIELD_NAME(ctes)
+READ_FIELD_NAME(cursor_name)
+READ_FIELD_NAME(cursor_param)
+READ_FIELD_NAME(cvarno)
+READ_FIELD_NAME(cycle_clause)
+READ_FIELD_NAME(cycle_col_list)
+READ_FIELD_NAME(cycle_mark_collation)
+READ_FIELD_NAME(cycle_mark_column)
+READ_FIELD_NAME(cycle_mark_default)
+READ_FIELD_NAME(cycle_mark_neop)
+READ_FIELD_NAME(cycle_mark_type)
+READ_FIELD_NAME(cycle_mark_typmod)
+READ_FIELD_NAME(cycle_mark_value)
+READ_FIELD_NAME(cycle_path_column)
+READ_FIELD_NAME(database)
+READ_FIELD_NAME(datatype)
+READ_FIELD_NAME(dbname)
+READ_FIELD_NAME(def)
+READ_FIELD_NAME(defaction)
+READ_FIELD_NAME(deferrable)
+READ_FIELD_NAME(deferred)
+READ_FIELD_NAME(defexpr)
+READ_FIELD_NAME(definition)
+READ_FIELD_NAME(defname)
+READ_FIELD_NAME(defnames)
+READ_FIELD_NAME(defnamespace)
+READ_FIELD_NAME(defresult)
+READ_FIELD_NAME(dictname)
+READ_FIELD_NAME(dicts)
+READ_FIELD_NAME(direction)
+READ_FIELD_NAME(distinct_clause)
+READ_FIELD_NAME(docexpr)
+READ_FIELD_NAME(domainname)
+READ_FIELD_NAME(element_typeid)
+READ_FIELD_NAME(elements)
+READ_FIELD_NAME(elemexpr)
+READ_FIELD_NAME(encoding)
+READ_FIELD_NAME(end_in_range_func)
+READ_FIELD_NAME(end_offset)
+READ_FIELD_NAME(enrname)
+READ_FIELD_NAME(enrtuples)
+READ_FIELD_NAME(eqop)
+READ_FIELD_NAME(eref)
+READ_FIELD_NAME(error_on_error)
+READ_FIELD_NAME(event)
+READ_FIELD_NAME(eventname)
+READ_FIELD_NAME(events)
+READ_FIELD_NAME(excl_rel_index)
+READ_FIELD_NAME(excl_rel_tlist)
+READ_FIELD_NAME(exclude_op_names)
+READ_FIELD_NAME(exclusions)
+READ_FIELD_NAME(expr)
+READ_FIELD_NAME(exprs)
+READ_FIELD_NAME(extname)
+READ_FIELD_NAME(fdwname)
+READ_FIELD_NAME(fdwoptions)
+READ_FIELD_NAME(fieldnum)
+READ_FIELD_NAME(fieldnums)
+READ_FIELD_NAME(fields)
+READ_FIELD_NAME(filename)
+READ_FIELD_NAME(first_col_collation)
+READ_FIELD_NAME(first_col_type)
+READ_FIELD_NAME(first_col_typmod)
+READ_FIELD_NAME(fk_attrs)
+READ_FIELD_NAME(fk_del_action)
+READ_FIELD_NAME(fk_del_set_cols)
+READ_FIELD_NAME(fk_matchtype)
+READ_FIELD_NAME(fk_upd_action)
+READ_FIELD_NAME(for_all_tables)
+READ_FIELD_NAME(for_encoding_name)
+READ_FIELD_NAME(for_identity)
+READ_FIELD_NAME(for_ordinality)
+READ_FIELD_NAME(format)
+READ_FIELD_NAME(format_type)
+READ_FIELD_NAME(formatted_expr)
+READ_FIELD_NAME(frame_options)
+READ_FIELD_NAME(from_clause)
+READ_FIELD_NAME(fromlist)
+READ_FIELD_NAME(fromsql)
+READ_FIELD_NAME(func)
+READ_FIELD_NAME(func_name)
+READ_FIELD_NAME(func_options)
+READ_FIELD_NAME(func_variadic)
+READ_FIELD_NAME(funccall)
+READ_FIELD_NAME(funccolcollations)
+READ_FIELD_NAME(funccolcount)
+READ_FIELD_NAME(funccollid)
+READ_FIELD_NAME(funccolnames)
+READ_FIELD_NAME(funccoltypes)
+READ_FIELD_NAME(funccoltypmods)
+READ_FIELD_NAME(funcexpr)
+READ_FIELD_NAME(funcformat)
+READ_FIELD_NAME(funcid)
+READ_FIELD_NAME(funcname)
+READ_FIELD_NAME(funcordinality)
+READ_FIELD_NAME(funcparams)
+READ_FIELD_NAME(funcresulttype)
+READ_FIELD_NAME(funcretset)
+READ_FIELD_NAME(functions)
+READ_FIELD_NAME(functype)
+READ_FIELD_NAME(funcvariadic)
+READ_FIELD_NAME(generated)
+READ_FIELD_NAME(generated_when)
+READ_FIELD_NAME(gid)
+READ_FIELD_NAME(grant_option)
+READ_FIELD_NAME(granted_roles)
+READ_FIELD_NAME(grantee_roles)
+READ_FIELD_NAME(grantees)
+READ_FIELD_NAME(grantor)
+READ_FIELD_NAME(group_clause)
+READ_FIELD_NAME(group_clauses)
+READ_FIELD_NAME(group_distinct)
+READ_FIELD_NAME(grouping_sets)
+READ_FIELD_NAME(handler_name)
+READ_FIELD_NAME(has_aggs)
+READ_FIELD_NAME(has_distinct_on)
+READ_FIELD_NAME(has_for_update)
+READ_FIELD_NAME(has_modifying_cte)
+READ_FIELD_NAME(has_recursive)
+READ_FIELD_NAME(has_row_security)
+READ_FIELD_NAME(has_sub_links)
+READ_FIELD_NAME(has_target_srfs)
+READ_FIELD_NAME(has_version)
+READ_FIELD_NAME(has_window_funcs)
+READ_FIELD_NAME(hashable)
+READ_FIELD_NAME(having_clause)
+READ_FIELD_NAME(having_qual)
+READ_FIELD_NAME(how_many)
+READ_FIELD_NAME(identity)
+READ_FIELD_NAME(identity_sequence)
+READ_FIELD_NAME(identity_type)
+READ_FIELD_NAME(idxcomment)
+READ_FIELD_NAME(idxname)
+READ_FIELD_NAME(if_not_exists)
+READ_FIELD_NAME(in_from_cl)
+READ_FIELD_NAME(in_range_asc)
+READ_FIELD_NAME(in_range_coll)
+READ_FIELD_NAME(in_range_nulls_first)
+READ_FIELD_NAME(including)
+READ_FIELD_NAME(indent)
+READ_FIELD_NAME(index_elems)
+READ_FIELD_NAME(index_including_params)
+READ_FIELD_NAME(index_oid)
+READ_FIELD_NAME(index_params)
+READ_FIELD_NAME(indexcolname)
+READ_FIELD_NAME(indexname)
+READ_FIELD_NAME(indexspace)
+READ_FIELD_NAME(indirection)
+READ_FIELD_NAME(infer)
+READ_FIELD_NAME(infercollid)
+READ_FIELD_NAME(inferopclass)
+READ_FIELD_NAME(inh)
+READ_FIELD_NAME(inh_relations)
+READ_FIELD_NAME(inhcount)
+READ_FIELD_NAME(initdeferred)
+READ_FIELD_NAME(initially_valid)
+READ_FIELD_NAME(inout)
+READ_FIELD_NAME(inputcollid)
+READ_FIELD_NAME(inputcollids)
+READ_FIELD_NAME(inserted_cols)
+READ_FIELD_NAME(instead)
+READ_FIELD_NAME(into)
+READ_FIELD_NAME(into_clause)
+READ_FIELD_NAME(is_default)
+READ_FIELD_NAME(is_drop)
+READ_FIELD_NAME(is_from)
+READ_FIELD_NAME(is_from_type)
+READ_FIELD_NAME(is_grant)
+READ_FIELD_NAME(is_local)
+READ_FIELD_NAME(is_natural)
+READ_FIELD_NAME(is_new)
+READ_FIELD_NAME(is_no_inherit)
+READ_FIELD_NAME(is_not_null)
+READ_FIELD_NAME(is_procedure)
+READ_FIELD_NAME(is_program)
+READ_FIELD_NAME(is_reset)
+READ_FIELD_NAME(is_return)
+READ_FIELD_NAME(is_rowsfrom)
+READ_FIELD_NAME(is_select_into)
+READ_FIELD_NAME(is_slice)
+READ_FIELD_NAME(is_table)
+READ_FIELD_NAME(is_vacuumcmd)
+READ_FIELD_NAME(isall)
+READ_FIELD_NAME(isconstraint)
+READ_FIELD_NAME(ismove)
+READ_FIELD_NAME(item_type)
+READ_FIELD_NAME(items)
+READ_FIELD_NAME(itemtype)
+READ_FIELD_NAME(join_condition)
+READ_FIELD_NAME(join_using_alias)
+READ_FIELD_NAME(joinaliasvars)
+READ_FIELD_NAME(joinleftcols)
+READ_FIELD_NAME(joinmergedcols)
+READ_FIELD_NAME(joinrightcols)
+READ_FIELD_NAME(jointree)
+READ_FIELD_NAME(jointype)
+READ_FIELD_NAME(key)
+READ_FIELD_NAME(keys)
+READ_FIELD_NAME(kind)
+READ_FIELD_NAME(label)
+READ_FIELD_NAME(lang)
+READ_FIELD_NAME(lang_is_trusted)
+READ_FIELD_NAME(lang_oid)
+READ_FIELD_NAME(larg)
+READ_FIELD_NAME(largs)
+READ_FIELD_NAME(lateral)
+READ_FIELD_NAME(lexpr)
+READ_FIELD_NAME(lidx)
+READ_FIELD_NAME(limit_count)
+READ_FIELD_NAME(limit_offset)
+READ_FIELD_NAME(limit_option)
+READ_FIELD_NAME(list_type)
+READ_FIELD_NAME(listdatums)
+READ_FIELD_NAME(local_schema)
+READ_FIELD_NAME(location)
+READ_FIELD_NAME(locked_rels)
+READ_FIELD_NAME(locking_clause)
+READ_FIELD_NAME(lowerdatums)
+READ_FIELD_NAME(lplan)
+READ_FIELD_NAME(match_kind)
+READ_FIELD_NAME(merge_action_list)
+READ_FIELD_NAME(merge_join_condition)
+READ_FIELD_NAME(merge_target_relation)
+READ_FIELD_NAME(merge_when_clauses)
+READ_FIELD_NAME(method)
+READ_FIELD_NAME(minmaxcollid)
+READ_FIELD_NAME(minmaxtype)
+READ_FIELD_NAME(missing_ok)
+READ_FIELD_NAME(mode)
+READ_FIELD_NAME(modulus)
+READ_FIELD_NAME(msfcollid)
+READ_FIELD_NAME(msftype)
+READ_FIELD_NAME(multidims)
+READ_FIELD_NAME(name)
+READ_FIELD_NAME(name_location)
+READ_FIELD_NAME(named_args)
+READ_FIELD_NAME(names)
+READ_FIELD_NAME(namespaces)
+READ_FIELD_NAME(ncolumns)
+READ_FIELD_NAME(new_tablespacename)
+READ_FIELD_NAME(new_val)
+READ_FIELD_NAME(new_val_is_after)
+READ_FIELD_NAME(new_val_neighbor)
+READ_FIELD_NAME(newname)
+READ_FIELD_NAME(newowner)
+READ_FIELD_NAME(newrole)
+READ_FIELD_NAME(newschema)
+READ_FIELD_NAME(newvals)
+READ_FIELD_NAME(nnames)
+READ_FIELD_NAME(node)
+READ_FIELD_NAME(notnulls)
+READ_FIELD_NAME(nowait)
+READ_FIELD_NAME(ns_names)
+READ_FIELD_NAME(ns_uris)
+READ_FIELD_NAME(nulls_first)
+READ_FIELD_NAME(nulls_not_distinct)
+READ_FIELD_NAME(nulls_ordering)
+READ_FIELD_NAME(nulltesttype)
+READ_FIELD_NAME(num)
+READ_FIELD_NAME(number)
+READ_FIELD_NAME(objargs)
+READ_FIELD_NAME(object)
+READ_FIELD_NAME(object_type)
+READ_FIELD_NAME(objects)
+READ_FIELD_NAME(objfuncargs)
+READ_FIELD_NAME(objname)
+READ_FIELD_NAME(objtype)
+READ_FIELD_NAME(of_typename)
+READ_FIELD_NAME(oid)
+READ_FIELD_NAME(old_conpfeqop)
+READ_FIELD_NAME(old_create_subid)
+READ_FIELD_NAME(old_first_relfilelocator_subid)
+READ_FIELD_NAME(old_number)
+READ_FIELD_NAME(old_pktable_oid)
+READ_FIELD_NAME(old_val)
+READ_FIELD_NAME(oldstyle)
+READ_FIELD_NAME(omit_quotes)
+READ_FIELD_NAME(on_commit)
+READ_FIELD_NAME(on_conflict)
+READ_FIELD_NAME(on_conflict_clause)
+READ_FIELD_NAME(on_conflict_set)
+READ_FIELD_NAME(on_conflict_where)
+READ_FIELD_NAME(on_empty)
+READ_FIELD_NAME(on_error)
+READ_FIELD_NAME(oncommit)
+READ_FIELD_NAME(op)
+READ_FIELD_NAME(opclass)
+READ_FIELD_NAME(opclassname)
+READ_FIELD_NAME(opclassopts)
+READ_FIELD_NAME(opcollid)
+READ_FIELD_NAME(oper_name)
+READ_FIELD_NAME(opername)
+READ_FIELD_NAME(opfamilies)
+READ_FIELD_NAME(opfamilyname)
+READ_FIELD_NAME(opno)
+READ_FIELD_NAME(opnos)
+READ_FIELD_NAME(opresulttype)
+READ_FIELD_NAME(opretset)
+READ_FIELD_NAME(opt)
+READ_FIELD_NAME(options)
+READ_FIELD_NAME(order_clause)
+READ_FIELD_NAME(order_family)
+READ_FIELD_NAME(ordering)
+READ_FIELD_NAME(ordinality)
+READ_FIELD_NAME(ordinalitycol)
+READ_FIELD_NAME(orig_tablespacename)
+READ_FIELD_NAME(outargs)
+READ_FIELD_NAME(output)
+READ_FIELD_NAME(over)
+READ_FIELD_NAME(override)
+READ_FIELD_NAME(owner)
+READ_FIELD_NAME(owner_id)
+READ_FIELD_NAME(par_param)
+READ_FIELD_NAME(parallel_safe)
+READ_FIELD_NAME(param_ids)
+READ_FIELD_NAME(paramcollid)
+READ_FIELD_NAME(parameters)
+READ_FIELD_NAME(paramid)
+READ_FIELD_NAME(paramkind)
+READ_FIELD_NAME(params)
+READ_FIELD_NAME(paramtype)
+READ_FIELD_NAME(paramtypmod)
+READ_FIELD_NAME(part_params)
+READ_FIELD_NAME(partbound)
+READ_FIELD_NAME(partition_clause)
+READ_FIELD_NAME(partspec)
+READ_FIELD_NAME(passing)
+READ_FIELD_NAME(passing_names)
+READ_FIELD_NAME(passing_values)
+READ_FIELD_NAME(passingvalexprs)
+READ_FIELD_NAME(path)
+READ_FIELD_NAME(path_spec)
+READ_FIELD_NAME(pathspec)
+READ_FIELD_NAME(payload)
+READ_FIELD_NAME(pct_type)
+READ_FIELD_NAME(per_call_cost)
+READ_FIELD_NAME(perminfoindex)
+READ_FIELD_NAME(permissive)
+READ_FIELD_NAME(pk_attrs)
+READ_FIELD_NAME(pktable)
+READ_FIELD_NAME(plan)
+READ_FIELD_NAME(plan_id)
+READ_FIELD_NAME(plan_name)
+READ_FIELD_NAME(plhandler)
+READ_FIELD_NAME(plinline)
+READ_FIELD_NAME(plname)
+READ_FIELD_NAME(pltrusted)
+READ_FIELD_NAME(plvalidator)
+READ_FIELD_NAME(policy_name)
+READ_FIELD_NAME(polname)
+READ_FIELD_NAME(portalname)
+READ_FIELD_NAME(primary)
+READ_FIELD_NAME(priv_name)
+READ_FIELD_NAME(privileges)
+READ_FIELD_NAME(provider)
+READ_FIELD_NAME(publication)
+READ_FIELD_NAME(pubname)
+READ_FIELD_NAME(pubobjects)
+READ_FIELD_NAME(pubobjtype)
+READ_FIELD_NAME(pubtable)
+READ_FIELD_NAME(pushed_down)
+READ_FIELD_NAME(qual)
+READ_FIELD_NAME(quals)
+READ_FIELD_NAME(query)
+READ_FIELD_NAME(query_source)
+READ_FIELD_NAME(quotes)
+READ_FIELD_NAME(rarg)
+READ_FIELD_NAME(rargs)
+READ_FIELD_NAME(raw_default)
+READ_FIELD_NAME(raw_expr)
+READ_FIELD_NAME(rctype)
+READ_FIELD_NAME(recurse)
+READ_FIELD_NAME(recursive)
+READ_FIELD_NAME(refassgnexpr)
+READ_FIELD_NAME(refcollid)
+READ_FIELD_NAME(refcontainertype)
+READ_FIELD_NAME(refelemtype)
+READ_FIELD_NAME(refexpr)
+READ_FIELD_NAME(reflowerindexpr)
+READ_FIELD_NAME(refname)
+READ_FIELD_NAME(refrestype)
+READ_FIELD_NAME(refs)
+READ_FIELD_NAME(reftypmod)
+READ_FIELD_NAME(refupperindexpr)
+READ_FIELD_NAME(rel)
+READ_FIELD_NAME(relabelformat)
+READ_FIELD_NAME(relation)
+READ_FIELD_NAME(relation_oid)
+READ_FIELD_NAME(relation_type)
+READ_FIELD_NAME(relations)
+READ_FIELD_NAME(relid)
+READ_FIELD_NAME(relkind)
+READ_FIELD_NAME(rellockmode)
+READ_FIELD_NAME(relname)
+READ_FIELD_NAME(relpersistence)
+READ_FIELD_NAME(rels)
+READ_FIELD_NAME(remainder)
+READ_FIELD_NAME(remote_schema)
+READ_FIELD_NAME(remove)
+READ_FIELD_NAME(remove_type)
+READ_FIELD_NAME(rename_type)
+READ_FIELD_NAME(repeatable)
+READ_FIELD_NAME(replace)
+READ_FIELD_NAME(required_perms)
+READ_FIELD_NAME(reset_default_tblspc)
+READ_FIELD_NAME(resjunk)
+READ_FIELD_NAME(resname)
+READ_FIELD_NAME(resno)
+READ_FIELD_NAME(resorigcol)
+READ_FIELD_NAME(resorigtbl)
+READ_FIELD_NAME(ressortgroupref)
+READ_FIELD_NAME(restart_seqs)
+READ_FIELD_NAME(result)
+READ_FIELD_NAME(result_relation)
+READ_FIELD_NAME(resultcollid)
+READ_FIELD_NAME(resulttype)
+READ_FIELD_NAME(resulttypmod)
+READ_FIELD_NAME(return_type)
+READ_FIELD_NAME(returning)
+READ_FIELD_NAME(returning_list)
+READ_FIELD_NAME(returnval)
+READ_FIELD_NAME(rexpr)
+READ_FIELD_NAME(role)
+READ_FIELD_NAME(rolename)
+READ_FIELD_NAME(roles)
+READ_FIELD_NAME(roletype)
+READ_FIELD_NAME(row)
+READ_FIELD_NAME(row_format)
+READ_FIELD_NAME(row_marks)
+READ_FIELD_NAME(row_typeid)
+READ_FIELD_NAME(rowexpr)
+READ_FIELD_NAME(rplan)
+READ_FIELD_NAME(rtable)
+READ_FIELD_NAME(rtekind)
+READ_FIELD_NAME(rteperminfos)
+READ_FIELD_NAME(rti)
+READ_FIELD_NAME(rtindex)
+READ_FIELD_NAME(rulename)
+READ_FIELD_NAME(run_condition)
+READ_FIELD_NAME(savepoint_name)
+READ_FIELD_NAME(schema_elts)
+READ_FIELD_NAME(schemaname)
+READ_FIELD_NAME(search_breadth_first)
+READ_FIELD_NAME(search_clause)
+READ_FIELD_NAME(search_col_list)
+READ_FIELD_NAME(search_seq_column)
+READ_FIELD_NAME(security_barrier)
+READ_FIELD_NAME(security_quals)
+READ_FIELD_NAME(select_stmt)
+READ_FIELD_NAME(selected_cols)
+READ_FIELD_NAME(self_reference)
+READ_FIELD_NAME(seqid)
+READ_FIELD_NAME(sequence)
+READ_FIELD_NAME(server_name)
+READ_FIELD_NAME(servername)
+READ_FIELD_NAME(servertype)
+READ_FIELD_NAME(set_operations)
+READ_FIELD_NAME(set_param)
+READ_FIELD_NAME(setof)
+READ_FIELD_NAME(setstmt)
+READ_FIELD_NAME(skip_data)
+READ_FIELD_NAME(skip_if_new_val_exists)
+READ_FIELD_NAME(skip_validation)
+READ_FIELD_NAME(sort_clause)
+READ_FIELD_NAME(sortby_dir)
+READ_FIELD_NAME(sortby_nulls)
+READ_FIELD_NAME(sortop)
+READ_FIELD_NAME(source)
+READ_FIELD_NAME(source_relation)
+READ_FIELD_NAME(source_text)
+READ_FIELD_NAME(sourcetype)
+READ_FIELD_NAME(sql_body)
+READ_FIELD_NAME(start_in_range_func)
+READ_FIELD_NAME(start_offset)
+READ_FIELD_NAME(startup_cost)
+READ_FIELD_NAME(stat_types)
+READ_FIELD_NAME(stmt)
+READ_FIELD_NAME(stmt_len)
+READ_FIELD_NAME(stmt_location)
+READ_FIELD_NAME(stmt_type)
+READ_FIELD_NAME(storage)
+READ_FIELD_NAME(storage_name)
+READ_FIELD_NAME(storedtype)
+READ_FIELD_NAME(strategy)
+READ_FIELD_NAME(strength)
+READ_FIELD_NAME(string)
+READ_FIELD_NAME(stxcomment)
+READ_FIELD_NAME(stxstattarget)
+READ_FIELD_NAME(sub_link_id)
+READ_FIELD_NAME(sub_link_type)
+READ_FIELD_NAME(subname)
+READ_FIELD_NAME(subplans)
+READ_FIELD_NAME(subquery)
+READ_FIELD_NAME(subselect)
+READ_FIELD_NAME(subtype)
+READ_FIELD_NAME(table)
+READ_FIELD_NAME(table_elts)
+READ_FIELD_NAME(table_list)
+READ_FIELD_NAME(table_space)
+READ_FIELD_NAME(table_space_name)
+READ_FIELD_NAME(tablefunc)
+READ_FIELD_NAME(tablesample)
+READ_FIELD_NAME(tablespacename)
+READ_FIELD_NAME(target)
+READ_FIELD_NAME(target_list)
+READ_FIELD_NAME(targettype)
+READ_FIELD_NAME(targtype)
+READ_FIELD_NAME(testexpr)
+READ_FIELD_NAME(tgenabled)
+READ_FIELD_NAME(timing)
+READ_FIELD_NAME(tle_sort_group_ref)
+READ_FIELD_NAME(to_encoding_name)
+READ_FIELD_NAME(tokentype)
+READ_FIELD_NAME(tosql)
+READ_FIELD_NAME(transformed)
+READ_FIELD_NAME(transition_rels)
+READ_FIELD_NAME(trigname)
+READ_FIELD_NAME(tsmhandler)
+READ_FIELD_NAME(type)
+READ_FIELD_NAME(type_id)
+READ_FIELD_NAME(type_mod)
+READ_FIELD_NAME(type_name)
+READ_FIELD_NAME(type_oid)
+READ_FIELD_NAME(typemod)
+READ_FIELD_NAME(typevar)
+READ_FIELD_NAME(typid)
+READ_FIELD_NAME(typmod)
+READ_FIELD_NAME(typmods)
+READ_FIELD_NAME(uidx)
+READ_FIELD_NAME(unique)
+READ_FIELD_NAME(unique_keys)
+READ_FIELD_NAME(unknown_eq_false)
+READ_FIELD_NAME(update_colnos)
+READ_FIELD_NAME(updated_cols)
+READ_FIELD_NAME(upperdatums)
+READ_FIELD_NAME(use_hash_table)
+READ_FIELD_NAME(use_io_coercion)
+READ_FIELD_NAME(use_json_coercion)
+READ_FIELD_NAME(use_op)
+READ_FIELD_NAME(use_or)
+READ_FIELD_NAME(user)
+READ_FIELD_NAME(using_clause)
+READ_FIELD_NAME(utility_stmt)
+READ_FIELD_NAME(va_cols)
+READ_FIELD_NAME(val)
+READ_FIELD_NAME(vals)
+READ_FIELD_NAME(value)
+READ_FIELD_NAME(values)
+READ_FIELD_NAME(values_lists)
+READ_FIELD_NAME(varattno)
+READ_FIELD_NAME(varcollid)
+READ_FIELD_NAME(varlevelsup)
+READ_FIELD_NAME(varno)
+READ_FIELD_NAME(varnullingrels)
+READ_FIELD_NAME(vartype)
+READ_FIELD_NAME(vartypmod)
+READ_FIELD_NAME(version)
+READ_FIELD_NAME(view)
+READ_FIELD_NAME(view_query)
+READ_FIELD_NAME(wait_policy)
+READ_FIELD_NAME(wfunc_left)
+READ_FIELD_NAME(when_clause)
+READ_FIELD_NAME(whenclause)
+READ_FIELD_NAME(where_clause)
+READ_FIELD_NAME(winagg)
+READ_FIELD_NAME(wincollid)
+READ_FIELD_NAME(window_clause)
+READ_FIELD_NAME(winfnoid)
+READ_FIELD_NAME(winref)
+READ_FIELD_NAME(winstar)
+READ_FIELD_NAME(wintype)
+READ_FIELD_NAME(with_check)
+READ_FIELD_NAME(with_check_option)
+READ_FIELD_NAME(with_check_options)
+READ_FIELD_NAME(with_clause)
+READ_FIELD_NAME(wrapper)
+READ_FIELD_NAME(xmloption)
+READ_FIELD_NAME(xpr)
@@ -15,6 +15,14 @@ const char* progname = "pg_query";
 
 __thread sig_atomic_t pg_query_initialized = 0;
 
+static __thread PgQueryMemoryStats pg_query_memory_stats;
+
+static PgQueryOutputAllocator pg_query_output_allocator = {malloc, free};
+
+// AllocSet totals when the current call entered its memory context
+static __thread Size pg_query_call_allocated_base;
+static __thread uint64 pg_query_call_blocks_base;
+
 #ifdef HAVE_PTHREAD
 static pthread_key_t pg_query_thread_exit_key;
 static void pg_query_thread_exit(void *key);
@@ -81,6 +89,10 @@ MemoryContext pg_query_enter_memory_context()
 
 	pg_query_init();
 
+	pg_query_call_allocated_base = AllocSetTrackedAllocated;
+	pg_query_call_blocks_base = AllocSetTrackedBlocks;
+	AllocSetTrackedPeak = AllocSetTrackedAllocated;
+
 	Assert(CurrentMemoryContext == TopMemoryContext);
 	ctx = AllocSetContextCreate(TopMemoryContext,
 								"pg_query",
@@ -90,8 +102,32 @@ MemoryContext pg_query_enter_memory_context()
 	return ctx;
 }
 
+static Size pg_query_mem_allocated(MemoryContext context)
+{
+	Size total = context->mem_allocated;
+
+	for (MemoryContext child = context->firstchild; child != NULL; child = child->nextchild)
+		total += pg_query_mem_allocated(child);
+
+	return total;
+}
+
+PgQueryMemoryStats pg_query_last_memory_stats(void)
+{
+	return pg_query_memory_stats;
+}
+
+void pg_query_reset_memory_stats(void)
+{
+	memset(&pg_query_memory_stats, 0, sizeof(pg_query_memory_stats));
+}
+
 void pg_query_exit_memory_context(MemoryContext ctx)
 {
+	pg_query_memory_stats.mem_allocated = pg_query_mem_allocated(ctx);
+	pg_query_memory_stats.peak_mem_allocated = AllocSetTrackedPeak - pg_query_call_allocated_base;
+	pg_query_memory_stats.n_blocks = AllocSetTrackedBlocks - pg_query_call_blocks_base;
+
 	// Return to previous PostgreSQL memory context
 	MemoryContextSwitchTo(TopMemoryContext);
 
@@ -99,6 +135,41 @@ void pg_query_exit_memory_context(MemoryContext ctx)
 	ctx = NULL;
 }
 
+void pg_query_set_output_allocator(const PgQueryOutputAllocator *allocator)
+{
+	if (allocator == NULL)
+	{
+		pg_query_output_allocator.alloc = malloc;
+		pg_query_output_allocator.free = free;
+	}
+	else
+	{
+		pg_query_output_allocator = *allocator;
+	}
+}
+
+void *pg_query_output_alloc(size_t size)
+{
+	return pg_query_output_allocator.alloc(size);
+}
+
+// Copies len bytes of str and a terminating NUL byte into an output buffer
+char *pg_query_output_strdup(const char *str, size_t len)
+{
+	char *copy = pg_query_output_alloc(len + 1);
+
+	memcpy(copy, str, len);
+	copy[len] = '\0';
+
+	return copy;
+}
+
+void pg_query_output_free(void *ptr)
+{
+	if (ptr != NULL)
+		pg_query_output_allocator.free(ptr);
+}
+
 void pg_query_free_error(PgQueryError *error)
 {
 	free(error->message);
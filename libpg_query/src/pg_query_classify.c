@@ -0,0 +1,840 @@
+#include "pg_query.h"
+#include "pg_query_internal.h"
+
+#include "gramparse.h"
+#include "nodes/parsenodes.h"
+
+/*
+ * Statement classification
+ *
+ * Tells the type of each statement, and whether it is read-only, from the
+ * scanner's tokens where the leading keywords settle that, which is much
+ * cheaper than parsing. Statements classified from their tokens aren't
+ * checked for syntax errors beyond what the scanner reports. If the tokens
+ * leave any statement open (most DDL, BEGIN ATOMIC function bodies, scanner
+ * errors, ...), the input is parsed instead and the types are taken from the
+ * parse tree.
+ *
+ * A statement is read-only if it can't write data or change the schema:
+ * SELECT without INTO or a locking clause (and without data-modifying CTEs),
+ * SHOW, SET, RESET, transaction control, EXPLAIN (unless it is EXPLAIN
+ * ANALYZE of a statement that isn't read-only), COPY ... TO, and cursor
+ * statements over read-only queries. Functions called by a statement aren't
+ * looked at, so "SELECT nextval('seq')" counts as read-only.
+ */
+
+typedef struct {
+	int tok;
+	int location;
+} ClassifyToken;
+
+typedef struct {
+	const char *stmt_type;
+	bool read_only;
+} Classification;
+
+static bool classify_tokens(const ClassifyToken *tokens, int start, int end, Classification *out);
+
+static bool
+is_keyword(int tok)
+{
+	switch (tok)
+	{
+		#define PG_KEYWORD(a,b,c,d) case b: return true;
+		#include "parser/kwlist.h"
+		#undef PG_KEYWORD
+		default:
+			return false;
+	}
+}
+
+static bool
+is_name(int tok)
+{
+	return tok == IDENT || is_keyword(tok);
+}
+
+// Returns the index after the ")" matching the "(" at i, or -1
+static int
+skip_parens(const ClassifyToken *tokens, int i, int end)
+{
+	int depth = 0;
+
+	for (; i < end; i++)
+	{
+		if (tokens[i].tok == '(')
+			depth++;
+		else if (tokens[i].tok == ')' && --depth == 0)
+			return i + 1;
+	}
+
+	return -1;
+}
+
+// Returns the index after the possibly qualified name at i, or -1
+static int
+skip_qualified_name(const ClassifyToken *tokens, int i, int end)
+{
+	if (i >= end || !is_name(tokens[i].tok))
+		return -1;
+
+	for (i++; i + 1 < end && tokens[i].tok == '.' && is_name(tokens[i + 1].tok); i += 2)
+		;
+
+	return i;
+}
+
+// Returns the index of the first tok outside of parentheses, or -1
+static int
+find_token(const ClassifyToken *tokens, int start, int end, int tok)
+{
+	int depth = 0;
+
+	for (int i = start; i < end; i++)
+	{
+		if (tokens[i].tok == '(')
+			depth++;
+		else if (tokens[i].tok == ')')
+			depth--;
+		else if (depth == 0 && tokens[i].tok == tok)
+			return i;
+	}
+
+	return -1;
+}
+
+static bool
+has_token(const ClassifyToken *tokens, int start, int end, int tok)
+{
+	for (int i = start; i < end; i++)
+	{
+		if (tokens[i].tok == tok)
+			return true;
+	}
+
+	return false;
+}
+
+// FOR UPDATE, FOR NO KEY UPDATE, FOR SHARE or FOR KEY SHARE anywhere
+static bool
+has_locking_clause(const ClassifyToken *tokens, int start, int end)
+{
+	for (int i = start; i + 1 < end; i++)
+	{
+		if (tokens[i].tok != FOR)
+			continue;
+
+		switch (tokens[i + 1].tok)
+		{
+			case UPDATE:
+			case SHARE:
+			case NO:
+			case KEY:
+				return true;
+		}
+	}
+
+	return false;
+}
+
+static bool
+is_query_type(const char *stmt_type)
+{
+	return strcmp(stmt_type, "select_stmt") == 0 ||
+		strcmp(stmt_type, "insert_stmt") == 0 ||
+		strcmp(stmt_type, "update_stmt") == 0 ||
+		strcmp(stmt_type, "delete_stmt") == 0 ||
+		strcmp(stmt_type, "merge_stmt") == 0;
+}
+
+// Read-only if the tokens from start classify as a read-only statement
+static bool
+read_only_from(const ClassifyToken *tokens, int start, int end)
+{
+	Classification inner;
+
+	return start >= 0 && classify_tokens(tokens, start, end, &inner) && inner.read_only;
+}
+
+// WITH [RECURSIVE] name [(columns)] AS [[NOT] MATERIALIZED] (query) [, ...] query
+static bool
+classify_with(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	Classification query;
+	bool read_only = true;
+	int i = start + 1;
+
+	if (i < end && tokens[i].tok == RECURSIVE)
+		i++;
+
+	for (;;)
+	{
+		int body_end;
+
+		if (i >= end || !is_name(tokens[i].tok))
+			return false;
+		i++;
+
+		if (i < end && tokens[i].tok == '(' && (i = skip_parens(tokens, i, end)) < 0)
+			return false;
+
+		if (i >= end || tokens[i].tok != AS)
+			return false;
+		i++;
+
+		if (i < end && tokens[i].tok == NOT)
+			i++;
+		if (i < end && tokens[i].tok == MATERIALIZED)
+			i++;
+
+		if (i >= end || tokens[i].tok != '(' || (body_end = skip_parens(tokens, i, end)) < 0)
+			return false;
+
+		if (!classify_tokens(tokens, i + 1, body_end - 1, &query) || !is_query_type(query.stmt_type))
+			return false;
+
+		read_only &= query.read_only;
+		i = body_end;
+
+		// SEARCH and CYCLE clauses are rare enough to leave to the parser
+		if (i >= end || tokens[i].tok != ',')
+			break;
+		i++;
+	}
+
+	if (!classify_tokens(tokens, i, end, &query) || !is_query_type(query.stmt_type))
+		return false;
+
+	out->stmt_type = query.stmt_type;
+	out->read_only = read_only && query.read_only;
+
+	return true;
+}
+
+static bool
+classify_create(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	int i = start + 1;
+
+	if (i + 1 < end && tokens[i].tok == OR && tokens[i + 1].tok == REPLACE)
+		i += 2;
+
+	while (i < end && (tokens[i].tok == TEMP || tokens[i].tok == TEMPORARY || tokens[i].tok == LOCAL ||
+					   tokens[i].tok == GLOBAL || tokens[i].tok == UNLOGGED))
+		i++;
+
+	if (i >= end)
+		return false;
+
+	out->read_only = false;
+
+	switch (tokens[i].tok)
+	{
+		case TABLE:
+			out->stmt_type = find_token(tokens, i, end, AS) >= 0 ? "create_table_as_stmt" : "create_stmt";
+			return true;
+		case UNIQUE:
+		case INDEX:
+			out->stmt_type = "index_stmt";
+			return true;
+		case RECURSIVE:
+		case VIEW:
+			out->stmt_type = "view_stmt";
+			return true;
+		case MATERIALIZED:
+			out->stmt_type = "create_table_as_stmt";
+			return true;
+		case SEQUENCE:
+			out->stmt_type = "create_seq_stmt";
+			return true;
+		case SCHEMA:
+			out->stmt_type = "create_schema_stmt";
+			return true;
+		case EXTENSION:
+			out->stmt_type = "create_extension_stmt";
+			return true;
+		case FUNCTION:
+		case PROCEDURE:
+			out->stmt_type = "create_function_stmt";
+			return true;
+		case CONSTRAINT:
+		case TRIGGER:
+			out->stmt_type = "create_trig_stmt";
+			return true;
+		case RULE:
+			out->stmt_type = "rule_stmt";
+			return true;
+		case DATABASE:
+			out->stmt_type = "createdb_stmt";
+			return true;
+		case ROLE:
+			out->stmt_type = "create_role_stmt";
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool
+classify_drop(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	if (start + 1 >= end)
+		return false;
+
+	out->read_only = false;
+
+	switch (tokens[start + 1].tok)
+	{
+		case DATABASE:
+			out->stmt_type = "dropdb_stmt";
+			return true;
+		case TABLESPACE:
+			out->stmt_type = "drop_table_space_stmt";
+			return true;
+		case SUBSCRIPTION:
+			out->stmt_type = "drop_subscription_stmt";
+			return true;
+		case OWNED:
+			out->stmt_type = "drop_owned_stmt";
+			return true;
+		case ROLE:
+		case GROUP_P:
+			out->stmt_type = "drop_role_stmt";
+			return true;
+		case USER:
+			out->stmt_type = start + 2 < end && tokens[start + 2].tok == MAPPING ? "drop_user_mapping_stmt" : "drop_role_stmt";
+			return true;
+		case TABLE:
+		case INDEX:
+		case VIEW:
+		case MATERIALIZED:
+		case SEQUENCE:
+		case SCHEMA:
+		case FUNCTION:
+		case PROCEDURE:
+		case ROUTINE:
+		case AGGREGATE:
+		case TYPE_P:
+		case DOMAIN_P:
+		case EXTENSION:
+		case TRIGGER:
+		case RULE:
+		case POLICY:
+		case FOREIGN:
+		case SERVER:
+		case COLLATION:
+		case CONVERSION_P:
+		case STATISTICS:
+		case PUBLICATION:
+		case TEXT_P:
+		case EVENT:
+		case ACCESS:
+		case OPERATOR:
+		case CAST:
+		case TRANSFORM:
+		case LANGUAGE:
+		case PROCEDURAL:
+			out->stmt_type = "drop_stmt";
+			return true;
+		default:
+			return false;
+	}
+}
+
+// Only ALTER TABLE, the other ALTER statements are left to the parser
+static bool
+classify_alter(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	int i = start + 1;
+
+	if (i >= end || tokens[i].tok != TABLE)
+		return false;
+	i++;
+
+	// ALTER TABLE ALL IN TABLESPACE
+	if (i < end && tokens[i].tok == ALL)
+		return false;
+
+	if (i + 1 < end && tokens[i].tok == IF_P && tokens[i + 1].tok == EXISTS)
+		i += 2;
+	if (i < end && tokens[i].tok == ONLY)
+		i++;
+
+	if ((i = skip_qualified_name(tokens, i, end)) < 0)
+		return false;
+	if (i < end && tokens[i].tok == '*')
+		i++;
+
+	out->read_only = false;
+
+	if (i < end && tokens[i].tok == RENAME)
+		out->stmt_type = "rename_stmt";
+	else if (i + 1 < end && tokens[i].tok == SET && tokens[i + 1].tok == SCHEMA)
+		out->stmt_type = "alter_object_schema_stmt";
+	else
+		out->stmt_type = "alter_table_stmt";
+
+	return true;
+}
+
+// EXPLAIN [ANALYZE] [VERBOSE] statement, or EXPLAIN (options) statement
+static bool
+classify_explain(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	bool analyze = false;
+	int i = start + 1;
+
+	if (i < end && tokens[i].tok == '(')
+	{
+		int options_end = skip_parens(tokens, i, end);
+
+		if (options_end < 0)
+			return false;
+
+		analyze = has_token(tokens, i, options_end, ANALYZE) || has_token(tokens, i, options_end, ANALYSE);
+		i = options_end;
+	}
+	else
+	{
+		for (; i < end && (tokens[i].tok == ANALYZE || tokens[i].tok == ANALYSE || tokens[i].tok == VERBOSE); i++)
+			analyze |= tokens[i].tok != VERBOSE;
+	}
+
+	out->stmt_type = "explain_stmt";
+	out->read_only = !analyze || read_only_from(tokens, i, end);
+
+	return true;
+}
+
+// COPY (query) TO ..., COPY table TO ... or COPY table FROM ...
+static bool
+classify_copy(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	int i = start + 1;
+
+	out->stmt_type = "copy_stmt";
+
+	if (i < end && tokens[i].tok == '(')
+	{
+		int query_end = skip_parens(tokens, i, end);
+
+		if (query_end < 0)
+			return false;
+
+		out->read_only = read_only_from(tokens, i + 1, query_end - 1);
+	}
+	else
+	{
+		out->read_only = find_token(tokens, i, end, FROM) < 0;
+	}
+
+	return true;
+}
+
+static bool
+classify_tokens(const ClassifyToken *tokens, int start, int end, Classification *out)
+{
+	int i;
+
+	if (start >= end)
+		return false;
+
+	out->read_only = false;
+
+	switch (tokens[start].tok)
+	{
+		case WITH:
+			return classify_with(tokens, start, end, out);
+		// Not '(': a parenthesized query may hold a data-modifying WITH, or be invalid
+		case SELECT:
+		case VALUES:
+		case TABLE:
+			out->stmt_type = "select_stmt";
+			out->read_only = !has_token(tokens, start, end, INTO) && !has_locking_clause(tokens, start, end);
+			return true;
+		case INSERT:
+			out->stmt_type = "insert_stmt";
+			return true;
+		case UPDATE:
+			out->stmt_type = "update_stmt";
+			return true;
+		case DELETE_P:
+			out->stmt_type = "delete_stmt";
+			return true;
+		case MERGE:
+			out->stmt_type = "merge_stmt";
+			return true;
+		case BEGIN_P:
+		case START:
+		case COMMIT:
+		case END_P:
+		case ROLLBACK:
+		case ABORT_P:
+		case SAVEPOINT:
+		case RELEASE:
+			out->stmt_type = "transaction_stmt";
+			out->read_only = true;
+			return true;
+		case PREPARE:
+			if (start + 1 < end && tokens[start + 1].tok == TRANSACTION)
+			{
+				out->stmt_type = "transaction_stmt";
+				out->read_only = true;
+				return true;
+			}
+
+			// PREPARE name [(types)] AS statement
+			i = find_token(tokens, start + 1, end, AS);
+			out->stmt_type = "prepare_stmt";
+			out->read_only = i >= 0 && read_only_from(tokens, i + 1, end);
+			return true;
+		case DECLARE:
+			// DECLARE name [options] CURSOR [options] FOR query
+			i = find_token(tokens, start + 1, end, CURSOR);
+			if (i < 0 || (i = find_token(tokens, i + 1, end, FOR)) < 0)
+				return false;
+
+			out->stmt_type = "declare_cursor_stmt";
+			out->read_only = read_only_from(tokens, i + 1, end);
+			return true;
+		case SHOW:
+			out->stmt_type = "variable_show_stmt";
+			out->read_only = true;
+			return true;
+		case SET:
+			// SET CONSTRAINTS ... vs. setting a variable that happens to be called "constraints"
+			if (start + 1 < end && tokens[start + 1].tok == CONSTRAINTS)
+			{
+				if (start + 2 < end && (tokens[start + 2].tok == '=' || tokens[start + 2].tok == TO))
+					return false;
+
+				out->stmt_type = "constraints_set_stmt";
+			}
+			else
+			{
+				out->stmt_type = "variable_set_stmt";
+			}
+			out->read_only = true;
+			return true;
+		case RESET:
+			out->stmt_type = "variable_set_stmt";
+			out->read_only = true;
+			return true;
+		case FETCH:
+		case MOVE:
+			out->stmt_type = "fetch_stmt";
+			out->read_only = true;
+			return true;
+		case CLOSE:
+			out->stmt_type = "close_portal_stmt";
+			out->read_only = true;
+			return true;
+		case DEALLOCATE:
+			out->stmt_type = "deallocate_stmt";
+			out->read_only = true;
+			return true;
+		case DISCARD:
+			out->stmt_type = "discard_stmt";
+			out->read_only = true;
+			return true;
+		case UNLISTEN:
+			out->stmt_type = "unlisten_stmt";
+			out->read_only = true;
+			return true;
+		case EXPLAIN:
+			return classify_explain(tokens, start, end, out);
+		case COPY:
+			return classify_copy(tokens, start, end, out);
+		case LISTEN:
+			out->stmt_type = "listen_stmt";
+			return true;
+		case NOTIFY:
+			out->stmt_type = "notify_stmt";
+			return true;
+		case EXECUTE:
+			out->stmt_type = "execute_stmt";
+			return true;
+		case DO:
+			out->stmt_type = "do_stmt";
+			return true;
+		case CALL:
+			out->stmt_type = "call_stmt";
+			return true;
+		case TRUNCATE:
+			out->stmt_type = "truncate_stmt";
+			return true;
+		case COMMENT:
+			out->stmt_type = "comment_stmt";
+			return true;
+		case VACUUM:
+		case ANALYZE:
+		case ANALYSE:
+			out->stmt_type = "vacuum_stmt";
+			return true;
+		case LOCK_P:
+			out->stmt_type = "lock_stmt";
+			return true;
+		case CHECKPOINT:
+			out->stmt_type = "check_point_stmt";
+			return true;
+		case CLUSTER:
+			out->stmt_type = "cluster_stmt";
+			return true;
+		case REINDEX:
+			out->stmt_type = "reindex_stmt";
+			return true;
+		case LOAD:
+			out->stmt_type = "load_stmt";
+			return true;
+		case GRANT:
+		case REVOKE:
+			// Privileges are granted ON an object, roles are granted without
+			out->stmt_type = find_token(tokens, start + 1, end, ON) >= 0 ? "grant_stmt" : "grant_role_stmt";
+			return true;
+		case CREATE:
+			return classify_create(tokens, start, end, out);
+		case DROP:
+			return classify_drop(tokens, start, end, out);
+		case ALTER:
+			return classify_alter(tokens, start, end, out);
+		default:
+			return false;
+	}
+}
+
+/*
+ * Read-only flag for a statement whose type came from the parser, erring on
+ * the side of "not read-only" where the tokens don't settle it
+ */
+static bool
+read_only_for_type(const char *stmt_type, const ClassifyToken *tokens, int start, int end)
+{
+	Classification classification;
+
+	if (tokens != NULL && classify_tokens(tokens, start, end, &classification) &&
+		strcmp(classification.stmt_type, stmt_type) == 0)
+		return classification.read_only;
+
+	if (strcmp(stmt_type, "select_stmt") == 0)
+		return !has_token(tokens, start, end, INTO) && !has_locking_clause(tokens, start, end) &&
+			!has_token(tokens, start, end, INSERT) && !has_token(tokens, start, end, UPDATE) &&
+			!has_token(tokens, start, end, DELETE_P) && !has_token(tokens, start, end, MERGE);
+
+	return strcmp(stmt_type, "variable_show_stmt") == 0 ||
+		strcmp(stmt_type, "variable_set_stmt") == 0 ||
+		strcmp(stmt_type, "constraints_set_stmt") == 0 ||
+		strcmp(stmt_type, "transaction_stmt") == 0 ||
+		strcmp(stmt_type, "fetch_stmt") == 0 ||
+		strcmp(stmt_type, "close_portal_stmt") == 0 ||
+		strcmp(stmt_type, "deallocate_stmt") == 0 ||
+		strcmp(stmt_type, "discard_stmt") == 0 ||
+		strcmp(stmt_type, "unlisten_stmt") == 0;
+}
+
+/* The name of the node's field in the PgQuery.Node protobuf message */
+#define OUT_NODE(typename, typename_c, typename_underscore, typename_underscore_upcase, typename_cast, fldname) \
+	return #fldname;
+
+static const char *
+node_type_name(const Node *node)
+{
+	switch (nodeTag(node))
+	{
+		#include "pg_query_outfuncs_conds.c"
+
+		default:
+			return NULL;
+	}
+}
+
+#undef OUT_NODE
+
+/*
+ * Scans the input into tokens (without comments). Returns false if the
+ * statements can't be told apart by the tokens alone, e.g. because of a
+ * BEGIN ATOMIC function body, whose statements end in semicolons as well.
+ */
+static bool
+scan_tokens(const char *input, size_t len, ClassifyToken **tokens_out, int *n_tokens_out)
+{
+	core_yyscan_t yyscanner;
+	core_yy_extra_type yyextra;
+	core_YYSTYPE yylval;
+	YYLTYPE yylloc;
+	ClassifyToken *tokens;
+	int n_tokens = 0;
+	int tokens_size = 64;
+	bool ok = true;
+
+	tokens = palloc(sizeof(ClassifyToken) * tokens_size);
+
+	yyscanner = scanner_init_n(input, len, &yyextra, &ScanKeywords, ScanKeywordTokens);
+
+	for (;;)
+	{
+		int tok = core_yylex(&yylval, &yylloc, yyscanner);
+
+		if (tok == 0)
+			break;
+		if (tok == SQL_COMMENT || tok == C_COMMENT)
+			continue;
+		if (tok == ATOMIC)
+			ok = false;
+
+		if (n_tokens == tokens_size)
+		{
+			tokens_size *= 2;
+			tokens = repalloc(tokens, sizeof(ClassifyToken) * tokens_size);
+		}
+
+		tokens[n_tokens].tok = tok;
+		tokens[n_tokens].location = yylloc;
+		n_tokens++;
+	}
+
+	scanner_finish(yyscanner);
+
+	*tokens_out = tokens;
+	*n_tokens_out = n_tokens;
+
+	return ok;
+}
+
+/*
+ * Classifies the statements from the tokens alone, returns false if any of
+ * them is left open
+ */
+static bool
+classify_from_tokens(const ClassifyToken *tokens, int n_tokens, PgQueryClassifyResult *result)
+{
+	Classification *classifications = palloc(sizeof(Classification) * (n_tokens + 1));
+	int n_stmts = 0;
+	int stmt_start = 0;
+	int depth = 0;
+
+	for (int i = 0; i <= n_tokens; i++)
+	{
+		if (i < n_tokens && tokens[i].tok != ';')
+		{
+			if (tokens[i].tok == '(')
+				depth++;
+			else if (tokens[i].tok == ')' && --depth < 0)
+				return false;
+			continue;
+		}
+
+		if (depth != 0)
+		{
+			if (i == n_tokens)
+				return false;
+			continue;
+		}
+
+		// Empty statements are skipped, like the parser does
+		if (i > stmt_start && !classify_tokens(tokens, stmt_start, i, &classifications[n_stmts++]))
+			return false;
+
+		stmt_start = i + 1;
+	}
+
+	result->n_stmts = n_stmts;
+	result->stmts = malloc(sizeof(PgQueryClassifiedStmt) * (n_stmts > 0 ? n_stmts : 1));
+
+	for (int i = 0; i < n_stmts; i++)
+	{
+		result->stmts[i].stmt_type = classifications[i].stmt_type;
+		result->stmts[i].read_only = classifications[i].read_only;
+	}
+
+	return true;
+}
+
+// Returns the index of the first token at or after location
+static int
+token_at(const ClassifyToken *tokens, int n_tokens, int location)
+{
+	int i = 0;
+
+	while (i < n_tokens && tokens[i].location < location)
+		i++;
+
+	return i;
+}
+
+static void
+classify_from_parse_tree(List *tree, const ClassifyToken *tokens, int n_tokens, PgQueryClassifyResult *result)
+{
+	ListCell *lc;
+
+	result->n_stmts = list_length(tree);
+	result->stmts = malloc(sizeof(PgQueryClassifiedStmt) * (result->n_stmts > 0 ? result->n_stmts : 1));
+
+	foreach(lc, tree)
+	{
+		RawStmt *raw_stmt = castNode(RawStmt, lfirst(lc));
+		PgQueryClassifiedStmt *stmt = &result->stmts[foreach_current_index(lc)];
+		int start = token_at(tokens, n_tokens, raw_stmt->stmt_location);
+		int end = raw_stmt->stmt_len == 0 ? n_tokens : token_at(tokens, n_tokens, raw_stmt->stmt_location + raw_stmt->stmt_len);
+
+		stmt->stmt_type = node_type_name(raw_stmt->stmt);
+		stmt->read_only = stmt->stmt_type != NULL && read_only_for_type(stmt->stmt_type, tokens, start, end);
+	}
+}
+
+PgQueryClassifyResult pg_query_classify(const char* input)
+{
+	return pg_query_classify_n(input, strlen(input));
+}
+
+PgQueryClassifyResult pg_query_classify_n(const char* input, size_t len)
+{
+	MemoryContext ctx = NULL;
+	PgQueryClassifyResult result = {0};
+	ClassifyToken *tokens = NULL;
+	int n_tokens = 0;
+	bool classified = false;
+
+	ctx = pg_query_enter_memory_context();
+
+	PG_TRY();
+	{
+		if (scan_tokens(input, len, &tokens, &n_tokens))
+			classified = classify_from_tokens(tokens, n_tokens, &result);
+	}
+	PG_CATCH();
+	{
+		// The parser reports the same error, with the usual details
+		MemoryContextSwitchTo(ctx);
+		FlushErrorState();
+		tokens = NULL;
+		n_tokens = 0;
+	}
+	PG_END_TRY();
+
+	if (!classified)
+	{
+		PgQueryInternalParsetreeAndError parsetree_and_error = pg_query_raw_parse(input, len, PG_QUERY_PARSE_DEFAULT);
+
+		// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
+		result.stderr_buffer = parsetree_and_error.stderr_buffer;
+		result.error = parsetree_and_error.error;
+		result.parsed = true;
+
+		if (result.error == NULL)
+			classify_from_parse_tree(parsetree_and_error.tree, tokens, n_tokens, &result);
+	}
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+void pg_query_free_classify_result(PgQueryClassifyResult result)
+{
+	if (result.error) {
+		pg_query_free_error(result.error);
+	}
+
+	free(result.stmts);
+	free(result.stderr_buffer);
+}
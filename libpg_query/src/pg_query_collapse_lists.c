@@ -0,0 +1,236 @@
+#include "pg_query.h"
+#include "pg_query_internal.h"
+
+#include "nodes/parsenodes.h"
+#include "nodes/plannodes.h"
+#include "parser/scanner.h"
+#include "parser/scansup.h"
+
+/*
+ * Collapsing of long constant lists
+ *
+ * With PG_QUERY_COLLAPSE_LISTS(n) in the parser options, IN lists, ARRAY[...]
+ * expressions and VALUES lists with more than n items that are all constants
+ * (or rows of constants) are replaced as soon as raw_parser returns. The list
+ * is replaced by one that holds a single IntList of three integers: the
+ * number of items, and the location and length of the source text from the
+ * first constant to the end of the last one. VALUES lists keep one row, which
+ * holds the IntList.
+ *
+ * Constants don't contribute to fingerprints, and neither does an IntList,
+ * so the fingerprint of the collapsed tree is the same as that of the full
+ * one. Nothing in the raw parse tree is an IntList otherwise.
+ */
+
+typedef struct {
+	const char *input;
+	size_t len;
+	int max_length;
+} CollapseContext;
+
+static void _collapseNode(CollapseContext *ctx, const void *obj);
+
+static void
+_collapseList(CollapseContext *ctx, const List *list)
+{
+	const ListCell *lc;
+
+	foreach(lc, list)
+		_collapseNode(ctx, lfirst(lc));
+}
+
+/* The walker reuses the generated output functions, only following node fields */
+#define OUT_TYPE(typename, typename_c) CollapseContext *
+
+#define OUT_NODE(typename, typename_c, typename_underscore, typename_underscore_upcase, typename_cast, fldname) \
+	_out##typename_c(ctx, (const typename_cast *) obj);
+
+#define WRITE_INT_FIELD(outname, outname_json, fldname)
+#define WRITE_UINT_FIELD(outname, outname_json, fldname)
+#define WRITE_UINT64_FIELD(outname, outname_json, fldname)
+#define WRITE_LONG_FIELD(outname, outname_json, fldname)
+#define WRITE_CHAR_FIELD(outname, outname_json, fldname)
+#define WRITE_ENUM_FIELD(typename, outname, outname_json, fldname)
+#define WRITE_FLOAT_FIELD(outname, outname_json, fldname)
+#define WRITE_BOOL_FIELD(outname, outname_json, fldname)
+#define WRITE_STRING_FIELD(outname, outname_json, fldname)
+#define WRITE_BITMAPSET_FIELD(outname, outname_json, fldname)
+
+#define WRITE_LIST_FIELD(outname, outname_json, fldname) \
+	_collapseList(out, node->fldname);
+
+#define WRITE_NODE_PTR_FIELD(outname, outname_json, fldname) \
+	_collapseNode(out, node->fldname);
+
+#define WRITE_SPECIFIC_NODE_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
+	_out##typename(out, &node->fldname);
+
+#define WRITE_SPECIFIC_NODE_PTR_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
+	_collapseNode(out, node->fldname);
+
+static void
+_outList(CollapseContext *out, const List *node)
+{
+	_collapseList(out, node);
+}
+
+/* Leaf nodes */
+static void _outIntList(CollapseContext *out, const List *node) {}
+static void _outOidList(CollapseContext *out, const List *node) {}
+static void _outInteger(CollapseContext *out, const Integer *node) {}
+static void _outBoolean(CollapseContext *out, const Boolean *node) {}
+static void _outFloat(CollapseContext *out, const Float *node) {}
+static void _outString(CollapseContext *out, const String *node) {}
+static void _outBitString(CollapseContext *out, const BitString *node) {}
+static void _outAConst(CollapseContext *out, const A_Const *node) {}
+
+#include "pg_query_outfuncs_defs.c"
+
+static bool
+is_constant_list(const List *list)
+{
+	const ListCell *lc;
+
+	foreach(lc, list)
+	{
+		if (lfirst(lc) == NULL || !IsA(lfirst(lc), A_Const) || castNode(A_Const, lfirst(lc))->location < 0)
+			return false;
+	}
+
+	return list != NIL;
+}
+
+/*
+ * Returns the end of the constant at location. A negative number starts at
+ * its '-' sign, which may be followed by more signs and parentheses before
+ * the number itself.
+ */
+static int
+constant_end(CollapseContext *ctx, int location)
+{
+	core_yyscan_t yyscanner;
+	core_yy_extra_type yyextra;
+	core_YYSTYPE yylval;
+	YYLTYPE		yylloc;
+	int			tok;
+	int			parens = 0;
+	int			end;
+
+	yyscanner = scanner_init_n(ctx->input + location,
+							   ctx->len - location,
+							   &yyextra,
+							   &ScanKeywords,
+							   ScanKeywordTokens);
+
+	do
+	{
+		tok = core_yylex(&yylval, &yylloc, yyscanner);
+		if (tok == '(')
+			parens++;
+	} while (tok == '-' || tok == '(');
+
+	/* flex places a zero byte after the text of the current token */
+	end = yylloc + (int) strlen(yyextra.scanbuf + yylloc);
+
+	/* Unicode escape strings take the whitespace after them in search of UESCAPE */
+	while (end > yylloc && scanner_isspace(yyextra.scanbuf[end - 1]))
+		end--;
+
+	while (tok != 0 && parens-- > 0)
+	{
+		tok = core_yylex(&yylval, &yylloc, yyscanner);
+		if (tok == ')')
+			end = yylloc + 1;
+	}
+
+	scanner_finish(yyscanner);
+
+	return location + end;
+}
+
+static List *
+make_collapsed_list(CollapseContext *ctx, int n_items, const A_Const *first, const A_Const *last)
+{
+	int			end = constant_end(ctx, last->location);
+
+	return list_make1(list_make3_int(n_items, first->location, end - first->location));
+}
+
+/* Collapses the items of an IN list or ARRAY[...] */
+static void
+collapse_items(CollapseContext *ctx, List **items)
+{
+	List	   *list = *items;
+
+	if (list_length(list) <= ctx->max_length || !is_constant_list(list))
+		return;
+
+	*items = make_collapsed_list(ctx, list_length(list), linitial(list), llast(list));
+}
+
+/* Collapses the rows of a VALUES list */
+static void
+collapse_rows(CollapseContext *ctx, List **rows)
+{
+	List	   *list = *rows;
+	ListCell   *lc;
+
+	if (list_length(list) <= ctx->max_length)
+		return;
+
+	foreach(lc, list)
+	{
+		if (!IsA(lfirst(lc), List) || !is_constant_list(lfirst(lc)))
+			return;
+	}
+
+	*rows = list_make1(make_collapsed_list(ctx, list_length(list), linitial(linitial(list)), llast(llast(list))));
+}
+
+static void
+_collapseNode(CollapseContext *ctx, const void *obj)
+{
+	if (obj == NULL)
+		return;
+
+	/* Collapse the lists of this node before walking them */
+	switch (nodeTag(obj))
+	{
+		case T_A_Expr:
+			{
+				A_Expr	   *expr = (A_Expr *) obj;
+
+				if (expr->kind == AEXPR_IN && expr->rexpr != NULL && IsA(expr->rexpr, List))
+					collapse_items(ctx, (List **) &expr->rexpr);
+			}
+			break;
+		case T_A_ArrayExpr:
+			collapse_items(ctx, &((A_ArrayExpr *) obj)->elements);
+			break;
+		case T_SelectStmt:
+			collapse_rows(ctx, &((SelectStmt *) obj)->valuesLists);
+			break;
+		default:
+			break;
+	}
+
+	switch (nodeTag(obj))
+	{
+		#include "pg_query_outfuncs_conds.c"
+
+		default:
+			break;
+	}
+}
+
+/*
+ * Collapses the long constant lists of a tree that raw_parser just returned
+ * for input. Needs the scanner GUCs raw_parser ran with.
+ */
+void
+pg_query_collapse_lists(List *tree, const char *input, size_t len, int max_length)
+{
+	CollapseContext ctx = {input, len, max_length};
+
+	_collapseList(&ctx, tree);
+}
@@ -18,14 +18,19 @@ PgQueryDeparseResult pg_query_deparse_protobuf(PgQueryProtobuf parse_tree)
 	{
 		stmts = pg_query_protobuf_to_nodes(parse_tree);
 
+		/*
+		 * The SQL is usually around half the size of the protobuf, so with
+		 * room for that much the output rarely has to be grown and copied
+		 */
 		initStringInfo(&str);
+		enlargeStringInfo(&str, parse_tree.len);
 
 		foreach(lc, stmts) {
 			deparseRawStmt(&str, castNode(RawStmt, lfirst(lc)));
 			if (lnext(stmts, lc))
 				appendStringInfoString(&str, "; ");
 		}
-		result.query = strdup(str.data);
+		result.query = pg_query_output_strdup(str.data, str.len);
 	}
 	PG_CATCH();
 	{
@@ -36,7 +41,50 @@ PgQueryDeparseResult pg_query_deparse_protobuf(PgQueryProtobuf parse_tree)
 		error_data = CopyErrorData();
 
 		// Note: This is intentionally malloc so exiting the memory context doesn't free this
-		error = malloc(sizeof(PgQueryError));
+		error = calloc(1, sizeof(PgQueryError));
+		error->message   = strdup(error_data->message);
+		error->filename  = strdup(error_data->filename);
+		error->funcname  = strdup(error_data->funcname);
+		error->context   = NULL;
+		error->lineno	= error_data->lineno;
+		error->cursorpos = error_data->cursorpos;
+
+		result.error = error;
+		FlushErrorState();
+	}
+	PG_END_TRY();
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+PgQueryDeparseResult pg_query_deparse_node_protobuf(PgQueryProtobuf node)
+{
+	PgQueryDeparseResult result = {0};
+	StringInfoData str;
+	MemoryContext ctx;
+
+	ctx = pg_query_enter_memory_context();
+
+	PG_TRY();
+	{
+		Node *parsed = pg_query_protobuf_to_node(node);
+
+		initStringInfo(&str);
+		deparseNode(&str, parsed);
+		result.query = pg_query_output_strdup(str.data, str.len);
+	}
+	PG_CATCH();
+	{
+		ErrorData* error_data;
+		PgQueryError* error;
+
+		MemoryContextSwitchTo(ctx);
+		error_data = CopyErrorData();
+
+		// Note: This is intentionally malloc so exiting the memory context doesn't free this
+		error = calloc(1, sizeof(PgQueryError));
 		error->message   = strdup(error_data->message);
 		error->filename  = strdup(error_data->filename);
 		error->funcname  = strdup(error_data->funcname);
@@ -60,5 +108,5 @@ void pg_query_free_deparse_result(PgQueryDeparseResult result)
 		pg_query_free_error(result.error);
 	}
 
-	free(result.query);
+	pg_query_output_free(result.query);
 }
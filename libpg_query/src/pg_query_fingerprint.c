@@ -16,18 +16,51 @@
 #include "nodes/value.h"
 
 #include "common/hashfn.h"
+#include "utils/builtins.h"
 
 #include <unistd.h>
 #include <fcntl.h>
 
 // Definitions
 
+/*
+ * State for recording the fingerprints of subtrees (statements, subqueries and
+ * CTEs) while walking the whole tree.
+ *
+ * While at least one subtree is open, every byte fed into the main hash is
+ * also appended to "bytes"; a subtree's fingerprint is the hash of the range
+ * of bytes written between its opening and closing, so nested subtrees are
+ * recorded in the same pass.
+ */
+typedef struct FingerprintSubtreeItem
+{
+	PgQueryFingerprintSubtree subtree;
+
+	/* Offset into FingerprintSubtrees.bytes where this subtree starts */
+	size_t bytes_start;
+} FingerprintSubtreeItem;
+
+typedef struct FingerprintSubtrees
+{
+	StringInfoData bytes;
+
+	FingerprintSubtreeItem *items;
+	int n_items;
+	int items_size;
+
+	/* Index of the innermost open subtree, -1 if none is open */
+	int current;
+} FingerprintSubtrees;
+
 typedef struct FingerprintContext
 {
 	XXH3_state_t *xxh_state;
 
 	struct listsort_cache_hash *listsort_cache;
 
+	/* Only set for the top-level context in pg_query_fingerprint_subtrees */
+	FingerprintSubtrees *subtrees;
+
 	bool write_tokens;
 	dlist_head tokens;
 } FingerprintContext;
@@ -62,13 +95,42 @@ typedef struct FingerprintListsortItemCacheEntry
 #define SH_DECLARE
 #include "lib/simplehash.h"
 
+/*
+ * Identifies the field a node is being fingerprinted under, so decisions that
+ * depend on the parent field are a single comparison rather than strcmp calls
+ * on the field name. Only fields the fingerprinter looks at get their own
+ * value (see FINGERPRINT_FIELD_IDS in scripts/generate_fingerprint_outfuncs.rb).
+ */
+typedef enum FingerprintField
+{
+	FINGERPRINT_FIELD_NONE = 0,	/* top-level node, no parent field */
+	FINGERPRINT_FIELD_OTHER,
+	FINGERPRINT_FIELD_ARGS,
+	FINGERPRINT_FIELD_COLS,
+	FINGERPRINT_FIELD_FROM_CLAUSE,
+	FINGERPRINT_FIELD_REXPR,
+	FINGERPRINT_FIELD_TARGET_LIST,
+	FINGERPRINT_FIELD_VALUES_LISTS
+} FingerprintField;
+
+#define FINGERPRINT_FIELD_BIT(field) (UINT32_C(1) << (field))
+
+/* Lists in these fields are fingerprinted independent of their item order */
+#define FINGERPRINT_LISTSORT_FIELDS \
+	(FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_ARGS) | \
+	 FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_COLS) | \
+	 FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_FROM_CLAUSE) | \
+	 FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_REXPR) | \
+	 FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_TARGET_LIST) | \
+	 FINGERPRINT_FIELD_BIT(FINGERPRINT_FIELD_VALUES_LISTS))
+
 typedef struct FingerprintToken
 {
 	char *str;
 	dlist_node list_node;
 } FingerprintToken;
 
-static void _fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, char *parent_field_name, unsigned int depth);
+static void _fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, FingerprintField parent_field, unsigned int depth);
 static void _fingerprintInitContext(FingerprintContext *ctx, FingerprintContext *parent, bool write_tokens);
 static void _fingerprintFreeContext(FingerprintContext *ctx);
 
@@ -77,28 +139,126 @@ static void _fingerprintFreeContext(FingerprintContext *ctx);
 // Implementations
 
 static void
+_fingerprintPushToken(FingerprintContext *ctx, const char *str, size_t len)
+{
+	FingerprintToken *token = palloc0(sizeof(FingerprintToken));
+	token->str = palloc(len + 1);
+	memcpy(token->str, str, len);
+	token->str[len] = '\0';
+	dlist_push_tail(&ctx->tokens, &token->list_node);
+}
+
+static inline void
+_fingerprintStringLen(FingerprintContext *ctx, const char *str, size_t len)
+{
+	if (ctx->xxh_state != NULL) {
+		XXH3_64bits_update(ctx->xxh_state, str, len);
+	}
+
+	if (ctx->subtrees != NULL && ctx->subtrees->current >= 0) {
+		appendBinaryStringInfo(&ctx->subtrees->bytes, str, len);
+	}
+
+	if (ctx->write_tokens) {
+		_fingerprintPushToken(ctx, str, len);
+	}
+}
+
+static inline void
 _fingerprintString(FingerprintContext *ctx, const char *str)
+{
+	_fingerprintStringLen(ctx, str, strlen(str));
+}
+
+/*
+ * Hashes two adjacent tokens with a single update. The tokens are passed as
+ * one concatenated run plus the length of the first one, so that the token
+ * list (used for debugging) still records them separately.
+ */
+static inline void
+_fingerprintStringPair(FingerprintContext *ctx, const char *run, size_t first_len, size_t len)
 {
 	if (ctx->xxh_state != NULL) {
-		XXH3_64bits_update(ctx->xxh_state, str, strlen(str));
+		XXH3_64bits_update(ctx->xxh_state, run, len);
+	}
+
+	if (ctx->subtrees != NULL && ctx->subtrees->current >= 0) {
+		appendBinaryStringInfo(&ctx->subtrees->bytes, run, len);
 	}
 
 	if (ctx->write_tokens) {
-		FingerprintToken *token = palloc0(sizeof(FingerprintToken));
-		token->str = pstrdup(str);
-		dlist_push_tail(&ctx->tokens, &token->list_node);
+		_fingerprintPushToken(ctx, run, first_len);
+		_fingerprintPushToken(ctx, run + first_len, len - first_len);
 	}
 }
 
+// Constant tokens have their lengths computed at compile time
+#define _fingerprintLiteral(ctx, lit) \
+	_fingerprintStringLen(ctx, "" lit, sizeof(lit) - 1)
+#define _fingerprintLiteralPair(ctx, a, b) \
+	_fingerprintStringPair(ctx, "" a b, sizeof(a) - 1, sizeof(a b) - 1)
+
+/*
+ * Locale-independent decimal formatting, equivalent to the "%d"/"%ld" and
+ * UINT64_FORMAT output previously produced with sprintf.
+ */
+static void
+_fingerprintUInt64Digits(FingerprintContext *ctx, uint64 value, bool negative)
+{
+	char buffer[MAXINT8LEN + 1];
+	char *end = buffer + sizeof(buffer);
+	char *p = end;
+
+	do {
+		*--p = '0' + (value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	if (negative)
+		*--p = '-';
+
+	_fingerprintStringLen(ctx, p, end - p);
+}
+
+static inline void
+_fingerprintUInt64(FingerprintContext *ctx, uint64 value)
+{
+	_fingerprintUInt64Digits(ctx, value, false);
+}
+
+static inline void
+_fingerprintInt64(FingerprintContext *ctx, int64 value)
+{
+	if (value < 0)
+		_fingerprintUInt64Digits(ctx, (uint64) 0 - (uint64) value, true);
+	else
+		_fingerprintUInt64Digits(ctx, (uint64) value, false);
+}
+
+/*
+ * Undoes writing a field name, after fingerprinting the field's value turned
+ * out to produce no output. "prev" is the hash state before the field name.
+ */
+static void
+_fingerprintDiscardFieldName(FingerprintContext *ctx, XXH3_state_t *prev, size_t name_len)
+{
+	XXH3_copyState(ctx->xxh_state, prev);
+
+	if (ctx->subtrees != NULL && ctx->subtrees->current >= 0) {
+		ctx->subtrees->bytes.len -= name_len;
+		ctx->subtrees->bytes.data[ctx->subtrees->bytes.len] = '\0';
+	}
+
+	if (ctx->write_tokens)
+		dlist_delete(dlist_tail_node(&ctx->tokens));
+}
+
 static void
 _fingerprintInteger(FingerprintContext *ctx, const union ValUnion *value)
 {
 	if (value->ival.ival != 0) {
-		_fingerprintString(ctx, "Integer");
-		_fingerprintString(ctx, "ival");
-		char buffer[50];
-		sprintf(buffer, "%d", value->ival.ival);
-		_fingerprintString(ctx, buffer);
+		_fingerprintLiteralPair(ctx, "Integer", "ival");
+		_fingerprintInt64(ctx, value->ival.ival);
 	}
 }
 
@@ -109,8 +269,7 @@ _fingerprintFloat(FingerprintContext *ctx, const union ValUnion *value)
 		// NB: We output `str` here intentionally, to match the output format from libpg_query 14
 		// and below. This results in stable fingerprints, despite the field name being changed in
 		// PG15 to `fval`.
-		_fingerprintString(ctx, "Float");
-		_fingerprintString(ctx, "str");
+		_fingerprintLiteralPair(ctx, "Float", "str");
 		_fingerprintString(ctx, value->fval.fval);
 	}
 }
@@ -118,9 +277,11 @@ _fingerprintFloat(FingerprintContext *ctx, const union ValUnion *value)
 static void
 _fingerprintBoolean(FingerprintContext *ctx, const union ValUnion *value)
 {
-	_fingerprintString(ctx, "Boolean");
-	_fingerprintString(ctx, "boolval");
-	_fingerprintString(ctx, value->boolval.boolval ? "true" : "false");
+	_fingerprintLiteralPair(ctx, "Boolean", "boolval");
+	if (value->boolval.boolval)
+		_fingerprintLiteral(ctx, "true");
+	else
+		_fingerprintLiteral(ctx, "false");
 }
 
 static void
@@ -130,8 +291,7 @@ _fingerprintBitString(FingerprintContext *ctx, const union ValUnion *value)
 		// NB: We output `str` here intentionally, to match the output format from libpg_query 14
 		// and below. This results in stable fingerprints, despite the field name being changed in
 		// PG15 to `bsval`.
-		_fingerprintString(ctx, "BitString");
-		_fingerprintString(ctx, "str");
+		_fingerprintLiteralPair(ctx, "BitString", "str");
 		_fingerprintString(ctx, value->bsval.bsval);
 	}
 }
@@ -148,11 +308,9 @@ static int compareFingerprintListsortItem(const void *a, const void *b)
 }
 
 static void
-_fingerprintList(FingerprintContext *ctx, const List *node, const void *parent, char *field_name, unsigned int depth)
+_fingerprintList(FingerprintContext *ctx, const List *node, const void *parent, FingerprintField field, unsigned int depth)
 {
-	if (field_name != NULL && (strcmp(field_name, "fromClause") == 0 || strcmp(field_name, "targetList") == 0 ||
-		strcmp(field_name, "cols") == 0 || strcmp(field_name, "rexpr") == 0 || strcmp(field_name, "valuesLists") == 0 ||
-		strcmp(field_name, "args") == 0))
+	if (FINGERPRINT_LISTSORT_FIELDS & FINGERPRINT_FIELD_BIT(field))
 	{
 		/*
 		 * Check for cached values for the hashes of subnodes
@@ -186,7 +344,7 @@ _fingerprintList(FingerprintContext *ctx, const List *node, const void *parent,
 				FingerprintListsortItem* lctx = palloc0(sizeof(FingerprintListsortItem));
 
 				_fingerprintInitContext(&fctx, ctx, false);
-				_fingerprintNode(&fctx, lfirst(lc), parent, field_name, depth + 1);
+				_fingerprintNode(&fctx, lfirst(lc), parent, field, depth + 1);
 				lctx->hash = XXH3_64bits_digest(fctx.xxh_state);
 				lctx->list_pos = listsort_items_size;
 				_fingerprintFreeContext(&fctx);
@@ -209,7 +367,7 @@ _fingerprintList(FingerprintContext *ctx, const List *node, const void *parent,
 			if (i > 0 && listsort_items[i - 1]->hash == listsort_items[i]->hash)
 				continue; // Ignore duplicates
 
-			_fingerprintNode(ctx, lfirst(list_nth_cell(node, listsort_items[i]->list_pos)), parent, field_name, depth + 1);
+			_fingerprintNode(ctx, lfirst(list_nth_cell(node, listsort_items[i]->list_pos)), parent, field, depth + 1);
 		}
 	}
 	else
@@ -218,7 +376,7 @@ _fingerprintList(FingerprintContext *ctx, const List *node, const void *parent,
 
 		foreach(lc, node)
 		{
-			_fingerprintNode(ctx, lfirst(lc), parent, field_name, depth + 1);
+			_fingerprintNode(ctx, lfirst(lc), parent, field, depth + 1);
 
 			lnext(node, lc);
 		}
@@ -232,6 +390,9 @@ _fingerprintInitContext(FingerprintContext *ctx, FingerprintContext *parent, boo
 	if (ctx->xxh_state == NULL) abort();
 	if (XXH3_64bits_reset_withSeed(ctx->xxh_state, PG_QUERY_FINGERPRINT_VERSION) == XXH_ERROR) abort();
 
+	// Subtrees are only recorded by the top-level context, never while hashing list items for sorting
+	ctx->subtrees = NULL;
+
 	if (parent != NULL)
 	{
 		ctx->listsort_cache = parent->listsort_cache;
@@ -257,11 +418,77 @@ _fingerprintFreeContext(FingerprintContext *ctx) {
 	XXH3_freeState(ctx->xxh_state);
 }
 
+static int
+_fingerprintOpenSubtree(FingerprintContext *ctx, const void *obj, const void *parent)
+{
+	FingerprintSubtrees *subtrees = ctx->subtrees;
+	PgQueryFingerprintSubtree *item;
+	int index;
+
+	if (subtrees->n_items == subtrees->items_size)
+	{
+		subtrees->items_size *= 2;
+		subtrees->items = repalloc(subtrees->items, subtrees->items_size * sizeof(FingerprintSubtreeItem));
+	}
+
+	index = subtrees->n_items++;
+	subtrees->items[index].bytes_start = subtrees->bytes.len;
+	item = &subtrees->items[index].subtree;
+	item->parent = subtrees->current;
+	item->fingerprint = 0;
+
+	switch (nodeTag(obj))
+	{
+		case T_SelectStmt:
+			item->node_type = "SelectStmt";
+			// SelectStmt has no location of its own, use the statement's if this is a top-level statement
+			item->location = (parent != NULL && IsA(parent, RawStmt)) ? castNode(RawStmt, (void *) parent)->stmt_location : -1;
+			break;
+		case T_CommonTableExpr:
+			item->node_type = "CommonTableExpr";
+			item->location = castNode(CommonTableExpr, (void *) obj)->location;
+			break;
+		case T_SubLink:
+			item->node_type = "SubLink";
+			item->location = castNode(SubLink, (void *) obj)->location;
+			break;
+		case T_RangeSubselect:
+			item->node_type = "RangeSubselect";
+			item->location = -1;
+			break;
+		default:
+			Assert(false);
+			break;
+	}
+
+	subtrees->current = index;
+
+	return index;
+}
+
+static void
+_fingerprintCloseSubtree(FingerprintContext *ctx, int index)
+{
+	FingerprintSubtrees *subtrees = ctx->subtrees;
+	FingerprintSubtreeItem *item = &subtrees->items[index];
+
+	item->subtree.fingerprint = XXH3_64bits_withSeed(subtrees->bytes.data + item->bytes_start,
+													 subtrees->bytes.len - item->bytes_start,
+													 PG_QUERY_FINGERPRINT_VERSION);
+	subtrees->current = item->subtree.parent;
+
+	// Once the outermost subtree is done its bytes are no longer needed
+	if (subtrees->current < 0)
+		resetStringInfo(&subtrees->bytes);
+}
+
 #include "pg_query_enum_defs.c"
 #include "pg_query_fingerprint_defs.c"
 
+static void _fingerprintNodeContents(FingerprintContext *ctx, const void *obj, const void *parent, FingerprintField field, unsigned int depth);
+
 void
-_fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, char *field_name, unsigned int depth)
+_fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, FingerprintField field, unsigned int depth)
 {
 	// Some queries are overly complex in their parsetree - lets consistently cut them off at 100 nodes deep
 	if (depth >= 100) {
@@ -273,10 +500,26 @@ _fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, c
 		return; // Ignore
 	}
 
+	if (ctx->subtrees != NULL &&
+		(IsA(obj, SelectStmt) || IsA(obj, CommonTableExpr) || IsA(obj, SubLink) || IsA(obj, RangeSubselect)))
+	{
+		int index = _fingerprintOpenSubtree(ctx, obj, parent);
+		_fingerprintNodeContents(ctx, obj, parent, field, depth);
+		_fingerprintCloseSubtree(ctx, index);
+	}
+	else
+	{
+		_fingerprintNodeContents(ctx, obj, parent, field, depth);
+	}
+}
+
+static void
+_fingerprintNodeContents(FingerprintContext *ctx, const void *obj, const void *parent, FingerprintField field, unsigned int depth)
+{
 	switch (nodeTag(obj))
 	{
 		case T_List:
-			_fingerprintList(ctx, obj, parent, field_name, depth);
+			_fingerprintList(ctx, obj, parent, field, depth);
 			break;
 		case T_Integer:
 			_fingerprintInteger(ctx, obj);
@@ -291,8 +534,7 @@ _fingerprintNode(FingerprintContext *ctx, const void *obj, const void *parent, c
 			// NB: We output `str` here intentionally, to match the output format from libpg_query
 			// 14 and below. This results in stable fingerprints, despite the field name being
 			// changed in PG15 to `sval`.
-			_fingerprintString(ctx, "String");
-			_fingerprintString(ctx, "str");
+			_fingerprintLiteralPair(ctx, "String", "str");
 			_fingerprintString(ctx, ((union ValUnion*) obj)->sval.sval);
 			break;
 		case T_BitString:
@@ -315,7 +557,7 @@ uint64_t pg_query_fingerprint_node(const void *node)
 	uint64 result;
 
 	_fingerprintInitContext(&ctx, NULL, false);
-	_fingerprintNode(&ctx, node, NULL, NULL, 0);
+	_fingerprintNode(&ctx, node, NULL, FINGERPRINT_FIELD_NONE, 0);
 
 	result = XXH3_64bits_digest(ctx.xxh_state);
 
@@ -325,6 +567,11 @@ uint64_t pg_query_fingerprint_node(const void *node)
 }
 
 PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int parser_options, bool printTokens)
+{
+	return pg_query_fingerprint_with_opts_n(input, strlen(input), parser_options, printTokens);
+}
+
+PgQueryFingerprintResult pg_query_fingerprint_with_opts_n(const char* input, size_t len, int parser_options, bool printTokens)
 {
 	MemoryContext ctx = NULL;
 	PgQueryInternalParsetreeAndError parsetree_and_error;
@@ -332,7 +579,7 @@ PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int p
 
 	ctx = pg_query_enter_memory_context();
 
-	parsetree_and_error = pg_query_raw_parse(input, parser_options);
+	parsetree_and_error = pg_query_raw_parse(input, len, parser_options);
 
 	// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
 	result.stderr_buffer = parsetree_and_error.stderr_buffer;
@@ -345,7 +592,7 @@ PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int p
 		_fingerprintInitContext(&ctx, NULL, printTokens);
 
 		if (parsetree_and_error.tree != NULL) {
-			_fingerprintNode(&ctx, parsetree_and_error.tree, NULL, NULL, 0);
+			_fingerprintNode(&ctx, parsetree_and_error.tree, NULL, FINGERPRINT_FIELD_NONE, 0);
 		}
 
 		if (printTokens) {
@@ -372,7 +619,7 @@ PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int p
 						   chash.digest[0], chash.digest[1], chash.digest[2], chash.digest[3],
 						   chash.digest[4], chash.digest[5], chash.digest[6], chash.digest[7]);
 		if (n < 0 || n >= 17) {
-			PgQueryError* error = malloc(sizeof(PgQueryError));
+			PgQueryError* error = calloc(1, sizeof(PgQueryError));
 			error->message = strdup("Failed to output fingerprint string due to snprintf failure");
 			result.error = error;
 		}
@@ -383,6 +630,80 @@ PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int p
 	return result;
 }
 
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_opts(const char* input, int parser_options)
+{
+	return pg_query_fingerprint_subtrees_opts_n(input, strlen(input), parser_options);
+}
+
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_n(const char* input, size_t len)
+{
+	return pg_query_fingerprint_subtrees_opts_n(input, len, PG_QUERY_PARSE_DEFAULT);
+}
+
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees_opts_n(const char* input, size_t len, int parser_options)
+{
+	MemoryContext ctx = NULL;
+	PgQueryInternalParsetreeAndError parsetree_and_error;
+	PgQueryFingerprintSubtreesResult result = {0};
+
+	ctx = pg_query_enter_memory_context();
+
+	parsetree_and_error = pg_query_raw_parse(input, len, parser_options);
+
+	// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
+	result.stderr_buffer = parsetree_and_error.stderr_buffer;
+	result.error = parsetree_and_error.error;
+
+	if (parsetree_and_error.tree != NULL || result.error == NULL) {
+		FingerprintContext ctx;
+		FingerprintSubtrees subtrees;
+		XXH64_canonical_t chash;
+
+		initStringInfo(&subtrees.bytes);
+		subtrees.items_size = 16;
+		subtrees.items = palloc(subtrees.items_size * sizeof(FingerprintSubtreeItem));
+		subtrees.n_items = 0;
+		subtrees.current = -1;
+
+		_fingerprintInitContext(&ctx, NULL, false);
+		ctx.subtrees = &subtrees;
+
+		if (parsetree_and_error.tree != NULL) {
+			_fingerprintNode(&ctx, parsetree_and_error.tree, NULL, FINGERPRINT_FIELD_NONE, 0);
+		}
+
+		result.fingerprint = XXH3_64bits_digest(ctx.xxh_state);
+		_fingerprintFreeContext(&ctx);
+
+		XXH64_canonicalFromHash(&chash, result.fingerprint);
+		result.fingerprint_str = malloc(17 * sizeof(char));
+		int n = snprintf(result.fingerprint_str, 17, "%02x%02x%02x%02x%02x%02x%02x%02x",
+						   chash.digest[0], chash.digest[1], chash.digest[2], chash.digest[3],
+						   chash.digest[4], chash.digest[5], chash.digest[6], chash.digest[7]);
+		if (n < 0 || n >= 17) {
+			PgQueryError* error = calloc(1, sizeof(PgQueryError));
+			error->message = strdup("Failed to output fingerprint string due to snprintf failure");
+			result.error = error;
+		}
+
+		if (subtrees.n_items > 0) {
+			result.subtrees = malloc(subtrees.n_items * sizeof(PgQueryFingerprintSubtree));
+			for (int i = 0; i < subtrees.n_items; i++)
+				result.subtrees[i] = subtrees.items[i].subtree;
+		}
+		result.n_subtrees = subtrees.n_items;
+	}
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+PgQueryFingerprintSubtreesResult pg_query_fingerprint_subtrees(const char* input)
+{
+	return pg_query_fingerprint_subtrees_opts(input, PG_QUERY_PARSE_DEFAULT);
+}
+
 PgQueryFingerprintResult pg_query_fingerprint(const char* input)
 {
 	return pg_query_fingerprint_with_opts(input, PG_QUERY_PARSE_DEFAULT, false);
@@ -393,6 +714,16 @@ PgQueryFingerprintResult pg_query_fingerprint_opts(const char* input, int parser
 	return pg_query_fingerprint_with_opts(input, parser_options, false);
 }
 
+PgQueryFingerprintResult pg_query_fingerprint_n(const char* input, size_t len)
+{
+	return pg_query_fingerprint_with_opts_n(input, len, PG_QUERY_PARSE_DEFAULT, false);
+}
+
+PgQueryFingerprintResult pg_query_fingerprint_opts_n(const char* input, size_t len, int parser_options)
+{
+	return pg_query_fingerprint_with_opts_n(input, len, parser_options, false);
+}
+
 void pg_query_free_fingerprint_result(PgQueryFingerprintResult result)
 {
 	if (result.error) {
@@ -405,3 +736,17 @@ void pg_query_free_fingerprint_result(PgQueryFingerprintResult result)
 	free(result.fingerprint_str);
 	free(result.stderr_buffer);
 }
+
+void pg_query_free_fingerprint_subtrees_result(PgQueryFingerprintSubtreesResult result)
+{
+	if (result.error) {
+		free(result.error->message);
+		free(result.error->filename);
+		free(result.error->funcname);
+		free(result.error);
+	}
+
+	free(result.fingerprint_str);
+	free(result.subtrees);
+	free(result.stderr_buffer);
+}
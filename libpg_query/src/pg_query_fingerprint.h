@@ -5,6 +5,8 @@
 
 extern PgQueryFingerprintResult pg_query_fingerprint_with_opts(const char* input, int parser_options, bool printTokens);
 
+extern PgQueryFingerprintResult pg_query_fingerprint_with_opts_n(const char* input, size_t len, int parser_options, bool printTokens);
+
 extern uint64_t pg_query_fingerprint_node(const void * node);
 
 #endif
@@ -4,6 +4,7 @@
 #include "postgres.h"
 #include "utils/memutils.h"
 #include "nodes/pg_list.h"
+#include "parser/parser.h"
 
 #define STDERR_BUFFER_LEN 4096
 #define DEBUG
@@ -14,10 +15,25 @@ typedef struct {
   PgQueryError* error;
 } PgQueryInternalParsetreeAndError;
 
-PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, int parser_options);
+PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, size_t len, int parser_options);
+List *pg_query_raw_parser(const char *input, size_t len, RawParseMode mode);
+PgQueryErrorCode pg_query_parse_limit_error(void);
+void pg_query_collapse_lists(List *tree, const char *input, size_t len, int max_length);
 
 void pg_query_free_error(PgQueryError *error);
 
+// Output buffers of results, see PgQueryOutputAllocator
+void *pg_query_output_alloc(size_t size);
+char *pg_query_output_strdup(const char *str, size_t len);
+void pg_query_output_free(void *ptr);
+
+// Maintained by aset.c, see patches/11_alloc_set_track_peak.patch
+extern __thread Size AllocSetTrackedAllocated;
+extern __thread Size AllocSetTrackedPeak;
+extern __thread uint64 AllocSetTrackedBlocks;
+extern __thread Size AllocSetTrackedLimit;
+extern __thread bool AllocSetTrackedLimitExceeded;
+
 MemoryContext pg_query_enter_memory_context();
 void pg_query_exit_memory_context(MemoryContext ctx);
 
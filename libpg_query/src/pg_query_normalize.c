@@ -49,10 +49,25 @@ typedef struct pgssConstLocations
 	int param_refs_buf_size;
 	int param_refs_count;
 
+	/* Should ParamRefs be collected into param_ref_locations? Set by pg_query_param_refs */
+	bool record_param_ref_locations;
+
+	/* ParamRefLocation for each ParamRef walked, in the order they were found */
+	List *param_ref_locations;
+
 	/* Should only utility statements be normalized? Set by pg_query_normalize_utility */
 	bool normalize_utility_only;
 } pgssConstLocations;
 
+/*
+ * A ParamRef found by pg_query_param_refs, and the type it is cast to
+ */
+typedef struct ParamRefLocation
+{
+	ParamRef *param_ref;
+	TypeName *type_name;	/* NULL unless the ParamRef is the argument of a TypeCast */
+} ParamRefLocation;
+
 /*
  * Intermediate working state struct to remember param refs for individual target list elements
  */
@@ -123,10 +138,11 @@ fill_in_constant_lengths(pgssConstLocations *jstate, const char *query)
 	locs = jstate->clocations;
 
 	/* initialize the flex scanner --- should match raw_parser() */
-	yyscanner = scanner_init(query,
-							 &yyextra,
-							 &ScanKeywords,
-							 ScanKeywordTokens);
+	yyscanner = scanner_init_n(query,
+							   jstate->query_len,
+							   &yyextra,
+							   &ScanKeywords,
+							   ScanKeywordTokens);
 
 	/* Search for each constant, in sequence */
 	for (i = 0; i < jstate->clocations_count; i++)
@@ -383,8 +399,28 @@ static bool const_record_walker(Node *node, pgssConstLocations *jstate)
 						jstate->param_refs = (int *) repalloc(jstate->param_refs, jstate->param_refs_buf_size * sizeof(int));
 					}
 				}
+
+				if (jstate->record_param_ref_locations) {
+					ParamRefLocation *param_ref_location = palloc0(sizeof(ParamRefLocation));
+					param_ref_location->param_ref = (ParamRef *) node;
+					jstate->param_ref_locations = lappend(jstate->param_ref_locations, param_ref_location);
+				}
 			}
 			break;
+		case T_TypeCast:
+			{
+				TypeCast *type_cast = (TypeCast *) node;
+
+				/* Remember the type of cast ParamRefs, e.g. "$1::text" */
+				if (jstate->record_param_ref_locations && type_cast->arg != NULL && IsA(type_cast->arg, ParamRef))
+				{
+					if (const_record_walker(type_cast->arg, jstate))
+						return true;
+					((ParamRefLocation *) llast(jstate->param_ref_locations))->type_name = type_cast->typeName;
+					return false;
+				}
+				return raw_expression_tree_walker(node, const_record_walker, (void*) jstate);
+			}
 		case T_DefElem:
 			{
 				DefElem * defElem = (DefElem *) node;
@@ -421,6 +457,41 @@ static bool const_record_walker(Node *node, pgssConstLocations *jstate)
 		case T_DoStmt:
 			if (jstate->normalize_utility_only) return false;
 			return const_record_walker((Node *) ((DoStmt *) node)->args, jstate);
+		case T_PrepareStmt:
+			/* Statements that aren't normalized, but whose param refs are still reported */
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((PrepareStmt *) node)->query, jstate);
+		case T_ExecuteStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((ExecuteStmt *) node)->params, jstate);
+		case T_CreateTableAsStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((CreateTableAsStmt *) node)->query, jstate);
+		case T_ViewStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((ViewStmt *) node)->query, jstate);
+		case T_CallStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((CallStmt *) node)->funccall, jstate);
+		case T_CreateStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((CreateStmt *) node)->tableElts, jstate);
+		case T_AlterTableStmt:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker((Node *) ((AlterTableStmt *) node)->cmds, jstate);
+		case T_AlterTableCmd:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker(((AlterTableCmd *) node)->def, jstate);
+		case T_ColumnDef:
+			/* raw_expression_tree_walker skips the constraints, e.g. "DEFAULT $1" */
+			if (!jstate->record_param_ref_locations)
+				return raw_expression_tree_walker(node, const_record_walker, (void*) jstate);
+			if (raw_expression_tree_walker(node, const_record_walker, (void*) jstate))
+				return true;
+			return const_record_walker((Node *) ((ColumnDef *) node)->constraints, jstate);
+		case T_Constraint:
+			if (!jstate->record_param_ref_locations) return false;
+			return const_record_walker(((Constraint *) node)->raw_expr, jstate);
 		case T_CreateSubscriptionStmt:
 			record_matching_string(jstate, ((CreateSubscriptionStmt *) node)->conninfo);
 			break;
@@ -587,7 +658,7 @@ static bool const_record_walker(Node *node, pgssConstLocations *jstate)
 	return false;
 }
 
-PgQueryNormalizeResult pg_query_normalize_ext(const char* input, bool normalize_utility_only)
+PgQueryNormalizeResult pg_query_normalize_ext(const char* input, size_t len, bool normalize_utility_only)
 {
 	MemoryContext ctx = NULL;
 	PgQueryNormalizeResult result = {0};
@@ -599,11 +670,12 @@ PgQueryNormalizeResult pg_query_normalize_ext(const char* input, bool normalize_
 		List *tree;
 		pgssConstLocations jstate;
 		int query_len;
+		char *normalized_query;
 
 		/* Parse query */
-		tree = raw_parser(input, RAW_PARSE_DEFAULT);
+		tree = pg_query_raw_parser(input, len, RAW_PARSE_DEFAULT);
 
-		query_len = (int) strlen(input);
+		query_len = (int) len;
 
 		/* Set up workspace for constant recording */
 		jstate.clocations_buf_size = 32;
@@ -617,13 +689,16 @@ PgQueryNormalizeResult pg_query_normalize_ext(const char* input, bool normalize_
 		jstate.param_refs = NULL;
 		jstate.param_refs_buf_size = 0;
 		jstate.param_refs_count = 0;
+		jstate.record_param_ref_locations = false;
+		jstate.param_ref_locations = NIL;
 		jstate.normalize_utility_only = normalize_utility_only;
 
 		/* Walk tree and record const locations */
 		const_record_walker((Node *) tree, &jstate);
 
 		/* Normalize query */
-		result.normalized_query = strdup(generate_normalized_query(&jstate, 0, &query_len, PG_UTF8));
+		normalized_query = generate_normalized_query(&jstate, 0, &query_len, PG_UTF8);
+		result.normalized_query = pg_query_output_strdup(normalized_query, query_len);
 	}
 	PG_CATCH();
 	{
@@ -633,13 +708,14 @@ PgQueryNormalizeResult pg_query_normalize_ext(const char* input, bool normalize_
 		MemoryContextSwitchTo(ctx);
 		error_data = CopyErrorData();
 
-		error = malloc(sizeof(PgQueryError));
+		error = calloc(1, sizeof(PgQueryError));
 		error->message   = strdup(error_data->message);
 		error->filename  = strdup(error_data->filename);
 		error->funcname  = strdup(error_data->funcname);
 		error->context   = NULL;
 		error->lineno    = error_data->lineno;
 		error->cursorpos = error_data->cursorpos;
+		error->code      = pg_query_parse_limit_error();
 
 		result.error = error;
 		FlushErrorState();
@@ -653,13 +729,162 @@ PgQueryNormalizeResult pg_query_normalize_ext(const char* input, bool normalize_
 
 PgQueryNormalizeResult pg_query_normalize(const char* input)
 {
-	return pg_query_normalize_ext(input, false);
+	return pg_query_normalize_ext(input, strlen(input), false);
+}
+
+PgQueryNormalizeResult pg_query_normalize_n(const char* input, size_t len)
+{
+	return pg_query_normalize_ext(input, len, false);
 }
 
 
 PgQueryNormalizeResult pg_query_normalize_utility(const char* input)
 {
-	return pg_query_normalize_ext(input, true);
+	return pg_query_normalize_ext(input, strlen(input), true);
+}
+
+PgQueryNormalizeResult pg_query_normalize_utility_n(const char* input, size_t len)
+{
+	return pg_query_normalize_ext(input, len, true);
+}
+
+static int
+comp_param_ref_location(const void *a, const void *b)
+{
+	int			l = ((const PgQueryParamRef *) a)->location;
+	int			r = ((const PgQueryParamRef *) b)->location;
+
+	if (l < r)
+		return -1;
+	else if (l > r)
+		return +1;
+	else
+		return 0;
+}
+
+/*
+ * Builds the result entry for a ParamRef found by const_record_walker. A cast
+ * ParamRef covers the type name too when the type comes first (e.g. in
+ * "INTERVAL $1").
+ */
+static void
+fill_param_ref(PgQueryParamRef *param_ref, ParamRefLocation *param_ref_location)
+{
+	ParamRef   *node = param_ref_location->param_ref;
+	TypeName   *type_name = param_ref_location->type_name;
+	ListCell   *lc;
+
+	/* Number 0 is a "?" replacement character */
+	param_ref->location = node->location;
+	param_ref->length = node->number == 0 ? 1 : snprintf(NULL, 0, "$%d", node->number);
+
+	if (type_name == NULL)
+		return;
+
+	if (node->location == -1)
+	{
+		param_ref->location = type_name->location;
+	}
+	else if (type_name->location != -1 && type_name->location < node->location)
+	{
+		param_ref->length += node->location - type_name->location;
+		param_ref->location = type_name->location;
+	}
+
+	param_ref->n_type_names = list_length(type_name->names);
+	param_ref->type_names = malloc(param_ref->n_type_names * sizeof(char *));
+	foreach(lc, type_name->names)
+		param_ref->type_names[foreach_current_index(lc)] = strdup(strVal(lfirst(lc)));
+}
+
+PgQueryParamRefsResult pg_query_param_refs_n(const char* input, size_t len)
+{
+	MemoryContext ctx = NULL;
+	PgQueryParamRefsResult result = {0};
+
+	ctx = pg_query_enter_memory_context();
+
+	PG_TRY();
+	{
+		List *tree;
+		pgssConstLocations jstate;
+		ListCell *lc;
+
+		/* Parse query */
+		tree = pg_query_raw_parser(input, len, RAW_PARSE_DEFAULT);
+
+		/* Set up workspace like for normalizing, the constant locations are just not used */
+		jstate.clocations_buf_size = 32;
+		jstate.clocations = (pgssLocationLen *)
+			palloc(jstate.clocations_buf_size * sizeof(pgssLocationLen));
+		jstate.clocations_count = 0;
+		jstate.highest_normalize_param_id = 1;
+		jstate.highest_extern_param_id = 0;
+		jstate.query = input;
+		jstate.query_len = (int) len;
+		jstate.param_refs = NULL;
+		jstate.param_refs_buf_size = 0;
+		jstate.param_refs_count = 0;
+		jstate.record_param_ref_locations = true;
+		jstate.param_ref_locations = NIL;
+		jstate.normalize_utility_only = false;
+
+		/* Walk tree and record param refs */
+		const_record_walker((Node *) tree, &jstate);
+
+		result.n_param_refs = list_length(jstate.param_ref_locations);
+		if (result.n_param_refs > 0)
+		{
+			result.param_refs = calloc(result.n_param_refs, sizeof(PgQueryParamRef));
+			foreach(lc, jstate.param_ref_locations)
+				fill_param_ref(&result.param_refs[foreach_current_index(lc)], lfirst(lc));
+			qsort(result.param_refs, result.n_param_refs, sizeof(PgQueryParamRef), comp_param_ref_location);
+		}
+	}
+	PG_CATCH();
+	{
+		ErrorData* error_data;
+		PgQueryError* error;
+
+		MemoryContextSwitchTo(ctx);
+		error_data = CopyErrorData();
+
+		error = calloc(1, sizeof(PgQueryError));
+		error->message   = strdup(error_data->message);
+		error->filename  = strdup(error_data->filename);
+		error->funcname  = strdup(error_data->funcname);
+		error->context   = NULL;
+		error->lineno    = error_data->lineno;
+		error->cursorpos = error_data->cursorpos;
+		error->code      = pg_query_parse_limit_error();
+
+		result.error = error;
+		FlushErrorState();
+	}
+	PG_END_TRY();
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+PgQueryParamRefsResult pg_query_param_refs(const char* input)
+{
+	return pg_query_param_refs_n(input, strlen(input));
+}
+
+void pg_query_free_param_refs_result(PgQueryParamRefsResult result)
+{
+	if (result.error) {
+		pg_query_free_error(result.error);
+	}
+
+	for (int i = 0; i < result.n_param_refs; i++) {
+		for (int j = 0; j < result.param_refs[i].n_type_names; j++)
+			free(result.param_refs[i].type_names[j]);
+		free(result.param_refs[i].type_names);
+	}
+	free(result.param_refs);
 }
 
 void pg_query_free_normalize_result(PgQueryNormalizeResult result)
@@ -671,5 +896,5 @@ void pg_query_free_normalize_result(PgQueryNormalizeResult result)
     free(result.error);
   }
 
-  free(result.normalized_query);
+  pg_query_output_free(result.normalized_query);
 }
@@ -20,44 +20,70 @@
     _out##typename_c(out, (const typename_cast *) obj); \
   }
 
+/*
+ * The fields of every node go through the macros below, so they append keys
+ * and other literals with their length known at compile time, and format
+ * integers directly, instead of going through appendStringInfo's format
+ * string handling.
+ */
+
+/* Append a string literal */
+#define appendStringLiteral(out, str) \
+	appendBinaryStringInfo(out, str, sizeof(str) - 1)
+
+/* Write the key of a field */
+#define WRITE_KEY(outname_json) \
+	appendStringLiteral(out, "\"" CppAsString(outname_json) "\":")
+
 /* Write the label for the node type */
 #define WRITE_NODE_TYPE(nodelabel) \
-	appendStringInfoString(out, "\"" nodelabel "\":{")
+	appendStringLiteral(out, "\"" nodelabel "\":{")
 
 /* Write an integer field */
 #define WRITE_INT_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != 0) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":%d,", node->fldname); \
+		WRITE_KEY(outname_json); \
+		appendInt64(out, node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
 	}
 
 /* Write an unsigned integer field */
 #define WRITE_UINT_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != 0) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":%u,", node->fldname); \
+		WRITE_KEY(outname_json); \
+		appendUInt64(out, node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
 	}
 
 /* Write an unsigned integer field */
 #define WRITE_UINT64_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != 0) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":" UINT64_FORMAT ",", node->fldname); \
+		WRITE_KEY(outname_json); \
+		appendUInt64(out, node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
 	}
 
 /* Write a long-integer field */
 #define WRITE_LONG_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != 0) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":%ld,", node->fldname); \
+		WRITE_KEY(outname_json); \
+		appendInt64(out, node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
 	}
 
 /* Write a char field (ie, one ascii character) */
 #define WRITE_CHAR_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != 0) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":\"%c\",", node->fldname); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":\""); \
+		appendStringInfoCharMacro(out, node->fldname); \
+		appendStringLiteral(out, "\","); \
 	}
 
 /* Write an enumerated-type field */
 #define WRITE_ENUM_FIELD(typename, outname, outname_json, fldname) \
-	appendStringInfo(out, "\"" CppAsString(outname_json) "\":\"%s\",", \
-					 _enumToString##typename(node->fldname));
+	appendStringLiteral(out, "\"" CppAsString(outname_json) "\":\""); \
+	appendStringInfoString(out, _enumToString##typename(node->fldname)); \
+	appendStringLiteral(out, "\",");
 
 /* Write a float field */
 #define WRITE_FLOAT_FIELD(outname, outname_json, fldname) \
@@ -66,74 +92,108 @@
 /* Write a boolean field */
 #define WRITE_BOOL_FIELD(outname, outname_json, fldname) \
 	if (node->fldname) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":%s,", \
-					 	booltostr(node->fldname)); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":true,"); \
 	}
 
 /* Write a character-string (possibly NULL) field */
 #define WRITE_STRING_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != NULL) { \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":"); \
+		WRITE_KEY(outname_json); \
 	 	_outToken(out, node->fldname); \
-	 	appendStringInfo(out, ","); \
+	 	appendStringInfoCharMacro(out, ','); \
 	}
 
 #define WRITE_LIST_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != NULL) { \
 		const ListCell *lc; \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":"); \
-		appendStringInfoChar(out, '['); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":["); \
 		foreach(lc, node->fldname) { \
 			if (lfirst(lc) == NULL) \
-				appendStringInfoString(out, "{}"); \
+				appendStringLiteral(out, "{}"); \
 			else \
 				_outNode(out, lfirst(lc)); \
 			if (lnext(node->fldname, lc)) \
-				appendStringInfoString(out, ","); \
+				appendStringInfoCharMacro(out, ','); \
 		} \
-		 appendStringInfo(out, "],"); \
-    }
+		appendStringLiteral(out, "],"); \
+	}
 
 #define WRITE_NODE_FIELD(outname, outname_json, fldname) \
 	if (true) { \
-		 appendStringInfo(out, "\"" CppAsString(outname_json) "\":"); \
-	     _outNode(out, &node->fldname); \
-		 appendStringInfo(out, ","); \
-  	}
+		WRITE_KEY(outname_json); \
+		_outNode(out, &node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
+	}
 
 #define WRITE_NODE_PTR_FIELD(outname, outname_json, fldname) \
 	if (node->fldname != NULL) { \
-		 appendStringInfo(out, "\"" CppAsString(outname_json) "\":"); \
-		 _outNode(out, node->fldname); \
-		 appendStringInfo(out, ","); \
+		WRITE_KEY(outname_json); \
+		_outNode(out, node->fldname); \
+		appendStringInfoCharMacro(out, ','); \
 	}
 
 #define WRITE_SPECIFIC_NODE_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
 	{ \
-    	appendStringInfo(out, "\"" CppAsString(outname_json) "\":{"); \
-    	_out##typename(out, &node->fldname); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":{"); \
+		_out##typename(out, &node->fldname); \
 		removeTrailingDelimiter(out); \
- 		appendStringInfo(out, "},"); \
-  	}
+		appendStringLiteral(out, "},"); \
+	}
 
 #define WRITE_SPECIFIC_NODE_PTR_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
 	if (node->fldname != NULL) { \
-		 appendStringInfo(out, "\"" CppAsString(outname_json) "\":{"); \
-	   	 _out##typename(out, node->fldname); \
-		 removeTrailingDelimiter(out); \
- 		 appendStringInfo(out, "},"); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":{"); \
+		_out##typename(out, node->fldname); \
+		removeTrailingDelimiter(out); \
+		appendStringLiteral(out, "},"); \
 	}
 
 #define WRITE_BITMAPSET_FIELD(outname, outname_json, fldname) \
 	if (!bms_is_empty(node->fldname)) \
 	{ \
 		int x = 0; \
-		appendStringInfo(out, "\"" CppAsString(outname_json) "\":["); \
+		appendStringLiteral(out, "\"" CppAsString(outname_json) "\":["); \
 		while ((x = bms_next_member(node->fldname, x)) >= 0) \
-			appendStringInfo(out, "%d,", x); \
+		{ \
+			appendInt64(out, x); \
+			appendStringInfoCharMacro(out, ','); \
+		} \
 		removeTrailingDelimiter(out); \
-		appendStringInfo(out, "],"); \
+		appendStringLiteral(out, "],"); \
+	}
+
+/*
+ * Append the decimal representation of an integer, like "%d", "%u" and "%ld"
+ * would
+ */
+static inline void
+appendUInt64(StringInfo out, uint64 value)
+{
+	char		buf[20];
+	char	   *p = buf + sizeof(buf);
+
+	do
+	{
+		*--p = '0' + value % 10;
+		value /= 10;
+	} while (value != 0);
+
+	appendBinaryStringInfo(out, p, buf + sizeof(buf) - p);
+}
+
+static inline void
+appendInt64(StringInfo out, int64 value)
+{
+	if (value < 0)
+	{
+		appendStringInfoCharMacro(out, '-');
+		appendUInt64(out, (uint64) 0 - (uint64) value);
 	}
+	else
+	{
+		appendUInt64(out, (uint64) value);
+	}
+}
 
 static void _outNode(StringInfo out, const void *obj);
 
@@ -142,22 +202,20 @@ _outList(StringInfo out, const List *node)
 {
 	const ListCell *lc;
 
-	appendStringInfo(out, "\"items\":");
-	appendStringInfoChar(out, '[');
+	appendStringLiteral(out, "\"items\":[");
 
 	foreach(lc, node)
 	{
 		if (lfirst(lc) == NULL)
-			appendStringInfoString(out, "{}");
+			appendStringLiteral(out, "{}");
 		else
 			_outNode(out, lfirst(lc));
 
 		if (lnext(node, lc))
-			appendStringInfoString(out, ",");
+			appendStringInfoCharMacro(out, ',');
 	}
 
-	appendStringInfoChar(out, ']');
-	appendStringInfo(out, ",");
+	appendStringLiteral(out, "],");
 }
 
 static void
@@ -165,19 +223,17 @@ _outIntList(StringInfo out, const List *node)
 {
 	const ListCell *lc;
 
-	appendStringInfo(out, "\"items\":");
-	appendStringInfoChar(out, '[');
+	appendStringLiteral(out, "\"items\":[");
 
 	foreach(lc, node)
 	{
-		appendStringInfo(out, "%d", lfirst_int(lc));
+		appendInt64(out, lfirst_int(lc));
 
 		if (lnext(node, lc))
-			appendStringInfoString(out, ",");
+			appendStringInfoCharMacro(out, ',');
 	}
 
-	appendStringInfoChar(out, ']');
-	appendStringInfo(out, ",");
+	appendStringLiteral(out, "],");
 }
 
 static void
@@ -185,19 +241,17 @@ _outOidList(StringInfo out, const List *node)
 {
 	const ListCell *lc;
 
-	appendStringInfo(out, "\"items\":");
-	appendStringInfoChar(out, '[');
+	appendStringLiteral(out, "\"items\":[");
 
 	foreach(lc, node)
 	{
-		appendStringInfo(out, "%u", lfirst_oid(lc));
+		appendUInt64(out, lfirst_oid(lc));
 
 		if (lnext(node, lc))
-			appendStringInfoString(out, ",");
+			appendStringInfoCharMacro(out, ',');
 	}
 
-	appendStringInfoChar(out, ']');
-	appendStringInfo(out, ",");
+	appendStringLiteral(out, "],");
 }
 
 static void
@@ -206,33 +260,36 @@ _outInteger(StringInfo out, const Integer *node)
 	/* Don't output anything if the value is the default (0), to match
 	 * protobuf's behavior. */
 	if (node->ival != 0)
-		appendStringInfo(out, "\"ival\":%d", node->ival);
+	{
+		appendStringLiteral(out, "\"ival\":");
+		appendInt64(out, node->ival);
+	}
 }
 
 static void
 _outBoolean(StringInfo out, const Boolean *node)
 {
-	appendStringInfo(out, "\"boolval\":%s", booltostr(node->boolval));
+	appendStringInfoString(out, node->boolval ? "\"boolval\":true" : "\"boolval\":false");
 }
 
 static void
 _outFloat(StringInfo out, const Float *node)
 {
-	appendStringInfo(out, "\"fval\":");
+	appendStringLiteral(out, "\"fval\":");
 	_outToken(out, node->fval);
 }
 
 static void
 _outString(StringInfo out, const String *node)
 {
-	appendStringInfo(out, "\"sval\":");
+	appendStringLiteral(out, "\"sval\":");
 	_outToken(out, node->sval);
 }
 
 static void
 _outBitString(StringInfo out, const BitString *node)
 {
-	appendStringInfo(out, "\"bsval\":");
+	appendStringLiteral(out, "\"bsval\":");
 	_outToken(out, node->bsval);
 }
 
@@ -240,29 +297,29 @@ static void
 _outAConst(StringInfo out, const A_Const *node)
 {
 	if (node->isnull) {
-		appendStringInfo(out, "\"isnull\":true");
+		appendStringLiteral(out, "\"isnull\":true");
 	} else {
 		switch (node->val.node.type) {
 			case T_Integer:
-				appendStringInfoString(out, "\"ival\":{");
+				appendStringLiteral(out, "\"ival\":{");
 				_outInteger(out, &node->val.ival);
 				appendStringInfoChar(out, '}');
 				break;
 			case T_Float:
-				appendStringInfoString(out, "\"fval\":{");
+				appendStringLiteral(out, "\"fval\":{");
 				_outFloat(out, &node->val.fval);
 				appendStringInfoChar(out, '}');
 				break;
 			case T_Boolean:
-				appendStringInfo(out, "\"boolval\":{%s}", node->val.boolval.boolval ? "\"boolval\":true" : "");
+				appendStringInfoString(out, node->val.boolval.boolval ? "\"boolval\":{\"boolval\":true}" : "\"boolval\":{}");
 				break;
 			case T_String:
-				appendStringInfoString(out, "\"sval\":{");
+				appendStringLiteral(out, "\"sval\":{");
 				_outString(out, &node->val.sval);
 				appendStringInfoChar(out, '}');
 				break;
 			case T_BitString:
-				appendStringInfoString(out, "\"bsval\":{");
+				appendStringLiteral(out, "\"bsval\":{");
 				_outBitString(out, &node->val.bsval);
 				appendStringInfoChar(out, '}');
 				break;
@@ -273,7 +330,8 @@ _outAConst(StringInfo out, const A_Const *node)
 		}
 	}
 
-	appendStringInfo(out, ",\"location\":%d", node->location);
+	appendStringLiteral(out, ",\"location\":");
+	appendInt64(out, node->location);
 }
 
 #include "pg_query_enum_defs.c"
@@ -284,7 +342,7 @@ _outNode(StringInfo out, const void *obj)
 {
 	if (obj == NULL)
 	{
-		appendStringInfoString(out, "null");
+		appendStringLiteral(out, "null");
 	}
 	else
 	{
@@ -297,11 +355,11 @@ _outNode(StringInfo out, const void *obj)
 				elog(WARNING, "could not dump unrecognized node type: %d",
 					 (int) nodeTag(obj));
 
-				appendStringInfo(out, "}");
+				appendStringInfoCharMacro(out, '}');
 				return;
 		}
 		removeTrailingDelimiter(out);
-		appendStringInfo(out, "}}");
+		appendStringLiteral(out, "}}");
 	}
 }
 
@@ -1,4 +1,5 @@
 #include "pg_query_outfuncs.h"
+#include "pg_query_internal.h"
 
 #include "postgres.h"
 #include <ctype.h>
@@ -125,9 +126,14 @@ _outIntList(PgQuery__IntList* out, const List *node)
 	out->items = palloc(sizeof(PgQuery__Node*) * out->n_items);
     foreach(lc, node)
     {
+		PgQuery__Integer *value = palloc(sizeof(PgQuery__Integer));
+		pg_query__integer__init(value);
+		value->ival = lfirst_int(lc);
+
 		out->items[i] = palloc(sizeof(PgQuery__Node));
 		pg_query__node__init(out->items[i]);
-	    _outNode(out->items[i], lfirst(lc));
+		out->items[i]->node_case = PG_QUERY__NODE__NODE_INTEGER;
+		out->items[i]->integer = value;
 		i++;
     }
 }
@@ -290,8 +296,8 @@ pg_query_nodes_to_protobuf(const void *obj)
 	}
 
 	protobuf.len = pg_query__parse_result__get_packed_size(&parse_result);
-	// Note: This is intentionally malloc so exiting the memory context doesn't free this
-	protobuf.data = malloc(sizeof(char) * protobuf.len);
+	// Note: This is intentionally not palloc so exiting the memory context doesn't free this
+	protobuf.data = pg_query_output_alloc(sizeof(char) * protobuf.len);
 	pg_query__parse_result__pack(&parse_result, (void*) protobuf.data); 
 
 	return protobuf;
@@ -13,6 +13,7 @@ extern "C"
 #include "pg_query_outfuncs.h"
 
 #include "postgres.h"
+#include "pg_query_internal.h"
 #include <ctype.h>
 #include "access/relation.h"
 #include "nodes/parsenodes.h"
@@ -105,7 +106,7 @@ _outIntList(pg_query::IntList* out_node, const List *node)
 
 	foreach(lc, node)
 	{
-		_outNode(out_node->add_items(), lfirst(lc));
+		out_node->add_items()->mutable_integer()->set_ival(lfirst_int(lc));
 	}
 }
 
@@ -226,7 +227,7 @@ pg_query_nodes_to_protobuf(const void *obj)
 	const ListCell *lc;
 	pg_query::ParseResult parse_result;
 	if (obj == NULL) {
-		protobuf.data = strdup("");
+		protobuf.data = pg_query_output_strdup("", 0);
 		protobuf.len = 0;
 		return protobuf;
 	}
@@ -240,7 +241,8 @@ pg_query_nodes_to_protobuf(const void *obj)
 	std::string output;
 	parse_result.SerializeToString(&output);
 
-	protobuf.data = (char*) calloc(output.size(), sizeof(char));
+	// Note: This is intentionally not palloc so exiting the memory context doesn't free this
+	protobuf.data = (char*) pg_query_output_alloc(sizeof(char) * output.size());
 	memcpy(protobuf.data, output.data(), output.size());
 	protobuf.len = output.size();
 
@@ -9,7 +9,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 
-PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, int parser_options)
+PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, size_t len, int parser_options)
 {
 	PgQueryInternalParsetreeAndError result = {0};
 	MemoryContext parse_context = CurrentMemoryContext;
@@ -23,7 +23,7 @@ PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, int parse
 #ifndef DEBUG
 	// Setup pipe for stderr redirection
 	if (pipe(stderr_pipe) != 0) {
-		PgQueryError* error = malloc(sizeof(PgQueryError));
+		PgQueryError* error = calloc(1, sizeof(PgQueryError));
 
 		error->message = strdup("Failed to open pipe, too many open file descriptors")
 
@@ -70,7 +70,10 @@ PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, int parse
 		standard_conforming_strings = !((parser_options & PG_QUERY_DISABLE_STANDARD_CONFORMING_STRINGS) == PG_QUERY_DISABLE_STANDARD_CONFORMING_STRINGS);
 		escape_string_warning = !((parser_options & PG_QUERY_DISABLE_ESCAPE_STRING_WARNING) == PG_QUERY_DISABLE_ESCAPE_STRING_WARNING);
 
-		result.tree = raw_parser(input, rawParseMode);
+		result.tree = pg_query_raw_parser(input, len, rawParseMode);
+
+		if (parser_options >> PG_QUERY_COLLAPSE_LISTS_SHIFT)
+			pg_query_collapse_lists(result.tree, input, len, parser_options >> PG_QUERY_COLLAPSE_LISTS_SHIFT);
 
 		backslash_quote = BACKSLASH_QUOTE_SAFE_ENCODING;
 		standard_conforming_strings = true;
@@ -92,13 +95,14 @@ PgQueryInternalParsetreeAndError pg_query_raw_parse(const char* input, int parse
 		error_data = CopyErrorData();
 
 		// Note: This is intentionally malloc so exiting the memory context doesn't free this
-		error = malloc(sizeof(PgQueryError));
+		error = calloc(1, sizeof(PgQueryError));
 		error->message   = strdup(error_data->message);
 		error->filename  = strdup(error_data->filename);
 		error->funcname  = strdup(error_data->funcname);
 		error->context   = NULL;
 		error->lineno    = error_data->lineno;
 		error->cursorpos = error_data->cursorpos;
+		error->code      = pg_query_parse_limit_error();
 
 		result.error = error;
 		FlushErrorState();
@@ -121,6 +125,16 @@ PgQueryParseResult pg_query_parse(const char* input)
 }
 
 PgQueryParseResult pg_query_parse_opts(const char* input, int parser_options)
+{
+	return pg_query_parse_opts_n(input, strlen(input), parser_options);
+}
+
+PgQueryParseResult pg_query_parse_n(const char* input, size_t len)
+{
+	return pg_query_parse_opts_n(input, len, PG_QUERY_PARSE_DEFAULT);
+}
+
+PgQueryParseResult pg_query_parse_opts_n(const char* input, size_t len, int parser_options)
 {
 	MemoryContext ctx = NULL;
 	PgQueryInternalParsetreeAndError parsetree_and_error;
@@ -129,14 +143,14 @@ PgQueryParseResult pg_query_parse_opts(const char* input, int parser_options)
 
 	ctx = pg_query_enter_memory_context();
 
-	parsetree_and_error = pg_query_raw_parse(input, parser_options);
+	parsetree_and_error = pg_query_raw_parse(input, len, parser_options);
 
 	// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
 	result.stderr_buffer = parsetree_and_error.stderr_buffer;
 	result.error = parsetree_and_error.error;
 
 	tree_json = pg_query_nodes_to_json(parsetree_and_error.tree);
-	result.parse_tree = strdup(tree_json);
+	result.parse_tree = pg_query_output_strdup(tree_json, strlen(tree_json));
 	pfree(tree_json);
 
 	pg_query_exit_memory_context(ctx);
@@ -150,6 +164,16 @@ PgQueryProtobufParseResult pg_query_parse_protobuf(const char* input)
 }
 
 PgQueryProtobufParseResult pg_query_parse_protobuf_opts(const char* input, int parser_options)
+{
+	return pg_query_parse_protobuf_opts_n(input, strlen(input), parser_options);
+}
+
+PgQueryProtobufParseResult pg_query_parse_protobuf_n(const char* input, size_t len)
+{
+	return pg_query_parse_protobuf_opts_n(input, len, PG_QUERY_PARSE_DEFAULT);
+}
+
+PgQueryProtobufParseResult pg_query_parse_protobuf_opts_n(const char* input, size_t len, int parser_options)
 {
 	MemoryContext ctx = NULL;
 	PgQueryInternalParsetreeAndError parsetree_and_error;
@@ -157,7 +181,7 @@ PgQueryProtobufParseResult pg_query_parse_protobuf_opts(const char* input, int p
 
 	ctx = pg_query_enter_memory_context();
 
-	parsetree_and_error = pg_query_raw_parse(input, parser_options);
+	parsetree_and_error = pg_query_raw_parse(input, len, parser_options);
 
 	// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
 	result.stderr_buffer = parsetree_and_error.stderr_buffer;
@@ -175,7 +199,7 @@ void pg_query_free_parse_result(PgQueryParseResult result)
 		pg_query_free_error(result.error);
 	}
 
-	free(result.parse_tree);
+	pg_query_output_free(result.parse_tree);
 	free(result.stderr_buffer);
 }
 
@@ -185,6 +209,6 @@ void pg_query_free_protobuf_parse_result(PgQueryProtobufParseResult result)
 		pg_query_free_error(result.error);
 	}
 
-	free(result.parse_tree.data);
+	pg_query_output_free(result.parse_tree.data);
 	free(result.stderr_buffer);
 }
@@ -0,0 +1,185 @@
+#include "pg_query.h"
+#include "pg_query_internal.h"
+
+#include "nodes/parsenodes.h"
+#include "nodes/plannodes.h"
+
+/*
+ * Parse limits
+ *
+ * The memory and node limits are enforced while raw_parser runs: by aset.c
+ * when a new block would go over the memory limit, and by newNode() when the
+ * node count reaches the node limit. Both raise a regular ERROR, so the parse
+ * stops right away.
+ *
+ * The depth limit is checked by walking the tree as soon as raw_parser
+ * returns, before anything else looks at it. The walk stops at the first node
+ * that is nested too deep, so it never recurses deeper than the limit itself,
+ * and the recursive walks that run later (output functions, fingerprinting,
+ * deparsing) are protected from running out of stack.
+ */
+
+static __thread PgQueryParseLimits parse_limits;
+
+// Which limit the most recent parse on this thread exceeded, if any
+static __thread PgQueryErrorCode parse_limit_error;
+
+__thread uint64 newNodeCount = 0;
+__thread uint64 newNodeLimit = 0;
+
+void pg_query_set_parse_limits(PgQueryParseLimits limits)
+{
+	parse_limits = limits;
+}
+
+void newNodeLimitExceeded(void)
+{
+	newNodeLimit = 0;
+	parse_limit_error = PG_QUERY_ERROR_NODE_LIMIT;
+
+	ereport(ERROR,
+			(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+			 errmsg("node limit exceeded"),
+			 errdetail("The parse tree has more than %zu nodes.", parse_limits.max_nodes)));
+}
+
+typedef struct {
+	int depth;
+	int max_depth;
+} ParseDepthContext;
+
+static void _depthNode(ParseDepthContext *ctx, const void *obj);
+
+static void
+_depthList(ParseDepthContext *ctx, const List *list)
+{
+	const ListCell *lc;
+
+	foreach(lc, list)
+		_depthNode(ctx, lfirst(lc));
+}
+
+/* The walker reuses the generated output functions, only following node fields */
+#define OUT_TYPE(typename, typename_c) ParseDepthContext *
+
+#define OUT_NODE(typename, typename_c, typename_underscore, typename_underscore_upcase, typename_cast, fldname) \
+	_out##typename_c(ctx, (const typename_cast *) obj);
+
+#define WRITE_INT_FIELD(outname, outname_json, fldname)
+#define WRITE_UINT_FIELD(outname, outname_json, fldname)
+#define WRITE_UINT64_FIELD(outname, outname_json, fldname)
+#define WRITE_LONG_FIELD(outname, outname_json, fldname)
+#define WRITE_CHAR_FIELD(outname, outname_json, fldname)
+#define WRITE_ENUM_FIELD(typename, outname, outname_json, fldname)
+#define WRITE_FLOAT_FIELD(outname, outname_json, fldname)
+#define WRITE_BOOL_FIELD(outname, outname_json, fldname)
+#define WRITE_STRING_FIELD(outname, outname_json, fldname)
+#define WRITE_BITMAPSET_FIELD(outname, outname_json, fldname)
+
+#define WRITE_LIST_FIELD(outname, outname_json, fldname) \
+	_depthList(out, node->fldname);
+
+#define WRITE_NODE_PTR_FIELD(outname, outname_json, fldname) \
+	_depthNode(out, node->fldname);
+
+#define WRITE_SPECIFIC_NODE_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
+	_out##typename(out, &node->fldname);
+
+#define WRITE_SPECIFIC_NODE_PTR_FIELD(typename, typename_underscore, outname, outname_json, fldname) \
+	_depthNode(out, node->fldname);
+
+static void
+_outList(ParseDepthContext *out, const List *node)
+{
+	_depthList(out, node);
+}
+
+/* Leaf nodes */
+static void _outIntList(ParseDepthContext *out, const List *node) {}
+static void _outOidList(ParseDepthContext *out, const List *node) {}
+static void _outInteger(ParseDepthContext *out, const Integer *node) {}
+static void _outBoolean(ParseDepthContext *out, const Boolean *node) {}
+static void _outFloat(ParseDepthContext *out, const Float *node) {}
+static void _outString(ParseDepthContext *out, const String *node) {}
+static void _outBitString(ParseDepthContext *out, const BitString *node) {}
+static void _outAConst(ParseDepthContext *out, const A_Const *node) {}
+
+#include "pg_query_outfuncs_defs.c"
+
+static void
+_depthNode(ParseDepthContext *ctx, const void *obj)
+{
+	if (obj == NULL)
+		return;
+
+	if (++ctx->depth > ctx->max_depth)
+	{
+		parse_limit_error = PG_QUERY_ERROR_DEPTH_LIMIT;
+
+		ereport(ERROR,
+				(errcode(ERRCODE_STATEMENT_TOO_COMPLEX),
+				 errmsg("nesting depth limit exceeded"),
+				 errdetail("The parse tree is nested more than %d levels deep.", ctx->max_depth)));
+	}
+
+	switch (nodeTag(obj))
+	{
+		#include "pg_query_outfuncs_conds.c"
+
+		default:
+			break;
+	}
+
+	ctx->depth--;
+}
+
+/*
+ * raw_parser_n with the limits set through pg_query_set_parse_limits. Callers
+ * run this inside PG_TRY, and use pg_query_parse_limit_error to tell errors
+ * caused by a limit apart from other errors.
+ */
+List *
+pg_query_raw_parser(const char *input, size_t len, RawParseMode mode)
+{
+	List *tree = NIL;
+
+	parse_limit_error = PG_QUERY_ERROR_DEFAULT;
+
+	if (parse_limits.max_memory > 0)
+	{
+		AllocSetTrackedLimit = AllocSetTrackedAllocated + parse_limits.max_memory;
+		AllocSetTrackedLimitExceeded = false;
+	}
+
+	if (parse_limits.max_nodes > 0)
+		newNodeLimit = newNodeCount + parse_limits.max_nodes + 1;
+
+	PG_TRY();
+	{
+		tree = raw_parser_n(input, len, mode);
+
+		if (parse_limits.max_depth > 0)
+		{
+			ParseDepthContext ctx = {0, parse_limits.max_depth};
+
+			_depthList(&ctx, tree);
+		}
+	}
+	PG_FINALLY();
+	{
+		if (AllocSetTrackedLimitExceeded)
+			parse_limit_error = PG_QUERY_ERROR_MEMORY_LIMIT;
+
+		AllocSetTrackedLimit = 0;
+		AllocSetTrackedLimitExceeded = false;
+		newNodeLimit = 0;
+	}
+	PG_END_TRY();
+
+	return tree;
+}
+
+PgQueryErrorCode pg_query_parse_limit_error(void)
+{
+	return parse_limit_error;
+}
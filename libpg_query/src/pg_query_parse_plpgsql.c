@@ -11,6 +11,7 @@
 #include <catalog/pg_proc.h>
 #include <nodes/parsenodes.h>
 #include <nodes/nodeFuncs.h>
+#include <lib/stringinfo.h>
 
 typedef struct {
 	PLpgSQL_function *func;
@@ -322,7 +323,7 @@ PgQueryInternalPlpgsqlFuncAndError pg_query_raw_parse_plpgsql(Node* stmt)
 #ifndef DEBUG
 	// Setup pipe for stderr redirection
 	if (pipe(stderr_pipe) != 0) {
-		PgQueryError* error = malloc(sizeof(PgQueryError));
+		PgQueryError* error = calloc(1, sizeof(PgQueryError));
 
 		error->message = strdup("Failed to open pipe, too many open file descriptors")
 
@@ -355,7 +356,7 @@ PgQueryInternalPlpgsqlFuncAndError pg_query_raw_parse_plpgsql(Node* stmt)
 #endif
 
 		if (strlen(stderr_buffer) > 0) {
-			PgQueryError* error = malloc(sizeof(PgQueryError));
+			PgQueryError* error = calloc(1, sizeof(PgQueryError));
 			error->message = strdup(stderr_buffer);
 			error->filename = "";
 			error->funcname = "";
@@ -372,7 +373,7 @@ PgQueryInternalPlpgsqlFuncAndError pg_query_raw_parse_plpgsql(Node* stmt)
 		error_data = CopyErrorData();
 
 		// Note: This is intentionally malloc so exiting the memory context doesn't free this
-		error = malloc(sizeof(PgQueryError));
+		error = calloc(1, sizeof(PgQueryError));
 		error->message   = strdup(error_data->message);
 		error->filename  = strdup(error_data->filename);
 		error->funcname  = strdup(error_data->funcname);
@@ -438,18 +439,25 @@ static bool stmts_walker(Node *node, plStmts *state)
 }
 
 PgQueryPlpgsqlParseResult pg_query_parse_plpgsql(const char* input)
+{
+	return pg_query_parse_plpgsql_n(input, strlen(input));
+}
+
+PgQueryPlpgsqlParseResult pg_query_parse_plpgsql_n(const char* input, size_t len)
 {
 	MemoryContext ctx = NULL;
 	PgQueryPlpgsqlParseResult result = {0};
 	PgQueryInternalParsetreeAndError parse_result;
 	plStmts statements;
+	StringInfoData out;
 	size_t i;
 
 	ctx = pg_query_enter_memory_context();
 
-	parse_result = pg_query_raw_parse(input, PG_QUERY_PARSE_DEFAULT);
+	parse_result = pg_query_raw_parse(input, len, PG_QUERY_PARSE_DEFAULT);
 	result.error = parse_result.error;
 	if (result.error != NULL) {
+		free(parse_result.stderr_buffer);
 		pg_query_exit_memory_context(ctx);
 		return result;
 	}
@@ -460,13 +468,16 @@ PgQueryPlpgsqlParseResult pg_query_parse_plpgsql(const char* input)
 
 	stmts_walker((Node*) parse_result.tree, &statements);
 
-	if (statements.stmts_count == 0) {
-		result.plpgsql_funcs = strdup("[]");
-		pg_query_exit_memory_context(ctx);
-		return result;
-	}
+	if (statements.stmts_count > 0)
+		result.funcs = malloc(statements.stmts_count * sizeof(PgQueryPlpgsqlFunc));
 
-	result.plpgsql_funcs = strdup("[\n");
+	/*
+	 * All functions are appended to one growing buffer, which is copied into
+	 * the output buffer once at the end, so the output is assembled in linear
+	 * time however many functions there are.
+	 */
+	initStringInfo(&out);
+	appendStringInfoString(&out, "[\n");
 
 	for (i = 0; i < statements.stmts_count; i++) {
 		PgQueryInternalPlpgsqlFuncAndError func_and_error;
@@ -477,36 +488,39 @@ PgQueryPlpgsqlParseResult pg_query_parse_plpgsql(const char* input)
 		result.error = func_and_error.error;
 
 		if (result.error != NULL) {
+			free(result.funcs);
+			result.funcs = NULL;
+			result.n_funcs = 0;
+			free(parse_result.stderr_buffer);
 			pg_query_exit_memory_context(ctx);
 			return result;
 		}
 
 		if (func_and_error.func != NULL) {
-			char *func_json;
-			char *new_out;
-			size_t new_out_len;
+			char *func_json = plpgsqlToJSON(func_and_error.func);
+			size_t func_json_len = strlen(func_json);
 
-			func_json = plpgsqlToJSON(func_and_error.func);
 			plpgsql_free_function_memory(func_and_error.func);
 
-			new_out_len = strlen(result.plpgsql_funcs) + strlen(func_json) + 3;
-			new_out = malloc(new_out_len);
-			int n = snprintf(new_out, new_out_len, "%s%s,\n", result.plpgsql_funcs, func_json);
-			if (n < 0 || n >= new_out_len) {
-				PgQueryError* error = malloc(sizeof(PgQueryError));
-				error->message = strdup("Failed to output PL/pgSQL functions due to snprintf failure");
-				result.error = error;
-			} else {
-				free(result.plpgsql_funcs);
-				result.plpgsql_funcs = new_out;
-			}
+			result.funcs[result.n_funcs].offset = out.len;
+			result.funcs[result.n_funcs].len = func_json_len;
+			result.n_funcs++;
+
+			appendBinaryStringInfo(&out, func_json, func_json_len);
+			appendStringInfoString(&out, ",\n");
 
 			pfree(func_json);
 		}
 	}
 
-	result.plpgsql_funcs[strlen(result.plpgsql_funcs) - 2] = '\n';
-	result.plpgsql_funcs[strlen(result.plpgsql_funcs) - 1] = ']';
+	if (result.n_funcs > 0) {
+		// Replace the last ",\n" separator
+		out.data[out.len - 2] = '\n';
+		out.data[out.len - 1] = ']';
+		result.plpgsql_funcs = pg_query_output_strdup(out.data, out.len);
+	} else {
+		result.plpgsql_funcs = pg_query_output_strdup("[]", 2);
+	}
 
 	free(parse_result.stderr_buffer);
 	pg_query_exit_memory_context(ctx);
@@ -520,5 +534,657 @@ void pg_query_free_plpgsql_parse_result(PgQueryPlpgsqlParseResult result)
 		pg_query_free_error(result.error);
 	}
 
-	free(result.plpgsql_funcs);
+	free(result.funcs);
+	pg_query_output_free(result.plpgsql_funcs);
+}
+
+/*
+ * Dependency summary
+ *
+ * Every SQL expression of a compiled function is parsed with the raw parser
+ * in the mode PL/pgSQL recorded for it, and the tables and functions it
+ * refers to are collected, with the same types as the Elixir side uses for
+ * the statements it parses itself. The string of a dynamic EXECUTE isn't
+ * known before it runs, so only the expression that builds it is looked at.
+ */
+
+typedef struct plDepsContext
+{
+	List	   *tables;			/* PgQueryPlpgsqlRef *, deduplicated */
+	List	   *functions;		/* PgQueryPlpgsqlRef * */
+	List	   *cte_names;		/* char *, of the expression being walked */
+	const char *type;			/* type of the relations walked right now */
+} plDepsContext;
+
+static bool deps_walker(Node *node, plDepsContext *ctx);
+
+static void deps_add_ref(List **refs, char *name, const char *type)
+{
+	ListCell   *lc;
+	PgQueryPlpgsqlRef *ref;
+
+	foreach(lc, *refs)
+	{
+		ref = (PgQueryPlpgsqlRef *) lfirst(lc);
+		if (ref->type == type && strcmp(ref->name, name) == 0)
+			return;
+	}
+
+	ref = palloc(sizeof(PgQueryPlpgsqlRef));
+	ref->name = name;
+	ref->type = type;
+	*refs = lappend(*refs, ref);
+}
+
+static char *deps_join_names(List *names)
+{
+	StringInfoData buf;
+	ListCell   *lc;
+
+	initStringInfo(&buf);
+	foreach(lc, names)
+	{
+		if (buf.len > 0)
+			appendStringInfoChar(&buf, '.');
+		appendStringInfoString(&buf, strVal(lfirst(lc)));
+	}
+
+	return buf.data;
+}
+
+static void deps_add_relation(plDepsContext *ctx, RangeVar *rv, const char *type)
+{
+	ListCell   *lc;
+
+	if (rv->schemaname == NULL)
+	{
+		foreach(lc, ctx->cte_names)
+		{
+			if (strcmp((char *) lfirst(lc), rv->relname) == 0)
+				return;
+		}
+
+		deps_add_ref(&ctx->tables, rv->relname, type);
+	}
+	else
+	{
+		deps_add_ref(&ctx->tables, psprintf("%s.%s", rv->schemaname, rv->relname), type);
+	}
+}
+
+static void deps_add_ctes(plDepsContext *ctx, WithClause *with)
+{
+	ListCell   *lc;
+
+	if (with == NULL)
+		return;
+
+	foreach(lc, with->ctes)
+		ctx->cte_names = lappend(ctx->cte_names, ((CommonTableExpr *) lfirst(lc))->ctename);
+}
+
+static bool deps_walk_as(Node *node, const char *type, plDepsContext *ctx)
+{
+	const char *saved_type = ctx->type;
+	bool		result;
+
+	ctx->type = type;
+	result = deps_walker(node, ctx);
+	ctx->type = saved_type;
+
+	return result;
+}
+
+static bool deps_walker(Node *node, plDepsContext *ctx)
+{
+	ListCell   *lc;
+
+	if (node == NULL)
+		return false;
+
+	switch (nodeTag(node))
+	{
+		case T_RangeVar:
+			deps_add_relation(ctx, (RangeVar *) node, ctx->type);
+			return false;
+		case T_FuncCall:
+			deps_add_ref(&ctx->functions, deps_join_names(((FuncCall *) node)->funcname), "call");
+			break;
+		case T_SelectStmt:
+			{
+				SelectStmt *stmt = (SelectStmt *) node;
+
+				deps_add_ctes(ctx, stmt->withClause);
+				if (stmt->intoClause)
+					deps_add_relation(ctx, stmt->intoClause->rel, "ddl");
+				break;
+			}
+		case T_InsertStmt:
+			{
+				InsertStmt *stmt = (InsertStmt *) node;
+
+				deps_add_ctes(ctx, stmt->withClause);
+				deps_add_relation(ctx, stmt->relation, "dml");
+				return deps_walk_as((Node *) stmt->withClause, "select", ctx) ||
+					deps_walk_as(stmt->selectStmt, "select", ctx) ||
+					deps_walk_as((Node *) stmt->onConflictClause, "select", ctx) ||
+					deps_walk_as((Node *) stmt->returningList, "select", ctx);
+			}
+		case T_UpdateStmt:
+			{
+				UpdateStmt *stmt = (UpdateStmt *) node;
+
+				deps_add_ctes(ctx, stmt->withClause);
+				deps_add_relation(ctx, stmt->relation, "dml");
+				return deps_walk_as((Node *) stmt->withClause, "select", ctx) ||
+					deps_walk_as((Node *) stmt->targetList, "select", ctx) ||
+					deps_walk_as((Node *) stmt->fromClause, "select", ctx) ||
+					deps_walk_as(stmt->whereClause, "select", ctx) ||
+					deps_walk_as((Node *) stmt->returningList, "select", ctx);
+			}
+		case T_DeleteStmt:
+			{
+				DeleteStmt *stmt = (DeleteStmt *) node;
+
+				deps_add_ctes(ctx, stmt->withClause);
+				deps_add_relation(ctx, stmt->relation, "dml");
+				return deps_walk_as((Node *) stmt->withClause, "select", ctx) ||
+					deps_walk_as((Node *) stmt->usingClause, "select", ctx) ||
+					deps_walk_as(stmt->whereClause, "select", ctx) ||
+					deps_walk_as((Node *) stmt->returningList, "select", ctx);
+			}
+		case T_MergeStmt:
+			{
+				MergeStmt  *stmt = (MergeStmt *) node;
+
+				deps_add_ctes(ctx, stmt->withClause);
+				deps_add_relation(ctx, stmt->relation, "dml");
+				return deps_walk_as((Node *) stmt->withClause, "select", ctx) ||
+					deps_walk_as(stmt->sourceRelation, "select", ctx) ||
+					deps_walk_as(stmt->joinCondition, "select", ctx) ||
+					deps_walk_as((Node *) stmt->mergeWhenClauses, "select", ctx) ||
+					deps_walk_as((Node *) stmt->returningList, "select", ctx);
+			}
+		case T_CallStmt:
+			return deps_walker((Node *) ((CallStmt *) node)->funccall, ctx);
+		case T_CreateStmt:
+			deps_add_relation(ctx, ((CreateStmt *) node)->relation, "ddl");
+			return false;
+		case T_CreateTableAsStmt:
+			{
+				CreateTableAsStmt *stmt = (CreateTableAsStmt *) node;
+
+				deps_add_relation(ctx, stmt->into->rel, "ddl");
+				return deps_walk_as(stmt->query, "select", ctx);
+			}
+		case T_ViewStmt:
+			{
+				ViewStmt   *stmt = (ViewStmt *) node;
+
+				deps_add_relation(ctx, stmt->view, "ddl");
+				return deps_walk_as(stmt->query, "select", ctx);
+			}
+		case T_IndexStmt:
+			deps_add_relation(ctx, ((IndexStmt *) node)->relation, "ddl");
+			return false;
+		case T_AlterTableStmt:
+			deps_add_relation(ctx, ((AlterTableStmt *) node)->relation, "ddl");
+			return false;
+		case T_RefreshMatViewStmt:
+			deps_add_relation(ctx, ((RefreshMatViewStmt *) node)->relation, "ddl");
+			return false;
+		case T_CreateTrigStmt:
+			deps_add_relation(ctx, ((CreateTrigStmt *) node)->relation, "ddl");
+			return false;
+		case T_TruncateStmt:
+			return deps_walk_as((Node *) ((TruncateStmt *) node)->relations, "ddl", ctx);
+		case T_LockStmt:
+			return deps_walk_as((Node *) ((LockStmt *) node)->relations, "select", ctx);
+		case T_CopyStmt:
+			{
+				CopyStmt   *stmt = (CopyStmt *) node;
+
+				if (stmt->relation)
+					deps_add_relation(ctx, stmt->relation, "select");
+				return deps_walk_as(stmt->query, "select", ctx);
+			}
+		case T_ExplainStmt:
+			return deps_walker(((ExplainStmt *) node)->query, ctx);
+		case T_ReturnStmt:
+			return deps_walker(((ReturnStmt *) node)->returnval, ctx);
+		case T_CreateFunctionStmt:
+			deps_add_ref(&ctx->functions, deps_join_names(((CreateFunctionStmt *) node)->funcname), "ddl");
+			return false;
+		case T_DropStmt:
+			{
+				DropStmt   *stmt = (DropStmt *) node;
+
+				foreach(lc, stmt->objects)
+				{
+					switch (stmt->removeType)
+					{
+						case OBJECT_TABLE:
+						case OBJECT_VIEW:
+						case OBJECT_MATVIEW:
+						case OBJECT_FOREIGN_TABLE:
+							deps_add_ref(&ctx->tables, deps_join_names((List *) lfirst(lc)), "ddl");
+							break;
+						case OBJECT_FUNCTION:
+						case OBJECT_PROCEDURE:
+						case OBJECT_ROUTINE:
+							deps_add_ref(&ctx->functions, deps_join_names(((ObjectWithArgs *) lfirst(lc))->objname), "ddl");
+							break;
+						default:
+							break;
+					}
+				}
+				return false;
+			}
+		default:
+			break;
+	}
+
+	return raw_expression_tree_walker(node, deps_walker, (void *) ctx);
+}
+
+/*
+ * Walks one statement, or each statement of a list of them. Statements that
+ * contain nodes the raw walker doesn't know are skipped.
+ */
+static void deps_walk_tree(Node *node, plDepsContext *ctx)
+{
+	MemoryContext ccxt = CurrentMemoryContext;
+	ListCell   *lc;
+
+	if (node == NULL)
+		return;
+
+	if (IsA(node, List))
+	{
+		foreach(lc, (List *) node)
+			deps_walk_tree((Node *) lfirst(lc), ctx);
+		return;
+	}
+
+	if (IsA(node, RawStmt))
+		node = ((RawStmt *) node)->stmt;
+
+	// CTE names only hide tables within the statement that defines them
+	ctx->cte_names = NIL;
+	ctx->type = "select";
+
+	PG_TRY();
+	{
+		deps_walker(node, ctx);
+	}
+	PG_CATCH();
+	{
+		MemoryContextSwitchTo(ccxt);
+		FlushErrorState();
+	}
+	PG_END_TRY();
+}
+
+static void deps_walk_sql(const char *query, RawParseMode mode, plDepsContext *ctx)
+{
+	MemoryContext ccxt = CurrentMemoryContext;
+	List	   *tree = NIL;
+
+	PG_TRY();
+	{
+		tree = pg_query_raw_parser(query, strlen(query), mode);
+	}
+	PG_CATCH();
+	{
+		MemoryContextSwitchTo(ccxt);
+		FlushErrorState();
+	}
+	PG_END_TRY();
+
+	deps_walk_tree((Node *) tree, ctx);
+}
+
+static void deps_walk_expr(PLpgSQL_expr *expr, plDepsContext *ctx)
+{
+	if (expr != NULL && expr->query != NULL)
+		deps_walk_sql(expr->query, expr->parseMode, ctx);
+}
+
+static void deps_walk_exprs(List *exprs, plDepsContext *ctx)
+{
+	ListCell   *lc;
+
+	foreach(lc, exprs)
+		deps_walk_expr((PLpgSQL_expr *) lfirst(lc), ctx);
+}
+
+static void deps_walk_stmts(List *stmts, plDepsContext *ctx);
+
+static void deps_walk_stmt(PLpgSQL_stmt *stmt, plDepsContext *ctx)
+{
+	ListCell   *lc;
+
+	switch (stmt->cmd_type)
+	{
+		case PLPGSQL_STMT_BLOCK:
+			{
+				PLpgSQL_stmt_block *block = (PLpgSQL_stmt_block *) stmt;
+
+				deps_walk_stmts(block->body, ctx);
+				if (block->exceptions)
+				{
+					foreach(lc, block->exceptions->exc_list)
+						deps_walk_stmts(((PLpgSQL_exception *) lfirst(lc))->action, ctx);
+				}
+				break;
+			}
+		case PLPGSQL_STMT_ASSIGN:
+			deps_walk_expr(((PLpgSQL_stmt_assign *) stmt)->expr, ctx);
+			break;
+		case PLPGSQL_STMT_IF:
+			{
+				PLpgSQL_stmt_if *s = (PLpgSQL_stmt_if *) stmt;
+
+				deps_walk_expr(s->cond, ctx);
+				deps_walk_stmts(s->then_body, ctx);
+				foreach(lc, s->elsif_list)
+				{
+					PLpgSQL_if_elsif *elif = (PLpgSQL_if_elsif *) lfirst(lc);
+
+					deps_walk_expr(elif->cond, ctx);
+					deps_walk_stmts(elif->stmts, ctx);
+				}
+				deps_walk_stmts(s->else_body, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_CASE:
+			{
+				PLpgSQL_stmt_case *s = (PLpgSQL_stmt_case *) stmt;
+
+				deps_walk_expr(s->t_expr, ctx);
+				foreach(lc, s->case_when_list)
+				{
+					PLpgSQL_case_when *cwt = (PLpgSQL_case_when *) lfirst(lc);
+
+					deps_walk_expr(cwt->expr, ctx);
+					deps_walk_stmts(cwt->stmts, ctx);
+				}
+				deps_walk_stmts(s->else_stmts, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_LOOP:
+			deps_walk_stmts(((PLpgSQL_stmt_loop *) stmt)->body, ctx);
+			break;
+		case PLPGSQL_STMT_WHILE:
+			deps_walk_expr(((PLpgSQL_stmt_while *) stmt)->cond, ctx);
+			deps_walk_stmts(((PLpgSQL_stmt_while *) stmt)->body, ctx);
+			break;
+		case PLPGSQL_STMT_FORI:
+			{
+				PLpgSQL_stmt_fori *s = (PLpgSQL_stmt_fori *) stmt;
+
+				deps_walk_expr(s->lower, ctx);
+				deps_walk_expr(s->upper, ctx);
+				deps_walk_expr(s->step, ctx);
+				deps_walk_stmts(s->body, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_FORS:
+			deps_walk_expr(((PLpgSQL_stmt_fors *) stmt)->query, ctx);
+			deps_walk_stmts(((PLpgSQL_stmt_fors *) stmt)->body, ctx);
+			break;
+		case PLPGSQL_STMT_FORC:
+			deps_walk_expr(((PLpgSQL_stmt_forc *) stmt)->argquery, ctx);
+			deps_walk_stmts(((PLpgSQL_stmt_forc *) stmt)->body, ctx);
+			break;
+		case PLPGSQL_STMT_FOREACH_A:
+			deps_walk_expr(((PLpgSQL_stmt_foreach_a *) stmt)->expr, ctx);
+			deps_walk_stmts(((PLpgSQL_stmt_foreach_a *) stmt)->body, ctx);
+			break;
+		case PLPGSQL_STMT_EXIT:
+			deps_walk_expr(((PLpgSQL_stmt_exit *) stmt)->cond, ctx);
+			break;
+		case PLPGSQL_STMT_RETURN:
+			deps_walk_expr(((PLpgSQL_stmt_return *) stmt)->expr, ctx);
+			break;
+		case PLPGSQL_STMT_RETURN_NEXT:
+			deps_walk_expr(((PLpgSQL_stmt_return_next *) stmt)->expr, ctx);
+			break;
+		case PLPGSQL_STMT_RETURN_QUERY:
+			{
+				PLpgSQL_stmt_return_query *s = (PLpgSQL_stmt_return_query *) stmt;
+
+				deps_walk_expr(s->query, ctx);
+				deps_walk_expr(s->dynquery, ctx);
+				deps_walk_exprs(s->params, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_RAISE:
+			{
+				PLpgSQL_stmt_raise *s = (PLpgSQL_stmt_raise *) stmt;
+
+				deps_walk_exprs(s->params, ctx);
+				foreach(lc, s->options)
+					deps_walk_expr(((PLpgSQL_raise_option *) lfirst(lc))->expr, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_ASSERT:
+			deps_walk_expr(((PLpgSQL_stmt_assert *) stmt)->cond, ctx);
+			deps_walk_expr(((PLpgSQL_stmt_assert *) stmt)->message, ctx);
+			break;
+		case PLPGSQL_STMT_EXECSQL:
+			deps_walk_expr(((PLpgSQL_stmt_execsql *) stmt)->sqlstmt, ctx);
+			break;
+		case PLPGSQL_STMT_DYNEXECUTE:
+			deps_walk_expr(((PLpgSQL_stmt_dynexecute *) stmt)->query, ctx);
+			deps_walk_exprs(((PLpgSQL_stmt_dynexecute *) stmt)->params, ctx);
+			break;
+		case PLPGSQL_STMT_DYNFORS:
+			{
+				PLpgSQL_stmt_dynfors *s = (PLpgSQL_stmt_dynfors *) stmt;
+
+				deps_walk_expr(s->query, ctx);
+				deps_walk_exprs(s->params, ctx);
+				deps_walk_stmts(s->body, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_OPEN:
+			{
+				PLpgSQL_stmt_open *s = (PLpgSQL_stmt_open *) stmt;
+
+				deps_walk_expr(s->argquery, ctx);
+				deps_walk_expr(s->query, ctx);
+				deps_walk_expr(s->dynquery, ctx);
+				deps_walk_exprs(s->params, ctx);
+				break;
+			}
+		case PLPGSQL_STMT_FETCH:
+			deps_walk_expr(((PLpgSQL_stmt_fetch *) stmt)->expr, ctx);
+			break;
+		case PLPGSQL_STMT_PERFORM:
+			deps_walk_expr(((PLpgSQL_stmt_perform *) stmt)->expr, ctx);
+			break;
+		case PLPGSQL_STMT_CALL:
+			deps_walk_expr(((PLpgSQL_stmt_call *) stmt)->expr, ctx);
+			break;
+		default:
+			// GET DIAGNOSTICS, CLOSE, COMMIT and ROLLBACK have no expressions
+			break;
+	}
+}
+
+static void deps_walk_stmts(List *stmts, plDepsContext *ctx)
+{
+	ListCell   *lc;
+
+	foreach(lc, stmts)
+		deps_walk_stmt((PLpgSQL_stmt *) lfirst(lc), ctx);
+}
+
+static void deps_walk_function(PLpgSQL_function *func, plDepsContext *ctx)
+{
+	int			i;
+
+	// Defaults of variables and the queries of bound cursors
+	for (i = 0; i < func->ndatums; i++)
+	{
+		PLpgSQL_datum *d = func->datums[i];
+
+		if (d->dtype == PLPGSQL_DTYPE_VAR || d->dtype == PLPGSQL_DTYPE_PROMISE)
+		{
+			deps_walk_expr(((PLpgSQL_var *) d)->default_val, ctx);
+			deps_walk_expr(((PLpgSQL_var *) d)->cursor_explicit_expr, ctx);
+		}
+		else if (d->dtype == PLPGSQL_DTYPE_REC)
+		{
+			deps_walk_expr(((PLpgSQL_rec *) d)->default_val, ctx);
+		}
+	}
+
+	if (func->action)
+		deps_walk_stmt((PLpgSQL_stmt *) func->action, ctx);
+}
+
+/*
+ * Functions in LANGUAGE sql aren't compiled by PL/pgSQL, their body is
+ * either already parsed (BEGIN ATOMIC) or a string of SQL statements.
+ */
+static bool deps_walk_sql_function(CreateFunctionStmt *stmt, plDepsContext *ctx)
+{
+	ListCell   *lc;
+	char	   *language = NULL;
+	char	   *source = NULL;
+
+	foreach(lc, stmt->options)
+	{
+		DefElem    *elem = (DefElem *) lfirst(lc);
+
+		if (strcmp(elem->defname, "language") == 0)
+			language = strVal(elem->arg);
+		else if (strcmp(elem->defname, "as") == 0)
+			source = strVal(linitial((List *) elem->arg));
+	}
+
+	if (language == NULL || strcmp(language, "sql") != 0)
+		return false;
+
+	// A BEGIN ATOMIC body is a list of statements, a RETURN body a single one
+	if (stmt->sql_body != NULL)
+		deps_walk_tree(stmt->sql_body, ctx);
+	else if (source != NULL)
+	{
+		deps_walk_sql(source, RAW_PARSE_DEFAULT, ctx);
+	}
+
+	return true;
+}
+
+static PgQueryPlpgsqlRef *deps_copy_refs(List *refs)
+{
+	PgQueryPlpgsqlRef *copy;
+	ListCell   *lc;
+
+	if (refs == NIL)
+		return NULL;
+
+	copy = malloc(list_length(refs) * sizeof(PgQueryPlpgsqlRef));
+	foreach(lc, refs)
+	{
+		PgQueryPlpgsqlRef *ref = (PgQueryPlpgsqlRef *) lfirst(lc);
+
+		copy[foreach_current_index(lc)].name = strdup(ref->name);
+		copy[foreach_current_index(lc)].type = ref->type;
+	}
+
+	return copy;
+}
+
+PgQueryPlpgsqlDepsResult pg_query_plpgsql_deps(const char* input)
+{
+	return pg_query_plpgsql_deps_n(input, strlen(input));
+}
+
+PgQueryPlpgsqlDepsResult pg_query_plpgsql_deps_n(const char* input, size_t len)
+{
+	MemoryContext ctx = NULL;
+	PgQueryPlpgsqlDepsResult result = {0};
+	PgQueryInternalParsetreeAndError parse_result;
+	plStmts statements;
+	size_t i;
+
+	ctx = pg_query_enter_memory_context();
+
+	parse_result = pg_query_raw_parse(input, len, PG_QUERY_PARSE_DEFAULT);
+	free(parse_result.stderr_buffer);
+	result.error = parse_result.error;
+	if (result.error != NULL) {
+		pg_query_exit_memory_context(ctx);
+		return result;
+	}
+
+	statements.stmts_buf_size = 100;
+	statements.stmts = (Node**) palloc(statements.stmts_buf_size * sizeof(Node*));
+	statements.stmts_count = 0;
+
+	stmts_walker((Node*) parse_result.tree, &statements);
+
+	if (statements.stmts_count > 0)
+		result.funcs = calloc(statements.stmts_count, sizeof(PgQueryPlpgsqlDeps));
+
+	for (i = 0; i < statements.stmts_count; i++) {
+		Node *stmt = statements.stmts[i];
+		PgQueryPlpgsqlDeps *deps = &result.funcs[result.n_funcs];
+		plDepsContext deps_ctx = {0};
+
+		if (IsA(stmt, CreateFunctionStmt))
+			deps->name = strdup(deps_join_names(((CreateFunctionStmt *) stmt)->funcname));
+
+		if (!IsA(stmt, CreateFunctionStmt) || !deps_walk_sql_function((CreateFunctionStmt *) stmt, &deps_ctx)) {
+			PgQueryInternalPlpgsqlFuncAndError func_and_error = pg_query_raw_parse_plpgsql(stmt);
+
+			if (func_and_error.error != NULL) {
+				result.n_funcs++;
+				pg_query_free_plpgsql_deps_result(result);
+				result = (PgQueryPlpgsqlDepsResult) {0};
+				result.error = func_and_error.error;
+				pg_query_exit_memory_context(ctx);
+				return result;
+			}
+
+			if (func_and_error.func != NULL) {
+				deps_walk_function(func_and_error.func, &deps_ctx);
+				plpgsql_free_function_memory(func_and_error.func);
+			}
+		}
+
+		deps->tables = deps_copy_refs(deps_ctx.tables);
+		deps->n_tables = list_length(deps_ctx.tables);
+		deps->functions = deps_copy_refs(deps_ctx.functions);
+		deps->n_functions = list_length(deps_ctx.functions);
+		result.n_funcs++;
+	}
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+void pg_query_free_plpgsql_deps_result(PgQueryPlpgsqlDepsResult result)
+{
+	int i, j;
+
+	if (result.error) {
+		pg_query_free_error(result.error);
+	}
+
+	for (i = 0; i < result.n_funcs; i++) {
+		for (j = 0; j < result.funcs[i].n_tables; j++)
+			free(result.funcs[i].tables[j].name);
+		for (j = 0; j < result.funcs[i].n_functions; j++)
+			free(result.funcs[i].functions[j].name);
+		free(result.funcs[i].tables);
+		free(result.funcs[i].functions);
+		free(result.funcs[i].name);
+	}
+	free(result.funcs);
 }
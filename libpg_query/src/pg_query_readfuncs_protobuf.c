@@ -152,13 +152,38 @@ static Node * _readNode(PgQuery__Node *msg)
 	}
 }
 
+/*
+ * The unpacked message is only needed until it has been converted to nodes,
+ * so it's allocated in the current memory context, which is released as a
+ * whole, instead of with malloc. protobuf-c frees a message by going over
+ * every field of every submessage, which for the Node message (one field
+ * per node type) took longer than deparsing the nodes.
+ */
+static void *
+protobuf_palloc(void *allocator_data, size_t size)
+{
+	return palloc(size);
+}
+
+static void
+protobuf_pfree(void *allocator_data, void *pointer)
+{
+	// Released with the memory context
+}
+
+static ProtobufCAllocator protobuf_allocator = {
+	.alloc = protobuf_palloc,
+	.free = protobuf_pfree,
+	.allocator_data = NULL
+};
+
 List * pg_query_protobuf_to_nodes(PgQueryProtobuf protobuf)
 {
 	PgQuery__ParseResult *result = NULL;
 	List * list = NULL;
 	size_t i = 0;
 
-	result = pg_query__parse_result__unpack(NULL, protobuf.len, (const uint8_t *) protobuf.data);
+	result = pg_query__parse_result__unpack(&protobuf_allocator, protobuf.len, (const uint8_t *) protobuf.data);
 
 	// TODO: Handle this by returning an error instead
 	Assert(result != NULL);
@@ -171,7 +196,17 @@ List * pg_query_protobuf_to_nodes(PgQueryProtobuf protobuf)
     for (i = 1; i < result->n_stmts; i++)
 		list = lappend(list, _readRawStmt(result->stmts[i]));
 
-	pg_query__parse_result__free_unpacked(result, NULL);
-
 	return list;
 }
+
+Node * pg_query_protobuf_to_node(PgQueryProtobuf protobuf)
+{
+	PgQuery__Node *msg;
+
+	msg = pg_query__node__unpack(&protobuf_allocator, protobuf.len, (const uint8_t *) protobuf.data);
+
+	if (msg == NULL)
+		elog(ERROR, "invalid protobuf node");
+
+	return _readNode(msg);
+}
@@ -0,0 +1,468 @@
+#include "pg_query.h"
+#include "pg_query_internal.h"
+
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+
+#include "postgres_deparse.h"
+
+/*
+ * Parse tree rewrites
+ *
+ * The input is parsed, the rewrites requested in a PgQueryRewrite are made on
+ * the raw parse tree, and the tree is deparsed again, all in one memory
+ * context, so callers that only want to change a few parts of a query (e.g. a
+ * proxy that scopes every statement to a tenant) don't need to pass the tree
+ * through protobuf.
+ *
+ * Relations are renamed and qualified wherever they appear in DML and SELECT
+ * statements (including their CTEs and subqueries), in EXPLAIN, COPY, CREATE
+ * TABLE AS, CREATE VIEW, TRUNCATE and LOCK. References to CTEs of the
+ * statement are left alone. Other statements are deparsed unchanged.
+ *
+ * The WHERE expression and the LIMIT only go into the top-level statements
+ * (and each side of a top-level UNION, INTERSECT or EXCEPT for the WHERE
+ * expression), not into subqueries. The exception are UPDATEs and DELETEs in
+ * WITH clauses, at any depth, which get the WHERE expression like top-level
+ * ones, since they change rows no matter what the outer statement reads.
+ * SELECTs without a FROM clause have no rows to filter and are left alone.
+ */
+
+typedef struct RewriteContext
+{
+	const PgQueryRewrite *rewrite;
+	List	   *cte_names;		/* char *, of the WITH clauses in scope */
+} RewriteContext;
+
+static bool rewrite_walker(Node *node, RewriteContext *ctx);
+
+static void rewrite_relation(RewriteContext *ctx, RangeVar *rv, bool can_alias)
+{
+	const PgQueryRewrite *rewrite = ctx->rewrite;
+	ListCell   *lc;
+	int			i;
+
+	if (rv->schemaname == NULL)
+	{
+		foreach(lc, ctx->cte_names)
+		{
+			if (strcmp((char *) lfirst(lc), rv->relname) == 0)
+				return;
+		}
+	}
+
+	for (i = 0; i < rewrite->n_relations; i++)
+	{
+		const PgQueryRewriteRelation *relation = &rewrite->relations[i];
+
+		if (strcmp(relation->relname, rv->relname) != 0)
+			continue;
+		if (relation->schemaname == NULL ? rv->schemaname != NULL :
+			rv->schemaname == NULL || strcmp(relation->schemaname, rv->schemaname) != 0)
+			continue;
+
+		if (relation->new_relname != NULL && strcmp(relation->new_relname, rv->relname) != 0)
+		{
+			// Columns may be qualified with the old name, so keep it as alias
+			if (can_alias && rv->alias == NULL)
+				rv->alias = makeAlias(rv->relname, NIL);
+			rv->relname = pstrdup(relation->new_relname);
+		}
+		if (relation->new_schemaname != NULL)
+			rv->schemaname = pstrdup(relation->new_schemaname);
+		break;
+	}
+
+	if (rv->schemaname == NULL && rewrite->schemaname != NULL)
+		rv->schemaname = pstrdup(rewrite->schemaname);
+}
+
+/*
+ * Walks a statement that may have a WITH clause. The CTE names hide tables
+ * from the rest of the statement, and from the CTEs that follow them (or all
+ * CTEs, with RECURSIVE), but not from anything outside of the statement.
+ */
+static bool rewrite_walk_with(Node *node, WithClause **with, RewriteContext *ctx)
+{
+	WithClause *clause = *with;
+	int			n_cte_names = list_length(ctx->cte_names);
+	ListCell   *lc;
+
+	if (clause != NULL)
+	{
+		if (clause->recursive)
+		{
+			foreach(lc, clause->ctes)
+				ctx->cte_names = lappend(ctx->cte_names, castNode(CommonTableExpr, lfirst(lc))->ctename);
+		}
+
+		foreach(lc, clause->ctes)
+		{
+			CommonTableExpr *cte = castNode(CommonTableExpr, lfirst(lc));
+
+			rewrite_walker(cte->ctequery, ctx);
+			if (!clause->recursive)
+				ctx->cte_names = lappend(ctx->cte_names, cte->ctename);
+		}
+	}
+
+	// The CTEs were walked above, so leave them out of the walk of the statement
+	*with = NULL;
+	raw_expression_tree_walker(node, rewrite_walker, (void *) ctx);
+	*with = clause;
+
+	ctx->cte_names = list_truncate(ctx->cte_names, n_cte_names);
+
+	return false;
+}
+
+static bool rewrite_walker(Node *node, RewriteContext *ctx)
+{
+	ListCell   *lc;
+
+	if (node == NULL)
+		return false;
+
+	switch (nodeTag(node))
+	{
+		case T_RangeVar:
+			rewrite_relation(ctx, (RangeVar *) node, true);
+			return false;
+		case T_IntoClause:
+			rewrite_relation(ctx, ((IntoClause *) node)->rel, false);
+			return false;
+		case T_LockingClause:
+			// FOR UPDATE OF refers to the relations by the names used in FROM
+			return false;
+		case T_SelectStmt:
+			return rewrite_walk_with(node, &((SelectStmt *) node)->withClause, ctx);
+		case T_InsertStmt:
+			return rewrite_walk_with(node, &((InsertStmt *) node)->withClause, ctx);
+		case T_UpdateStmt:
+			return rewrite_walk_with(node, &((UpdateStmt *) node)->withClause, ctx);
+		case T_DeleteStmt:
+			return rewrite_walk_with(node, &((DeleteStmt *) node)->withClause, ctx);
+		case T_MergeStmt:
+			return rewrite_walk_with(node, &((MergeStmt *) node)->withClause, ctx);
+		case T_ExplainStmt:
+			return rewrite_walker(((ExplainStmt *) node)->query, ctx);
+		case T_CopyStmt:
+			{
+				CopyStmt   *stmt = (CopyStmt *) node;
+
+				if (stmt->relation)
+					rewrite_relation(ctx, stmt->relation, false);
+				return rewrite_walker(stmt->query, ctx);
+			}
+		case T_CreateTableAsStmt:
+			{
+				CreateTableAsStmt *stmt = (CreateTableAsStmt *) node;
+
+				rewrite_relation(ctx, stmt->into->rel, false);
+				return rewrite_walker(stmt->query, ctx);
+			}
+		case T_ViewStmt:
+			{
+				ViewStmt   *stmt = (ViewStmt *) node;
+
+				rewrite_relation(ctx, stmt->view, false);
+				return rewrite_walker(stmt->query, ctx);
+			}
+		case T_TruncateStmt:
+			foreach(lc, ((TruncateStmt *) node)->relations)
+				rewrite_relation(ctx, castNode(RangeVar, lfirst(lc)), false);
+			return false;
+		case T_LockStmt:
+			foreach(lc, ((LockStmt *) node)->relations)
+				rewrite_relation(ctx, castNode(RangeVar, lfirst(lc)), false);
+			return false;
+		default:
+			break;
+	}
+
+	return raw_expression_tree_walker(node, rewrite_walker, (void *) ctx);
+}
+
+static bool rewrite_walks_stmt(Node *node)
+{
+	switch (nodeTag(node))
+	{
+		case T_SelectStmt:
+		case T_InsertStmt:
+		case T_UpdateStmt:
+		case T_DeleteStmt:
+		case T_MergeStmt:
+		case T_ExplainStmt:
+		case T_CopyStmt:
+		case T_CreateTableAsStmt:
+		case T_ViewStmt:
+		case T_TruncateStmt:
+		case T_LockStmt:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * Parses the WHERE expression, which the PL/pgSQL expression mode turns into
+ * the target list of a SELECT
+ */
+static Node *rewrite_parse_where(const char *where)
+{
+	List	   *tree = pg_query_raw_parser(where, strlen(where), RAW_PARSE_PLPGSQL_EXPR);
+	SelectStmt *stmt;
+	ResTarget  *target;
+
+	stmt = castNode(SelectStmt, castNode(RawStmt, linitial(tree))->stmt);
+	target = list_length(stmt->targetList) == 1 ? castNode(ResTarget, linitial(stmt->targetList)) : NULL;
+
+	if (target == NULL || target->name != NULL || stmt->distinctClause != NIL ||
+		stmt->fromClause != NIL || stmt->whereClause != NULL || stmt->groupClause != NIL ||
+		stmt->havingClause != NULL || stmt->windowClause != NIL || stmt->sortClause != NIL ||
+		stmt->limitCount != NULL || stmt->limitOffset != NULL || stmt->lockingClause != NIL)
+		elog(ERROR, "rewrite error: WHERE must be a single expression");
+
+	return target->val;
+}
+
+static Node *rewrite_and_where(Node *where, Node *expr)
+{
+	if (where == NULL)
+		return copyObject(expr);
+
+	if (IsA(where, CurrentOfExpr))
+		elog(ERROR, "rewrite error: can't add to WHERE CURRENT OF");
+
+	if (IsA(where, BoolExpr) && ((BoolExpr *) where)->boolop == AND_EXPR)
+	{
+		((BoolExpr *) where)->args = lappend(((BoolExpr *) where)->args, copyObject(expr));
+		return where;
+	}
+
+	return (Node *) makeBoolExpr(AND_EXPR, list_make2(where, copyObject(expr)), -1);
+}
+
+static void rewrite_select_where(SelectStmt *stmt, Node *expr)
+{
+	if (stmt->op != SETOP_NONE)
+	{
+		rewrite_select_where(stmt->larg, expr);
+		rewrite_select_where(stmt->rarg, expr);
+	}
+	else if (stmt->valuesLists == NIL && stmt->fromClause != NIL)
+	{
+		stmt->whereClause = rewrite_and_where(stmt->whereClause, expr);
+	}
+}
+
+static void rewrite_where(Node *node, const PgQueryRewrite *rewrite, Node *expr);
+
+/*
+ * Adds the WHERE expression to the UPDATEs and DELETEs in the WITH clauses
+ * of the statement, including those nested in other CTEs
+ */
+static void rewrite_cte_where(Node *node, const PgQueryRewrite *rewrite, Node *expr)
+{
+	WithClause *with;
+	ListCell   *lc;
+
+	switch (nodeTag(node))
+	{
+		case T_SelectStmt:
+			if (((SelectStmt *) node)->op != SETOP_NONE)
+			{
+				rewrite_cte_where((Node *) ((SelectStmt *) node)->larg, rewrite, expr);
+				rewrite_cte_where((Node *) ((SelectStmt *) node)->rarg, rewrite, expr);
+			}
+			with = ((SelectStmt *) node)->withClause;
+			break;
+		case T_InsertStmt:
+			if (((InsertStmt *) node)->selectStmt != NULL)
+				rewrite_cte_where(((InsertStmt *) node)->selectStmt, rewrite, expr);
+			with = ((InsertStmt *) node)->withClause;
+			break;
+		case T_UpdateStmt:
+			with = ((UpdateStmt *) node)->withClause;
+			break;
+		case T_DeleteStmt:
+			with = ((DeleteStmt *) node)->withClause;
+			break;
+		case T_MergeStmt:
+			with = ((MergeStmt *) node)->withClause;
+			break;
+		default:
+			return;
+	}
+
+	if (with == NULL)
+		return;
+
+	foreach(lc, with->ctes)
+	{
+		Node	   *query = lfirst_node(CommonTableExpr, lc)->ctequery;
+
+		if (IsA(query, UpdateStmt) || IsA(query, DeleteStmt))
+			rewrite_where(query, rewrite, expr);
+		else
+			rewrite_cte_where(query, rewrite, expr);
+	}
+}
+
+static void rewrite_where(Node *node, const PgQueryRewrite *rewrite, Node *expr)
+{
+	rewrite_cte_where(node, rewrite, expr);
+
+	switch (nodeTag(node))
+	{
+		case T_SelectStmt:
+			if (rewrite->where_stmts & PG_QUERY_REWRITE_SELECT)
+				rewrite_select_where((SelectStmt *) node, expr);
+			break;
+		case T_UpdateStmt:
+			if (rewrite->where_stmts & PG_QUERY_REWRITE_UPDATE)
+				((UpdateStmt *) node)->whereClause = rewrite_and_where(((UpdateStmt *) node)->whereClause, expr);
+			break;
+		case T_DeleteStmt:
+			if (rewrite->where_stmts & PG_QUERY_REWRITE_DELETE)
+				((DeleteStmt *) node)->whereClause = rewrite_and_where(((DeleteStmt *) node)->whereClause, expr);
+			break;
+		default:
+			break;
+	}
+}
+
+static Node *rewrite_make_int(int value)
+{
+	A_Const    *n = makeNode(A_Const);
+
+	n->val.ival.type = T_Integer;
+	n->val.ival.ival = value;
+	n->location = -1;
+
+	return (Node *) n;
+}
+
+static void rewrite_limit(SelectStmt *stmt, const PgQueryRewrite *rewrite)
+{
+	Node	   *count;
+
+	if (rewrite->limit >= 0)
+	{
+		stmt->limitCount = rewrite_make_int(rewrite->limit);
+		if (stmt->limitOption != LIMIT_OPTION_WITH_TIES)
+			stmt->limitOption = LIMIT_OPTION_COUNT;
+	}
+
+	if (rewrite->max_limit < 0)
+		return;
+
+	count = stmt->limitCount;
+	if (count == NULL || (IsA(count, A_Const) && ((A_Const *) count)->isnull))
+	{
+		// No limit, or LIMIT ALL
+		stmt->limitCount = rewrite_make_int(rewrite->max_limit);
+		if (stmt->limitOption != LIMIT_OPTION_WITH_TIES)
+			stmt->limitOption = LIMIT_OPTION_COUNT;
+	}
+	else if (IsA(count, A_Const) && IsA(&((A_Const *) count)->val, Integer))
+	{
+		if (intVal(&((A_Const *) count)->val) > rewrite->max_limit)
+			stmt->limitCount = rewrite_make_int(rewrite->max_limit);
+	}
+	else
+	{
+		// Parameters and other expressions are only known at runtime
+		MinMaxExpr *least = makeNode(MinMaxExpr);
+
+		least->op = IS_LEAST;
+		least->args = list_make2(count, rewrite_make_int(rewrite->max_limit));
+		least->location = -1;
+		stmt->limitCount = (Node *) least;
+	}
+}
+
+static PgQueryDeparseResult pg_query_rewrite_ext(const char* input, size_t len, const PgQueryRewrite *rewrite)
+{
+	PgQueryDeparseResult result = {0};
+	StringInfoData str;
+	MemoryContext ctx;
+
+	ctx = pg_query_enter_memory_context();
+
+	PG_TRY();
+	{
+		List	   *tree = pg_query_raw_parser(input, len, RAW_PARSE_DEFAULT);
+		Node	   *where = NULL;
+		RewriteContext rewrite_ctx;
+		ListCell   *lc;
+
+		if (rewrite->where != NULL)
+			where = rewrite_parse_where(rewrite->where);
+
+		rewrite_ctx.rewrite = rewrite;
+
+		initStringInfo(&str);
+		enlargeStringInfo(&str, len);
+
+		foreach(lc, tree)
+		{
+			RawStmt    *raw_stmt = castNode(RawStmt, lfirst(lc));
+			Node	   *stmt = raw_stmt->stmt;
+
+			// CTE names only hide tables within the statement that defines them
+			rewrite_ctx.cte_names = NIL;
+
+			if ((rewrite->n_relations > 0 || rewrite->schemaname != NULL) &&
+				rewrite_walks_stmt(stmt))
+				rewrite_walker(stmt, &rewrite_ctx);
+
+			if (where != NULL)
+				rewrite_where(stmt, rewrite, where);
+
+			if (IsA(stmt, SelectStmt))
+				rewrite_limit((SelectStmt *) stmt, rewrite);
+
+			deparseRawStmt(&str, raw_stmt);
+			if (lnext(tree, lc))
+				appendStringInfoString(&str, "; ");
+		}
+		result.query = pg_query_output_strdup(str.data, str.len);
+	}
+	PG_CATCH();
+	{
+		ErrorData* error_data;
+		PgQueryError* error;
+
+		MemoryContextSwitchTo(ctx);
+		error_data = CopyErrorData();
+
+		// Note: This is intentionally malloc so exiting the memory context doesn't free this
+		error = calloc(1, sizeof(PgQueryError));
+		error->message   = strdup(error_data->message);
+		error->filename  = strdup(error_data->filename);
+		error->funcname  = strdup(error_data->funcname);
+		error->context   = NULL;
+		error->lineno    = error_data->lineno;
+		error->cursorpos = error_data->cursorpos;
+		error->code      = pg_query_parse_limit_error();
+
+		result.error = error;
+		FlushErrorState();
+	}
+	PG_END_TRY();
+
+	pg_query_exit_memory_context(ctx);
+
+	return result;
+}
+
+PgQueryDeparseResult pg_query_rewrite(const char* input, const PgQueryRewrite *rewrite)
+{
+	return pg_query_rewrite_ext(input, strlen(input), rewrite);
+}
+
+PgQueryDeparseResult pg_query_rewrite_n(const char* input, size_t len, const PgQueryRewrite *rewrite)
+{
+	return pg_query_rewrite_ext(input, len, rewrite);
+}
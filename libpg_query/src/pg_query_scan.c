@@ -24,6 +24,11 @@ struct yyguts_t
 };
 
 PgQueryScanResult pg_query_scan(const char* input)
+{
+  return pg_query_scan_n(input, strlen(input));
+}
+
+PgQueryScanResult pg_query_scan_n(const char* input, size_t len)
 {
   MemoryContext ctx = NULL;
   PgQueryScanResult result = {0};
@@ -49,7 +54,7 @@ PgQueryScanResult pg_query_scan(const char* input)
 #ifndef DEBUG
   // Setup pipe for stderr redirection
   if (pipe(stderr_pipe) != 0) {
-    PgQueryError* error = malloc(sizeof(PgQueryError));
+    PgQueryError* error = calloc(1, sizeof(PgQueryError));
 
     error->message = strdup("Failed to open pipe, too many open file descriptors")
 
@@ -69,7 +74,7 @@ PgQueryScanResult pg_query_scan(const char* input)
   PG_TRY();
   {
     // Really this is stupid, we only run twice so we can pre-allocate the output array correctly
-    yyscanner = scanner_init(input, &yyextra, &ScanKeywords, ScanKeywordTokens);
+    yyscanner = scanner_init_n(input, len, &yyextra, &ScanKeywords, ScanKeywordTokens);
     for (;; token_count++)
     {
       if (core_yylex(&yylval, &yylloc, yyscanner) == 0) break;
@@ -79,7 +84,7 @@ PgQueryScanResult pg_query_scan(const char* input)
     output_tokens = malloc(sizeof(PgQuery__ScanToken *) * token_count);
 
     /* initialize the flex scanner --- should match raw_parser() */
-    yyscanner = scanner_init(input, &yyextra, &ScanKeywords, ScanKeywordTokens);
+    yyscanner = scanner_init_n(input, len, &yyextra, &ScanKeywords, ScanKeywordTokens);
 
     /* Lex tokens  */
     for (i = 0; ; i++)
@@ -114,7 +119,7 @@ PgQueryScanResult pg_query_scan(const char* input)
     scan_result.n_tokens = token_count;
     scan_result.tokens = output_tokens;
     result.pbuf.len = pg_query__scan_result__get_packed_size(&scan_result);
-    result.pbuf.data = malloc(result.pbuf.len);
+    result.pbuf.data = pg_query_output_alloc(result.pbuf.len);
     pg_query__scan_result__pack(&scan_result, (void*) result.pbuf.data);
 
     for (i = 0; i < token_count; i++) {
@@ -138,7 +143,7 @@ PgQueryScanResult pg_query_scan(const char* input)
     error_data = CopyErrorData();
 
     // Note: This is intentionally malloc so exiting the memory context doesn't free this
-    error = malloc(sizeof(PgQueryError));
+    error = calloc(1, sizeof(PgQueryError));
     error->message   = strdup(error_data->message);
     error->filename  = strdup(error_data->filename);
     error->funcname  = strdup(error_data->funcname);
@@ -169,6 +174,6 @@ void pg_query_free_scan_result(PgQueryScanResult result)
     pg_query_free_error(result.error);
   }
 
-  free(result.pbuf.data);
+  pg_query_output_free(result.pbuf.data);
   free(result.stderr_buffer);
 }
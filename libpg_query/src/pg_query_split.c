@@ -8,6 +8,11 @@
 #include <fcntl.h>
 
 PgQuerySplitResult pg_query_split_with_scanner(const char* input)
+{
+  return pg_query_split_with_scanner_n(input, strlen(input));
+}
+
+PgQuerySplitResult pg_query_split_with_scanner_n(const char* input, size_t len)
 {
   MemoryContext ctx = NULL;
   PgQuerySplitResult result = {0};
@@ -34,7 +39,7 @@ PgQuerySplitResult pg_query_split_with_scanner(const char* input)
 #ifndef DEBUG
   // Setup pipe for stderr redirection
   if (pipe(stderr_pipe) != 0) {
-    PgQueryError* error = malloc(sizeof(PgQueryError));
+    PgQueryError* error = calloc(1, sizeof(PgQueryError));
 
     error->message = strdup("Failed to open pipe, too many open file descriptors")
 
@@ -54,7 +59,7 @@ PgQuerySplitResult pg_query_split_with_scanner(const char* input)
   PG_TRY();
   {
     // Really this is stupid, we only run twice so we can pre-allocate the output array correctly
-    yyscanner = scanner_init(input, &yyextra, &ScanKeywords, ScanKeywordTokens);
+    yyscanner = scanner_init_n(input, len, &yyextra, &ScanKeywords, ScanKeywordTokens);
     while (true)
     {
       int tok = core_yylex(&yylval, &yylloc, yyscanner);
@@ -84,7 +89,7 @@ PgQuerySplitResult pg_query_split_with_scanner(const char* input)
     // Now actually set the output values
     keyword_before_terminator = false;
     open_parens = 0;
-    yyscanner = scanner_init(input, &yyextra, &ScanKeywords, ScanKeywordTokens);
+    yyscanner = scanner_init_n(input, len, &yyextra, &ScanKeywords, ScanKeywordTokens);
     while (true)
     {
       int tok = core_yylex(&yylval, &yylloc, yyscanner);
@@ -137,7 +142,7 @@ PgQuerySplitResult pg_query_split_with_scanner(const char* input)
     error_data = CopyErrorData();
 
     // Note: This is intentionally malloc so exiting the memory context doesn't free this
-    error = malloc(sizeof(PgQueryError));
+    error = calloc(1, sizeof(PgQueryError));
     error->message   = strdup(error_data->message);
     error->filename  = strdup(error_data->filename);
     error->funcname  = strdup(error_data->funcname);
@@ -163,6 +168,11 @@ PgQuerySplitResult pg_query_split_with_scanner(const char* input)
 }
 
 PgQuerySplitResult pg_query_split_with_parser(const char* input)
+{
+	return pg_query_split_with_parser_n(input, strlen(input));
+}
+
+PgQuerySplitResult pg_query_split_with_parser_n(const char* input, size_t len)
 {
 	MemoryContext ctx = NULL;
 	PgQueryInternalParsetreeAndError parsetree_and_error;
@@ -170,7 +180,7 @@ PgQuerySplitResult pg_query_split_with_parser(const char* input)
 
 	ctx = pg_query_enter_memory_context();
 
-	parsetree_and_error = pg_query_raw_parse(input, PG_QUERY_PARSE_DEFAULT);
+	parsetree_and_error = pg_query_raw_parse(input, len, PG_QUERY_PARSE_DEFAULT);
 
 	// These are all malloc-ed and will survive exiting the memory context, the caller is responsible to free them now
 	result.stderr_buffer = parsetree_and_error.stderr_buffer;
@@ -188,7 +198,7 @@ PgQuerySplitResult pg_query_split_with_parser(const char* input)
 			result.stmts[foreach_current_index(lc)] = malloc(sizeof(PgQuerySplitStmt));
 			result.stmts[foreach_current_index(lc)]->stmt_location = raw_stmt->stmt_location;
 			if (raw_stmt->stmt_len == 0)
-				result.stmts[foreach_current_index(lc)]->stmt_len = strlen(input) - raw_stmt->stmt_location;
+				result.stmts[foreach_current_index(lc)]->stmt_len = len - raw_stmt->stmt_location;
 			else
 				result.stmts[foreach_current_index(lc)]->stmt_len = raw_stmt->stmt_len;
 		}
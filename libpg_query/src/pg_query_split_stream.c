@@ -0,0 +1,683 @@
+#include "pg_query.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Streaming statement splitter
+ *
+ * Splits input that arrives in chunks, e.g. a pg_dump file read piece by
+ * piece, without ever holding more than the current chunk. The postgres
+ * scanner needs the whole input at once, so this is a small hand-written
+ * lexer that only knows what it takes to find statement boundaries, and keeps
+ * its state between chunks: string literals (with backslash escapes in E''
+ * strings), quoted identifiers, dollar-quoted strings, nested block comments,
+ * line comments, parentheses (so "CREATE RULE ... (SELECT 1; SELECT 2)" stays
+ * one statement) and BEGIN ... END blocks of SQL-standard function bodies,
+ * which are recognized the same way psql does it.
+ *
+ * A statement starts after the previous semicolon and ends before its own, as
+ * with pg_query_split_with_scanner. Statements made up of only whitespace and
+ * comments are left out.
+ *
+ * The data that follows a COPY ... FROM STDIN statement, as in pg_dump output,
+ * isn't SQL: it is skipped line by line up to the line holding only "\.",
+ * and the next statement starts after that line.
+ */
+
+typedef enum
+{
+	SPLIT_NORMAL,
+	SPLIT_WORD,
+	SPLIT_LINE_COMMENT,
+	SPLIT_BLOCK_COMMENT,
+	SPLIT_QUOTE,
+	SPLIT_QUOTE_END,			/* seen the closing quote, unless another one follows */
+	SPLIT_IDENT_QUOTE,
+	SPLIT_IDENT_QUOTE_END,
+	SPLIT_DOLLAR_TAG,			/* between the opening $ of a dollar quote and the $ ending its tag */
+	SPLIT_DOLLAR_QUOTE,
+	SPLIT_COPY_DATA
+} SplitState;
+
+/* How much of a COPY ... FROM STDIN statement has been seen */
+typedef enum
+{
+	COPY_NONE,
+	COPY_STMT,					/* the statement starts with COPY */
+	COPY_FROM,					/* the last word was FROM */
+	COPY_STDIN					/* FROM was followed by STDIN */
+} CopyState;
+
+/* Position in a line of COPY data, when looking for the "\." that ends it */
+#define COPY_LINE_START 0
+#define COPY_LINE_BACKSLASH 1
+#define COPY_LINE_END_MARKER 2
+#define COPY_LINE_DATA 3
+
+#define WORD_BUFFER_LEN 16
+#define MAX_TRACKED_IDENTIFIERS 4
+
+struct PgQuerySplitStream
+{
+	SplitState state;
+	uint64_t offset;			/* stream position of the current byte */
+	uint64_t stmt_start;
+	uint64_t token_start;		/* where the current string or comment started, for errors */
+	bool has_token;				/* current statement has more than whitespace and comments */
+	bool finished;
+
+	char pending;				/* '-' or '/' that may start a comment, or 0 */
+	bool escape_string;			/* in an E'' string */
+	bool escape_next;			/* the next byte of the E'' string is escaped */
+	char comment_prev;
+	int comment_depth;
+	int paren_depth;
+
+	/* Current word, only as much as is needed to compare it to keywords */
+	char word[WORD_BUFFER_LEN];
+	size_t word_len;
+	bool word_is_identifier;
+
+	/* BEGIN ... END tracking, see psqlscan.l */
+	char identifiers[MAX_TRACKED_IDENTIFIERS];
+	int identifier_count;
+	int begin_depth;
+
+	CopyState copy_state;
+	int copy_line;
+
+	/* Dollar quote tag, without the $ signs */
+	char *tag;
+	size_t tag_len;
+	size_t tag_capacity;
+	size_t tag_match;			/* bytes of the closing "$tag$" seen so far */
+
+	PgQuerySplitStreamStmt *stmts;
+	int n_stmts;
+	int stmts_capacity;
+	PgQueryError *error;
+};
+
+static bool
+is_space(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static bool
+is_ident_start(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (unsigned char) c >= 0x80;
+}
+
+static bool
+is_ident_cont(char c)
+{
+	return is_ident_start(c) || (c >= '0' && c <= '9') || c == '$';
+}
+
+// Compares the current word to a lowercase keyword
+static bool
+word_is(const char *word, const char *keyword)
+{
+	for (; *word && *keyword; word++, keyword++)
+		if (tolower((unsigned char) *word) != *keyword)
+			return false;
+
+	return *word == *keyword;
+}
+
+static bool
+set_error(PgQuerySplitStream *stream, const char *message, uint64_t position)
+{
+	PgQueryError *error = calloc(1, sizeof(PgQueryError));
+
+	if (error == NULL)
+		return false;
+
+	error->message = strdup(message);
+	error->filename = strdup("pg_query_split_stream.c");
+	error->funcname = strdup("pg_query_split_stream_finish");
+	error->cursorpos = position < INT_MAX ? (int) position + 1 : 0;
+	stream->error = error;
+
+	return true;
+}
+
+static bool
+add_stmt(PgQuerySplitStream *stream, uint64_t end)
+{
+	if (!stream->has_token)
+		return true;
+
+	if (stream->n_stmts == stream->stmts_capacity)
+	{
+		int capacity = stream->stmts_capacity > 0 ? stream->stmts_capacity * 2 : 16;
+		PgQuerySplitStreamStmt *stmts = realloc(stream->stmts, capacity * sizeof(PgQuerySplitStreamStmt));
+
+		if (stmts == NULL)
+			return false;
+
+		stream->stmts = stmts;
+		stream->stmts_capacity = capacity;
+	}
+
+	stream->stmts[stream->n_stmts].stmt_location = stream->stmt_start;
+	stream->stmts[stream->n_stmts].stmt_len = end - stream->stmt_start;
+	stream->n_stmts++;
+
+	return true;
+}
+
+static void
+end_stmt(PgQuerySplitStream *stream)
+{
+	stream->stmt_start = stream->offset + 1;
+	stream->has_token = false;
+	stream->identifier_count = 0;
+	stream->begin_depth = 0;
+	stream->copy_state = COPY_NONE;
+}
+
+// Keeps track of whether the statement is a COPY ... FROM STDIN
+static void
+track_copy(PgQuerySplitStream *stream, const char *word)
+{
+	if (stream->identifier_count == 0)
+		stream->copy_state = word_is(word, "copy") ? COPY_STMT : COPY_NONE;
+	else if (stream->copy_state == COPY_NONE || stream->paren_depth > 0)
+		return;
+	else if (word_is(word, "from"))
+		stream->copy_state = COPY_FROM;
+	else if (stream->copy_state == COPY_FROM)
+		stream->copy_state = word_is(word, "stdin") ? COPY_STDIN : COPY_STMT;
+}
+
+/*
+ * Keeps track of whether we are inside the BEGIN ... END body of a CREATE
+ * [OR REPLACE] FUNCTION/PROCEDURE statement, where semicolons don't end the
+ * statement. Same heuristic as psql.
+ */
+static void
+end_word(PgQuerySplitStream *stream)
+{
+	const char *word = stream->word;
+	char *ids = stream->identifiers;
+
+	stream->state = SPLIT_NORMAL;
+
+	if (!stream->word_is_identifier)
+		return;
+
+	if (stream->word_len >= WORD_BUFFER_LEN)
+		word = "";
+	else
+		stream->word[stream->word_len] = '\0';
+
+	track_copy(stream, word);
+
+	if (stream->identifier_count == 0)
+		memset(ids, 0, sizeof(stream->identifiers));
+
+	if (stream->identifier_count < MAX_TRACKED_IDENTIFIERS &&
+		(word_is(word, "create") || word_is(word, "function") ||
+		 word_is(word, "procedure") || word_is(word, "or") ||
+		 word_is(word, "replace")))
+		ids[stream->identifier_count] = tolower((unsigned char) word[0]);
+
+	stream->identifier_count++;
+
+	if (ids[0] == 'c' &&
+		(ids[1] == 'f' || ids[1] == 'p' ||
+		 (ids[1] == 'o' && ids[2] == 'r' && (ids[3] == 'f' || ids[3] == 'p'))) &&
+		stream->paren_depth == 0)
+	{
+		if (word_is(word, "begin"))
+			stream->begin_depth++;
+		else if (word_is(word, "case"))
+		{
+			/* CASE also ends with END, but only matters inside a BEGIN */
+			if (stream->begin_depth > 0)
+				stream->begin_depth++;
+		}
+		else if (word_is(word, "end"))
+		{
+			if (stream->begin_depth > 0)
+				stream->begin_depth--;
+		}
+	}
+}
+
+static void
+start_word(PgQuerySplitStream *stream, char c, bool is_identifier)
+{
+	stream->state = SPLIT_WORD;
+	stream->word[0] = c;
+	stream->word_len = 1;
+	stream->word_is_identifier = is_identifier;
+	stream->has_token = true;
+}
+
+static void
+start_quote(PgQuerySplitStream *stream, SplitState state)
+{
+	stream->state = state;
+	stream->token_start = stream->offset;
+	stream->has_token = true;
+}
+
+static bool
+add_tag_byte(PgQuerySplitStream *stream, char c)
+{
+	if (stream->tag_len == stream->tag_capacity)
+	{
+		size_t capacity = stream->tag_capacity > 0 ? stream->tag_capacity * 2 : 32;
+		char *tag = realloc(stream->tag, capacity);
+
+		if (tag == NULL)
+			return false;
+
+		stream->tag = tag;
+		stream->tag_capacity = capacity;
+	}
+
+	stream->tag[stream->tag_len++] = c;
+
+	return true;
+}
+
+// Resolves a '-' or '/' held back from the previous byte, returns whether c was consumed
+static bool
+resolve_pending(PgQuerySplitStream *stream, char c)
+{
+	char pending = stream->pending;
+
+	stream->pending = 0;
+
+	if (pending == '-' && c == '-')
+	{
+		stream->state = SPLIT_LINE_COMMENT;
+		return true;
+	}
+
+	if (pending == '/' && c == '*')
+	{
+		stream->state = SPLIT_BLOCK_COMMENT;
+		stream->token_start = stream->offset - 1;
+		stream->comment_depth = 1;
+		stream->comment_prev = 0;
+		return true;
+	}
+
+	stream->has_token = true;
+
+	return false;
+}
+
+// Handles a byte outside of strings, comments and words, returns false when out of memory
+static bool
+split_normal(PgQuerySplitStream *stream, char c)
+{
+	if (stream->pending != 0 && resolve_pending(stream, c))
+		return true;
+
+	switch (c)
+	{
+		case ';':
+			if (stream->paren_depth == 0 && stream->begin_depth == 0)
+			{
+				bool		copy_data = stream->copy_state == COPY_STDIN;
+
+				if (!add_stmt(stream, stream->offset))
+					return false;
+				end_stmt(stream);
+
+				/* The data starts on the next line */
+				if (copy_data)
+				{
+					stream->state = SPLIT_COPY_DATA;
+					stream->copy_line = COPY_LINE_DATA;
+				}
+			}
+			else
+				stream->has_token = true;
+			break;
+		case '(':
+			stream->paren_depth++;
+			stream->has_token = true;
+			break;
+		case ')':
+			if (stream->paren_depth > 0)
+				stream->paren_depth--;
+			stream->has_token = true;
+			break;
+		case '-':
+		case '/':
+			stream->pending = c;
+			break;
+		case '\'':
+			stream->escape_string = false;
+			start_quote(stream, SPLIT_QUOTE);
+			break;
+		case '"':
+			start_quote(stream, SPLIT_IDENT_QUOTE);
+			break;
+		case '$':
+			start_quote(stream, SPLIT_DOLLAR_TAG);
+			stream->tag_len = 0;
+			break;
+		default:
+			if (is_ident_start(c))
+				start_word(stream, c, true);
+			else if (c >= '0' && c <= '9')
+				start_word(stream, c, false);
+			else if (!is_space(c))
+				stream->has_token = true;
+			break;
+	}
+
+	return true;
+}
+
+// Handles one byte, returns false when out of memory
+static bool
+split_byte(PgQuerySplitStream *stream, char c)
+{
+	switch (stream->state)
+	{
+		case SPLIT_NORMAL:
+			return split_normal(stream, c);
+
+		case SPLIT_WORD:
+			if (is_ident_cont(c))
+			{
+				if (stream->word_len < WORD_BUFFER_LEN)
+					stream->word[stream->word_len] = c;
+				stream->word_len++;
+				return true;
+			}
+
+			if (c == '\'' && stream->word_is_identifier && stream->word_len == 1 &&
+				(stream->word[0] == 'e' || stream->word[0] == 'E'))
+			{
+				end_word(stream);
+				stream->escape_string = true;
+				start_quote(stream, SPLIT_QUOTE);
+				return true;
+			}
+
+			end_word(stream);
+			return split_normal(stream, c);
+
+		case SPLIT_LINE_COMMENT:
+			if (c == '\n' || c == '\r')
+				stream->state = SPLIT_NORMAL;
+			return true;
+
+		case SPLIT_BLOCK_COMMENT:
+			if (stream->comment_prev == '*' && c == '/')
+			{
+				c = 0;
+				if (--stream->comment_depth == 0)
+					stream->state = SPLIT_NORMAL;
+			}
+			else if (stream->comment_prev == '/' && c == '*')
+			{
+				c = 0;
+				stream->comment_depth++;
+			}
+			stream->comment_prev = c;
+			return true;
+
+		case SPLIT_QUOTE:
+			if (stream->escape_next)
+				stream->escape_next = false;
+			else if (c == '\\' && stream->escape_string)
+				stream->escape_next = true;
+			else if (c == '\'')
+				stream->state = SPLIT_QUOTE_END;
+			return true;
+
+		case SPLIT_QUOTE_END:
+			if (c == '\'')
+			{
+				stream->state = SPLIT_QUOTE;
+				return true;
+			}
+			stream->state = SPLIT_NORMAL;
+			return split_normal(stream, c);
+
+		case SPLIT_IDENT_QUOTE:
+			if (c == '"')
+				stream->state = SPLIT_IDENT_QUOTE_END;
+			return true;
+
+		case SPLIT_IDENT_QUOTE_END:
+			if (c == '"')
+			{
+				stream->state = SPLIT_IDENT_QUOTE;
+				return true;
+			}
+			stream->state = SPLIT_NORMAL;
+			return split_normal(stream, c);
+
+		case SPLIT_DOLLAR_TAG:
+			if (c == '$')
+			{
+				stream->state = SPLIT_DOLLAR_QUOTE;
+				stream->tag_match = 0;
+				return true;
+			}
+
+			if (is_ident_start(c) || (stream->tag_len > 0 && c >= '0' && c <= '9'))
+				return add_tag_byte(stream, c);
+
+			/* Not a dollar quote, e.g. the parameter in "$1" */
+			if (stream->tag_len == 0 && c >= '0' && c <= '9')
+			{
+				start_word(stream, c, false);
+				return true;
+			}
+
+			stream->state = SPLIT_NORMAL;
+			return split_normal(stream, c);
+
+		case SPLIT_DOLLAR_QUOTE:
+			{
+				size_t delimiter_len = stream->tag_len + 2;
+				size_t i = stream->tag_match;
+				char expected = (i == 0 || i == delimiter_len - 1) ? '$' : stream->tag[i - 1];
+
+				if (c == expected)
+				{
+					if (++stream->tag_match == delimiter_len)
+						stream->state = SPLIT_NORMAL;
+				}
+				else
+				{
+					/* The tag can't contain '$', so only a '$' can start a new match */
+					stream->tag_match = c == '$' ? 1 : 0;
+				}
+				return true;
+			}
+
+		case SPLIT_COPY_DATA:
+			if (c == '\n')
+			{
+				if (stream->copy_line == COPY_LINE_END_MARKER)
+				{
+					stream->state = SPLIT_NORMAL;
+					stream->stmt_start = stream->offset + 1;
+				}
+				stream->copy_line = COPY_LINE_START;
+			}
+			else if (stream->copy_line == COPY_LINE_START && c == '\\')
+				stream->copy_line = COPY_LINE_BACKSLASH;
+			else if (stream->copy_line == COPY_LINE_BACKSLASH && c == '.')
+				stream->copy_line = COPY_LINE_END_MARKER;
+			else if (!(stream->copy_line == COPY_LINE_END_MARKER && c == '\r'))
+				stream->copy_line = COPY_LINE_DATA;
+			return true;
+	}
+
+	return true;
+}
+
+PgQuerySplitStream* pg_query_split_stream_new(void)
+{
+	return calloc(1, sizeof(PgQuerySplitStream));
+}
+
+PgQuerySplitStreamResult pg_query_split_stream_feed(PgQuerySplitStream* stream, const char* chunk, size_t len)
+{
+	PgQuerySplitStreamResult result = {0};
+	const char *end = chunk + len;
+	const char *p = chunk;
+
+	stream->n_stmts = 0;
+
+	if (stream->error != NULL || stream->finished)
+	{
+		if (stream->error == NULL)
+			set_error(stream, "split stream is already finished", stream->offset);
+		result.error = stream->error;
+		return result;
+	}
+
+	while (p < end)
+	{
+		/* Skip ahead to the end of long string literals */
+		if (stream->state == SPLIT_QUOTE && !stream->escape_string)
+		{
+			const char *quote = memchr(p, '\'', end - p);
+
+			if (quote == NULL)
+			{
+				stream->offset += end - p;
+				break;
+			}
+			stream->offset += quote - p;
+			p = quote;
+		}
+		else if (stream->state == SPLIT_COPY_DATA && stream->copy_line == COPY_LINE_DATA)
+		{
+			const char *newline = memchr(p, '\n', end - p);
+
+			if (newline == NULL)
+			{
+				stream->offset += end - p;
+				break;
+			}
+			stream->offset += newline - p;
+			p = newline;
+		}
+		else if (stream->state == SPLIT_DOLLAR_QUOTE && stream->tag_match == 0)
+		{
+			const char *dollar = memchr(p, '$', end - p);
+
+			if (dollar == NULL)
+			{
+				stream->offset += end - p;
+				break;
+			}
+			stream->offset += dollar - p;
+			p = dollar;
+		}
+
+		if (!split_byte(stream, *p))
+		{
+			set_error(stream, "out of memory", stream->offset);
+			result.error = stream->error;
+			return result;
+		}
+
+		stream->offset++;
+		p++;
+	}
+
+	result.stmts = stream->stmts;
+	result.n_stmts = stream->n_stmts;
+	result.pending_location = stream->state == SPLIT_COPY_DATA ? stream->offset : stream->stmt_start;
+
+	return result;
+}
+
+PgQuerySplitStreamResult pg_query_split_stream_finish(PgQuerySplitStream* stream)
+{
+	PgQuerySplitStreamResult result = {0};
+	const char *message = NULL;
+
+	stream->n_stmts = 0;
+
+	if (stream->error != NULL || stream->finished)
+	{
+		if (stream->error == NULL)
+			set_error(stream, "split stream is already finished", stream->offset);
+		result.error = stream->error;
+		return result;
+	}
+
+	stream->finished = true;
+
+	switch (stream->state)
+	{
+		case SPLIT_QUOTE:
+			message = "unterminated quoted string";
+			break;
+		case SPLIT_IDENT_QUOTE:
+			message = "unterminated quoted identifier";
+			break;
+		case SPLIT_BLOCK_COMMENT:
+			message = "unterminated /* comment";
+			break;
+		case SPLIT_DOLLAR_QUOTE:
+			message = "unterminated dollar-quoted string";
+			break;
+		default:
+			break;
+	}
+
+	if (message != NULL)
+	{
+		set_error(stream, message, stream->token_start);
+		result.error = stream->error;
+		return result;
+	}
+
+	if (stream->pending != 0)
+		stream->has_token = true;
+
+	if (!add_stmt(stream, stream->offset))
+	{
+		set_error(stream, "out of memory", stream->offset);
+		result.error = stream->error;
+		return result;
+	}
+
+	result.stmts = stream->stmts;
+	result.n_stmts = stream->n_stmts;
+	result.pending_location = stream->offset;
+
+	return result;
+}
+
+void pg_query_split_stream_free(PgQuerySplitStream* stream)
+{
+	if (stream == NULL)
+		return;
+
+	if (stream->error != NULL)
+	{
+		free(stream->error->message);
+		free(stream->error->filename);
+		free(stream->error->funcname);
+		free(stream->error);
+	}
+
+	free(stream->tag);
+	free(stream->stmts);
+	free(stream);
+}
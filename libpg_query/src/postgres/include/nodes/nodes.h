@@ -132,6 +132,15 @@ typedef struct Node
 
 #define nodeTag(nodeptr)		(((const Node*)(nodeptr))->type)
 
+/*
+ * libpg_query counts the nodes created on the current thread, so that it can
+ * abort parses that build more than newNodeLimit of them (0 disables the
+ * check).  newNodeLimitExceeded() raises the error.
+ */
+extern PGDLLIMPORT __thread uint64 newNodeCount;
+extern PGDLLIMPORT __thread uint64 newNodeLimit;
+extern void newNodeLimitExceeded(void) pg_attribute_noreturn();
+
 /*
  * newNode -
  *	  create a new node of the specified size and tag the node with the
@@ -149,6 +158,9 @@ newNode(size_t size, NodeTag tag)
 	result = (Node *) palloc0(size);
 	result->type = tag;
 
+	if (unlikely(++newNodeCount == newNodeLimit))
+		newNodeLimitExceeded();
+
 	return result;
 }
 
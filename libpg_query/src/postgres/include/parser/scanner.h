@@ -139,6 +139,11 @@ extern core_yyscan_t scanner_init(const char *str,
 								  core_yy_extra_type *yyext,
 								  const ScanKeywordList *keywordlist,
 								  const uint16 *keyword_tokens);
+extern core_yyscan_t scanner_init_n(const char *str,
+									Size slen,
+									core_yy_extra_type *yyext,
+									const ScanKeywordList *keywordlist,
+									const uint16 *keyword_tokens);
 extern void scanner_finish(core_yyscan_t yyscanner);
 extern int	core_yylex(core_YYSTYPE *yylval_param, YYLTYPE *yylloc_param,
 					   core_yyscan_t yyscanner);
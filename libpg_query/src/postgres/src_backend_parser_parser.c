@@ -52,14 +52,25 @@ static char *str_udeescape(const char *str, char escape,
  */
 List *
 raw_parser(const char *str, RawParseMode mode)
+{
+	return raw_parser_n(str, strlen(str), mode);
+}
+
+/*
+ * raw_parser_n
+ *		Like raw_parser, for a string of len bytes that need not be
+ *		null-terminated.
+ */
+List *
+raw_parser_n(const char *str, Size len, RawParseMode mode)
 {
 	core_yyscan_t yyscanner;
 	base_yy_extra_type yyextra;
 	int			yyresult;
 
 	/* initialize the flex scanner */
-	yyscanner = scanner_init(str, &yyextra.core_yy_extra,
-							 &ScanKeywords, ScanKeywordTokens);
+	yyscanner = scanner_init_n(str, len, &yyextra.core_yy_extra,
+							   &ScanKeywords, ScanKeywordTokens);
 
 	/* base_yylex() only needs us to initialize the lookahead token, if any */
 	if (mode == RAW_PARSE_DEFAULT)
@@ -10660,7 +10660,20 @@ scanner_init(const char *str,
 			 const ScanKeywordList *keywordlist,
 			 const uint16 *keyword_tokens)
 {
-	Size		slen = strlen(str);
+	return scanner_init_n(str, strlen(str), yyext, keywordlist, keyword_tokens);
+}
+
+/*
+ * Like scanner_init, for a string of slen bytes that need not be
+ * null-terminated
+ */
+core_yyscan_t
+scanner_init_n(const char *str,
+			   Size slen,
+			   core_yy_extra_type *yyext,
+			   const ScanKeywordList *keywordlist,
+			   const uint16 *keyword_tokens)
+{
 	yyscan_t	scanner;
 
 	if (yylex_init(&scanner) != 0)
@@ -275,6 +275,53 @@ typedef struct AllocSetFreeList
 	AllocSetContext *first_free;	/* list header */
 } AllocSetFreeList;
 
+/*
+ * Per-thread totals over all AllocSets, used by libpg_query to report how
+ * much memory a call needed.  AllocSetTrackedAllocated mirrors the sum of
+ * mem_allocated (counting contexts on the freelists as released), and
+ * AllocSetTrackedPeak is its high-water mark, which callers may reset.
+ */
+__thread Size AllocSetTrackedAllocated = 0;
+__thread Size AllocSetTrackedPeak = 0;
+__thread uint64 AllocSetTrackedBlocks = 0;
+
+#define AllocSetTrackAlloc(size) \
+	do { \
+		AllocSetTrackedAllocated += (size); \
+		AllocSetTrackedBlocks++; \
+		if (AllocSetTrackedAllocated > AllocSetTrackedPeak) \
+			AllocSetTrackedPeak = AllocSetTrackedAllocated; \
+	} while (0)
+#define AllocSetTrackFree(size) (AllocSetTrackedAllocated -= (size))
+
+/*
+ * libpg_query can also cap AllocSetTrackedAllocated to abort pathological
+ * parses early.  Once a new block would take it above AllocSetTrackedLimit
+ * (0 disables the check), the allocation fails with an error, and the limit
+ * is lifted so that error handling can still allocate.
+ */
+__thread Size AllocSetTrackedLimit = 0;
+__thread bool AllocSetTrackedLimitExceeded = false;
+
+static void pg_attribute_noreturn()
+AllocSetLimitError(Size size)
+{
+	AllocSetTrackedLimit = 0;
+	AllocSetTrackedLimitExceeded = true;
+
+	ereport(ERROR,
+			(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+			 errmsg("memory limit exceeded"),
+			 errdetail("Failed on request of size %zu.", size)));
+}
+
+#define AllocSetCheckLimit(size) \
+	do { \
+		if (unlikely(AllocSetTrackedLimit != 0 && \
+					 AllocSetTrackedAllocated + (size) > AllocSetTrackedLimit)) \
+			AllocSetLimitError(size); \
+	} while (0)
+
 /* context_freelists[0] is for default params, [1] for small params */
 static __thread AllocSetFreeList context_freelists[2] =
 {
@@ -447,6 +494,7 @@ AllocSetContextCreateInternal(MemoryContext parent,
 
 			((MemoryContext) set)->mem_allocated =
 				KeeperBlock(set)->endptr - ((char *) set);
+			AllocSetTrackAlloc(((MemoryContext) set)->mem_allocated);
 
 			return (MemoryContext) set;
 		}
@@ -540,6 +588,7 @@ AllocSetContextCreateInternal(MemoryContext parent,
 						name);
 
 	((MemoryContext) set)->mem_allocated = firstBlockSize;
+	AllocSetTrackAlloc(firstBlockSize);
 
 	return (MemoryContext) set;
 }
@@ -604,6 +653,7 @@ AllocSetReset(MemoryContext context)
 		{
 			/* Normal case, release the block */
 			context->mem_allocated -= block->endptr - ((char *) block);
+			AllocSetTrackFree(block->endptr - ((char *) block));
 
 #ifdef CLOBBER_FREED_MEMORY
 			wipe_mem(block, block->freeptr - ((char *) block));
@@ -631,7 +681,7 @@ AllocSetDelete(MemoryContext context)
 {
 	AllocSet	set = (AllocSet) context;
 	AllocBlock	block = set->blocks;
-	Size		keepersize PG_USED_FOR_ASSERTS_ONLY;
+	Size		keepersize;
 
 	Assert(AllocSetIsValid(set));
 
@@ -682,6 +732,8 @@ AllocSetDelete(MemoryContext context)
 		freelist->first_free = set;
 		freelist->num_free++;
 
+		AllocSetTrackFree(keepersize);
+
 		return;
 	}
 
@@ -691,7 +743,10 @@ AllocSetDelete(MemoryContext context)
 		AllocBlock	next = block->next;
 
 		if (!IsKeeperBlock(set, block))
+		{
 			context->mem_allocated -= block->endptr - ((char *) block);
+			AllocSetTrackFree(block->endptr - ((char *) block));
+		}
 
 #ifdef CLOBBER_FREED_MEMORY
 		wipe_mem(block, block->freeptr - ((char *) block));
@@ -704,6 +759,7 @@ AllocSetDelete(MemoryContext context)
 	}
 
 	Assert(context->mem_allocated == keepersize);
+	AllocSetTrackFree(keepersize);
 
 	/* Finally, free the context header, including the keeper block */
 	free(set);
@@ -735,11 +791,13 @@ AllocSetAllocLarge(MemoryContext context, Size size, int flags)
 #endif
 
 	blksize = chunk_size + ALLOC_BLOCKHDRSZ + ALLOC_CHUNKHDRSZ;
+	AllocSetCheckLimit(blksize);
 	block = (AllocBlock) malloc(blksize);
 	if (block == NULL)
 		return MemoryContextAllocationFailure(context, size, flags);
 
 	context->mem_allocated += blksize;
+	AllocSetTrackAlloc(blksize);
 
 	block->aset = set;
 	block->freeptr = block->endptr = ((char *) block) + blksize;
@@ -928,6 +986,7 @@ AllocSetAllocFromNewBlock(MemoryContext context, Size size, int flags,
 		blksize <<= 1;
 
 	/* Try to allocate it */
+	AllocSetCheckLimit(blksize);
 	block = (AllocBlock) malloc(blksize);
 
 	/*
@@ -946,6 +1005,7 @@ AllocSetAllocFromNewBlock(MemoryContext context, Size size, int flags,
 		return MemoryContextAllocationFailure(context, size, flags);
 
 	context->mem_allocated += blksize;
+	AllocSetTrackAlloc(blksize);
 
 	block->aset = set;
 	block->freeptr = ((char *) block) + ALLOC_BLOCKHDRSZ;
@@ -1123,6 +1183,7 @@ AllocSetFree(void *pointer)
 			block->next->prev = block->prev;
 
 		set->header.mem_allocated -= block->endptr - ((char *) block);
+		AllocSetTrackFree(block->endptr - ((char *) block));
 
 #ifdef CLOBBER_FREED_MEMORY
 		wipe_mem(block, block->freeptr - ((char *) block));
@@ -1246,6 +1307,9 @@ AllocSetRealloc(void *pointer, Size size, int flags)
 		blksize = chksize + ALLOC_BLOCKHDRSZ + ALLOC_CHUNKHDRSZ;
 		oldblksize = block->endptr - ((char *) block);
 
+		if (blksize > oldblksize)
+			AllocSetCheckLimit(blksize - oldblksize);
+
 		block = (AllocBlock) realloc(block, blksize);
 		if (block == NULL)
 		{
@@ -1257,6 +1321,8 @@ AllocSetRealloc(void *pointer, Size size, int flags)
 		/* updated separately, not to underflow when (oldblksize > blksize) */
 		set->header.mem_allocated -= oldblksize;
 		set->header.mem_allocated += blksize;
+		AllocSetTrackFree(oldblksize);
+		AllocSetTrackAlloc(blksize);
 
 		block->freeptr = block->endptr = ((char *) block) + blksize;
 
@@ -44,6 +44,66 @@ removeTrailingSpace(StringInfo str)
 	}
 }
 
+/*
+ * Append an identifier, quoted if necessary.
+ *
+ * Same as appending quote_identifier's result, but identifiers that need
+ * quotes are written straight into the output instead of into a copy first.
+ */
+static void
+appendIdentifier(StringInfo str, const char *ident)
+{
+	bool		safe = ((ident[0] >= 'a' && ident[0] <= 'z') || ident[0] == '_');
+	int			nquotes = 0;
+	const char *ptr;
+	char	   *optr;
+
+	for (ptr = ident; *ptr; ptr++)
+	{
+		char		ch = *ptr;
+
+		if (!((ch >= 'a' && ch <= 'z') ||
+			  (ch >= '0' && ch <= '9') ||
+			  (ch == '_')))
+		{
+			safe = false;
+			if (ch == '"')
+				nquotes++;
+		}
+	}
+
+	if (quote_all_identifiers)
+		safe = false;
+
+	// Keywords are quoted except for unreserved ones, see quote_identifier
+	if (safe && ptr - ident <= ScanKeywords.max_kw_len)
+	{
+		int			kwnum = ScanKeywordLookup(ident, &ScanKeywords);
+
+		if (kwnum >= 0 && ScanKeywordCategories[kwnum] != UNRESERVED_KEYWORD)
+			safe = false;
+	}
+
+	if (safe)
+	{
+		appendBinaryStringInfo(str, ident, ptr - ident);
+		return;
+	}
+
+	enlargeStringInfo(str, (ptr - ident) + nquotes + 2);
+	optr = str->data + str->len;
+	*optr++ = '"';
+	for (ptr = ident; *ptr; ptr++)
+	{
+		if (*ptr == '"')
+			*optr++ = '"';
+		*optr++ = *ptr;
+	}
+	*optr++ = '"';
+	*optr = '\0';
+	str->len = optr - str->data;
+}
+
 /*
  * Append a SQL string literal representing "val" to buf.
  *
@@ -233,7 +293,7 @@ static void deparseAnyName(StringInfo str, List *parts)
 	foreach(lc, parts)
 	{
 		Assert(IsA(lfirst(lc), String));
-		appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+		appendIdentifier(str, strVal(lfirst(lc)));
 		if (lnext(parts, lc))
 			appendStringInfoChar(str, '.');
 	}
@@ -245,7 +305,7 @@ static void deparseAnyNameSkipFirst(StringInfo str, List *parts)
 	for_each_from(lc, parts, 1)
 	{
 		Assert(IsA(lfirst(lc), String));
-		appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+		appendIdentifier(str, strVal(lfirst(lc)));
 		if (lnext(parts, lc))
 			appendStringInfoChar(str, '.');
 	}
@@ -258,7 +318,7 @@ static void deparseAnyNameSkipLast(StringInfo str, List *parts)
 	{
 		if (lnext(parts, lc))
 		{
-			appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+			appendIdentifier(str, strVal(lfirst(lc)));
 			if (foreach_current_index(lc) < list_length(parts) - 2)
 				appendStringInfoChar(str, '.');
 		}
@@ -486,7 +546,7 @@ static void deparseExprList(StringInfo str, List *exprs)
 // "ColId", "name", "database_name", "access_method" and "index_name" in gram.y
 static void deparseColId(StringInfo str, char *s)
 {
-	appendStringInfoString(str, quote_identifier(s));
+	appendIdentifier(str, s);
 }
 
 // "ColLabel", "attr_name"
@@ -495,7 +555,7 @@ static void deparseColId(StringInfo str, char *s)
 // specific on how to handle keywords here
 static void deparseColLabel(StringInfo str, char *s)
 {
-	appendStringInfoString(str, quote_identifier(s));
+	appendIdentifier(str, s);
 }
 
 // "SignedIconst" and "Iconst" in gram.y
@@ -707,7 +767,7 @@ static void deparseAnyOperator(StringInfo str, List *op)
 	Assert(isOp(strVal(llast(op))));
 	if (list_length(op) == 2)
 	{
-		appendStringInfoString(str, quote_identifier(strVal(linitial(op))));
+		appendIdentifier(str, strVal(linitial(op)));
 		appendStringInfoChar(str, '.');
 		appendStringInfoString(str, strVal(llast(op)));
 	}
@@ -837,7 +897,7 @@ static void deparseDefinition(StringInfo str, List *options)
 	foreach (lc, options)
 	{
 		DefElem *def_elem = castNode(DefElem, lfirst(lc));
-		appendStringInfoString(str, quote_identifier(def_elem->defname));
+		appendIdentifier(str, def_elem->defname);
 		if (def_elem->arg != NULL) {
 			appendStringInfoString(str, " = ");
 			deparseDefArg(str, def_elem->arg, false);
@@ -873,7 +933,7 @@ static void deparseCreateGenericOptions(StringInfo str, List *options)
 	foreach(lc, options)
 	{
 		DefElem *def_elem = castNode(DefElem, lfirst(lc));
-		appendStringInfoString(str, quote_identifier(def_elem->defname));
+		appendIdentifier(str, def_elem->defname);
 		appendStringInfoChar(str, ' ');
 		deparseStringLiteral(str, strVal(def_elem->arg));
 		if (lnext(options, lc))
@@ -943,7 +1003,7 @@ static void deparseCommonFuncOptItem(StringInfo str, DefElem *def_elem)
 	else if (strcmp(def_elem->defname, "parallel") == 0)
 	{
 		appendStringInfoString(str, "PARALLEL ");
-		appendStringInfoString(str, quote_identifier(strVal(def_elem->arg)));
+		appendIdentifier(str, strVal(def_elem->arg));
 	}
 	else
 	{
@@ -965,7 +1025,7 @@ static void deparseNonReservedWordOrSconst(StringInfo str, const char *val)
 	else if (strlen(val) >= NAMEDATALEN)
 		deparseStringLiteral(str, val);
 	else
-		appendStringInfoString(str, quote_identifier(val));
+		appendIdentifier(str, val);
 }
 
 // "func_as" in gram.y
@@ -1041,25 +1101,25 @@ static void deparseAlterGenericOptions(StringInfo str, List *options)
 		switch (def_elem->defaction)
 		{
 			case DEFELEM_UNSPEC:
-				appendStringInfoString(str, quote_identifier(def_elem->defname));
+				appendIdentifier(str, def_elem->defname);
 				appendStringInfoChar(str, ' ');
 				deparseStringLiteral(str, strVal(def_elem->arg));
 				break;
 			case DEFELEM_SET:
 				appendStringInfoString(str, "SET ");
-				appendStringInfoString(str, quote_identifier(def_elem->defname));
+				appendIdentifier(str, def_elem->defname);
 				appendStringInfoChar(str, ' ');
 				deparseStringLiteral(str, strVal(def_elem->arg));
 				break;
 			case DEFELEM_ADD:
 				appendStringInfoString(str, "ADD ");
-				appendStringInfoString(str, quote_identifier(def_elem->defname));
+				appendIdentifier(str, def_elem->defname);
 				appendStringInfoChar(str, ' ');
 				deparseStringLiteral(str, strVal(def_elem->arg));
 				break;
 			case DEFELEM_DROP:
 				appendStringInfoString(str, "DROP ");
-				appendStringInfoString(str, quote_identifier(def_elem->defname));
+				appendIdentifier(str, def_elem->defname);
 				break;
 		}
 
@@ -1076,7 +1136,7 @@ static void deparseFuncName(StringInfo str, List *func_name)
 
 	foreach(lc, func_name)
 	{
-		appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+		appendIdentifier(str, strVal(lfirst(lc)));
 		if (lnext(func_name, lc))
 			appendStringInfoChar(str, '.');
 	}
@@ -1220,7 +1280,7 @@ static void deparseColumnList(StringInfo str, List *columns)
 	ListCell *lc = NULL;
 	foreach(lc, columns)
 	{
-		appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+		appendIdentifier(str, strVal(lfirst(lc)));
 		if (lnext(columns, lc))
 			appendStringInfoString(str, ", ");
 	}
@@ -1267,7 +1327,7 @@ static void deparseHandlerName(StringInfo str, List *handler_name)
 
 	foreach(lc, handler_name)
 	{
-		appendStringInfoString(str, quote_identifier(strVal(lfirst(lc))));
+		appendIdentifier(str, strVal(lfirst(lc)));
 		if (lnext(handler_name, lc))
 			appendStringInfoChar(str, '.');
 	}
@@ -1538,11 +1598,11 @@ static void deparseRelOptions(StringInfo str, List *l)
 		DefElem *def_elem = castNode(DefElem, lfirst(lc));
 		if (def_elem->defnamespace != NULL)
 		{
-			appendStringInfoString(str, quote_identifier(def_elem->defnamespace));
+			appendIdentifier(str, def_elem->defnamespace);
 			appendStringInfoChar(str, '.');
 		}
 		if (def_elem->defname != NULL)
-			appendStringInfoString(str, quote_identifier(def_elem->defname));
+			appendIdentifier(str, def_elem->defname);
 		if (def_elem->defname != NULL && def_elem->arg != NULL)
 			appendStringInfoChar(str, '=');
 		if (def_elem->arg != NULL)
@@ -1587,7 +1647,7 @@ static void deparseTargetList(StringInfo str, List *l)
 
 		if (res_target->name != NULL) {
 			appendStringInfoString(str, " AS ");
-			appendStringInfoString(str, quote_identifier(res_target->name));
+			appendIdentifier(str, res_target->name);
 		}
 
 		if (lnext(l, lc))
@@ -1604,7 +1664,7 @@ static void deparseInsertColumnList(StringInfo str, List *l)
 	{
 		ResTarget *res_target = castNode(ResTarget, lfirst(lc));
 		Assert(res_target->name != NULL);
-		appendStringInfoString(str, quote_identifier(res_target->name));
+		appendIdentifier(str, res_target->name);
 		deparseOptIndirection(str, res_target->indirection, 0);
 		if (lnext(l, lc))
 			appendStringInfoString(str, ", ");
@@ -1626,7 +1686,7 @@ static void deparseXmlAttributeList(StringInfo str, List *l)
 		if (res_target->name != NULL)
 		{
 			appendStringInfoString(str, " AS ");
-			appendStringInfoString(str, quote_identifier(res_target->name));
+			appendIdentifier(str, res_target->name);
 		}
 
 		if (lnext(l, lc))
@@ -1652,7 +1712,7 @@ static void deparseXmlNamespaceList(StringInfo str, List *l)
 		if (res_target->name != NULL)
 		{
 			appendStringInfoString(str, " AS ");
-			appendStringInfoString(str, quote_identifier(res_target->name));
+			appendIdentifier(str, res_target->name);
 		}
 
 		if (lnext(l, lc))
@@ -1743,7 +1803,7 @@ static void deparseWhereOrCurrentClause(StringInfo str, Node *node)
 	if (IsA(node, CurrentOfExpr)) {
 		CurrentOfExpr *current_of_expr = castNode(CurrentOfExpr, node);
 		appendStringInfoString(str, "CURRENT OF ");
-		appendStringInfoString(str, quote_identifier(current_of_expr->cursor_name));
+		appendIdentifier(str, current_of_expr->cursor_name);
 	} else {
 		deparseExpr(str, node);
 	}
@@ -2434,7 +2494,7 @@ static void deparseIntoClause(StringInfo str, IntoClause *into_clause)
 	if (into_clause->accessMethod != NULL)
 	{
 		appendStringInfoString(str, "USING ");
-		appendStringInfoString(str, quote_identifier(into_clause->accessMethod));
+		appendIdentifier(str, into_clause->accessMethod);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -2459,7 +2519,7 @@ static void deparseIntoClause(StringInfo str, IntoClause *into_clause)
 	if (into_clause->tableSpaceName != NULL)
 	{
 		appendStringInfoString(str, "TABLESPACE ");
-		appendStringInfoString(str, quote_identifier(into_clause->tableSpaceName));
+		appendIdentifier(str, into_clause->tableSpaceName);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -2473,18 +2533,18 @@ static void deparseRangeVar(StringInfo str, RangeVar *range_var, DeparseNodeCont
 
 	if (range_var->catalogname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(range_var->catalogname));
+		appendIdentifier(str, range_var->catalogname);
 		appendStringInfoChar(str, '.');
 	}
 
 	if (range_var->schemaname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(range_var->schemaname));
+		appendIdentifier(str, range_var->schemaname);
 		appendStringInfoChar(str, '.');
 	}
 
 	Assert(range_var->relname != NULL);
-	appendStringInfoString(str, quote_identifier(range_var->relname));
+	appendIdentifier(str, range_var->relname);
 	appendStringInfoChar(str, ' ');
 
 	if (range_var->alias != NULL)
@@ -2506,9 +2566,90 @@ void deparseRawStmt(StringInfo str, RawStmt *raw_stmt)
 	deparseStmt(str, raw_stmt->stmt);
 }
 
+// Deparses a node on its own, outside of the statement it was taken from
+void deparseNode(StringInfo str, Node *node)
+{
+	ListCell *lc;
+
+	if (node == NULL)
+		elog(ERROR, "deparse error in deparseNode: empty node");
+
+	switch (nodeTag(node))
+	{
+		case T_List:
+			// A target list, or a list of expressions such as a GROUP BY
+			// clause, with nested lists (e.g. the rows of VALUES) in parens
+			foreach(lc, castNode(List, node))
+			{
+				Node *item = lfirst(lc);
+
+				if (IsA(item, List))
+					appendStringInfoChar(str, '(');
+				deparseNode(str, item);
+				if (IsA(item, List))
+					appendStringInfoChar(str, ')');
+				if (lnext(castNode(List, node), lc))
+					appendStringInfoString(str, ", ");
+			}
+			break;
+		case T_ResTarget:
+			deparseTargetList(str, list_make1(node));
+			break;
+		case T_GroupingSet:
+			deparseGroupingSet(str, castNode(GroupingSet, node));
+			break;
+		case T_TypeName:
+			deparseTypeName(str, castNode(TypeName, node));
+			break;
+		case T_RangeVar:
+			deparseRangeVar(str, castNode(RangeVar, node), DEPARSE_NODE_CONTEXT_NONE);
+			break;
+		case T_ColumnRef:
+		case T_A_Const:
+		case T_ParamRef:
+		case T_A_Indirection:
+		case T_CaseExpr:
+		case T_SubLink:
+		case T_A_ArrayExpr:
+		case T_RowExpr:
+		case T_GroupingFunc:
+		case T_TypeCast:
+		case T_CollateClause:
+		case T_A_Expr:
+		case T_BoolExpr:
+		case T_NullTest:
+		case T_BooleanTest:
+		case T_JsonIsPredicate:
+		case T_SetToDefault:
+		case T_MergeSupportFunc:
+		case T_JsonParseExpr:
+		case T_JsonScalarExpr:
+		case T_JsonSerializeExpr:
+		case T_JsonFuncExpr:
+		case T_FuncCall:
+		case T_SQLValueFunction:
+		case T_MinMaxExpr:
+		case T_CoalesceExpr:
+		case T_XmlExpr:
+		case T_XmlSerialize:
+		case T_JsonObjectAgg:
+		case T_JsonArrayAgg:
+		case T_JsonObjectConstructor:
+		case T_JsonArrayConstructor:
+		case T_JsonArrayQueryConstructor:
+			deparseExpr(str, node);
+			break;
+		default:
+			deparseStmt(str, node);
+			break;
+	}
+
+	removeTrailingSpace(str);
+}
+
 static void deparseAlias(StringInfo str, Alias *alias)
 {
-	appendStringInfoString(str, quote_identifier(alias->aliasname));
+	appendIdentifier(str, alias->aliasname);
 
 	if (list_length(alias->colnames) > 0)
 	{
@@ -2858,7 +2999,7 @@ static void deparseWindowDef(StringInfo str, WindowDef* window_def)
 
 	if (window_def->refname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(window_def->refname));
+		appendIdentifier(str, window_def->refname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -3507,7 +3648,7 @@ static void deparseCTESearchClause(StringInfo str, CTESearchClause *search_claus
 		deparseColumnList(str, search_clause->search_col_list);
 
 	appendStringInfoString(str, " SET ");
-	appendStringInfoString(str, quote_identifier(search_clause->search_seq_column));
+	appendIdentifier(str, search_clause->search_seq_column);
 }
 
 static void deparseCTECycleClause(StringInfo str, CTECycleClause *cycle_clause)
@@ -3518,7 +3659,7 @@ static void deparseCTECycleClause(StringInfo str, CTECycleClause *cycle_clause)
 		deparseColumnList(str, cycle_clause->cycle_col_list);
 
 	appendStringInfoString(str, " SET ");
-	appendStringInfoString(str, quote_identifier(cycle_clause->cycle_mark_column));
+	appendIdentifier(str, cycle_clause->cycle_mark_column);
 
 	if (cycle_clause->cycle_mark_value)
 	{
@@ -3533,7 +3674,7 @@ static void deparseCTECycleClause(StringInfo str, CTECycleClause *cycle_clause)
 	}
 	
 	appendStringInfoString(str, " USING ");
-	appendStringInfoString(str, quote_identifier(cycle_clause->cycle_path_column));
+	appendIdentifier(str, cycle_clause->cycle_path_column);
 }
 
 static void deparseCommonTableExpr(StringInfo str, CommonTableExpr *cte)
@@ -4140,7 +4281,7 @@ static void deparseColumnDef(StringInfo str, ColumnDef *column_def)
 
 	if (column_def->colname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(column_def->colname));
+		appendIdentifier(str, column_def->colname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -4275,7 +4416,7 @@ static void deparseInferClause(StringInfo str, InferClause *infer_clause)
 	if (infer_clause->conname != NULL)
 	{
 		appendStringInfoString(str, "ON CONSTRAINT ");
-		appendStringInfoString(str, quote_identifier(infer_clause->conname));
+		appendIdentifier(str, infer_clause->conname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -4594,7 +4735,7 @@ static void deparseCreateOpClassStmt(StringInfo str, CreateOpClassStmt *create_o
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "USING ");
-	appendStringInfoString(str, quote_identifier(create_op_class_stmt->amname));
+	appendIdentifier(str, create_op_class_stmt->amname);
 	appendStringInfoChar(str, ' ');
 
 	if (create_op_class_stmt->opfamilyname != NULL)
@@ -4616,7 +4757,7 @@ static void deparseCreateOpFamilyStmt(StringInfo str, CreateOpFamilyStmt *create
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "USING ");
-	appendStringInfoString(str, quote_identifier(create_op_family_stmt->amname));
+	appendIdentifier(str, create_op_family_stmt->amname);
 }
 
 static void deparseCreateOpClassItem(StringInfo str, CreateOpClassItem *create_op_class_item)
@@ -4782,7 +4923,7 @@ static void deparseConstraint(StringInfo str, Constraint *constraint)
 	if (constraint->conname != NULL)
 	{
 		appendStringInfoString(str, "CONSTRAINT ");
-		appendStringInfoString(str, quote_identifier(constraint->conname));
+		appendIdentifier(str, constraint->conname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -4837,7 +4978,7 @@ static void deparseConstraint(StringInfo str, Constraint *constraint)
 			if (strcmp(constraint->access_method, DEFAULT_INDEX_TYPE) != 0)
 			{
 				appendStringInfoString(str, "USING ");
-				appendStringInfoString(str, quote_identifier(constraint->access_method));
+				appendIdentifier(str, constraint->access_method);
 				appendStringInfoChar(str, ' ');
 			}
 			appendStringInfoChar(str, '(');
@@ -5228,7 +5369,7 @@ static void deparseAlterRoleSetStmt(StringInfo str, AlterRoleSetStmt *alter_role
 	if (alter_role_set_stmt->database != NULL)
 	{
 		appendStringInfoString(str, "IN DATABASE ");
-		appendStringInfoString(str, quote_identifier(alter_role_set_stmt->database));
+		appendIdentifier(str, alter_role_set_stmt->database);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -5260,7 +5401,7 @@ static void deparseRoleSpec(StringInfo str, RoleSpec *role_spec)
 	{
 		case ROLESPEC_CSTRING:
 			Assert(role_spec->rolename != NULL);
-			appendStringInfoString(str, quote_identifier(role_spec->rolename));
+			appendIdentifier(str, role_spec->rolename);
 			break;
 		case ROLESPEC_CURRENT_ROLE:
 			appendStringInfoString(str, "CURRENT_ROLE");
@@ -5467,7 +5608,7 @@ static void deparseCreateStmt(StringInfo str, CreateStmt *create_stmt, bool is_f
 	if (create_stmt->accessMethod != NULL)
 	{
 		appendStringInfoString(str, "USING ");
-		appendStringInfoString(str, quote_identifier(create_stmt->accessMethod));
+		appendIdentifier(str, create_stmt->accessMethod);
 	}
 
 	deparseOptWith(str, create_stmt->options);
@@ -5491,7 +5632,7 @@ static void deparseCreateStmt(StringInfo str, CreateStmt *create_stmt, bool is_f
 	if (create_stmt->tablespacename != NULL)
 	{
 		appendStringInfoString(str, "TABLESPACE ");
-		appendStringInfoString(str, quote_identifier(create_stmt->tablespacename));
+		appendIdentifier(str, create_stmt->tablespacename);
 	}
 
 	removeTrailingSpace(str);
@@ -5502,7 +5643,7 @@ static void deparseCreateFdwStmt(StringInfo str, CreateFdwStmt *create_fdw_stmt)
 	ListCell *lc;
 
 	appendStringInfoString(str, "CREATE FOREIGN DATA WRAPPER ");
-	appendStringInfoString(str, quote_identifier(create_fdw_stmt->fdwname));
+	appendIdentifier(str, create_fdw_stmt->fdwname);
 	appendStringInfoChar(str, ' ');
 
 	if (list_length(create_fdw_stmt->func_options) > 0)
@@ -5519,7 +5660,7 @@ static void deparseCreateFdwStmt(StringInfo str, CreateFdwStmt *create_fdw_stmt)
 static void deparseAlterFdwStmt(StringInfo str, AlterFdwStmt *alter_fdw_stmt)
 {
 	appendStringInfoString(str, "ALTER FOREIGN DATA WRAPPER ");
-	appendStringInfoString(str, quote_identifier(alter_fdw_stmt->fdwname));
+	appendIdentifier(str, alter_fdw_stmt->fdwname);
 	appendStringInfoChar(str, ' ');
 
 	if (list_length(alter_fdw_stmt->func_options) > 0)
@@ -5541,7 +5682,7 @@ static void deparseCreateForeignServerStmt(StringInfo str, CreateForeignServerSt
 	appendStringInfoString(str, "CREATE SERVER ");
 	if (create_foreign_server_stmt->if_not_exists)
 		appendStringInfoString(str, "IF NOT EXISTS ");
-	appendStringInfoString(str, quote_identifier(create_foreign_server_stmt->servername));
+	appendIdentifier(str, create_foreign_server_stmt->servername);
 	appendStringInfoChar(str, ' ');
 
 	if (create_foreign_server_stmt->servertype != NULL)
@@ -5559,7 +5700,7 @@ static void deparseCreateForeignServerStmt(StringInfo str, CreateForeignServerSt
 	}
 
 	appendStringInfoString(str, "FOREIGN DATA WRAPPER ");
-	appendStringInfoString(str, quote_identifier(create_foreign_server_stmt->fdwname));
+	appendIdentifier(str, create_foreign_server_stmt->fdwname);
 	appendStringInfoChar(str, ' ');
 
 	deparseCreateGenericOptions(str, create_foreign_server_stmt->options);
@@ -5571,7 +5712,7 @@ static void deparseAlterForeignServerStmt(StringInfo str, AlterForeignServerStmt
 {
 	appendStringInfoString(str, "ALTER SERVER ");
 
-	appendStringInfoString(str, quote_identifier(alter_foreign_server_stmt->servername));
+	appendIdentifier(str, alter_foreign_server_stmt->servername);
 	appendStringInfoChar(str, ' ');
 
 	if (alter_foreign_server_stmt->has_version)
@@ -5601,7 +5742,7 @@ static void deparseCreateUserMappingStmt(StringInfo str, CreateUserMappingStmt *
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "SERVER ");
-	appendStringInfoString(str, quote_identifier(create_user_mapping_stmt->servername));
+	appendIdentifier(str, create_user_mapping_stmt->servername);
 	appendStringInfoChar(str, ' ');
 
 	deparseCreateGenericOptions(str, create_user_mapping_stmt->options);
@@ -5625,7 +5766,7 @@ static void deparseAlterUserMappingStmt(StringInfo str, AlterUserMappingStmt *al
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "SERVER ");
-	appendStringInfoString(str, quote_identifier(alter_user_mapping_stmt->servername));
+	appendIdentifier(str, alter_user_mapping_stmt->servername);
 	appendStringInfoChar(str, ' ');
 
 	deparseAlterGenericOptions(str, alter_user_mapping_stmt->options);
@@ -5645,7 +5786,7 @@ static void deparseDropUserMappingStmt(StringInfo str, DropUserMappingStmt *drop
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "SERVER ");
-	appendStringInfoString(str, quote_identifier(drop_user_mapping_stmt->servername));
+	appendIdentifier(str, drop_user_mapping_stmt->servername);
 }
 
 static void deparseSecLabelStmt(StringInfo str, SecLabelStmt *sec_label_stmt)
@@ -5657,7 +5798,7 @@ static void deparseSecLabelStmt(StringInfo str, SecLabelStmt *sec_label_stmt)
 	if (sec_label_stmt->provider != NULL)
 	{
 		appendStringInfoString(str, "FOR ");
-		appendStringInfoString(str, quote_identifier(sec_label_stmt->provider));
+		appendIdentifier(str, sec_label_stmt->provider);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -5691,35 +5832,35 @@ static void deparseSecLabelStmt(StringInfo str, SecLabelStmt *sec_label_stmt)
 			break;
 		case OBJECT_DATABASE:
 			appendStringInfoString(str, "DATABASE ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_EVENT_TRIGGER:
 			appendStringInfoString(str, "EVENT TRIGGER ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_LANGUAGE:
 			appendStringInfoString(str, "LANGUAGE ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_PUBLICATION:
 			appendStringInfoString(str, "PUBLICATION ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_ROLE:
 			appendStringInfoString(str, "ROLE ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_SCHEMA:
 			appendStringInfoString(str, "SCHEMA ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_SUBSCRIPTION:
 			appendStringInfoString(str, "SUBSCRIPTION ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_TABLESPACE:
 			appendStringInfoString(str, "TABLESPACE ");
-			appendStringInfoString(str, quote_identifier(strVal(sec_label_stmt->object)));
+			appendIdentifier(str, strVal(sec_label_stmt->object));
 			break;
 		case OBJECT_TYPE:
 			appendStringInfoString(str, "TYPE ");
@@ -5770,7 +5911,7 @@ static void deparseCreateForeignTableStmt(StringInfo str, CreateForeignTableStmt
 	deparseCreateStmt(str, &create_foreign_table_stmt->base, true);
 
 	appendStringInfoString(str, " SERVER ");
-	appendStringInfoString(str, quote_identifier(create_foreign_table_stmt->servername));
+	appendIdentifier(str, create_foreign_table_stmt->servername);
 	appendStringInfoChar(str, ' ');
 
 	if (list_length(create_foreign_table_stmt->options) > 0)
@@ -5804,11 +5945,11 @@ static void deparseImportForeignSchemaStmt(StringInfo str, ImportForeignSchemaSt
 	}
 
 	appendStringInfoString(str, "FROM SERVER ");
-	appendStringInfoString(str, quote_identifier(import_foreign_schema_stmt->server_name));
+	appendIdentifier(str, import_foreign_schema_stmt->server_name);
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "INTO ");
-	appendStringInfoString(str, quote_identifier(import_foreign_schema_stmt->local_schema));
+	appendIdentifier(str, import_foreign_schema_stmt->local_schema);
 	appendStringInfoChar(str, ' ');
 
 	deparseCreateGenericOptions(str, import_foreign_schema_stmt->options);
@@ -6257,7 +6398,7 @@ static void deparseAlterObjectSchemaStmt(StringInfo str, AlterObjectSchemaStmt *
 			break;
 		case OBJECT_EXTENSION:
 			appendStringInfoString(str, "EXTENSION ");
-			appendStringInfoString(str, quote_identifier(strVal(alter_object_schema_stmt->object)));
+			appendIdentifier(str, strVal(alter_object_schema_stmt->object));
 			break;
 		case OBJECT_FUNCTION:
 			appendStringInfoString(str, "FUNCTION ");
@@ -6272,14 +6413,14 @@ static void deparseAlterObjectSchemaStmt(StringInfo str, AlterObjectSchemaStmt *
 			appendStringInfoString(str, "OPERATOR CLASS ");
 			deparseAnyNameSkipFirst(str, l);
 			appendStringInfoString(str, " USING ");
-			appendStringInfoString(str, quote_identifier(strVal(linitial(l))));
+			appendIdentifier(str, strVal(linitial(l)));
 			break;
 		case OBJECT_OPFAMILY:
 			l = castNode(List, alter_object_schema_stmt->object);
 			appendStringInfoString(str, "OPERATOR FAMILY ");
 			deparseAnyNameSkipFirst(str, l);
 			appendStringInfoString(str, " USING ");
-			appendStringInfoString(str, quote_identifier(strVal(linitial(l))));
+			appendIdentifier(str, strVal(linitial(l)));
 			break;
 		case OBJECT_PROCEDURE:
 			appendStringInfoString(str, "PROCEDURE ");
@@ -6349,7 +6490,7 @@ static void deparseAlterObjectSchemaStmt(StringInfo str, AlterObjectSchemaStmt *
 	}
 
 	appendStringInfoString(str, " SET SCHEMA ");
-	appendStringInfoString(str, quote_identifier(alter_object_schema_stmt->newschema));
+	appendIdentifier(str, alter_object_schema_stmt->newschema);
 }
 
 static void deparseAlterTableCmd(StringInfo str, AlterTableCmd *alter_table_cmd, DeparseNodeContext context)
@@ -6605,7 +6746,7 @@ static void deparseAlterTableCmd(StringInfo str, AlterTableCmd *alter_table_cmd,
 
 	if (alter_table_cmd->name != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(alter_table_cmd->name));
+		appendIdentifier(str, alter_table_cmd->name);
 		appendStringInfoChar(str, ' ');
 	} else if (alter_table_cmd->subtype == AT_SetAccessMethod)
 	{
@@ -6840,13 +6981,13 @@ static void deparseAlterDomainStmt(StringInfo str, AlterDomainStmt *alter_domain
 			appendStringInfoString(str, "DROP CONSTRAINT ");
 			if (alter_domain_stmt->missing_ok)
 				appendStringInfoString(str, "IF EXISTS ");
-			appendStringInfoString(str, quote_identifier(alter_domain_stmt->name));
+			appendIdentifier(str, alter_domain_stmt->name);
 			if (alter_domain_stmt->behavior == DROP_CASCADE)
 				appendStringInfoString(str, " CASCADE");
 			break;
 		case 'V':
 			appendStringInfoString(str, "VALIDATE CONSTRAINT ");
-			appendStringInfoString(str, quote_identifier(alter_domain_stmt->name));
+			appendIdentifier(str, alter_domain_stmt->name);
 			break;
 		default:
 			// No other subtypes supported by the parser
@@ -7003,7 +7144,7 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 		case OBJECT_DOMCONSTRAINT:
 			deparseAnyName(str, castNode(List, rename_stmt->object));
 			appendStringInfoString(str, " RENAME CONSTRAINT ");
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoChar(str, ' ');
 			break;
 		case OBJECT_OPCLASS:
@@ -7011,11 +7152,11 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 			l = castNode(List, rename_stmt->object);
 			deparseAnyNameSkipFirst(str, l);
 			appendStringInfoString(str, " USING ");
-			appendStringInfoString(str, quote_identifier(strVal(linitial(l))));
+			appendIdentifier(str, strVal(linitial(l)));
 			appendStringInfoString(str, " RENAME ");
 			break;
 		case OBJECT_POLICY:
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoString(str, " ON ");
 			deparseRangeVar(str, rename_stmt->relation, DEPARSE_NODE_CONTEXT_NONE);
 			appendStringInfoString(str, " RENAME ");
@@ -7042,18 +7183,18 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 		case OBJECT_COLUMN:
 			deparseRangeVar(str, rename_stmt->relation, DEPARSE_NODE_CONTEXT_NONE);
 			appendStringInfoString(str, " RENAME COLUMN ");
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoChar(str, ' ');
 			break;
 		case OBJECT_TABCONSTRAINT:
 			deparseRangeVar(str, rename_stmt->relation, DEPARSE_NODE_CONTEXT_NONE);
 			appendStringInfoString(str, " RENAME CONSTRAINT ");
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoChar(str, ' ');
 			break;
 		case OBJECT_RULE:
 		case OBJECT_TRIGGER:
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoString(str, " ON ");
 			deparseRangeVar(str, rename_stmt->relation, DEPARSE_NODE_CONTEXT_NONE);
 			appendStringInfoString(str, " RENAME ");
@@ -7063,14 +7204,14 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 		case OBJECT_PUBLICATION:
 		case OBJECT_FOREIGN_SERVER:
 		case OBJECT_EVENT_TRIGGER:
-			appendStringInfoString(str, quote_identifier(strVal(rename_stmt->object)));
+			appendIdentifier(str, strVal(rename_stmt->object));
 			appendStringInfoString(str, " RENAME ");
 			break;
 		case OBJECT_DATABASE:
 		case OBJECT_ROLE:
 		case OBJECT_SCHEMA:
 		case OBJECT_TABLESPACE:
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoString(str, " RENAME ");
 			break;
 		case OBJECT_COLLATION:
@@ -7088,7 +7229,7 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 		case OBJECT_ATTRIBUTE:
 			deparseRangeVar(str, rename_stmt->relation, DEPARSE_NODE_CONTEXT_ALTER_TYPE);
 			appendStringInfoString(str, " RENAME ATTRIBUTE ");
-			appendStringInfoString(str, quote_identifier(rename_stmt->subname));
+			appendIdentifier(str, rename_stmt->subname);
 			appendStringInfoChar(str, ' ');
 			break;
 		default:
@@ -7097,7 +7238,7 @@ static void deparseRenameStmt(StringInfo str, RenameStmt *rename_stmt)
 	}
 
 	appendStringInfoString(str, "TO ");
-	appendStringInfoString(str, quote_identifier(rename_stmt->newname));
+	appendIdentifier(str, rename_stmt->newname);
 	appendStringInfoChar(str, ' ');
 
 	deparseOptDropBehavior(str, rename_stmt->behavior);
@@ -7130,16 +7271,16 @@ static void deparseTransactionStmt(StringInfo str, TransactionStmt *transaction_
 			break;
 		case TRANS_STMT_SAVEPOINT:
 			appendStringInfoString(str, "SAVEPOINT ");
-			appendStringInfoString(str, quote_identifier(transaction_stmt->savepoint_name));
+			appendIdentifier(str, transaction_stmt->savepoint_name);
 			break;
 		case TRANS_STMT_RELEASE:
 			appendStringInfoString(str, "RELEASE ");
-			appendStringInfoString(str, quote_identifier(transaction_stmt->savepoint_name));
+			appendIdentifier(str, transaction_stmt->savepoint_name);
 			break;
 		case TRANS_STMT_ROLLBACK_TO:
 			appendStringInfoString(str, "ROLLBACK ");
 			appendStringInfoString(str, "TO SAVEPOINT ");
-			appendStringInfoString(str, quote_identifier(transaction_stmt->savepoint_name));
+			appendIdentifier(str, transaction_stmt->savepoint_name);
 			break;
 		case TRANS_STMT_PREPARE:
 			appendStringInfoString(str, "PREPARE TRANSACTION ");
@@ -7253,7 +7394,7 @@ static void deparseDropdbStmt(StringInfo str, DropdbStmt *dropdb_stmt)
 	if (dropdb_stmt->missing_ok)
 		appendStringInfoString(str, "IF EXISTS ");
 
-	appendStringInfoString(str, quote_identifier(dropdb_stmt->dbname));
+	appendIdentifier(str, dropdb_stmt->dbname);
 	appendStringInfoChar(str, ' ');
 
 	if (list_length(dropdb_stmt->options) > 0)
@@ -7299,7 +7440,7 @@ static void deparseVacuumStmt(StringInfo str, VacuumStmt *vacuum_stmt)
 			appendStringInfoChar(str, '(');
 			foreach(lc2, rel->va_cols)
 			{
-				appendStringInfoString(str, quote_identifier(strVal(lfirst(lc2))));
+				appendIdentifier(str, strVal(lfirst(lc2)));
 				if (lnext(rel->va_cols, lc2))
 					appendStringInfoString(str, ", ");
 			}
@@ -7616,7 +7757,7 @@ static void deparseCopyStmt(StringInfo str, CopyStmt *copy_stmt)
 				}
 				else
 				{
-					appendStringInfoString(str, quote_identifier(def_elem->defname));
+					appendIdentifier(str, def_elem->defname);
 					if (def_elem->arg != NULL)
 						appendStringInfoChar(str, ' ');
 					
@@ -7674,7 +7815,7 @@ static void deparseDoStmt(StringInfo str, DoStmt *do_stmt)
 		if (strcmp(defel->defname, "language") == 0)
 		{
 			appendStringInfoString(str, "LANGUAGE ");
-			appendStringInfoString(str, quote_identifier(strVal(defel->arg)));
+			appendIdentifier(str, strVal(defel->arg));
 			appendStringInfoChar(str, ' ');
 		}
 		else if (strcmp(defel->defname, "as") == 0)
@@ -8090,7 +8231,7 @@ static void deparseAccessPriv(StringInfo str, AccessPriv *access_priv)
 		else if (strcmp(access_priv->priv_name, "create") == 0)
 			appendStringInfoString(str, "create");
 		else
-			appendStringInfoString(str, quote_identifier(access_priv->priv_name));
+			appendIdentifier(str, access_priv->priv_name);
 	}
 	else
 	{
@@ -8276,7 +8417,7 @@ static void deparseIndexStmt(StringInfo str, IndexStmt *index_stmt)
 
 	if (index_stmt->idxname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(index_stmt->idxname));
+		appendIdentifier(str, index_stmt->idxname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -8287,7 +8428,7 @@ static void deparseIndexStmt(StringInfo str, IndexStmt *index_stmt)
 	if (index_stmt->accessMethod != NULL)
 	{
 		appendStringInfoString(str, "USING ");
-		appendStringInfoString(str, quote_identifier(index_stmt->accessMethod));
+		appendIdentifier(str, index_stmt->accessMethod);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -8322,7 +8463,7 @@ static void deparseIndexStmt(StringInfo str, IndexStmt *index_stmt)
 	if (index_stmt->tableSpace != NULL)
 	{
 		appendStringInfoString(str, "TABLESPACE ");
-		appendStringInfoString(str, quote_identifier(index_stmt->tableSpace));
+		appendIdentifier(str, index_stmt->tableSpace);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -8338,7 +8479,7 @@ static void deparseAlterOpFamilyStmt(StringInfo str, AlterOpFamilyStmt *alter_op
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "USING ");
-	appendStringInfoString(str, quote_identifier(alter_op_family_stmt->amname));
+	appendIdentifier(str, alter_op_family_stmt->amname);
 	appendStringInfoChar(str, ' ');
 
 	if (alter_op_family_stmt->isDrop)
@@ -8370,7 +8511,7 @@ static void deparseExecuteStmt(StringInfo str, ExecuteStmt *execute_stmt)
 	ListCell *lc;
 
 	appendStringInfoString(str, "EXECUTE ");
-	appendStringInfoString(str, quote_identifier(execute_stmt->name));
+	appendIdentifier(str, execute_stmt->name);
 	if (list_length(execute_stmt->params) > 0)
 	{
 		appendStringInfoChar(str, '(');
@@ -8383,7 +8524,7 @@ static void deparseDeallocateStmt(StringInfo str, DeallocateStmt *deallocate_stm
 {
 	appendStringInfoString(str, "DEALLOCATE ");
 	if (deallocate_stmt->name != NULL)
-		appendStringInfoString(str, quote_identifier(deallocate_stmt->name));
+		appendIdentifier(str, deallocate_stmt->name);
 	else
 		appendStringInfoString(str, "ALL");
 }
@@ -8564,7 +8705,7 @@ static void deparseCreateRoleStmt(StringInfo str, CreateRoleStmt *create_role_st
 			break;
 	}
 
-	appendStringInfoString(str, quote_identifier(create_role_stmt->role));
+	appendIdentifier(str, create_role_stmt->role);
 	appendStringInfoChar(str, ' ');
 
 	if (create_role_stmt->options != NULL)
@@ -8627,7 +8768,7 @@ static void deparseAlterRoleStmt(StringInfo str, AlterRoleStmt *alter_role_stmt)
 static void deparseDeclareCursorStmt(StringInfo str, DeclareCursorStmt *declare_cursor_stmt)
 {
 	appendStringInfoString(str, "DECLARE ");
-	appendStringInfoString(str, quote_identifier(declare_cursor_stmt->portalname));
+	appendIdentifier(str, declare_cursor_stmt->portalname);
 	appendStringInfoChar(str, ' ');
 
 	if (declare_cursor_stmt->options & CURSOR_OPT_BINARY)
@@ -8707,7 +8848,7 @@ static void deparseFetchStmt(StringInfo str, FetchStmt *fetch_stmt)
 			appendStringInfo(str, "RELATIVE %ld ", fetch_stmt->howMany);
 	}
 
-	appendStringInfoString(str, quote_identifier(fetch_stmt->portalname));
+	appendIdentifier(str, fetch_stmt->portalname);
 }
 
 static void deparseAlterDefaultPrivilegesStmt(StringInfo str, AlterDefaultPrivilegesStmt *alter_default_privileges_stmt)
@@ -8772,7 +8913,7 @@ static void deparseReindexStmt(StringInfo str, ReindexStmt *reindex_stmt)
 	}
 	else if (reindex_stmt->name != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(reindex_stmt->name));
+		appendIdentifier(str, reindex_stmt->name);
 	}
 }
 
@@ -8786,7 +8927,7 @@ static void deparseRuleStmt(StringInfo str, RuleStmt* rule_stmt)
 		appendStringInfoString(str, "OR REPLACE ");
 
 	appendStringInfoString(str, "RULE ");
-	appendStringInfoString(str, quote_identifier(rule_stmt->rulename));
+	appendIdentifier(str, rule_stmt->rulename);
 	appendStringInfoString(str, " AS ON ");
 
 	switch (rule_stmt->event)
@@ -8849,7 +8990,7 @@ static void deparseRuleStmt(StringInfo str, RuleStmt* rule_stmt)
 static void deparseNotifyStmt(StringInfo str, NotifyStmt *notify_stmt)
 {
 	appendStringInfoString(str, "NOTIFY ");
-	appendStringInfoString(str, quote_identifier(notify_stmt->conditionname));
+	appendIdentifier(str, notify_stmt->conditionname);
 
 	if (notify_stmt->payload != NULL)
 	{
@@ -8861,7 +9002,7 @@ static void deparseNotifyStmt(StringInfo str, NotifyStmt *notify_stmt)
 static void deparseListenStmt(StringInfo str, ListenStmt *listen_stmt)
 {
 	appendStringInfoString(str, "LISTEN ");
-	appendStringInfoString(str, quote_identifier(listen_stmt->conditionname));
+	appendIdentifier(str, listen_stmt->conditionname);
 }
 
 static void deparseUnlistenStmt(StringInfo str, UnlistenStmt *unlisten_stmt)
@@ -8870,7 +9011,7 @@ static void deparseUnlistenStmt(StringInfo str, UnlistenStmt *unlisten_stmt)
 	if (unlisten_stmt->conditionname == NULL)
 		appendStringInfoString(str, "*");
 	else
-		appendStringInfoString(str, quote_identifier(unlisten_stmt->conditionname));
+		appendIdentifier(str, unlisten_stmt->conditionname);
 }
 
 static void deparseCreateSeqStmt(StringInfo str, CreateSeqStmt *create_seq_stmt)
@@ -8949,11 +9090,11 @@ static void deparseCreateEventTrigStmt(StringInfo str, CreateEventTrigStmt *crea
 	ListCell *lc2 = NULL;
 
 	appendStringInfoString(str, "CREATE EVENT TRIGGER ");
-	appendStringInfoString(str, quote_identifier(create_event_trig_stmt->trigname));
+	appendIdentifier(str, create_event_trig_stmt->trigname);
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "ON ");
-	appendStringInfoString(str, quote_identifier(create_event_trig_stmt->eventname));
+	appendIdentifier(str, create_event_trig_stmt->eventname);
 	appendStringInfoChar(str, ' ');
 
 	if (create_event_trig_stmt->whenclause)
@@ -8964,7 +9105,7 @@ static void deparseCreateEventTrigStmt(StringInfo str, CreateEventTrigStmt *crea
 		{
 			DefElem *def_elem = castNode(DefElem, lfirst(lc));
 			List *l = castNode(List, def_elem->arg);
-			appendStringInfoString(str, quote_identifier(def_elem->defname));
+			appendIdentifier(str, def_elem->defname);
 			appendStringInfoString(str, " IN (");
 			foreach (lc2, l)
 			{
@@ -8988,7 +9129,7 @@ static void deparseCreateEventTrigStmt(StringInfo str, CreateEventTrigStmt *crea
 static void deparseAlterEventTrigStmt(StringInfo str, AlterEventTrigStmt *alter_event_trig_stmt)
 {
 	appendStringInfoString(str, "ALTER EVENT TRIGGER ");
-	appendStringInfoString(str, quote_identifier(alter_event_trig_stmt->trigname));
+	appendIdentifier(str, alter_event_trig_stmt->trigname);
 	appendStringInfoChar(str, ' ');
 
 	switch (alter_event_trig_stmt->tgenabled)
@@ -9040,7 +9181,7 @@ static void deparseReplicaIdentityStmt(StringInfo str, ReplicaIdentityStmt *repl
 		case REPLICA_IDENTITY_INDEX:
 			Assert(replica_identity_stmt->name != NULL);
 			appendStringInfoString(str, "USING INDEX ");
-			appendStringInfoString(str, quote_identifier(replica_identity_stmt->name));
+			appendIdentifier(str, replica_identity_stmt->name);
 			break;
 	}
 }
@@ -9093,7 +9234,7 @@ static void deparseCreatePolicyStmt(StringInfo str, CreatePolicyStmt *create_pol
 static void deparseAlterPolicyStmt(StringInfo str, AlterPolicyStmt *alter_policy_stmt)
 {
 	appendStringInfoString(str, "ALTER POLICY ");
-	appendStringInfoString(str, quote_identifier(alter_policy_stmt->policy_name));
+	appendIdentifier(str, alter_policy_stmt->policy_name);
 	appendStringInfoString(str, " ON ");
 	deparseRangeVar(str, alter_policy_stmt->table, DEPARSE_NODE_CONTEXT_NONE);
 	appendStringInfoChar(str, ' ');
@@ -9158,7 +9299,7 @@ static void deparseCreateTransformStmt(StringInfo str, CreateTransformStmt *crea
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "LANGUAGE ");
-	appendStringInfoString(str, quote_identifier(create_transform_stmt->lang));
+	appendIdentifier(str, create_transform_stmt->lang);
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoChar(str, '(');
@@ -9184,7 +9325,7 @@ static void deparseCreateTransformStmt(StringInfo str, CreateTransformStmt *crea
 static void deparseCreateAmStmt(StringInfo str, CreateAmStmt *create_am_stmt)
 {
 	appendStringInfoString(str, "CREATE ACCESS METHOD ");
-	appendStringInfoString(str, quote_identifier(create_am_stmt->amname));
+	appendIdentifier(str, create_am_stmt->amname);
 	appendStringInfoChar(str, ' ');
 
 	appendStringInfoString(str, "TYPE ");
@@ -9229,7 +9370,7 @@ static void deparsePublicationObjectList(StringInfo str, List *pubobjects) {
 				break;
 			case PUBLICATIONOBJ_TABLES_IN_SCHEMA:
 				appendStringInfoString(str, "TABLES IN SCHEMA ");
-				appendStringInfoString(str, quote_identifier(obj->name));
+				appendIdentifier(str, obj->name);
 				break;
 			case PUBLICATIONOBJ_TABLES_IN_CUR_SCHEMA:
 				appendStringInfoString(str, "TABLES IN SCHEMA CURRENT_SCHEMA");
@@ -9251,7 +9392,7 @@ static void deparseCreatePublicationStmt(StringInfo str, CreatePublicationStmt *
 	ListCell *lc = NULL;
 
 	appendStringInfoString(str, "CREATE PUBLICATION ");
-	appendStringInfoString(str, quote_identifier(create_publication_stmt->pubname));
+	appendIdentifier(str, create_publication_stmt->pubname);
 	appendStringInfoChar(str, ' ');
 
 	if (list_length(create_publication_stmt->pubobjects) > 0)
@@ -9500,7 +9641,7 @@ static void deparseCommentStmt(StringInfo str, CommentStmt *comment_stmt)
 		case OBJECT_FOREIGN_SERVER:
 		case OBJECT_SUBSCRIPTION:
 		case OBJECT_TABLESPACE:
-			appendStringInfoString(str, quote_identifier(strVal(comment_stmt->object)));
+			appendIdentifier(str, strVal(comment_stmt->object));
 			break;
 		case OBJECT_TYPE:
 		case OBJECT_DOMAIN:
@@ -9522,13 +9663,13 @@ static void deparseCommentStmt(StringInfo str, CommentStmt *comment_stmt)
 		case OBJECT_RULE:
 		case OBJECT_TRIGGER:
 			l = castNode(List, comment_stmt->object);
-			appendStringInfoString(str, quote_identifier(strVal(llast(l))));
+			appendIdentifier(str, strVal(llast(l)));
 			appendStringInfoString(str, " ON ");
 			deparseAnyNameSkipLast(str, l);
 			break;
 		case OBJECT_DOMCONSTRAINT:
 			l = castNode(List, comment_stmt->object);
-			appendStringInfoString(str, quote_identifier(strVal(llast(l))));
+			appendIdentifier(str, strVal(llast(l)));
 			appendStringInfoString(str, " ON DOMAIN ");
 			deparseTypeName(str, linitial(l));
 			break;
@@ -9537,14 +9678,14 @@ static void deparseCommentStmt(StringInfo str, CommentStmt *comment_stmt)
 			appendStringInfoString(str, "FOR ");
 			deparseTypeName(str, castNode(TypeName, linitial(l)));
 			appendStringInfoString(str, " LANGUAGE ");
-			appendStringInfoString(str, quote_identifier(strVal(lsecond(l))));
+			appendIdentifier(str, strVal(lsecond(l)));
 			break;
 		case OBJECT_OPCLASS:
 		case OBJECT_OPFAMILY:
 			l = castNode(List, comment_stmt->object);
 			deparseAnyNameSkipFirst(str, l);
 			appendStringInfoString(str, " USING ");
-			appendStringInfoString(str, quote_identifier(strVal(linitial(l))));
+			appendIdentifier(str, strVal(linitial(l)));
 			break;
 		case OBJECT_LARGEOBJECT:
 			deparseValue(str, (union ValUnion *) comment_stmt->object, DEPARSE_NODE_CONTEXT_NONE);
@@ -9724,7 +9865,7 @@ static void deparseVariableShowStmt(StringInfo str, VariableShowStmt *variable_s
 	else if (strcmp(variable_show_stmt->name, "all") == 0)
 		appendStringInfoString(str, "ALL");
 	else
-		appendStringInfoString(str, quote_identifier(variable_show_stmt->name));
+		appendIdentifier(str, variable_show_stmt->name);
 }
 
 static void deparseRangeTableSample(StringInfo str, RangeTableSample *range_table_sample)
@@ -9753,7 +9894,7 @@ static void deparseCreateSubscriptionStmt(StringInfo str, CreateSubscriptionStmt
 	ListCell *lc;
 
 	appendStringInfoString(str, "CREATE SUBSCRIPTION ");
-	appendStringInfoString(str, quote_identifier(create_subscription_stmt->subname));
+	appendIdentifier(str, create_subscription_stmt->subname);
 
 	appendStringInfoString(str, " CONNECTION ");
 	if (create_subscription_stmt->conninfo != NULL)
@@ -9780,7 +9921,7 @@ static void deparseAlterSubscriptionStmt(StringInfo str, AlterSubscriptionStmt *
 	ListCell *lc;
 
 	appendStringInfoString(str, "ALTER SUBSCRIPTION ");
-	appendStringInfoString(str, quote_identifier(alter_subscription_stmt->subname));
+	appendIdentifier(str, alter_subscription_stmt->subname);
 	appendStringInfoChar(str, ' ');
 
 	switch (alter_subscription_stmt->kind)
@@ -9995,7 +10136,7 @@ static void deparseOperatorDefList(StringInfo str, List *defs)
 	foreach (lc, defs)
 	{
 		DefElem *def_elem = castNode(DefElem, lfirst(lc));
-		appendStringInfoString(str, quote_identifier(def_elem->defname));
+		appendIdentifier(str, def_elem->defname);
 		appendStringInfoString(str, " = ");
 		if (def_elem->arg != NULL)
 			deparseDefArg(str, def_elem->arg, true);
@@ -10050,7 +10191,7 @@ static void deparseClosePortalStmt(StringInfo str, ClosePortalStmt *close_portal
 	appendStringInfoString(str, "CLOSE ");
 	if (close_portal_stmt->portalname != NULL)
 	{
-		appendStringInfoString(str, quote_identifier(close_portal_stmt->portalname));
+		appendIdentifier(str, close_portal_stmt->portalname);
 	}
 	else
 	{
@@ -10070,7 +10211,7 @@ static void deparseCreateTrigStmt(StringInfo str, CreateTrigStmt *create_trig_st
 		appendStringInfoString(str, "CONSTRAINT ");
 	appendStringInfoString(str, "TRIGGER ");
 
-	appendStringInfoString(str, quote_identifier(create_trig_stmt->trigname));
+	appendIdentifier(str, create_trig_stmt->trigname);
 	appendStringInfoChar(str, ' ');
 
 	switch (create_trig_stmt->timing)
@@ -10181,7 +10322,7 @@ static void deparseTriggerTransition(StringInfo str, TriggerTransition *trigger_
 	else
 		appendStringInfoString(str, "ROW ");
 
-	appendStringInfoString(str, quote_identifier(trigger_transition->name));
+	appendIdentifier(str, trigger_transition->name);
 }
 
 static void deparseXmlExpr(StringInfo str, XmlExpr* xml_expr)
@@ -10195,7 +10336,7 @@ static void deparseXmlExpr(StringInfo str, XmlExpr* xml_expr)
 			break;
 		case IS_XMLELEMENT: /* XMLELEMENT(name, xml_attributes, args) */
 			appendStringInfoString(str, "xmlelement(name ");
-			appendStringInfoString(str, quote_identifier(xml_expr->name));
+			appendIdentifier(str, xml_expr->name);
 			if (xml_expr->named_args != NULL)
 			{
 				appendStringInfoString(str, ", xmlattributes(");
@@ -10233,7 +10374,7 @@ static void deparseXmlExpr(StringInfo str, XmlExpr* xml_expr)
 			break;
 		case IS_XMLPI: /* XMLPI(name [, args]) */
 			appendStringInfoString(str, "xmlpi(name ");
-			appendStringInfoString(str, quote_identifier(xml_expr->name));
+			appendIdentifier(str, xml_expr->name);
 			if (xml_expr->args != NULL)
 			{
 				appendStringInfoString(str, ", ");
@@ -10271,7 +10412,7 @@ static void deparseXmlExpr(StringInfo str, XmlExpr* xml_expr)
 
 static void deparseRangeTableFuncCol(StringInfo str, RangeTableFuncCol* range_table_func_col)
 {
-	appendStringInfoString(str, quote_identifier(range_table_func_col->colname));
+	appendIdentifier(str, range_table_func_col->colname);
 	appendStringInfoChar(str, ' ');
 
 	if (range_table_func_col->for_ordinality)
@@ -10916,7 +11057,7 @@ static void deparseClusterStmt(StringInfo str, ClusterStmt *cluster_stmt)
 	if (cluster_stmt->indexname != NULL)
 	{
 		appendStringInfoString(str, "USING ");
-		appendStringInfoString(str, quote_identifier(cluster_stmt->indexname));
+		appendIdentifier(str, cluster_stmt->indexname);
 		appendStringInfoChar(str, ' ');
 	}
 
@@ -10941,7 +11082,7 @@ static void deparseValue(StringInfo str, union ValUnion *value, DeparseNodeConte
 			break;
 		case T_String:
 			if (context == DEPARSE_NODE_CONTEXT_IDENTIFIER) {
-				appendStringInfoString(str, quote_identifier(value->sval.sval));
+				appendIdentifier(str, value->sval.sval);
 			} else if (context == DEPARSE_NODE_CONTEXT_CONSTANT) {
 				deparseStringLiteral(str, value->sval.sval);
 			} else {
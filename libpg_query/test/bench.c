@@ -0,0 +1,483 @@
+// Microbenchmarks for the main libpg_query entry points
+//
+// Runs each benchmark over the statements in test/sql/postgres_regress and
+// reports the time and memory spent per input. Run it from the libpg_query
+// directory, usually through "make bench":
+//
+//   test/bench [-s min_seconds] [-t max_threads] [benchmark ...]
+//
+// With -t, every benchmark is additionally run with 1, 2, 4, ... up to
+// max_threads threads, each processing the whole corpus, to show how
+// throughput scales.
+//
+// When built with BENCH_COUNT_ALLOCS (and linked with --wrap for malloc,
+// calloc and realloc, see the Makefile), the calls into the system allocator
+// made by libpg_query are counted as well.
+
+#include <pg_query.h>
+
+#include <dirent.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define REGRESS_DIR "test/sql/postgres_regress/"
+
+typedef struct {
+	char *sql;
+	size_t len;
+	PgQueryProtobufParseResult parse_result;
+} Statement;
+
+typedef struct {
+	char *sql;
+	size_t len;
+} SqlFile;
+
+typedef struct {
+	Statement *stmts;
+	size_t n_stmts;
+	size_t stmt_bytes;
+	SqlFile *files;
+	size_t n_files;
+	size_t file_bytes;
+} Corpus;
+
+static Corpus corpus;
+
+#ifdef BENCH_COUNT_ALLOCS
+static __thread unsigned long long alloc_count = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+	alloc_count++;
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+	alloc_count++;
+	return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	alloc_count++;
+	return __real_realloc(ptr, size);
+}
+#endif
+
+/*
+ * Benchmarks
+ *
+ * Each one processes a single input and frees the result. Most of them take
+ * one statement at a time, split_with_parser takes whole files.
+ */
+
+static void bench_parse_protobuf(size_t i)
+{
+	pg_query_free_protobuf_parse_result(pg_query_parse_protobuf(corpus.stmts[i].sql));
+}
+
+static void bench_fingerprint(size_t i)
+{
+	pg_query_free_fingerprint_result(pg_query_fingerprint(corpus.stmts[i].sql));
+}
+
+static void bench_normalize(size_t i)
+{
+	pg_query_free_normalize_result(pg_query_normalize(corpus.stmts[i].sql));
+}
+
+static void bench_scan(size_t i)
+{
+	pg_query_free_scan_result(pg_query_scan(corpus.stmts[i].sql));
+}
+
+static void bench_split_with_parser(size_t i)
+{
+	pg_query_free_split_result(pg_query_split_with_parser(corpus.files[i].sql));
+}
+
+static void bench_deparse_protobuf(size_t i)
+{
+	pg_query_free_deparse_result(pg_query_deparse_protobuf(corpus.stmts[i].parse_result.parse_tree));
+}
+
+typedef struct {
+	const char *name;
+	void (*run)(size_t i);
+	bool per_file;
+} Benchmark;
+
+static const Benchmark benchmarks[] = {
+	{"parse_protobuf", bench_parse_protobuf, false},
+	{"fingerprint", bench_fingerprint, false},
+	{"normalize", bench_normalize, false},
+	{"scan", bench_scan, false},
+	{"split_with_parser", bench_split_with_parser, true},
+	{"deparse_protobuf", bench_deparse_protobuf, false},
+};
+static const size_t benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+/*
+ * Corpus loading
+ */
+
+static char *read_file(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == NULL)
+		return NULL;
+
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	char *buf = malloc(size + 1);
+	*len = fread(buf, 1, size, f);
+	buf[*len] = '\0';
+	fclose(f);
+
+	return buf;
+}
+
+static int compare_names(const void *a, const void *b)
+{
+	return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+static void add_statements(const char *sql)
+{
+	PgQuerySplitResult split_result = pg_query_split_with_scanner(sql);
+
+	if (split_result.error != NULL)
+	{
+		pg_query_free_split_result(split_result);
+		return;
+	}
+
+	corpus.stmts = realloc(corpus.stmts, (corpus.n_stmts + split_result.n_stmts) * sizeof(Statement));
+
+	for (int i = 0; i < split_result.n_stmts; i++)
+	{
+		Statement *stmt = &corpus.stmts[corpus.n_stmts];
+
+		stmt->len = split_result.stmts[i]->stmt_len;
+		stmt->sql = malloc(stmt->len + 1);
+		memcpy(stmt->sql, sql + split_result.stmts[i]->stmt_location, stmt->len);
+		stmt->sql[stmt->len] = '\0';
+
+		// Only keep statements that parse, the error path isn't what we want to measure
+		stmt->parse_result = pg_query_parse_protobuf(stmt->sql);
+		if (stmt->parse_result.error != NULL)
+		{
+			pg_query_free_protobuf_parse_result(stmt->parse_result);
+			free(stmt->sql);
+			continue;
+		}
+
+		corpus.stmt_bytes += stmt->len;
+		corpus.n_stmts++;
+	}
+
+	pg_query_free_split_result(split_result);
+}
+
+static bool load_corpus(void)
+{
+	DIR *dir = opendir(REGRESS_DIR);
+	if (dir == NULL)
+	{
+		printf("Could not open %s (run this from the libpg_query directory)\n", REGRESS_DIR);
+		return false;
+	}
+
+	char **names = NULL;
+	size_t n_names = 0;
+	struct dirent *entry;
+
+	while ((entry = readdir(dir)) != NULL)
+	{
+		size_t len = strlen(entry->d_name);
+		if (len > 4 && strcmp(entry->d_name + len - 4, ".sql") == 0)
+		{
+			names = realloc(names, (n_names + 1) * sizeof(char *));
+			names[n_names++] = strdup(entry->d_name);
+		}
+	}
+	closedir(dir);
+
+	// Sort so that runs are comparable
+	qsort(names, n_names, sizeof(char *), compare_names);
+
+	corpus.files = malloc(n_names * sizeof(SqlFile));
+
+	for (size_t i = 0; i < n_names; i++)
+	{
+		char path[1024];
+		size_t len;
+		snprintf(path, sizeof(path), "%s%s", REGRESS_DIR, names[i]);
+
+		char *sql = read_file(path, &len);
+		if (sql == NULL)
+			continue;
+
+		// Skip early parts of the file that intentionally test "invalid Unicode escape" errors
+		char *start = strcmp(names[i], "strings.sql") == 0 ? strstr(sql, "-- bytea\n") : NULL;
+		if (start != NULL)
+		{
+			len -= start - sql;
+			memmove(sql, start, len + 1);
+		}
+
+		add_statements(sql);
+
+		// Files that fail to split (e.g. due to parse errors) are only used for their statements
+		PgQuerySplitResult split_result = pg_query_split_with_parser(sql);
+		bool keep_file = split_result.error == NULL;
+		pg_query_free_split_result(split_result);
+
+		if (keep_file)
+		{
+			corpus.files[corpus.n_files].sql = sql;
+			corpus.files[corpus.n_files].len = len;
+			corpus.file_bytes += len;
+			corpus.n_files++;
+		}
+		else
+		{
+			free(sql);
+		}
+		free(names[i]);
+	}
+	free(names);
+
+	return true;
+}
+
+static void free_corpus(void)
+{
+	for (size_t i = 0; i < corpus.n_stmts; i++)
+	{
+		free(corpus.stmts[i].sql);
+		pg_query_free_protobuf_parse_result(corpus.stmts[i].parse_result);
+	}
+	for (size_t i = 0; i < corpus.n_files; i++)
+		free(corpus.files[i].sql);
+
+	free(corpus.stmts);
+	free(corpus.files);
+}
+
+/*
+ * Measurement
+ */
+
+typedef struct {
+	const Benchmark *benchmark;
+	size_t passes;
+
+	// Results
+	double seconds;
+	unsigned long long allocs;
+	unsigned long long blocks;
+	size_t mem_total;
+	size_t mem_max;
+} Run;
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t input_count(const Benchmark *benchmark)
+{
+	return benchmark->per_file ? corpus.n_files : corpus.n_stmts;
+}
+
+static size_t input_bytes(const Benchmark *benchmark)
+{
+	return benchmark->per_file ? corpus.file_bytes : corpus.stmt_bytes;
+}
+
+static void *run_passes(void *arg)
+{
+	Run *run = (Run *) arg;
+	size_t n = input_count(run->benchmark);
+
+#ifdef BENCH_COUNT_ALLOCS
+	unsigned long long allocs_before = alloc_count;
+#endif
+	double start = now();
+
+	for (size_t pass = 0; pass < run->passes; pass++)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			run->benchmark->run(i);
+
+			PgQueryMemoryStats stats = pg_query_last_memory_stats();
+			size_t mem = stats.peak_mem_allocated;
+			run->blocks += stats.n_blocks;
+			run->mem_total += mem;
+			if (mem > run->mem_max)
+				run->mem_max = mem;
+		}
+	}
+
+	run->seconds = now() - start;
+#ifdef BENCH_COUNT_ALLOCS
+	run->allocs = alloc_count - allocs_before;
+#endif
+
+	return NULL;
+}
+
+// Runs the benchmark on this thread for at least min_seconds, and returns
+// the number of passes over the corpus that took
+static size_t run_single(const Benchmark *benchmark, double min_seconds)
+{
+	size_t n = input_count(benchmark);
+	Run warmup = {benchmark, 1};
+	run_passes(&warmup);
+
+	// Estimate the number of passes needed from the warm-up
+	size_t passes = warmup.seconds > 0 ? (size_t) (min_seconds / warmup.seconds) + 1 : 1;
+	Run run = {benchmark, passes};
+	run_passes(&run);
+
+	double inputs = (double) n * passes;
+	char allocs[32] = "n/a";
+#ifdef BENCH_COUNT_ALLOCS
+	snprintf(allocs, sizeof(allocs), "%.1f", run.allocs / inputs);
+#endif
+
+	printf("%-20s %8zu %12.0f %10.2f %12s %12.1f %12zu %12zu\n",
+		   benchmark->name,
+		   n,
+		   run.seconds * 1e9 / inputs,
+		   input_bytes(benchmark) * passes / run.seconds / (1024 * 1024),
+		   allocs,
+		   run.blocks / inputs,
+		   (size_t) (run.mem_total / inputs),
+		   run.mem_max);
+
+	return passes;
+}
+
+static void run_threads(const Benchmark *benchmark, size_t passes, int max_threads)
+{
+	double base_throughput = 0;
+
+	for (int n_threads = 1;; n_threads *= 2)
+	{
+		if (n_threads > max_threads)
+			n_threads = max_threads;
+
+		pthread_t *threads = malloc(n_threads * sizeof(pthread_t));
+		Run *runs = calloc(n_threads, sizeof(Run));
+
+		double start = now();
+		for (int t = 0; t < n_threads; t++)
+		{
+			runs[t].benchmark = benchmark;
+			runs[t].passes = passes;
+			pthread_create(&threads[t], NULL, run_passes, &runs[t]);
+		}
+		for (int t = 0; t < n_threads; t++)
+			pthread_join(threads[t], NULL);
+		double seconds = now() - start;
+
+		double throughput = (double) input_count(benchmark) * passes * n_threads / seconds;
+		if (n_threads == 1)
+			base_throughput = throughput;
+
+		printf("%-20s %8d %14.0f %10.2fx\n", benchmark->name, n_threads, throughput, throughput / base_throughput);
+
+		free(threads);
+		free(runs);
+
+		if (n_threads == max_threads)
+			break;
+	}
+}
+
+static bool selected(const Benchmark *benchmark, int argc, char **argv)
+{
+	if (argc == 0)
+		return true;
+
+	for (int i = 0; i < argc; i++)
+	{
+		if (strcmp(argv[i], benchmark->name) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+int main(int argc, char **argv)
+{
+	double min_seconds = 1.0;
+	int max_threads = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:t:")) != -1)
+	{
+		switch (opt)
+		{
+			case 's':
+				min_seconds = atof(optarg);
+				break;
+			case 't':
+				max_threads = atoi(optarg);
+				break;
+			default:
+				printf("Usage: %s [-s min_seconds] [-t max_threads] [benchmark ...]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	argc -= optind;
+	argv += optind;
+
+	if (!load_corpus())
+		return EXIT_FAILURE;
+
+	printf("Corpus: %zu statements (%zu bytes), %zu files (%zu bytes)\n\n", corpus.n_stmts, corpus.stmt_bytes, corpus.n_files, corpus.file_bytes);
+	printf("%-20s %8s %12s %10s %12s %12s %12s %12s\n", "benchmark", "inputs", "ns/input", "MB/s", "allocs/input", "blocks/input", "avg peak mem", "max peak mem");
+
+	size_t passes[sizeof(benchmarks) / sizeof(benchmarks[0])];
+
+	for (size_t i = 0; i < benchmarkCount; i++)
+	{
+		if (selected(&benchmarks[i], argc, argv))
+			passes[i] = run_single(&benchmarks[i], min_seconds);
+	}
+
+	if (max_threads > 0)
+	{
+		printf("\n%-20s %8s %14s %11s\n", "benchmark", "threads", "inputs/s", "speedup");
+
+		for (size_t i = 0; i < benchmarkCount; i++)
+		{
+			if (selected(&benchmarks[i], argc, argv))
+				run_threads(&benchmarks[i], passes[i], max_threads);
+		}
+	}
+
+	free_corpus();
+	pg_query_exit();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+typedef struct {
+  const char *query;
+  const char *stmt_types; // comma-separated
+  bool read_only;
+  bool parsed;
+} ClassifyTest;
+
+static const ClassifyTest tests[] = {
+  {"SELECT 1", "select_stmt", true, false},
+  {"select * from users where id = 1 /* ; comment */ -- ;", "select_stmt", true, false},
+  {"(SELECT 1) UNION (SELECT 2)", "select_stmt", true, true},
+  {"(WITH d AS (DELETE FROM users RETURNING *) SELECT * FROM d)", "select_stmt", false, true},
+  {"VALUES (1), (2)", "select_stmt", true, false},
+  {"TABLE users", "select_stmt", true, false},
+  {"SELECT * INTO new_users FROM users", "select_stmt", false, false},
+  {"SELECT * FROM users FOR UPDATE", "select_stmt", false, false},
+  {"SELECT * FROM users FOR NO KEY UPDATE SKIP LOCKED", "select_stmt", false, false},
+  {"SELECT 'FOR UPDATE', \"into\" FROM t", "select_stmt", true, false},
+  {"INSERT INTO users (name) VALUES ('a')", "insert_stmt", false, false},
+  {"UPDATE users SET name = 'a'", "update_stmt", false, false},
+  {"DELETE FROM users", "delete_stmt", false, false},
+  {"MERGE INTO t USING s ON t.id = s.id WHEN MATCHED THEN DELETE", "merge_stmt", false, false},
+  {"WITH a AS (SELECT 1), b (x) AS MATERIALIZED (SELECT 2) SELECT * FROM a, b", "select_stmt", true, false},
+  {"WITH RECURSIVE t(n) AS (VALUES (1) UNION ALL SELECT n + 1 FROM t) SELECT n FROM t", "select_stmt", true, false},
+  {"WITH d AS (DELETE FROM users RETURNING *) SELECT * FROM d", "select_stmt", false, false},
+  {"WITH a AS (SELECT 1) INSERT INTO t SELECT * FROM a", "insert_stmt", false, false},
+  {"BEGIN; SELECT 1; COMMIT", "transaction_stmt,select_stmt,transaction_stmt", true, false},
+  {"START TRANSACTION READ ONLY; ROLLBACK", "transaction_stmt,transaction_stmt", true, false},
+  {"PREPARE TRANSACTION 'x'", "transaction_stmt", true, false},
+  {"PREPARE q (int) AS SELECT $1", "prepare_stmt", true, false},
+  {"PREPARE q AS UPDATE t SET a = 1", "prepare_stmt", false, false},
+  {"EXECUTE q (1)", "execute_stmt", false, false},
+  {"DEALLOCATE q", "deallocate_stmt", true, false},
+  {"SHOW search_path", "variable_show_stmt", true, false},
+  {"SET search_path = public; RESET ALL", "variable_set_stmt,variable_set_stmt", true, false},
+  {"SET CONSTRAINTS ALL DEFERRED", "constraints_set_stmt", true, false},
+  {"EXPLAIN SELECT 1", "explain_stmt", true, false},
+  {"EXPLAIN DELETE FROM users", "explain_stmt", true, false},
+  {"EXPLAIN ANALYZE DELETE FROM users", "explain_stmt", false, false},
+  {"EXPLAIN (ANALYZE, BUFFERS) SELECT 1", "explain_stmt", true, false},
+  {"EXPLAIN (ANALYZE) UPDATE t SET a = 1", "explain_stmt", false, false},
+  {"COPY users TO STDOUT", "copy_stmt", true, false},
+  {"COPY (SELECT * FROM users) TO STDOUT", "copy_stmt", true, false},
+  {"COPY users FROM STDIN", "copy_stmt", false, false},
+  {"DECLARE c CURSOR FOR SELECT 1; FETCH 10 c; MOVE c; CLOSE c", "declare_cursor_stmt,fetch_stmt,fetch_stmt,close_portal_stmt", true, false},
+  {"DECLARE c CURSOR FOR SELECT * FROM t FOR UPDATE", "declare_cursor_stmt", false, false},
+  {"LISTEN ch; NOTIFY ch; UNLISTEN ch", "listen_stmt,notify_stmt,unlisten_stmt", false, false},
+  {"DISCARD ALL", "discard_stmt", true, false},
+  {"DO $$ BEGIN PERFORM 1; END $$", "do_stmt", false, false},
+  {"CALL p()", "call_stmt", false, false},
+  {"TRUNCATE users", "truncate_stmt", false, false},
+  {"VACUUM users; ANALYZE users", "vacuum_stmt,vacuum_stmt", false, false},
+  {"LOCK TABLE users", "lock_stmt", false, false},
+  {"GRANT SELECT ON users TO bob; GRANT admins TO bob", "grant_stmt,grant_role_stmt", false, false},
+  {"CREATE TABLE t (a int, b text CHECK (b <> ''))", "create_stmt", false, false},
+  {"CREATE TEMP TABLE t AS SELECT 1", "create_table_as_stmt", false, false},
+  {"CREATE UNIQUE INDEX i ON t (a)", "index_stmt", false, false},
+  {"CREATE OR REPLACE VIEW v AS SELECT 1", "view_stmt", false, false},
+  {"CREATE MATERIALIZED VIEW v AS SELECT 1", "create_table_as_stmt", false, false},
+  {"CREATE FUNCTION f() RETURNS int AS $$ SELECT 1; $$ LANGUAGE sql", "create_function_stmt", false, false},
+  {"CREATE SCHEMA s; CREATE SEQUENCE s.seq", "create_schema_stmt,create_seq_stmt", false, false},
+  {"DROP TABLE t; DROP DATABASE d; DROP USER MAPPING FOR bob SERVER s", "drop_stmt,dropdb_stmt,drop_user_mapping_stmt", false, false},
+  {"ALTER TABLE ONLY public.t ADD COLUMN c int", "alter_table_stmt", false, false},
+  {"ALTER TABLE t RENAME TO u", "rename_stmt", false, false},
+  {"ALTER TABLE IF EXISTS t SET SCHEMA s", "alter_object_schema_stmt", false, false},
+  {";;SELECT 1;;", "select_stmt", true, false},
+  {"", "", true, false},
+  // Left to the parser
+  {"ALTER INDEX i RENAME TO j", "rename_stmt", false, true},
+  {"CREATE TYPE mood AS ENUM ('sad', 'ok')", "create_enum_stmt", false, true},
+  {"SELECT 1; CREATE DOMAIN d AS int", "select_stmt,create_domain_stmt", false, true},
+  {"SELECT 1; WITH t AS (SELECT 1) SEARCH DEPTH FIRST BY a SET o SELECT 1", "select_stmt,select_stmt", true, true},
+  {"SELECT * FROM t FOR SHARE; WITH t AS (SELECT 1) SEARCH DEPTH FIRST BY a SET o SELECT 1", "select_stmt,select_stmt", false, true},
+  {"CREATE FUNCTION f() RETURNS int BEGIN ATOMIC SELECT 1; SELECT 2; END; SELECT 3", "create_function_stmt,select_stmt", false, true},
+  {"WITH t AS (SELECT 1) SEARCH DEPTH FIRST BY a SET o SELECT 1", "select_stmt", true, true},
+};
+
+static const size_t testsLength = sizeof(tests) / sizeof(tests[0]);
+
+static void print_types(PgQueryClassifyResult result, char *buf) {
+  int i;
+
+  buf[0] = '\0';
+  for (i = 0; i < result.n_stmts; i++) {
+    if (i > 0)
+      strcat(buf, ",");
+    strcat(buf, result.stmts[i].stmt_type);
+  }
+}
+
+int main() {
+  bool ret_code = EXIT_SUCCESS;
+  char types[1024];
+  size_t i;
+
+  for (i = 0; i < testsLength; i++) {
+    PgQueryClassifyResult result = pg_query_classify(tests[i].query);
+    bool read_only = true;
+    int j;
+
+    if (result.error) {
+      ret_code = EXIT_FAILURE;
+      printf("%s\n", result.error->message);
+      pg_query_free_classify_result(result);
+      continue;
+    }
+
+    for (j = 0; j < result.n_stmts; j++)
+      read_only &= result.stmts[j].read_only;
+
+    print_types(result, types);
+
+    if (strcmp(types, tests[i].stmt_types) != 0 || read_only != tests[i].read_only || result.parsed != tests[i].parsed) {
+      ret_code = EXIT_FAILURE;
+      printf("INVALID result for \"%s\"\nexpected: %s read_only=%d parsed=%d\nactual:   %s read_only=%d parsed=%d\n",
+             tests[i].query, tests[i].stmt_types, tests[i].read_only, tests[i].parsed,
+             types, read_only, result.parsed);
+    } else {
+      printf(".");
+    }
+
+    pg_query_free_classify_result(result);
+  }
+
+  PgQueryClassifyResult result = pg_query_classify("SELECT 'unterminated");
+  if (result.error == NULL || strcmp(result.error->message, "unterminated quoted string at or near \"'unterminated\"") != 0) {
+    ret_code = EXIT_FAILURE;
+    printf("INVALID result for unterminated string: %s\n", result.error ? result.error->message : "no error");
+  } else {
+    printf(".");
+  }
+  pg_query_free_classify_result(result);
+
+  result = pg_query_classify("(SELECT 1");
+  if (result.error == NULL || !result.parsed) {
+    ret_code = EXIT_FAILURE;
+    printf("INVALID result for unbalanced parentheses\n");
+  } else {
+    printf(".");
+  }
+  pg_query_free_classify_result(result);
+
+  result = pg_query_classify("SELEC 1");
+  if (result.error == NULL || !result.parsed) {
+    ret_code = EXIT_FAILURE;
+    printf("INVALID result for syntax error\n");
+  } else {
+    printf(".");
+  }
+  pg_query_free_classify_result(result);
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ret_code;
+}
@@ -0,0 +1,110 @@
+#include <pg_query.h>
+#include "protobuf/pg_query.pb-c.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Each test parses the query with PG_QUERY_COLLAPSE_LISTS(2) and looks for
+// expected in the JSON parse tree, or checks that nothing was collapsed if
+// expected is NULL
+typedef struct {
+  const char *query;
+  const char *expected;
+} CollapseListsTest;
+
+static const CollapseListsTest tests[] = {
+  {"SELECT * FROM t WHERE id IN (1, -2, 'x', -(3) )", "\"rexpr\":{\"List\":{\"items\":[{\"IntList\":{\"items\":[4,29,16]}}]}}"},
+  {"SELECT * FROM t WHERE id NOT IN (1, 2, 3) AND a = ANY(ARRAY[1, 2, 3])", "\"elements\":[{\"IntList\":{\"items\":[3,60,7]}}]"},
+  {"INSERT INTO t VALUES (1, 'a'), (2, 'b'), (3, U&'c' )", "\"valuesLists\":[{\"List\":{\"items\":[{\"IntList\":{\"items\":[3,22,28]}}]}}]"},
+  {"SELECT * FROM t WHERE id IN (SELECT id FROM s WHERE x IN (1, 2, 3))", "\"IntList\":{\"items\":[3,58,7]}"},
+  {"SELECT * FROM t WHERE id IN (1, 2)", NULL},
+  {"SELECT * FROM t WHERE id IN (1, b, 3)", NULL},
+  {"SELECT * FROM t WHERE id IN (1, 2, 3::int)", NULL},
+  {"INSERT INTO t VALUES (1), (2), (DEFAULT)", NULL},
+  {"SELECT greatest(1, 2, 3)", NULL},
+};
+
+static bool run_test(const CollapseListsTest *test)
+{
+  PgQueryParseResult result = pg_query_parse_opts(test->query, PG_QUERY_COLLAPSE_LISTS(2));
+  PgQueryFingerprintResult fingerprint = pg_query_fingerprint(test->query);
+  PgQueryFingerprintResult collapsed_fingerprint = pg_query_fingerprint_opts(test->query, PG_QUERY_COLLAPSE_LISTS(2));
+  bool ok = true;
+
+  if (result.error) {
+    printf("\nERROR for \"%s\"\n  %s\n", test->query, result.error->message);
+    ok = false;
+  } else if (test->expected != NULL ? strstr(result.parse_tree, test->expected) == NULL : strstr(result.parse_tree, "IntList") != NULL) {
+    printf("\nINVALID result for \"%s\"\nexpected: %s\nactual: %s\n", test->query, test->expected ? test->expected : "(no IntList)", result.parse_tree);
+    ok = false;
+  } else if (fingerprint.error || collapsed_fingerprint.error || fingerprint.fingerprint != collapsed_fingerprint.fingerprint) {
+    printf("\nINVALID fingerprint for \"%s\"\n", test->query);
+    ok = false;
+  } else {
+    printf(".");
+  }
+
+  pg_query_free_parse_result(result);
+  pg_query_free_fingerprint_result(fingerprint);
+  pg_query_free_fingerprint_result(collapsed_fingerprint);
+
+  return ok;
+}
+
+// The IntList is written as a list of Integer nodes to protobuf, which can't
+// be deparsed
+static bool test_protobuf()
+{
+  const char *query = "SELECT * FROM t WHERE id IN (1, 2, 3)";
+  PgQueryProtobufParseResult result = pg_query_parse_protobuf_opts(query, PG_QUERY_COLLAPSE_LISTS(2));
+  PgQuery__ParseResult *msg;
+  PgQuery__IntList *int_list;
+  PgQueryDeparseResult deparse_result;
+  bool ok;
+
+  if (result.error) {
+    printf("\nERROR for \"%s\"\n  %s\n", query, result.error->message);
+    pg_query_free_protobuf_parse_result(result);
+    return false;
+  }
+
+  msg = pg_query__parse_result__unpack(NULL, result.parse_tree.len, (const uint8_t *) result.parse_tree.data);
+  int_list = msg->stmts[0]->stmt->select_stmt->where_clause->a_expr->rexpr->list->items[0]->int_list;
+  ok = int_list != NULL && int_list->n_items == 3 &&
+    int_list->items[0]->integer->ival == 3 &&
+    int_list->items[1]->integer->ival == 29 &&
+    int_list->items[2]->integer->ival == 7;
+  pg_query__parse_result__free_unpacked(msg, NULL);
+
+  deparse_result = pg_query_deparse_protobuf(result.parse_tree);
+  ok = ok && deparse_result.error != NULL;
+  pg_query_free_deparse_result(deparse_result);
+  pg_query_free_protobuf_parse_result(result);
+
+  if (ok)
+    printf(".");
+  else
+    printf("\nINVALID protobuf result for \"%s\"\n", query);
+
+  return ok;
+}
+
+int main() {
+  bool ret_code = EXIT_SUCCESS;
+  size_t i;
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+    if (!run_test(&tests[i]))
+      ret_code = EXIT_FAILURE;
+
+  if (!test_protobuf())
+    ret_code = EXIT_FAILURE;
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ret_code;
+}
@@ -0,0 +1,160 @@
+#include <pg_query.h>
+#include "protobuf/pg_query.pb-c.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Each test picks a node out of the first statement of the query, deparses
+// it on its own and compares the result
+typedef enum {
+  PICK_STMT,
+  PICK_WHERE_CLAUSE,
+  PICK_TARGET_LIST,
+  PICK_FIRST_TARGET,
+  PICK_GROUP_CLAUSE,
+  PICK_VALUES_LISTS,
+  PICK_FROM_RELATION,
+  PICK_CAST_TYPE
+} Pick;
+
+typedef struct {
+  const char *query;
+  Pick pick;
+  const char *expected;
+} DeparseNodeTest;
+
+static const DeparseNodeTest tests[] = {
+  {"SELECT * FROM users WHERE id = 1", PICK_STMT, "SELECT * FROM users WHERE id = 1"},
+  {"INSERT INTO t (a) VALUES (1) RETURNING *", PICK_STMT, "INSERT INTO t (a) VALUES (1) RETURNING *"},
+  {"SELECT 1 WHERE a = 1 AND (b OR c IS NULL)", PICK_WHERE_CLAUSE, "a = 1 AND (b OR c IS NULL)"},
+  {"SELECT 1 WHERE x IN (SELECT y FROM t)", PICK_WHERE_CLAUSE, "x IN (SELECT y FROM t)"},
+  {"SELECT a, b + 1 AS c, count(*) FROM t", PICK_TARGET_LIST, "a, b + 1 AS c, count(*)"},
+  {"SELECT lower(\"Name\") AS n FROM t", PICK_FIRST_TARGET, "lower(\"Name\") AS n"},
+  {"SELECT a, b FROM t GROUP BY a, ROLLUP (b, c)", PICK_GROUP_CLAUSE, "a, ROLLUP (b, c)"},
+  {"VALUES (1, 'a'), (2, 'b')", PICK_VALUES_LISTS, "(1, 'a'), (2, 'b')"},
+  {"SELECT * FROM public.users u", PICK_FROM_RELATION, "public.users u"},
+  {"SELECT * FROM ONLY users", PICK_FROM_RELATION, "ONLY users"},
+  {"SELECT x::varchar(10)[]", PICK_CAST_TYPE, "varchar(10)[]"},
+  {"SELECT x::timestamp with time zone", PICK_CAST_TYPE, "timestamp with time zone"},
+};
+
+static PgQuery__Node *pick_node(PgQuery__Node *stmt, Pick pick, PgQuery__Node *list_node, PgQuery__List *list)
+{
+	PgQuery__SelectStmt *select = stmt->select_stmt;
+
+	switch (pick)
+	{
+		case PICK_STMT:
+			return stmt;
+		case PICK_WHERE_CLAUSE:
+			return select->where_clause;
+		case PICK_TARGET_LIST:
+			list->n_items = select->n_target_list;
+			list->items = select->target_list;
+			return list_node;
+		case PICK_FIRST_TARGET:
+			return select->target_list[0];
+		case PICK_GROUP_CLAUSE:
+			list->n_items = select->n_group_clause;
+			list->items = select->group_clause;
+			return list_node;
+		case PICK_VALUES_LISTS:
+			list->n_items = select->n_values_lists;
+			list->items = select->values_lists;
+			return list_node;
+		case PICK_FROM_RELATION:
+			return select->from_clause[0];
+		case PICK_CAST_TYPE:
+		{
+			PgQuery__Node *cast = select->target_list[0]->res_target->val;
+			static PgQuery__Node type_node = PG_QUERY__NODE__INIT;
+			type_node.node_case = PG_QUERY__NODE__NODE_TYPE_NAME;
+			type_node.type_name = cast->type_cast->type_name;
+			return &type_node;
+		}
+	}
+
+	return NULL;
+}
+
+static bool run_test(const DeparseNodeTest *test)
+{
+	PgQueryProtobufParseResult parse_result = pg_query_parse_protobuf(test->query);
+	PgQuery__ParseResult *msg;
+	PgQuery__Node list_node = PG_QUERY__NODE__INIT;
+	PgQuery__List list = PG_QUERY__LIST__INIT;
+	PgQuery__Node *node;
+	PgQueryProtobuf protobuf;
+	PgQueryDeparseResult result;
+	bool ok = true;
+
+	if (parse_result.error)
+	{
+		printf("\nERROR for \"%s\"\n  %s\n", test->query, parse_result.error->message);
+		pg_query_free_protobuf_parse_result(parse_result);
+		return false;
+	}
+
+	msg = pg_query__parse_result__unpack(NULL, parse_result.parse_tree.len, (const uint8_t *) parse_result.parse_tree.data);
+	list_node.node_case = PG_QUERY__NODE__NODE_LIST;
+	list_node.list = &list;
+	node = pick_node(msg->stmts[0]->stmt, test->pick, &list_node, &list);
+
+	protobuf.len = pg_query__node__get_packed_size(node);
+	protobuf.data = malloc(protobuf.len);
+	pg_query__node__pack(node, (uint8_t *) protobuf.data);
+
+	result = pg_query_deparse_node_protobuf(protobuf);
+
+	if (result.error)
+	{
+		printf("\nERROR for \"%s\"\n  %s\n", test->query, result.error->message);
+		ok = false;
+	}
+	else if (strcmp(result.query, test->expected) != 0)
+	{
+		printf("\nINVALID result for \"%s\"\nexpected: %s\nactual: %s\n", test->query, test->expected, result.query);
+		ok = false;
+	}
+	else
+	{
+		printf(".");
+	}
+
+	pg_query_free_deparse_result(result);
+	free(protobuf.data);
+	pg_query__parse_result__free_unpacked(msg, NULL);
+	pg_query_free_protobuf_parse_result(parse_result);
+
+	return ok;
+}
+
+int main()
+{
+	size_t i;
+	int ret_code = EXIT_SUCCESS;
+	PgQueryProtobuf invalid = {.len = 3, .data = "\xff\xff\xff"};
+	PgQueryDeparseResult result;
+
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+		if (!run_test(&tests[i]))
+			ret_code = EXIT_FAILURE;
+
+	result = pg_query_deparse_node_protobuf(invalid);
+	if (result.error == NULL || strcmp(result.error->message, "invalid protobuf node") != 0)
+	{
+		printf("\nINVALID result for invalid protobuf\n");
+		ret_code = EXIT_FAILURE;
+	}
+	else
+	{
+		printf(".");
+	}
+	pg_query_free_deparse_result(result);
+
+	printf("\n");
+
+	return ret_code;
+}
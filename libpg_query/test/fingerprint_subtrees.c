@@ -0,0 +1,157 @@
+#include <pg_query.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fingerprint_tests.c"
+
+typedef struct {
+	const char *node_type;
+	int location;
+	int parent;
+} ExpectedSubtree;
+
+static bool check_subtrees(const char *query, const ExpectedSubtree *expected, int n_expected)
+{
+	PgQueryFingerprintSubtreesResult result = pg_query_fingerprint_subtrees(query);
+	bool ok = true;
+
+	if (result.error) {
+		printf("\nERROR for \"%s\": %s\n", query, result.error->message);
+		pg_query_free_fingerprint_subtrees_result(result);
+		return false;
+	}
+
+	if (result.n_subtrees != n_expected) {
+		printf("\nINVALID subtree count for \"%s\"\nexpected: %d\nactual: %d\n", query, n_expected, result.n_subtrees);
+		ok = false;
+	} else {
+		for (int i = 0; i < n_expected; i++) {
+			PgQueryFingerprintSubtree *subtree = &result.subtrees[i];
+			if (strcmp(subtree->node_type, expected[i].node_type) != 0 ||
+				subtree->location != expected[i].location ||
+				subtree->parent != expected[i].parent) {
+				printf("\nINVALID subtree %d for \"%s\"\nexpected: %s at %d (parent %d)\nactual: %s at %d (parent %d)\n",
+					   i, query, expected[i].node_type, expected[i].location, expected[i].parent,
+					   subtree->node_type, subtree->location, subtree->parent);
+				ok = false;
+			}
+		}
+	}
+
+	pg_query_free_fingerprint_subtrees_result(result);
+
+	if (ok)
+		printf(".");
+
+	return ok;
+}
+
+static uint64_t subtree_fingerprint(const char *query, int index)
+{
+	PgQueryFingerprintSubtreesResult result = pg_query_fingerprint_subtrees(query);
+	uint64_t fingerprint = 0;
+
+	if (result.error == NULL && index < result.n_subtrees)
+		fingerprint = result.subtrees[index].fingerprint;
+
+	pg_query_free_fingerprint_subtrees_result(result);
+
+	return fingerprint;
+}
+
+static bool check_same_subtree(const char *query_a, int index_a, const char *query_b, int index_b)
+{
+	uint64_t a = subtree_fingerprint(query_a, index_a);
+	uint64_t b = subtree_fingerprint(query_b, index_b);
+
+	if (a == 0 || a != b) {
+		printf("\nINVALID subtree fingerprint mismatch\n\"%s\" [%d]: %016llx\n\"%s\" [%d]: %016llx\n",
+			   query_a, index_a, (unsigned long long) a, query_b, index_b, (unsigned long long) b);
+		return false;
+	}
+
+	printf(".");
+	return true;
+}
+
+int main()
+{
+	size_t i;
+	bool ret_code = 0;
+
+	// The statement fingerprint must be unaffected by recording subtrees
+	for (i = 0; i < testsLength; i += 2)
+	{
+		PgQueryFingerprintSubtreesResult result = pg_query_fingerprint_subtrees(tests[i]);
+
+		if (result.error)
+		{
+			ret_code = -1;
+			printf("%s\n", result.error->message);
+		}
+		else if (strcmp(result.fingerprint_str, tests[i + 1]) == 0)
+		{
+			printf(".");
+		}
+		else
+		{
+			ret_code = -1;
+			printf("INVALID result for \"%s\"\nexpected: \"%s\"\nactual: \"%s\"\n", tests[i], tests[i + 1], result.fingerprint_str);
+		}
+
+		pg_query_free_fingerprint_subtrees_result(result);
+	}
+
+	ExpectedSubtree range_subselect[] = {
+		{"SelectStmt", 0, -1},
+		{"RangeSubselect", -1, 0},
+		{"SelectStmt", -1, 1},
+	};
+	if (!check_subtrees("SELECT * FROM (SELECT a FROM t) s", range_subselect, 3))
+		ret_code = -1;
+
+	ExpectedSubtree cte_and_sublink[] = {
+		{"SelectStmt", 0, -1},
+		{"SubLink", 45, 0},
+		{"SelectStmt", -1, 1},
+		{"CommonTableExpr", 5, 0},
+		{"SelectStmt", -1, 3},
+	};
+	if (!check_subtrees("WITH x AS (SELECT 1) SELECT * FROM x WHERE y IN (SELECT b FROM t)", cte_and_sublink, 5))
+		ret_code = -1;
+
+	ExpectedSubtree multi_stmt[] = {
+		{"SelectStmt", 0, -1},
+		{"SelectStmt", 9, -1},
+	};
+	if (!check_subtrees("SELECT 1; SELECT 2", multi_stmt, 2))
+		ret_code = -1;
+
+	if (!check_subtrees("UPDATE t SET a = 1", NULL, 0))
+		ret_code = -1;
+
+	// Subtree fingerprints only depend on the subtree itself
+	if (!check_same_subtree("SELECT * FROM (SELECT a FROM t WHERE b = 1) s", 2, "SELECT a FROM t WHERE b = 2", 0))
+		ret_code = -1;
+	if (!check_same_subtree("WITH x AS (SELECT 1) SELECT * FROM x", 1, "WITH x AS (SELECT 2) SELECT * FROM x JOIN z ON true", 1))
+		ret_code = -1;
+	if (!check_same_subtree("SELECT * FROM x WHERE y IN (SELECT b FROM t)", 1, "DELETE FROM z WHERE y IN (SELECT b FROM t)", 0))
+		ret_code = -1;
+
+	// Ensures that there isn't a memory leak in the error case
+	PgQueryFingerprintSubtreesResult result = pg_query_fingerprint_subtrees("SELECT !");
+	if (strcmp(result.error->message, "syntax error at end of input") != 0) {
+		printf("\nERROR mismatch: %s\n", result.error->message);
+		return EXIT_FAILURE;
+	}
+	pg_query_free_fingerprint_subtrees_result(result);
+
+	printf("\n");
+
+	pg_query_exit();
+
+	return ret_code;
+}
@@ -0,0 +1,86 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+static int n_allocs = 0;
+static int n_frees = 0;
+static void *last_alloc = NULL;
+
+static void *test_alloc(size_t size) {
+  n_allocs++;
+  last_alloc = malloc(size);
+  return last_alloc;
+}
+
+static void test_free(void *ptr) {
+  n_frees++;
+  free(ptr);
+}
+
+static bool check(const char *name, bool ok) {
+  if (ok)
+    printf(".");
+  else
+    printf("\n%s: output buffer was not allocated through the output allocator\n", name);
+
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  PgQueryOutputAllocator allocator = {test_alloc, test_free};
+  const char *query = "SELECT a FROM b WHERE c = 1";
+
+  pg_query_set_output_allocator(&allocator);
+
+  PgQueryProtobufParseResult parse_result = pg_query_parse_protobuf(query);
+  ok &= check("parse_protobuf", n_allocs == 1 && parse_result.parse_tree.data == last_alloc);
+
+  PgQueryDeparseResult deparse_result = pg_query_deparse_protobuf(parse_result.parse_tree);
+  ok &= check("deparse_protobuf", n_allocs == 2 && deparse_result.query == last_alloc && strcmp(deparse_result.query, query) == 0);
+
+  pg_query_free_deparse_result(deparse_result);
+  pg_query_free_protobuf_parse_result(parse_result);
+  ok &= check("free", n_frees == 2);
+
+  PgQueryParseResult json_result = pg_query_parse(query);
+  ok &= check("parse", n_allocs == 3 && json_result.parse_tree == last_alloc);
+  pg_query_free_parse_result(json_result);
+
+  PgQueryScanResult scan_result = pg_query_scan(query);
+  ok &= check("scan", n_allocs == 4 && scan_result.pbuf.data == last_alloc);
+  pg_query_free_scan_result(scan_result);
+
+  PgQueryNormalizeResult normalize_result = pg_query_normalize(query);
+  ok &= check("normalize", n_allocs == 5 && normalize_result.normalized_query == last_alloc &&
+              strcmp(normalize_result.normalized_query, "SELECT a FROM b WHERE c = $1") == 0);
+
+  // A caller that takes over the buffer clears the field, and frees it itself
+  char *normalized_query = normalize_result.normalized_query;
+  normalize_result.normalized_query = NULL;
+  pg_query_free_normalize_result(normalize_result);
+  ok &= check("taken over", n_frees == 4);
+  free(normalized_query);
+
+  // A failed normalize has no output to allocate
+  normalize_result = pg_query_normalize("SELEC 1");
+  ok &= check("error", n_allocs == 5 && normalize_result.error != NULL);
+  pg_query_free_normalize_result(normalize_result);
+  ok &= check("error free", n_frees == 4);
+
+  pg_query_set_output_allocator(NULL);
+
+  parse_result = pg_query_parse_protobuf(query);
+  ok &= check("reset", n_allocs == 5 && parse_result.parse_tree.data != NULL);
+  pg_query_free_protobuf_parse_result(parse_result);
+  ok &= check("reset free", n_frees == 4);
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,83 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Each param ref is written as "location:length", followed by ":" and the
+// dot-separated type names if it is cast, with param refs separated by spaces
+typedef struct {
+  const char *query;
+  const char *expected;
+} ParamRefsTest;
+
+static const ParamRefsTest tests[] = {
+  {"SELECT * FROM x WHERE y = $1 AND z = $2", "26:2 37:2"},
+  {"SELECT * FROM x WHERE y = $1 AND z = $2::timestamptz", "26:2 37:2:timestamptz"},
+  {"SELECT * FROM x WHERE y = $1::text AND z < now() - INTERVAL $2", "26:2:text 51:11:pg_catalog.interval"},
+  {"SELECT * FROM a WHERE x = $1 AND y = $12 AND z = $255", "26:2 37:3 49:4"},
+  {"SELECT $2, count(*) FROM x GROUP BY 1 ORDER BY 1 LIMIT $1", "7:2 55:2"},
+  {"SELECT CAST($1 AS int), $2::int::text", "12:2:pg_catalog.int4 24:2:pg_catalog.int4"},
+  {"UPDATE x SET a = $1 WHERE b = $2; DELETE FROM y WHERE c = $3", "17:2 30:2 58:2"},
+  {"INSERT INTO x (a) VALUES ($1), ($2) RETURNING $3", "26:2 32:2 46:2"},
+  {"PREPARE p AS SELECT $1; EXECUTE p($1)", "20:2 34:2"},
+  {"CREATE VIEW v AS SELECT $1; CALL f($2)", "24:2 35:2"},
+  {"CREATE TABLE t (a int DEFAULT $1, b int CHECK (b > $2), CHECK (a < $3))", "30:2 51:2 67:2"},
+  {"ALTER TABLE t ADD COLUMN c int DEFAULT $1::int, ALTER COLUMN a SET DEFAULT $2", "39:2:pg_catalog.int4 75:2"},
+  {"SELECT 1", ""},
+};
+
+static void format_param_refs(PgQueryParamRefsResult result, char *buf, size_t size)
+{
+  size_t n = 0;
+  int i, j;
+
+  buf[0] = '\0';
+  for (i = 0; i < result.n_param_refs; i++) {
+    n += snprintf(buf + n, size - n, "%s%d:%d", i > 0 ? " " : "", result.param_refs[i].location, result.param_refs[i].length);
+    for (j = 0; j < result.param_refs[i].n_type_names; j++)
+      n += snprintf(buf + n, size - n, "%s%s", j > 0 ? "." : ":", result.param_refs[i].type_names[j]);
+  }
+}
+
+int main() {
+  bool ret_code = EXIT_SUCCESS;
+  char actual[1024];
+  size_t i;
+  PgQueryParamRefsResult result;
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    result = pg_query_param_refs(tests[i].query);
+
+    if (result.error) {
+      ret_code = EXIT_FAILURE;
+      printf("%s\n", result.error->message);
+    } else {
+      format_param_refs(result, actual, sizeof(actual));
+      if (strcmp(actual, tests[i].expected) == 0) {
+        printf(".");
+      } else {
+        ret_code = EXIT_FAILURE;
+        printf("\nINVALID result for \"%s\"\nexpected: %s\nactual: %s\n", tests[i].query, tests[i].expected, actual);
+      }
+    }
+
+    pg_query_free_param_refs_result(result);
+  }
+
+  result = pg_query_param_refs_n("SELECT $1 FROM", 14);
+  if (result.error && strcmp(result.error->message, "syntax error at end of input") == 0) {
+    printf(".");
+  } else {
+    ret_code = EXIT_FAILURE;
+    printf("\nINVALID result for syntax error\n");
+  }
+  pg_query_free_param_refs_result(result);
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ret_code;
+}
@@ -0,0 +1,138 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Builds prefix + n copies of item separated by sep + suffix
+static char *build_query(const char *prefix, const char *item, const char *sep, const char *suffix, int n) {
+  size_t len = strlen(prefix) + n * (strlen(item) + strlen(sep)) + strlen(suffix) + 1;
+  char *query = malloc(len);
+  int i;
+
+  strcpy(query, prefix);
+  for (i = 0; i < n; i++) {
+    if (i > 0)
+      strcat(query, sep);
+    strcat(query, item);
+  }
+  strcat(query, suffix);
+
+  return query;
+}
+
+static bool check_parse(const char *name, const char *query, PgQueryErrorCode expected) {
+  PgQueryProtobufParseResult result = pg_query_parse_protobuf(query);
+  bool ok;
+
+  if (expected == PG_QUERY_ERROR_DEFAULT) {
+    ok = result.error == NULL;
+    if (!ok)
+      printf("\n%s: unexpected error \"%s\"\n", name, result.error->message);
+  } else {
+    ok = result.error != NULL && result.error->code == expected;
+    if (!ok)
+      printf("\n%s: expected error code %d, got %s (code %d)\n", name, expected,
+             result.error ? result.error->message : "no error", result.error ? result.error->code : 0);
+  }
+
+  pg_query_free_protobuf_parse_result(result);
+
+  if (ok)
+    printf(".");
+
+  return ok;
+}
+
+static bool check_normalize(const char *name, const char *query, PgQueryErrorCode expected) {
+  PgQueryNormalizeResult result = pg_query_normalize(query);
+  bool ok = expected == PG_QUERY_ERROR_DEFAULT ? result.error == NULL : result.error != NULL && result.error->code == expected;
+
+  if (!ok)
+    printf("\n%s: expected error code %d, got %s\n", name, expected, result.error ? result.error->message : "no error");
+  else
+    printf(".");
+
+  pg_query_free_normalize_result(result);
+
+  return ok;
+}
+
+static bool check_fingerprint(const char *name, const char *query, PgQueryErrorCode expected) {
+  PgQueryFingerprintResult result = pg_query_fingerprint(query);
+  bool ok = expected == PG_QUERY_ERROR_DEFAULT ? result.error == NULL : result.error != NULL && result.error->code == expected;
+
+  if (!ok)
+    printf("\n%s: expected error code %d, got %s\n", name, expected, result.error ? result.error->message : "no error");
+  else
+    printf(".");
+
+  pg_query_free_fingerprint_result(result);
+
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  char *deep = build_query("SELECT ", "1", " + ", "", 200);
+  char *wide = build_query("SELECT ", "a", ", ", "", 500);
+  char *long_list = build_query("SELECT * FROM t WHERE id IN (", "123456", ", ", ")", 20000);
+  PgQueryParseLimits limits = {0};
+  int round;
+
+  // Without limits everything parses
+  ok &= check_parse("deep, no limits", deep, PG_QUERY_ERROR_DEFAULT);
+  ok &= check_parse("wide, no limits", wide, PG_QUERY_ERROR_DEFAULT);
+  ok &= check_parse("long list, no limits", long_list, PG_QUERY_ERROR_DEFAULT);
+
+  // Run twice, to make sure that hitting a limit doesn't affect later calls
+  for (round = 0; round < 2; round++) {
+    limits.max_depth = 50;
+    limits.max_nodes = 0;
+    limits.max_memory = 0;
+    pg_query_set_parse_limits(limits);
+    ok &= check_parse("depth limit", deep, PG_QUERY_ERROR_DEPTH_LIMIT);
+    ok &= check_fingerprint("depth limit (fingerprint)", deep, PG_QUERY_ERROR_DEPTH_LIMIT);
+    ok &= check_normalize("depth limit (normalize)", deep, PG_QUERY_ERROR_DEPTH_LIMIT);
+    ok &= check_parse("below depth limit", wide, PG_QUERY_ERROR_DEFAULT);
+
+    limits.max_depth = 0;
+    limits.max_nodes = 1000;
+    pg_query_set_parse_limits(limits);
+    ok &= check_parse("node limit", wide, PG_QUERY_ERROR_NODE_LIMIT);
+    ok &= check_normalize("node limit (normalize)", wide, PG_QUERY_ERROR_NODE_LIMIT);
+    ok &= check_parse("below node limit", deep, PG_QUERY_ERROR_DEFAULT);
+
+    limits.max_nodes = 0;
+    limits.max_memory = 256 * 1024;
+    pg_query_set_parse_limits(limits);
+    ok &= check_parse("memory limit", long_list, PG_QUERY_ERROR_MEMORY_LIMIT);
+    ok &= check_fingerprint("memory limit (fingerprint)", long_list, PG_QUERY_ERROR_MEMORY_LIMIT);
+    ok &= check_parse("below memory limit", wide, PG_QUERY_ERROR_DEFAULT);
+
+    // Other errors keep the default code while limits are set
+    PgQueryProtobufParseResult result = pg_query_parse_protobuf("SELEC 1");
+    if (result.error != NULL && result.error->code == PG_QUERY_ERROR_DEFAULT) {
+      printf(".");
+    } else {
+      printf("\nsyntax error: expected an error with the default code\n");
+      ok = false;
+    }
+    pg_query_free_protobuf_parse_result(result);
+
+    limits.max_memory = 0;
+    pg_query_set_parse_limits(limits);
+    ok &= check_parse("long list, limits removed", long_list, PG_QUERY_ERROR_DEFAULT);
+  }
+
+  printf("\n");
+
+  free(deep);
+  free(wide);
+  free(long_list);
+
+  pg_query_exit();
+
+  return ok ? 0 : -1;
+}
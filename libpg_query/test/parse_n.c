@@ -0,0 +1,118 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "parse_tests.c"
+
+// Trailing bytes that would change every result if they were read
+#define JUNK " ; SELECT junk FROM 'unterminated"
+
+static bool same_error(PgQueryError *a, PgQueryError *b) {
+  if (a == NULL || b == NULL)
+    return a == b;
+
+  return strcmp(a->message, b->message) == 0 && a->cursorpos == b->cursorpos;
+}
+
+static bool same_protobuf(PgQueryProtobuf a, PgQueryProtobuf b) {
+  return a.len == b.len && (a.len == 0 || memcmp(a.data, b.data, a.len) == 0);
+}
+
+static bool same_split(PgQuerySplitResult a, PgQuerySplitResult b) {
+  int i;
+
+  if (!same_error(a.error, b.error) || a.n_stmts != b.n_stmts)
+    return false;
+
+  for (i = 0; i < a.n_stmts; i++) {
+    if (a.stmts[i]->stmt_location != b.stmts[i]->stmt_location || a.stmts[i]->stmt_len != b.stmts[i]->stmt_len)
+      return false;
+  }
+
+  return true;
+}
+
+static bool check(const char *name, const char *query, bool ok) {
+  if (ok)
+    printf(".");
+  else
+    printf("\n%s: length-aware result differs for \"%s\"\n", name, query);
+
+  return ok;
+}
+
+// Runs query through the _n functions from a buffer that has junk after the
+// query instead of a NUL byte, and compares with the NUL-terminated results
+static bool check_query(const char *query) {
+  size_t len = strlen(query);
+  char *buf = malloc(len + sizeof(JUNK));
+  bool ok = true;
+
+  memcpy(buf, query, len);
+  memcpy(buf + len, JUNK, sizeof(JUNK));
+
+  PgQueryProtobufParseResult parse = pg_query_parse_protobuf(query);
+  PgQueryProtobufParseResult parse_n = pg_query_parse_protobuf_n(buf, len);
+  ok &= check("parse_protobuf", query, same_error(parse.error, parse_n.error) && same_protobuf(parse.parse_tree, parse_n.parse_tree));
+  pg_query_free_protobuf_parse_result(parse);
+  pg_query_free_protobuf_parse_result(parse_n);
+
+  PgQueryFingerprintResult fingerprint = pg_query_fingerprint(query);
+  PgQueryFingerprintResult fingerprint_n = pg_query_fingerprint_n(buf, len);
+  ok &= check("fingerprint", query, same_error(fingerprint.error, fingerprint_n.error) && fingerprint.fingerprint == fingerprint_n.fingerprint);
+  pg_query_free_fingerprint_result(fingerprint);
+  pg_query_free_fingerprint_result(fingerprint_n);
+
+  PgQueryNormalizeResult normalize = pg_query_normalize(query);
+  PgQueryNormalizeResult normalize_n = pg_query_normalize_n(buf, len);
+  ok &= check("normalize", query, same_error(normalize.error, normalize_n.error) &&
+              (normalize.error != NULL || strcmp(normalize.normalized_query, normalize_n.normalized_query) == 0));
+  pg_query_free_normalize_result(normalize);
+  pg_query_free_normalize_result(normalize_n);
+
+  PgQueryScanResult scan = pg_query_scan(query);
+  PgQueryScanResult scan_n = pg_query_scan_n(buf, len);
+  ok &= check("scan", query, same_error(scan.error, scan_n.error) && same_protobuf(scan.pbuf, scan_n.pbuf));
+  pg_query_free_scan_result(scan);
+  pg_query_free_scan_result(scan_n);
+
+  PgQuerySplitResult split = pg_query_split_with_scanner(query);
+  PgQuerySplitResult split_n = pg_query_split_with_scanner_n(buf, len);
+  ok &= check("split_with_scanner", query, same_split(split, split_n));
+  pg_query_free_split_result(split);
+  pg_query_free_split_result(split_n);
+
+  split = pg_query_split_with_parser(query);
+  split_n = pg_query_split_with_parser_n(buf, len);
+  ok &= check("split_with_parser", query, same_split(split, split_n));
+  pg_query_free_split_result(split);
+  pg_query_free_split_result(split_n);
+
+  free(buf);
+
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  size_t i;
+
+  for (i = 0; i < testsLength; i += 2)
+    ok &= check_query(tests[i]);
+
+  // Like the NUL-terminated functions, the scanner stops at a NUL byte
+  PgQueryProtobufParseResult result = pg_query_parse_protobuf("SELECT 1");
+  PgQueryProtobufParseResult result_n = pg_query_parse_protobuf_n("SELECT 1\0 2", 11);
+  ok &= check("embedded NUL", "SELECT 1\\0 2", result_n.error == NULL && same_protobuf(result.parse_tree, result_n.parse_tree));
+  pg_query_free_protobuf_parse_result(result);
+  pg_query_free_protobuf_parse_result(result_n);
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
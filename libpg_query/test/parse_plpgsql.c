@@ -50,6 +50,23 @@ int main() {
 		return EXIT_FAILURE;
 	}
 
+	// The function offsets tile the JSON array, with a separator after each object
+	size_t expected_offset = 2;
+	for (int i = 0; i < result.n_funcs; i++) {
+		const char *func = result.plpgsql_funcs + result.funcs[i].offset;
+
+		if (result.funcs[i].offset != expected_offset || func[0] != '{' || func[result.funcs[i].len - 1] != '}') {
+			printf("INVALID offset for function %d: %zu\n", i, result.funcs[i].offset);
+			ret_code = EXIT_FAILURE;
+		}
+		expected_offset = result.funcs[i].offset + result.funcs[i].len + 2;
+	}
+
+	if (result.n_funcs == 0 || expected_offset != strlen(result.plpgsql_funcs)) {
+		printf("INVALID function offsets\n");
+		ret_code = EXIT_FAILURE;
+	}
+
 	f_out = fopen("test/plpgsql_samples.actual.json", "w");
 	fprintf(f_out, "%s\n", result.plpgsql_funcs);
 	fclose(f_out);
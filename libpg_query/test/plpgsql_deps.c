@@ -0,0 +1,102 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Input, then the expected functions, one per line as "name: tables | functions"
+static const char* tests[] = {
+  "CREATE FUNCTION f() RETURNS void AS $$ BEGIN INSERT INTO log SELECT * FROM users; END $$ LANGUAGE plpgsql",
+  "f: log dml, users select | ",
+  "CREATE FUNCTION public.f(p int) RETURNS int AS $$\n"
+  "DECLARE\n"
+  "  n int := (SELECT count(*) FROM counts);\n"
+  "  c CURSOR FOR SELECT * FROM cursor_table;\n"
+  "  r record;\n"
+  "BEGIN\n"
+  "  IF EXISTS (SELECT 1 FROM s.cond_table) THEN\n"
+  "    UPDATE t SET x = lower(y) FROM joined WHERE t.id = p;\n"
+  "  ELSE\n"
+  "    DELETE FROM t WHERE id = p;\n"
+  "  END IF;\n"
+  "  FOR r IN SELECT * FROM loop_table LOOP\n"
+  "    PERFORM notify_row(r.id);\n"
+  "  END LOOP;\n"
+  "  RETURN n;\n"
+  "EXCEPTION WHEN others THEN\n"
+  "  INSERT INTO errors VALUES (SQLERRM);\n"
+  "  RETURN 0;\n"
+  "END $$ LANGUAGE plpgsql",
+  "public.f: counts select, cursor_table select, s.cond_table select, t dml, joined select, loop_table select, errors dml | count call, lower call, notify_row call",
+  "DO $$ DECLARE v int; BEGIN WITH x AS (SELECT * FROM a) SELECT * INTO v FROM x; CALL p(1); EXECUTE format('TRUNCATE %I', 'hidden'); END $$",
+  "(do): a select | p call, format call",
+  "CREATE FUNCTION f() RETURNS void AS $$ BEGIN CREATE TABLE n (id int); TRUNCATE old; DROP TABLE gone; DROP FUNCTION g(int); END $$ LANGUAGE plpgsql",
+  "f: n ddl, old ddl, gone ddl | g ddl",
+  "CREATE FUNCTION f() RETURNS int LANGUAGE sql AS 'SELECT count(*) FROM a; INSERT INTO b VALUES (1)';\n"
+  "CREATE FUNCTION g() RETURNS int LANGUAGE sql BEGIN ATOMIC SELECT 1 FROM c; END;\n"
+  "CREATE FUNCTION h() RETURNS int LANGUAGE sql RETURN (SELECT max(x) FROM d)",
+  "f: a select, b dml | count call\n"
+  "g: c select | \n"
+  "h: d select | max call",
+  "CREATE FUNCTION f() RETURNS int AS $$ BEGIN SELECT 1 FROM a; SELECT 2 FROM a; UPDATE a SET x = 1; END $$ LANGUAGE plpgsql",
+  "f: a select, a dml | ",
+  "SELECT 1",
+  "",
+};
+
+static void append_refs(char *buf, PgQueryPlpgsqlRef *refs, int n_refs)
+{
+  for (int i = 0; i < n_refs; i++)
+    sprintf(buf + strlen(buf), "%s%s %s", i > 0 ? ", " : "", refs[i].name, refs[i].type);
+}
+
+int main() {
+  bool ret_code = EXIT_SUCCESS;
+  size_t i;
+  char buf[2048];
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i += 2) {
+    PgQueryPlpgsqlDepsResult result = pg_query_plpgsql_deps(tests[i]);
+
+    if (result.error) {
+      ret_code = EXIT_FAILURE;
+      printf("%s\n", result.error->message);
+      pg_query_free_plpgsql_deps_result(result);
+      continue;
+    }
+
+    buf[0] = '\0';
+    for (int j = 0; j < result.n_funcs; j++) {
+      sprintf(buf + strlen(buf), "%s%s: ", j > 0 ? "\n" : "", result.funcs[j].name ? result.funcs[j].name : "(do)");
+      append_refs(buf, result.funcs[j].tables, result.funcs[j].n_tables);
+      strcat(buf, " | ");
+      append_refs(buf, result.funcs[j].functions, result.funcs[j].n_functions);
+    }
+
+    if (strcmp(buf, tests[i + 1]) == 0) {
+      printf(".");
+    } else {
+      ret_code = EXIT_FAILURE;
+      printf("INVALID result for \"%s\"\nexpected: %s\n  actual: %s\n", tests[i], tests[i + 1], buf);
+    }
+
+    pg_query_free_plpgsql_deps_result(result);
+  }
+
+  // Errors in function bodies are reported like by pg_query_parse_plpgsql
+  PgQueryPlpgsqlDepsResult result = pg_query_plpgsql_deps("CREATE FUNCTION f() RETURNS void AS $$ BEGIN SELEC 1; END $$ LANGUAGE plpgsql");
+  if (result.error == NULL || result.n_funcs != 0) {
+    ret_code = EXIT_FAILURE;
+    printf("INVALID result for function with syntax error\n");
+  } else {
+    printf(".");
+  }
+  pg_query_free_plpgsql_deps_result(result);
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ret_code;
+}
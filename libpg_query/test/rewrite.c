@@ -0,0 +1,105 @@
+#include <pg_query.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+static const PgQueryRewriteRelation relations[] = {
+  {NULL, "users", NULL, "accounts"},
+  {"old", "events", "archive", NULL},
+};
+
+static const PgQueryRewrite rename_relations = {relations, 2, NULL, NULL, 0, -1, -1};
+static const PgQueryRewrite qualify = {relations, 2, "tenant_1", NULL, 0, -1, -1};
+static const PgQueryRewrite tenant = {NULL, 0, NULL, "tenant_id = $1", PG_QUERY_REWRITE_SELECT | PG_QUERY_REWRITE_UPDATE | PG_QUERY_REWRITE_DELETE, -1, -1};
+static const PgQueryRewrite tenant_select = {NULL, 0, NULL, "tenant_id = $1 OR public", PG_QUERY_REWRITE_SELECT, -1, -1};
+static const PgQueryRewrite set_limit = {NULL, 0, NULL, NULL, 0, 10, -1};
+static const PgQueryRewrite max_limit = {NULL, 0, NULL, NULL, 0, -1, 100};
+
+typedef struct {
+  const char *query;
+  const PgQueryRewrite *rewrite;
+  const char *expected;
+} RewriteTest;
+
+static const RewriteTest tests[] = {
+  {"SELECT users.id FROM users JOIN public.users p ON true", &rename_relations, "SELECT users.id FROM accounts users JOIN public.users p ON true"},
+  {"SELECT * FROM users u, old.events", &rename_relations, "SELECT * FROM accounts u, archive.events"},
+  {"INSERT INTO users (id) SELECT id FROM users RETURNING users.id", &rename_relations, "INSERT INTO accounts AS users (id) SELECT id FROM accounts users RETURNING users.id"},
+  {"SELECT * FROM users FOR UPDATE OF users", &rename_relations, "SELECT * FROM accounts users FOR UPDATE OF users"},
+  {"WITH users AS (SELECT 1) SELECT * FROM users, x.users", &qualify, "WITH users AS (SELECT 1) SELECT * FROM users, x.users"},
+  {"WITH orders AS (SELECT * FROM orders WHERE paid) SELECT * FROM orders", &qualify, "WITH orders AS (SELECT * FROM tenant_1.orders WHERE paid) SELECT * FROM orders"},
+  {"SELECT * FROM (WITH accounts AS (SELECT 1) SELECT * FROM accounts) x, accounts", &qualify, "SELECT * FROM (WITH accounts AS (SELECT 1) SELECT * FROM accounts) x, tenant_1.accounts"},
+  {"SELECT * FROM t WHERE EXISTS (WITH users AS (SELECT 1) SELECT 1) AND id IN (SELECT id FROM users)", &qualify, "SELECT * FROM tenant_1.t WHERE EXISTS (WITH users AS (SELECT 1) SELECT 1) AND id IN (SELECT id FROM tenant_1.accounts users)"},
+  {"WITH RECURSIVE t AS (SELECT 1 UNION ALL SELECT * FROM t, s) SELECT * FROM t", &qualify, "WITH RECURSIVE t AS (SELECT 1 UNION ALL SELECT * FROM t, tenant_1.s) SELECT * FROM t"},
+  {"WITH a AS (SELECT 1), b AS (SELECT * FROM a) SELECT * FROM b", &qualify, "WITH a AS (SELECT 1), b AS (SELECT * FROM a) SELECT * FROM b"},
+  {"SELECT * FROM users WHERE id IN (SELECT user_id FROM orders)", &qualify, "SELECT * FROM tenant_1.accounts users WHERE id IN (SELECT user_id FROM tenant_1.orders)"},
+  {"UPDATE t SET a = 1 FROM s; DELETE FROM t USING s", &qualify, "UPDATE tenant_1.t SET a = 1 FROM tenant_1.s; DELETE FROM tenant_1.t USING tenant_1.s"},
+  {"SELECT * INTO t FROM s", &qualify, "SELECT * INTO tenant_1.t FROM tenant_1.s"},
+  {"EXPLAIN SELECT * FROM t; TRUNCATE t; CREATE TABLE t (id int)", &qualify, "EXPLAIN SELECT * FROM tenant_1.t; TRUNCATE tenant_1.t; CREATE TABLE t (id int)"},
+  {"SELECT * FROM t", &tenant, "SELECT * FROM t WHERE tenant_id = $1"},
+  {"SELECT * FROM t WHERE a = 1 AND b = 2", &tenant, "SELECT * FROM t WHERE a = 1 AND b = 2 AND tenant_id = $1"},
+  {"SELECT * FROM t WHERE a = 1 OR b = 2", &tenant, "SELECT * FROM t WHERE (a = 1 OR b = 2) AND tenant_id = $1"},
+  {"SELECT a FROM t UNION SELECT a FROM s WHERE b", &tenant, "SELECT a FROM t WHERE tenant_id = $1 UNION SELECT a FROM s WHERE b AND tenant_id = $1"},
+  {"UPDATE t SET a = 1; DELETE FROM t WHERE a; INSERT INTO t VALUES (1)", &tenant, "UPDATE t SET a = 1 WHERE tenant_id = $1; DELETE FROM t WHERE a AND tenant_id = $1; INSERT INTO t VALUES (1)"},
+  {"WITH d AS (DELETE FROM x RETURNING *) SELECT * FROM d", &tenant, "WITH d AS (DELETE FROM x WHERE tenant_id = $1 RETURNING *) SELECT * FROM d WHERE tenant_id = $1"},
+  {"WITH a AS (WITH u AS (UPDATE x SET b = 1 RETURNING id) SELECT id FROM u) INSERT INTO t SELECT id FROM a", &tenant, "WITH a AS (WITH u AS (UPDATE x SET b = 1 WHERE tenant_id = $1 RETURNING id) SELECT id FROM u) INSERT INTO t SELECT id FROM a"},
+  {"WITH d AS (DELETE FROM x RETURNING *) SELECT * FROM d", &tenant_select, "WITH d AS (DELETE FROM x RETURNING *) SELECT * FROM d WHERE tenant_id = $1 OR public"},
+  {"SELECT 2; SELECT 1 UNION SELECT a FROM t", &tenant, "SELECT 2; SELECT 1 UNION SELECT a FROM t WHERE tenant_id = $1"},
+  {"SELECT * FROM t WHERE id IN (SELECT id FROM s); UPDATE t SET a = 1", &tenant_select, "SELECT * FROM t WHERE id IN (SELECT id FROM s) AND (tenant_id = $1 OR public); UPDATE t SET a = 1"},
+  {"SELECT * FROM t", &set_limit, "SELECT * FROM t LIMIT 10"},
+  {"SELECT * FROM t LIMIT $1 OFFSET 5", &set_limit, "SELECT * FROM t LIMIT 10 OFFSET 5"},
+  {"SELECT * FROM t", &max_limit, "SELECT * FROM t LIMIT 100"},
+  {"SELECT * FROM t LIMIT ALL", &max_limit, "SELECT * FROM t LIMIT 100"},
+  {"SELECT * FROM t LIMIT 5", &max_limit, "SELECT * FROM t LIMIT 5"},
+  {"SELECT * FROM t FETCH FIRST 500 ROWS ONLY", &max_limit, "SELECT * FROM t LIMIT 100"},
+  {"SELECT * FROM t LIMIT $1", &max_limit, "SELECT * FROM t LIMIT LEAST($1, 100)"},
+  {"SELECT * FROM (SELECT * FROM s LIMIT 1000) x; UPDATE t SET a = 1", &max_limit, "SELECT * FROM (SELECT * FROM s LIMIT 1000) x LIMIT 100; UPDATE t SET a = 1"},
+};
+
+static const RewriteTest error_tests[] = {
+  {"SELECT * FROM t", &(PgQueryRewrite) {NULL, 0, NULL, "a FROM b", PG_QUERY_REWRITE_SELECT, -1, -1}, "rewrite error: WHERE must be a single expression"},
+  {"DELETE FROM t WHERE CURRENT OF c", &tenant, "rewrite error: can't add to WHERE CURRENT OF"},
+  {"SELECT * FROM", &rename_relations, "syntax error at end of input"},
+};
+
+int main() {
+  bool ret_code = EXIT_SUCCESS;
+  size_t i;
+
+  for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    PgQueryDeparseResult result = pg_query_rewrite(tests[i].query, tests[i].rewrite);
+
+    if (result.error) {
+      ret_code = EXIT_FAILURE;
+      printf("%s\n", result.error->message);
+    } else if (strcmp(result.query, tests[i].expected) == 0) {
+      printf(".");
+    } else {
+      ret_code = EXIT_FAILURE;
+      printf("\nINVALID result for \"%s\"\nexpected: %s\nactual: %s\n", tests[i].query, tests[i].expected, result.query);
+    }
+
+    pg_query_free_deparse_result(result);
+  }
+
+  for (i = 0; i < sizeof(error_tests) / sizeof(error_tests[0]); i++) {
+    PgQueryDeparseResult result = pg_query_rewrite_n(error_tests[i].query, strlen(error_tests[i].query), error_tests[i].rewrite);
+
+    if (result.error && strcmp(result.error->message, error_tests[i].expected) == 0) {
+      printf(".");
+    } else {
+      ret_code = EXIT_FAILURE;
+      printf("\nINVALID result for \"%s\"\nexpected error: %s\nactual: %s\n", error_tests[i].query, error_tests[i].expected, result.error ? result.error->message : result.query);
+    }
+
+    pg_query_free_deparse_result(result);
+  }
+
+  printf("\n");
+
+  pg_query_exit();
+
+  return ret_code;
+}
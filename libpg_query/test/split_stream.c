@@ -0,0 +1,147 @@
+#include <pg_query.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "split_tests.c"
+
+static const char* stream_tests[] = {
+  "SELECT $$a;b$$; SELECT $x$ $$; $x$",
+  "loc=0,len=14;loc=15,len=19",
+  "SELECT $1; SELECT a$b; SELECT 2",
+  "loc=0,len=9;loc=10,len=11;loc=22,len=9",
+  "SELECT 'it''s;'; SELECT E'\\';'; SELECT 'a\\'; SELECT 1",
+  "loc=0,len=15;loc=16,len=14;loc=31,len=12;loc=44,len=9",
+  "SELECT \"a;\"\"b\" FROM t; SELECT 2",
+  "loc=0,len=21;loc=22,len=9",
+  "SELECT /* a /* nested ; */ ; */ 1; SELECT 2",
+  "loc=0,len=33;loc=34,len=9",
+  "SELECT 1 -- ;\r; SELECT 2/3; SELECT 4-1",
+  "loc=0,len=14;loc=15,len=11;loc=27,len=11",
+  "CREATE FUNCTION f() RETURNS int BEGIN ATOMIC SELECT 1; SELECT CASE WHEN true THEN 2 END; END; SELECT 3",
+  "loc=0,len=92;loc=93,len=9",
+  "CREATE OR REPLACE PROCEDURE p() BEGIN ATOMIC INSERT INTO t VALUES (1); END; BEGIN; COMMIT",
+  "loc=0,len=74;loc=75,len=6;loc=82,len=7",
+  "/* only a comment */; -- and another\n",
+  "",
+  "COPY t (a, \"b;\") FROM stdin;\n1\t'it's; here\n\\.x\t\\N\n\\.\nSELECT 1",
+  "loc=0,len=27;loc=53,len=8",
+  "COPY t FROM STDIN WITH (FORMAT csv);\r\n\"a;\",$$\r\n\\.\r\n; COPY t TO stdout; SELECT 'x\n\\.\n'",
+  "loc=0,len=35;loc=52,len=17;loc=70,len=15",
+  "COPY (SELECT * FROM stdin) TO stdout; SELECT 1",
+  "loc=0,len=36;loc=37,len=9",
+  "COPY t FROM stdin; 1\t'a",
+  "loc=0,len=17",
+};
+
+static const char* error_tests[] = {
+  "SELECT 1; SELECT 'a",
+  "unterminated quoted string",
+  "SELECT \"a",
+  "unterminated quoted identifier",
+  "SELECT 1 /* a /* b */",
+  "unterminated /* comment",
+  "SELECT $a$ b $a",
+  "unterminated dollar-quoted string",
+};
+
+static void append_stmts(char *buf, PgQuerySplitStreamResult result)
+{
+	for (int i = 0; i < result.n_stmts; i++)
+		sprintf(buf + strlen(buf), "%sloc=%" PRIu64 ",len=%" PRIu64, buf[0] ? ";" : "",
+				result.stmts[i].stmt_location, result.stmts[i].stmt_len);
+}
+
+// Splits the input in chunks of chunk_size bytes, returns the error message or NULL
+static const char* split_in_chunks(const char *input, size_t chunk_size, char *buf)
+{
+	PgQuerySplitStream *stream = pg_query_split_stream_new();
+	PgQuerySplitStreamResult result;
+	size_t len = strlen(input);
+	static char message[256];
+
+	buf[0] = '\0';
+
+	for (size_t pos = 0; pos < len; pos += chunk_size)
+	{
+		result = pg_query_split_stream_feed(stream, input + pos, pos + chunk_size < len ? chunk_size : len - pos);
+		append_stmts(buf, result);
+	}
+
+	result = pg_query_split_stream_finish(stream);
+	append_stmts(buf, result);
+
+	if (result.error)
+		snprintf(message, sizeof(message), "%s", result.error->message);
+
+	pg_query_split_stream_free(stream);
+
+	return result.error ? message : NULL;
+}
+
+static bool check(const char *input, const char *expected, bool expect_error)
+{
+	char buf[1024];
+	size_t len = strlen(input);
+
+	for (size_t chunk_size = 1; chunk_size <= (len > 0 ? len : 1); chunk_size++)
+	{
+		const char *error = split_in_chunks(input, chunk_size, buf);
+		const char *actual = expect_error ? (error ? error : "no error") : (error ? error : buf);
+
+		if (strcmp(actual, expected) != 0)
+		{
+			printf("INVALID split stream result for \"%s\" in chunks of %zu bytes\nexpected: %s\n  actual: %s\n", input, chunk_size, expected, actual);
+			return false;
+		}
+	}
+
+	printf(".");
+	return true;
+}
+
+int main()
+{
+	size_t i;
+	bool ret_code = EXIT_SUCCESS;
+
+	for (i = 0; i < testsLength; i += 2)
+		if (!check(tests[i], tests[i + 1], false))
+			ret_code = EXIT_FAILURE;
+
+	for (i = 0; i < sizeof(stream_tests) / sizeof(stream_tests[0]); i += 2)
+		if (!check(stream_tests[i], stream_tests[i + 1], false))
+			ret_code = EXIT_FAILURE;
+
+	for (i = 0; i < sizeof(error_tests) / sizeof(error_tests[0]); i += 2)
+		if (!check(error_tests[i], error_tests[i + 1], true))
+			ret_code = EXIT_FAILURE;
+
+	// Feeding after finishing is an error
+	PgQuerySplitStream *stream = pg_query_split_stream_new();
+	pg_query_split_stream_feed(stream, "SELECT 1", 8);
+	PgQuerySplitStreamResult result = pg_query_split_stream_finish(stream);
+	if (result.error || result.n_stmts != 1)
+	{
+		ret_code = EXIT_FAILURE;
+		printf("INVALID result for finish\n");
+	}
+	result = pg_query_split_stream_feed(stream, "SELECT 2", 8);
+	if (result.error == NULL || strcmp(result.error->message, "split stream is already finished") != 0)
+	{
+		ret_code = EXIT_FAILURE;
+		printf("INVALID result for feed after finish\n");
+	}
+	else
+	{
+		printf(".");
+	}
+	pg_query_split_stream_free(stream);
+
+	printf("\n");
+
+	return ret_code;
+}
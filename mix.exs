@@ -10,6 +10,7 @@ defmodule ExPgQuery.MixProject do
       elixir: "~> 1.16",
       start_permanent: Mix.env() == :prod,
       deps: deps(),
+      aliases: aliases(),
       package: package(),
       description: description(),
       test_coverage: [tool: ExCoveralls],
@@ -65,6 +66,12 @@ defmodule ExPgQuery.MixProject do
     ]
   end
 
+  defp aliases do
+    [
+      bench: ["run bench/run.exs"]
+    ]
+  end
+
   # Run "mix help compile.app" to learn about applications.
   def application do
     [
@@ -76,12 +83,15 @@ defmodule ExPgQuery.MixProject do
   defp deps do
     [
       {:protox, "~> 1.7"},
+      {:telemetry, "~> 1.0"},
       {:elixir_make, "~> 0.9", runtime: false},
       {:ex_doc, "~> 0.36", only: :dev, runtime: false},
       {:credo, "~> 1.7", only: [:dev, :test], runtime: false},
       {:cc_precompiler, "~> 0.1.10", runtime: false, github: "cocoa-xu/cc_precompiler"},
       {:mix_test_watch, "~> 1.0", only: [:dev, :test], runtime: false},
       {:excoveralls, "~> 0.18", only: :test},
+      {:benchee, "~> 1.3", only: :dev},
+      {:benchee_json, "~> 1.0", only: :dev},
       {:junit_formatter, "~> 3.4", only: :test}
     ]
   end
@@ -1,4 +1,5 @@
 #include <erl_nif.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -6,6 +7,9 @@
 #include "../libpg_query/pg_query.h"
 #include "../libpg_query/protobuf/pg_query.pb-c.h"
 #include "../libpg_query/vendor/protobuf-c/protobuf-c.h"
+#include "../libpg_query/vendor/xxhash/xxhash.h"
+
+#include "ex_pg_query_struct.h"
 
 #ifndef MAX_SQL_LENGTH
 #define MAX_SQL_LENGTH (16 * 1024 * 1024)
@@ -55,37 +59,6 @@ static ERL_NIF_TERM make_success(ErlNifEnv *env, const unsigned char *data,
   return enif_make_tuple2(env, enif_make_atom(env, "ok"), binary);
 }
 
-/**
- * Allocates a null-terminated string from a binary input using enif_alloc.
- * Caller must use enif_free to deallocate the returned string.
- *
- * @param binary The input binary to convert
- * @param error_term Output parameter for error term if allocation fails
- * @param env The NIF environment
- * @return char* Null-terminated string or NULL if allocation fails
- */
-static char *mk_cstr(const ErlNifBinary *binary, ERL_NIF_TERM *error_term,
-                     ErlNifEnv *env) {
-  // Check for overflow in size calculation
-  if (binary->size >= SIZE_MAX - 1) {
-    *error_term = make_error(env, "input size too large");
-    return NULL;
-  }
-
-  char *str = enif_alloc(binary->size + 1);
-  if (str == NULL) {
-    DEBUG_LOG("Memory allocation failed for string of size %zu",
-              binary->size + 1);
-    *error_term = make_error(env, "memory allocation failed");
-    return NULL;
-  }
-
-  memcpy(str, binary->data, binary->size);
-  str[binary->size] = '\0';
-
-  return str;
-}
-
 /**
  * Validates NIF arguments ensuring proper arity and binary input
  *
@@ -128,7 +101,9 @@ static bool validate_args(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[],
  *
  * @param env The NIF environment
  * @param error The PostgreSQL query error
- * @return ERL_NIF_TERM {:error, %{message: string, cursorpos: integer}}
+ * @return ERL_NIF_TERM {:error, %{message: string, cursorpos: integer}}, with
+ * a code (:memory_limit, :node_limit or :depth_limit) when a parse limit was
+ * exceeded
  */
 static ERL_NIF_TERM create_parse_error_map(ErlNifEnv *env,
                                            const PgQueryError *error) {
@@ -156,9 +131,484 @@ static ERL_NIF_TERM create_parse_error_map(ErlNifEnv *env,
     return make_error(env, "failed to create error map");
   }
 
+  static const char *codes[] = {
+      [PG_QUERY_ERROR_MEMORY_LIMIT] = "memory_limit",
+      [PG_QUERY_ERROR_NODE_LIMIT] = "node_limit",
+      [PG_QUERY_ERROR_DEPTH_LIMIT] = "depth_limit"};
+
+  if (error->code != PG_QUERY_ERROR_DEFAULT &&
+      !enif_make_map_put(env, error_map, enif_make_atom(env, "code"),
+                         enif_make_atom(env, codes[error->code]),
+                         &error_map)) {
+    DEBUG_LOG("Failed to add code to error map");
+    return make_error(env, "failed to create error map");
+  }
+
   return enif_make_tuple2(env, enif_make_atom(env, "error"), error_map);
 }
 
+/*
+ * Parse limits
+ *
+ * The parse_max_memory, parse_max_nodes and parse_max_depth load options are
+ * handed to libpg_query, which keeps its limits per thread, so every thread
+ * applies them before it parses for the first time. Parses that go over a
+ * limit fail early with a regular parse error.
+ */
+
+static PgQueryParseLimits parse_limits;
+static __thread bool parse_limits_applied;
+
+static void apply_parse_limits(void) {
+  if (!parse_limits_applied) {
+    pg_query_set_parse_limits(parse_limits);
+    parse_limits_applied = true;
+  }
+}
+
+/*
+ * Output binaries
+ *
+ * libpg_query allocates the output of a call (protobuf data, normalized or
+ * deparsed query) through output_alloc, which puts it in a binary, so that it
+ * can be returned with enif_make_binary instead of being copied. A thread
+ * holds at most one such binary at a time; other output buffers (only needed
+ * while several results are alive at once) are allocated with enif_alloc and
+ * copied as before.
+ */
+
+static __thread ErlNifBinary output_binary;
+static __thread bool output_binary_held;
+
+static void *output_alloc(size_t size) {
+  if (!output_binary_held && enif_alloc_binary(size, &output_binary)) {
+    output_binary_held = true;
+    return output_binary.data;
+  }
+
+  return enif_alloc(size);
+}
+
+static void output_free(void *ptr) {
+  if (output_binary_held && ptr == output_binary.data) {
+    enif_release_binary(&output_binary);
+    output_binary_held = false;
+  } else {
+    enif_free(ptr);
+  }
+}
+
+static const PgQueryOutputAllocator output_allocator = {output_alloc,
+                                                        output_free};
+
+/**
+ * Creates a binary for output allocated by libpg_query. If the output is in
+ * the thread's output binary, that binary is returned without copying, and
+ * *data is set to NULL so that freeing the result leaves it alone.
+ *
+ * @param env The NIF environment
+ * @param data Pointer to the result field holding the output
+ * @param len The length of the output
+ * @return ERL_NIF_TERM binary
+ */
+static ERL_NIF_TERM make_output_binary(ErlNifEnv *env, char **data,
+                                       size_t len) {
+  ERL_NIF_TERM binary;
+
+  // Drop anything after the output, e.g. the NUL byte of a string
+  if (!output_binary_held || (unsigned char *)*data != output_binary.data ||
+      (len != output_binary.size &&
+       !enif_realloc_binary(&output_binary, len))) {
+    unsigned char *binary_data = enif_make_new_binary(env, len, &binary);
+    memcpy(binary_data, *data, len);
+    return binary;
+  }
+
+  binary = enif_make_binary(env, &output_binary);
+  output_binary_held = false;
+  *data = NULL;
+
+  return binary;
+}
+
+/**
+ * Creates a success tuple of the form {:ok, data} for output allocated by
+ * libpg_query, see make_output_binary
+ *
+ * @return ERL_NIF_TERM {:ok, binary}
+ */
+static ERL_NIF_TERM make_output_success(ErlNifEnv *env, char **data,
+                                        size_t len) {
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"),
+                          make_output_binary(env, data, len));
+}
+
+/*
+ * Result cache
+ *
+ * Optional cache for fingerprint/1 and normalize/1, keyed by the 128-bit XXH3
+ * hash of the query text. It is split into shards that each have their own
+ * lock, hash table and share of the memory budget, and a shard that goes over
+ * its budget evicts entries using the CLOCK algorithm. An entry is created by
+ * whichever function sees a query first; the other result is filled in the
+ * first time it is asked for. Errors are not cached.
+ *
+ * The cache is configured when the NIF is loaded, and is disabled unless a
+ * cache_size is given.
+ */
+
+#define CACHE_DEFAULT_SHARDS 16
+
+// Used to size the hash tables from the memory budget
+#define CACHE_EXPECTED_ENTRY_SIZE 256
+
+typedef struct CacheEntry {
+  XXH128_hash_t key;
+  struct CacheEntry *bucket_next;
+  struct CacheEntry *clock_prev;
+  struct CacheEntry *clock_next;
+  size_t size; // bytes charged to the shard
+  bool referenced;
+
+  bool has_fingerprint;
+  uint64_t fingerprint;
+  char *normalized; // NULL until normalize/1 has seen the query
+  size_t normalized_len;
+} CacheEntry;
+
+typedef struct CacheShard {
+  ErlNifMutex *lock;
+  CacheEntry **buckets;
+  size_t bucket_mask;
+  CacheEntry *hand; // CLOCK hand, NULL when the shard is empty
+  size_t bytes;
+  size_t n_entries;
+
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+} CacheShard;
+
+typedef struct QueryCache {
+  CacheShard *shards;
+  unsigned n_shards; // 0 when the cache is disabled
+  size_t shard_budget;
+} QueryCache;
+
+static QueryCache query_cache;
+
+static CacheShard *cache_shard(XXH128_hash_t key) {
+  return &query_cache.shards[key.high64 & (query_cache.n_shards - 1)];
+}
+
+static CacheEntry **cache_bucket(CacheShard *shard, XXH128_hash_t key) {
+  return &shard->buckets[key.low64 & shard->bucket_mask];
+}
+
+static CacheEntry *cache_find(CacheShard *shard, XXH128_hash_t key) {
+  for (CacheEntry *entry = *cache_bucket(shard, key); entry != NULL;
+       entry = entry->bucket_next) {
+    if (XXH128_isEqual(entry->key, key)) {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+static void cache_remove(CacheShard *shard, CacheEntry *entry) {
+  CacheEntry **link = cache_bucket(shard, entry->key);
+  while (*link != entry) {
+    link = &(*link)->bucket_next;
+  }
+  *link = entry->bucket_next;
+
+  if (entry->clock_next == entry) {
+    shard->hand = NULL;
+  } else {
+    entry->clock_prev->clock_next = entry->clock_next;
+    entry->clock_next->clock_prev = entry->clock_prev;
+    if (shard->hand == entry) {
+      shard->hand = entry->clock_next;
+    }
+  }
+
+  shard->bytes -= entry->size;
+  shard->n_entries--;
+  enif_free(entry->normalized);
+  enif_free(entry);
+}
+
+/**
+ * Evicts entries until another `needed` bytes fit into the shard budget.
+ * Entries that were used since the hand last passed them get a second chance.
+ *
+ * @param shard The locked shard
+ * @param needed Number of bytes about to be added
+ * @param keep Entry that must not be evicted (may be NULL)
+ */
+static void cache_evict(CacheShard *shard, size_t needed, CacheEntry *keep) {
+  while (shard->hand != NULL &&
+         shard->bytes + needed > query_cache.shard_budget) {
+    CacheEntry *entry = shard->hand;
+
+    if (entry == keep) {
+      if (shard->n_entries == 1) {
+        break;
+      }
+      shard->hand = entry->clock_next;
+    } else if (entry->referenced) {
+      entry->referenced = false;
+      shard->hand = entry->clock_next;
+    } else {
+      cache_remove(shard, entry);
+      shard->evictions++;
+    }
+  }
+}
+
+/**
+ * Finds or creates the entry for a key and charges `extra` bytes to it,
+ * evicting other entries as needed
+ *
+ * @param shard The locked shard
+ * @param key Hash of the query text
+ * @param extra Number of bytes the caller is about to store in the entry
+ * @return CacheEntry* the entry, or NULL if it wouldn't fit into the budget
+ */
+static CacheEntry *cache_reserve(CacheShard *shard, XXH128_hash_t key,
+                                 size_t extra) {
+  CacheEntry *entry = cache_find(shard, key);
+  size_t needed = extra + (entry == NULL ? sizeof(CacheEntry) : 0);
+
+  if (needed + (entry == NULL ? 0 : entry->size) > query_cache.shard_budget) {
+    return NULL;
+  }
+
+  cache_evict(shard, needed, entry);
+
+  if (entry == NULL) {
+    entry = enif_alloc(sizeof(CacheEntry));
+    if (entry == NULL) {
+      return NULL;
+    }
+    memset(entry, 0, sizeof(CacheEntry));
+    entry->key = key;
+    entry->size = sizeof(CacheEntry);
+
+    CacheEntry **bucket = cache_bucket(shard, key);
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+
+    // New entries go right behind the hand, so they are looked at last
+    if (shard->hand == NULL) {
+      entry->clock_prev = entry->clock_next = entry;
+      shard->hand = entry;
+    } else {
+      entry->clock_next = shard->hand;
+      entry->clock_prev = shard->hand->clock_prev;
+      entry->clock_prev->clock_next = entry;
+      shard->hand->clock_prev = entry;
+    }
+
+    shard->bytes += sizeof(CacheEntry);
+    shard->n_entries++;
+  }
+
+  entry->referenced = true;
+  entry->size += extra;
+  shard->bytes += extra;
+
+  return entry;
+}
+
+static bool cache_get_fingerprint(XXH128_hash_t key, uint64_t *fingerprint) {
+  CacheShard *shard = cache_shard(key);
+
+  enif_mutex_lock(shard->lock);
+  CacheEntry *entry = cache_find(shard, key);
+  bool found = entry != NULL && entry->has_fingerprint;
+  if (found) {
+    entry->referenced = true;
+    *fingerprint = entry->fingerprint;
+    shard->hits++;
+  } else {
+    shard->misses++;
+  }
+  enif_mutex_unlock(shard->lock);
+
+  return found;
+}
+
+static void cache_put_fingerprint(XXH128_hash_t key, uint64_t fingerprint) {
+  CacheShard *shard = cache_shard(key);
+
+  enif_mutex_lock(shard->lock);
+  CacheEntry *entry = cache_reserve(shard, key, 0);
+  if (entry != NULL) {
+    entry->has_fingerprint = true;
+    entry->fingerprint = fingerprint;
+  }
+  enif_mutex_unlock(shard->lock);
+}
+
+/**
+ * Looks up the normalized text of a query, creating the binary for it while
+ * the shard is still locked
+ *
+ * @param env The NIF environment
+ * @param key Hash of the query text
+ * @param normalized Output parameter for the normalized query binary
+ * @return bool true on a cache hit
+ */
+static bool cache_get_normalized(ErlNifEnv *env, XXH128_hash_t key,
+                                 ERL_NIF_TERM *normalized) {
+  CacheShard *shard = cache_shard(key);
+
+  enif_mutex_lock(shard->lock);
+  CacheEntry *entry = cache_find(shard, key);
+  bool found = entry != NULL && entry->normalized != NULL;
+  if (found) {
+    entry->referenced = true;
+    unsigned char *data =
+        enif_make_new_binary(env, entry->normalized_len, normalized);
+    memcpy(data, entry->normalized, entry->normalized_len);
+    shard->hits++;
+  } else {
+    shard->misses++;
+  }
+  enif_mutex_unlock(shard->lock);
+
+  return found;
+}
+
+static void cache_put_normalized(XXH128_hash_t key, const char *normalized,
+                                 size_t len) {
+  CacheShard *shard = cache_shard(key);
+
+  enif_mutex_lock(shard->lock);
+  CacheEntry *entry = cache_find(shard, key);
+  if (entry == NULL || entry->normalized == NULL) {
+    entry = cache_reserve(shard, key, len);
+    char *copy = entry == NULL ? NULL : enif_alloc(len);
+    if (copy != NULL) {
+      memcpy(copy, normalized, len);
+      entry->normalized = copy;
+      entry->normalized_len = len;
+    } else if (entry != NULL) {
+      entry->size -= len;
+      shard->bytes -= len;
+    }
+  }
+  enif_mutex_unlock(shard->lock);
+}
+
+/**
+ * Sets up the cache shards
+ *
+ * @param max_bytes Total memory budget, 0 disables the cache
+ * @param n_shards Number of shards, rounded up to a power of two
+ * @return bool false if allocation fails
+ */
+static bool cache_init(size_t max_bytes, unsigned n_shards) {
+  if (max_bytes == 0) {
+    return true;
+  }
+
+  unsigned shards = 1;
+  while (shards < n_shards && shards < (1u << 16)) {
+    shards <<= 1;
+  }
+
+  size_t buckets = 16;
+  while (buckets * CACHE_EXPECTED_ENTRY_SIZE < max_bytes / shards &&
+         buckets < ((size_t)1 << 24)) {
+    buckets <<= 1;
+  }
+
+  query_cache.shards = enif_alloc(shards * sizeof(CacheShard));
+  if (query_cache.shards == NULL) {
+    return false;
+  }
+  memset(query_cache.shards, 0, shards * sizeof(CacheShard));
+  query_cache.n_shards = shards;
+  query_cache.shard_budget = max_bytes / shards;
+
+  for (unsigned i = 0; i < shards; i++) {
+    CacheShard *shard = &query_cache.shards[i];
+    shard->lock = enif_mutex_create("ex_pg_query_cache_shard");
+    shard->buckets = enif_alloc(buckets * sizeof(CacheEntry *));
+    if (shard->lock == NULL || shard->buckets == NULL) {
+      return false;
+    }
+    memset(shard->buckets, 0, buckets * sizeof(CacheEntry *));
+    shard->bucket_mask = buckets - 1;
+  }
+
+  DEBUG_LOG("Result cache enabled: %zu bytes in %u shards", max_bytes, shards);
+
+  return true;
+}
+
+static void cache_destroy(void) {
+  for (unsigned i = 0; i < query_cache.n_shards; i++) {
+    CacheShard *shard = &query_cache.shards[i];
+    while (shard->hand != NULL) {
+      cache_remove(shard, shard->hand);
+    }
+    if (shard->lock != NULL) {
+      enif_mutex_destroy(shard->lock);
+    }
+    enif_free(shard->buckets);
+  }
+
+  enif_free(query_cache.shards);
+  memset(&query_cache, 0, sizeof(query_cache));
+}
+
+/**
+ * Returns the result cache counters, summed over all shards
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects none
+ * @return ERL_NIF_TERM {:ok, %{hits: integer, misses: integer,
+ * evictions: integer, entries: integer, memory: integer, max_memory: integer}}
+ */
+static ERL_NIF_TERM cache_stats(ErlNifEnv *env, int argc,
+                                const ERL_NIF_TERM argv[]) {
+  uint64_t hits = 0, misses = 0, evictions = 0, entries = 0, bytes = 0;
+
+  for (unsigned i = 0; i < query_cache.n_shards; i++) {
+    CacheShard *shard = &query_cache.shards[i];
+    enif_mutex_lock(shard->lock);
+    hits += shard->hits;
+    misses += shard->misses;
+    evictions += shard->evictions;
+    entries += shard->n_entries;
+    bytes += shard->bytes;
+    enif_mutex_unlock(shard->lock);
+  }
+
+  ERL_NIF_TERM keys[] = {
+      enif_make_atom(env, "hits"),    enif_make_atom(env, "misses"),
+      enif_make_atom(env, "evictions"), enif_make_atom(env, "entries"),
+      enif_make_atom(env, "memory"),  enif_make_atom(env, "max_memory")};
+  ERL_NIF_TERM values[] = {
+      enif_make_uint64(env, hits),      enif_make_uint64(env, misses),
+      enif_make_uint64(env, evictions), enif_make_uint64(env, entries),
+      enif_make_uint64(env, bytes),
+      enif_make_uint64(env, (uint64_t)query_cache.shard_budget *
+                                query_cache.n_shards)};
+  ERL_NIF_TERM map;
+
+  if (!enif_make_map_from_arrays(env, keys, values, 6, &map)) {
+    return make_error(env, "failed to create result map");
+  }
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+}
+
 /**
  * Deparses a PostgreSQL query from its protobuf representation back to SQL
  *
@@ -214,44 +664,159 @@ static ERL_NIF_TERM deparse_protobuf(ErlNifEnv *env, int argc,
 
   DEBUG_LOG("Deparse successful");
   ERL_NIF_TERM ok_term =
-      make_success(env, (unsigned char *)result.query, strlen(result.query));
+      make_output_success(env, &result.query, strlen(result.query));
+
+  pg_query_free_deparse_result(result);
+  return ok_term;
+}
+
+/**
+ * Deparses a single node from its protobuf representation back to SQL
+ *
+ * Takes a binary containing a protobuf-encoded Node - a statement, an
+ * expression, a type name, a relation, a target list or a list of
+ * expressions - and converts it to SQL text on its own, without wrapping it
+ * in a statement.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument
+ * @return ERL_NIF_TERM {:ok, sql_binary} | {:error, reason}
+ */
+static ERL_NIF_TERM deparse_node_protobuf(ErlNifEnv *env, int argc,
+                                          const ERL_NIF_TERM argv[]) {
+  ErlNifBinary input_binary;
+  ERL_NIF_TERM error_term;
+
+  DEBUG_LOG("Starting deparse_node_protobuf");
+
+  if (!validate_args(env, argc, argv, &input_binary, &error_term,
+                     MAX_PROTOBUF_LENGTH)) {
+    return error_term;
+  }
+
+  // An invalid message is reported as an error by libpg_query itself
+  PgQueryProtobuf protobuf = {.len = input_binary.size,
+                              .data = (char *)input_binary.data};
+
+  DEBUG_LOG("Deparsing protobuf node of size %zu", protobuf.len);
+  PgQueryDeparseResult result = pg_query_deparse_node_protobuf(protobuf);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Deparse error: %s", result.error->message);
+    ERL_NIF_TERM error_term = make_error(env, result.error->message);
+    pg_query_free_deparse_result(result);
+    return error_term;
+  }
+
+  DEBUG_LOG("Deparse successful");
+  ERL_NIF_TERM ok_term =
+      make_output_success(env, &result.query, strlen(result.query));
+
+  pg_query_free_deparse_result(result);
+  return ok_term;
+}
+
+/**
+ * Deparses a tree of PgQuery structs back to SQL
+ *
+ * Takes a %PgQuery.ParseResult{} or a %PgQuery.Node{} as decoded by Protox
+ * and reads it into parse nodes directly, so the tree doesn't have to be
+ * encoded to protobuf on the Elixir side and decoded again here.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one struct argument
+ * @return ERL_NIF_TERM {:ok, sql_binary} | {:error, reason}
+ */
+static ERL_NIF_TERM deparse_struct(ErlNifEnv *env, int argc,
+                                   const ERL_NIF_TERM argv[]) {
+  DEBUG_LOG("Starting deparse_struct");
+
+  if (argc != 1 || !enif_is_map(env, argv[0])) {
+    return make_error(env, "expected a PgQuery struct");
+  }
+
+  PgQueryDeparseResult result = deparse_struct_tree(env, argv[0]);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Deparse error: %s", result.error->message);
+    ERL_NIF_TERM error_term = make_error(env, result.error->message);
+    pg_query_free_deparse_result(result);
+    return error_term;
+  }
+
+  DEBUG_LOG("Deparse successful");
+  ERL_NIF_TERM ok_term =
+      make_output_success(env, &result.query, strlen(result.query));
 
   pg_query_free_deparse_result(result);
   return ok_term;
 }
 
+/**
+ * Reads the optional maximum list length of parse_protobuf/2 and
+ * fingerprint/2 into libpg_query parser options
+ *
+ * Constant lists with more items than the maximum are collapsed while
+ * parsing, see PG_QUERY_COLLAPSE_LISTS. Without the argument nothing is
+ * collapsed.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments, the second one being the maximum
+ * @param parser_options Set to the parser options on success
+ * @return bool true if the maximum is left out or an integer from 1 to 32767
+ */
+static bool get_collapse_lists_options(ErlNifEnv *env, int argc,
+                                       const ERL_NIF_TERM argv[],
+                                       int *parser_options) {
+  int max_length = 0;
+
+  if (argc == 2 && (!enif_get_int(env, argv[1], &max_length) ||
+                    max_length < 1 || max_length > 32767)) {
+    return false;
+  }
+
+  *parser_options = PG_QUERY_COLLAPSE_LISTS(max_length);
+  return true;
+}
+
 /**
  * Parses a SQL query into its protobuf representation
  *
- * Takes a SQL query string and returns its protobuf-encoded parse tree.
+ * Takes a SQL query string and returns its protobuf-encoded parse tree. With
+ * a maximum list length, longer constant lists are collapsed into an IntList
+ * of their item count, location and length.
  *
  * @param env The NIF environment
  * @param argc Number of arguments
  * @param argv Array of arguments - expects one binary argument containing SQL
+ * and optionally the maximum list length
  * @return ERL_NIF_TERM {:ok, protobuf_binary} | {:error, reason}
  */
 static ERL_NIF_TERM parse_protobuf(ErlNifEnv *env, int argc,
                                    const ERL_NIF_TERM argv[]) {
   ErlNifBinary query_binary;
   ERL_NIF_TERM error_term;
+  int parser_options;
 
   DEBUG_LOG("Starting parse_protobuf");
 
-  if (!validate_args(env, argc, argv, &query_binary, &error_term,
-                     MAX_SQL_LENGTH)) {
-    return error_term;
+  if (!get_collapse_lists_options(env, argc, argv, &parser_options)) {
+    return make_error(env, "invalid options");
   }
 
-  char *query_str = mk_cstr(&query_binary, &error_term, env);
-
-  if (query_str == NULL) {
+  if (!validate_args(env, argc > 1 ? 1 : argc, argv, &query_binary,
+                     &error_term, MAX_SQL_LENGTH)) {
     return error_term;
   }
 
   // Parse the query
   DEBUG_LOG("Parsing query of size %zu", query_binary.size);
-  PgQueryProtobufParseResult result = pg_query_parse_protobuf(query_str);
-  enif_free(query_str);
+  apply_parse_limits();
+  PgQueryProtobufParseResult result = pg_query_parse_protobuf_opts_n(
+      (const char *)query_binary.data, query_binary.size, parser_options);
 
   if (result.error != NULL) {
     DEBUG_LOG("Parse error: %s at position %d", result.error->message,
@@ -263,57 +828,77 @@ static ERL_NIF_TERM parse_protobuf(ErlNifEnv *env, int argc,
   }
 
   DEBUG_LOG("Parse successful");
-  ERL_NIF_TERM ok_term = make_success(
-      env, (unsigned char *)result.parse_tree.data, result.parse_tree.len);
+  ERL_NIF_TERM ok_term = make_output_success(env, &result.parse_tree.data,
+                                             result.parse_tree.len);
 
   pg_query_free_protobuf_parse_result(result);
   return ok_term;
 }
 
 /**
- * Generates a unique fingerprint for a SQL query
+ * Parses a SQL query into its JSON representation
  *
- * The fingerprint can be used to identify similar queries that differ only
- * in their literal values.
+ * Gives consumers outside the BEAM that read JSON the same tree as
+ * parse_protobuf/1, without a protobuf dependency.
  *
  * @param env The NIF environment
  * @param argc Number of arguments
  * @param argv Array of arguments - expects one binary argument containing SQL
- * @return ERL_NIF_TERM {:ok, %{fingerprint: integer, fingerprint_str: binary}}
- * | {:error, reason}
+ * @return ERL_NIF_TERM {:ok, json_binary} | {:error, reason}
  */
-static ERL_NIF_TERM fingerprint(ErlNifEnv *env, int argc,
-                                const ERL_NIF_TERM argv[]) {
+static ERL_NIF_TERM parse_json(ErlNifEnv *env, int argc,
+                               const ERL_NIF_TERM argv[]) {
   ErlNifBinary query_binary;
   ERL_NIF_TERM error_term;
 
-  DEBUG_LOG("Starting fingerprint calculation");
+  DEBUG_LOG("Starting parse_json");
 
   if (!validate_args(env, argc, argv, &query_binary, &error_term,
                      MAX_SQL_LENGTH)) {
     return error_term;
   }
 
-  char *query_str = mk_cstr(&query_binary, &error_term, env);
-
-  if (query_str == NULL) {
-    return error_term;
-  }
-
-  // Calculate fingerprint
-  DEBUG_LOG("Calculating fingerprint for query of size %zu", query_binary.size);
-  PgQueryFingerprintResult result = pg_query_fingerprint(query_str);
-  enif_free(query_str); // Free the query string as we don't need it anymore
+  DEBUG_LOG("Parsing query of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryParseResult result =
+      pg_query_parse_n((const char *)query_binary.data, query_binary.size);
 
   if (result.error != NULL) {
-    DEBUG_LOG("Fingerprint error: %s", result.error->message);
-    ERL_NIF_TERM error_term = make_error(env, result.error->message);
-    pg_query_free_fingerprint_result(result);
+    DEBUG_LOG("Parse error: %s at position %d", result.error->message,
+              result.error->cursorpos);
+
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_parse_result(result);
     return error_term;
   }
 
-  // Create result map
-  ERL_NIF_TERM map = enif_make_new_map(env);
+  DEBUG_LOG("Parse successful");
+  ERL_NIF_TERM ok_term = make_output_success(env, &result.parse_tree,
+                                             strlen(result.parse_tree));
+
+  pg_query_free_parse_result(result);
+  return ok_term;
+}
+
+/**
+ * Converts a fingerprint result into a result tuple
+ *
+ * The result is not freed, the caller remains responsible for that.
+ *
+ * @param env The NIF environment
+ * @param result The libpg_query fingerprint result
+ * @return ERL_NIF_TERM {:ok, %{fingerprint: integer, fingerprint_str: binary}}
+ * | {:error, reason}
+ */
+static ERL_NIF_TERM make_fingerprint_result(ErlNifEnv *env,
+                                            PgQueryFingerprintResult result) {
+  if (result.error != NULL) {
+    DEBUG_LOG("Fingerprint error: %s", result.error->message);
+    return create_parse_error_map(env, result.error);
+  }
+
+  // Create result map
+  ERL_NIF_TERM map = enif_make_new_map(env);
   ERL_NIF_TERM fingerprint_int, fingerprint_str;
 
   // Convert uint64_t to ERL_NIF_TERM
@@ -332,19 +917,184 @@ static ERL_NIF_TERM fingerprint(ErlNifEnv *env, int argc,
       !enif_make_map_put(env, map, enif_make_atom(env, "fingerprint_str"),
                          fingerprint_str, &map)) {
     DEBUG_LOG("Failed to create result map");
-    pg_query_free_fingerprint_result(result);
     return make_error(env, "failed to create result map");
   }
 
-  DEBUG_LOG("Fingerprint calculation successful");
-
   // Create the final success tuple with the map
-  ERL_NIF_TERM ok_term = enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+}
+
+/**
+ * Generates a unique fingerprint for a SQL query
+ *
+ * The fingerprint can be used to identify similar queries that differ only
+ * in their literal values. A maximum list length collapses longer constant
+ * lists while parsing, which gives the same fingerprint with less work, so
+ * the cache is shared with fingerprint/1.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * and optionally the maximum list length
+ * @return ERL_NIF_TERM {:ok, %{fingerprint: integer, fingerprint_str: binary}}
+ * | {:error, reason}
+ */
+static ERL_NIF_TERM fingerprint(ErlNifEnv *env, int argc,
+                                const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+  int parser_options;
+
+  DEBUG_LOG("Starting fingerprint calculation");
+
+  if (!get_collapse_lists_options(env, argc, argv, &parser_options)) {
+    return make_error(env, "invalid options");
+  }
+
+  if (!validate_args(env, argc > 1 ? 1 : argc, argv, &query_binary,
+                     &error_term, MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  XXH128_hash_t cache_key;
+  if (query_cache.n_shards > 0) {
+    cache_key = XXH3_128bits(query_binary.data, query_binary.size);
+
+    uint64_t cached;
+    if (cache_get_fingerprint(cache_key, &cached)) {
+      char cached_str[17];
+      snprintf(cached_str, sizeof(cached_str), "%016" PRIx64, cached);
+      PgQueryFingerprintResult cached_result = {cached, cached_str, NULL, NULL};
+      return make_fingerprint_result(env, cached_result);
+    }
+  }
+
+  // Calculate fingerprint
+  DEBUG_LOG("Calculating fingerprint for query of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryFingerprintResult result = pg_query_fingerprint_opts_n(
+      (const char *)query_binary.data, query_binary.size, parser_options);
+
+  if (query_cache.n_shards > 0 && result.error == NULL) {
+    cache_put_fingerprint(cache_key, result.fingerprint);
+  }
+
+  ERL_NIF_TERM result_term = make_fingerprint_result(env, result);
 
   // Free the libpg_query result
   pg_query_free_fingerprint_result(result);
 
-  return ok_term;
+  return result_term;
+}
+
+/**
+ * Converts a subtree node type name (e.g. "SelectStmt") into the snake_case
+ * atom used for the corresponding PgQuery.Node oneof (e.g. :select_stmt)
+ *
+ * @param env The NIF environment
+ * @param node_type The node type name
+ * @return ERL_NIF_TERM atom
+ */
+static ERL_NIF_TERM make_node_type_atom(ErlNifEnv *env, const char *node_type) {
+  if (strcmp(node_type, "SelectStmt") == 0) {
+    return enif_make_atom(env, "select_stmt");
+  } else if (strcmp(node_type, "CommonTableExpr") == 0) {
+    return enif_make_atom(env, "common_table_expr");
+  } else if (strcmp(node_type, "SubLink") == 0) {
+    return enif_make_atom(env, "sub_link");
+  } else if (strcmp(node_type, "RangeSubselect") == 0) {
+    return enif_make_atom(env, "range_subselect");
+  }
+
+  return enif_make_atom(env, "unknown");
+}
+
+/**
+ * Generates the fingerprint of a SQL query along with the fingerprints of
+ * every statement, subquery and CTE in it, computed in a single pass
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * @return ERL_NIF_TERM {:ok, %{fingerprint: integer, fingerprint_str: binary,
+ * subtrees: [%{node_type: atom, location: integer | nil, parent: integer |
+ * nil, fingerprint: integer}]}} | {:error, reason}
+ */
+static ERL_NIF_TERM fingerprint_subtrees(ErlNifEnv *env, int argc,
+                                         const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+
+  DEBUG_LOG("Starting subtree fingerprint calculation");
+
+  if (!validate_args(env, argc, argv, &query_binary, &error_term,
+                     MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Calculating subtree fingerprints for query of size %zu",
+            query_binary.size);
+  apply_parse_limits();
+  PgQueryFingerprintSubtreesResult result =
+      pg_query_fingerprint_subtrees_n((const char *)query_binary.data,
+                                      query_binary.size);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Fingerprint error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_fingerprint_subtrees_result(result);
+    return error_term;
+  }
+
+  ERL_NIF_TERM nil = enif_make_atom(env, "nil");
+  ERL_NIF_TERM keys[] = {
+      enif_make_atom(env, "node_type"), enif_make_atom(env, "location"),
+      enif_make_atom(env, "parent"), enif_make_atom(env, "fingerprint")};
+
+  // Build the list back to front so it ends up in tree order
+  ERL_NIF_TERM subtrees = enif_make_list(env, 0);
+  for (int i = result.n_subtrees - 1; i >= 0; i--) {
+    PgQueryFingerprintSubtree *subtree = &result.subtrees[i];
+    ERL_NIF_TERM values[] = {
+        make_node_type_atom(env, subtree->node_type),
+        subtree->location >= 0 ? enif_make_int(env, subtree->location) : nil,
+        subtree->parent >= 0 ? enif_make_int(env, subtree->parent) : nil,
+        enif_make_uint64(env, (unsigned long long)subtree->fingerprint)};
+    ERL_NIF_TERM map;
+
+    if (!enif_make_map_from_arrays(env, keys, values, 4, &map)) {
+      DEBUG_LOG("Failed to create subtree map");
+      pg_query_free_fingerprint_subtrees_result(result);
+      return make_error(env, "failed to create result map");
+    }
+
+    subtrees = enif_make_list_cell(env, map, subtrees);
+  }
+
+  ERL_NIF_TERM map = enif_make_new_map(env);
+  ERL_NIF_TERM fingerprint_str;
+  size_t fingerprint_str_len = strlen(result.fingerprint_str);
+  unsigned char *str_binary =
+      enif_make_new_binary(env, fingerprint_str_len, &fingerprint_str);
+  memcpy(str_binary, result.fingerprint_str, fingerprint_str_len);
+
+  if (!enif_make_map_put(env, map, enif_make_atom(env, "fingerprint"),
+                         enif_make_uint64(
+                             env, (unsigned long long)result.fingerprint),
+                         &map) ||
+      !enif_make_map_put(env, map, enif_make_atom(env, "fingerprint_str"),
+                         fingerprint_str, &map) ||
+      !enif_make_map_put(env, map, enif_make_atom(env, "subtrees"), subtrees,
+                         &map)) {
+    DEBUG_LOG("Failed to create result map");
+    pg_query_free_fingerprint_subtrees_result(result);
+    return make_error(env, "failed to create result map");
+  }
+
+  DEBUG_LOG("Subtree fingerprint calculation successful");
+
+  pg_query_free_fingerprint_subtrees_result(result);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
 }
 
 /**
@@ -369,16 +1119,10 @@ static ERL_NIF_TERM scan(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
     return error_term;
   }
 
-  char *query_str = mk_cstr(&query_binary, &error_term, env);
-
-  if (query_str == NULL) {
-    return error_term;
-  }
-
   // Scan the query
   DEBUG_LOG("Scanning query of size %zu", query_binary.size);
-  PgQueryScanResult result = pg_query_scan(query_str);
-  enif_free(query_str); // Free the query string as we don't need it anymore
+  PgQueryScanResult result =
+      pg_query_scan_n((const char *)query_binary.data, query_binary.size);
 
   if (result.error != NULL) {
     DEBUG_LOG("Scan error: %s", result.error->message);
@@ -390,7 +1134,7 @@ static ERL_NIF_TERM scan(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
   // Create success term with the protobuf data
   DEBUG_LOG("Scan successful");
   ERL_NIF_TERM ok_term =
-      make_success(env, (unsigned char *)result.pbuf.data, result.pbuf.len);
+      make_output_success(env, &result.pbuf.data, result.pbuf.len);
 
   // Free the scan result
   pg_query_free_scan_result(result);
@@ -420,29 +1164,38 @@ static ERL_NIF_TERM normalize(ErlNifEnv *env, int argc,
     return error_term;
   }
 
-  char *query_str = mk_cstr(&query_binary, &error_term, env);
+  XXH128_hash_t cache_key;
+  if (query_cache.n_shards > 0) {
+    cache_key = XXH3_128bits(query_binary.data, query_binary.size);
 
-  if (query_str == NULL) {
-    return error_term;
+    ERL_NIF_TERM cached;
+    if (cache_get_normalized(env, cache_key, &cached)) {
+      return enif_make_tuple2(env, enif_make_atom(env, "ok"), cached);
+    }
   }
 
   // Normalize the query
   DEBUG_LOG("Normalizing query of size %zu", query_binary.size);
-  PgQueryNormalizeResult result = pg_query_normalize(query_str);
-  enif_free(query_str);
+  apply_parse_limits();
+  PgQueryNormalizeResult result =
+      pg_query_normalize_n((const char *)query_binary.data, query_binary.size);
+
+  if (query_cache.n_shards > 0 && result.error == NULL) {
+    cache_put_normalized(cache_key, result.normalized_query,
+                         strlen(result.normalized_query));
+  }
 
   if (result.error != NULL) {
     DEBUG_LOG("Normalize error: %s", result.error->message);
-    ERL_NIF_TERM error_term = make_error(env, result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
     pg_query_free_normalize_result(result);
     return error_term;
   }
 
   // Create success term with the normalized query
   DEBUG_LOG("Normalize successful");
-  ERL_NIF_TERM ok_term =
-      make_success(env, (unsigned char *)result.normalized_query,
-                   strlen(result.normalized_query));
+  ERL_NIF_TERM ok_term = make_output_success(
+      env, &result.normalized_query, strlen(result.normalized_query));
 
   // Free the normalize result
   pg_query_free_normalize_result(result);
@@ -450,25 +1203,1755 @@ static ERL_NIF_TERM normalize(ErlNifEnv *env, int argc,
 }
 
 /**
- * ExPgQuery NIF Implementation
+ * Copies a NUL-terminated string into a new binary
+ */
+static ERL_NIF_TERM make_c_string_binary(ErlNifEnv *env, const char *str) {
+  ERL_NIF_TERM binary;
+  size_t len = strlen(str);
+  memcpy(enif_make_new_binary(env, len, &binary), str, len);
+  return binary;
+}
+
+/**
+ * Converts a param ref to a %{location: integer, length: integer} map, with
+ * typename: [binary] added for param refs that are cast
+ */
+static ERL_NIF_TERM make_param_ref(ErlNifEnv *env,
+                                   const PgQueryParamRef *param_ref) {
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "location"),
+                         enif_make_atom(env, "length"),
+                         enif_make_atom(env, "typename")};
+  ERL_NIF_TERM values[3];
+  ERL_NIF_TERM map;
+
+  values[0] = enif_make_int(env, param_ref->location);
+  values[1] = enif_make_int(env, param_ref->length);
+  values[2] = enif_make_list(env, 0);
+  for (int i = param_ref->n_type_names - 1; i >= 0; i--) {
+    values[2] = enif_make_list_cell(
+        env, make_c_string_binary(env, param_ref->type_names[i]), values[2]);
+  }
+
+  enif_make_map_from_arrays(env, keys, values,
+                            param_ref->type_names != NULL ? 3 : 2, &map);
+  return map;
+}
+
+/**
+ * Returns the location and length of each param ref (e.g. $1) in a query
  *
- * This module provides NIFs for PostgreSQL query parsing, deparsing,
- * scanning and fingerprinting functionality. It wraps the libpg_query
- * library to provide these capabilities to Elixir applications.
+ * The param refs are collected by libpg_query while walking the raw parse
+ * tree, so no parse tree has to be decoded on the Elixir side.
  *
- * The module exposes four main functions:
- * - parse_protobuf/1: Parses SQL to protobuf format
- * - deparse_protobuf/1: Converts protobuf back to SQL
- * - scan/1: Performs lexical analysis of SQL
- * - fingerprint/1: Generates query fingerprints
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * @return ERL_NIF_TERM {:ok, [%{location: integer, length: integer}]}
+ * | {:error, reason}
+ */
+static ERL_NIF_TERM param_refs(ErlNifEnv *env, int argc,
+                               const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+
+  DEBUG_LOG("Starting param_refs");
+
+  if (!validate_args(env, argc, argv, &query_binary, &error_term,
+                     MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Finding param refs in query of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryParamRefsResult result = pg_query_param_refs_n(
+      (const char *)query_binary.data, query_binary.size);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Param refs error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_param_refs_result(result);
+    return error_term;
+  }
+
+  ERL_NIF_TERM list = enif_make_list(env, 0);
+  for (int i = result.n_param_refs - 1; i >= 0; i--) {
+    list = enif_make_list_cell(env, make_param_ref(env, &result.param_refs[i]),
+                               list);
+  }
+
+  DEBUG_LOG("Found %d param refs", result.n_param_refs);
+  pg_query_free_param_refs_result(result);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), list);
+}
+
+/**
+ * Classifies the statements of a SQL query without parsing it where the
+ * leading tokens of each statement settle its type
  *
- * All functions expect binary input and return tagged tuples:
- * {:ok, result} | {:error, reason}
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * @return ERL_NIF_TERM {:ok, %{statement_types: [atom], read_only: boolean}}
+ * | {:error, reason}
+ */
+static ERL_NIF_TERM classify(ErlNifEnv *env, int argc,
+                             const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+
+  DEBUG_LOG("Starting classify");
+
+  if (!validate_args(env, argc, argv, &query_binary, &error_term,
+                     MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Classifying query of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryClassifyResult result =
+      pg_query_classify_n((const char *)query_binary.data, query_binary.size);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Classify error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_classify_result(result);
+    return error_term;
+  }
+
+  // Build the list back to front so it ends up in statement order
+  ERL_NIF_TERM statement_types = enif_make_list(env, 0);
+  bool read_only = true;
+  for (int i = result.n_stmts - 1; i >= 0; i--) {
+    statement_types = enif_make_list_cell(
+        env, enif_make_atom(env, result.stmts[i].stmt_type), statement_types);
+    read_only = read_only && result.stmts[i].read_only;
+  }
+
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "statement_types"),
+                         enif_make_atom(env, "read_only")};
+  ERL_NIF_TERM values[] = {statement_types,
+                           enif_make_atom(env, read_only ? "true" : "false")};
+  ERL_NIF_TERM map;
+
+  pg_query_free_classify_result(result);
+
+  if (!enif_make_map_from_arrays(env, keys, values, 2, &map)) {
+    DEBUG_LOG("Failed to create result map");
+    return make_error(env, "failed to create result map");
+  }
+
+  DEBUG_LOG("Classify successful");
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+}
+
+#define SPLIT_OPT_SCANNER (1 << 0)
+#define SPLIT_OPT_BINARIES (1 << 1)
+
+/**
+ * Parses the list of split option atoms into a SPLIT_OPT_* bitmask
+ *
+ * @return int bitmask, -1 if the list contains unknown options
+ */
+static int parse_split_options(ErlNifEnv *env, ERL_NIF_TERM list) {
+  ERL_NIF_TERM head;
+  int options = 0;
+  char name[16];
+
+  while (enif_get_list_cell(env, list, &head, &list)) {
+    if (!enif_get_atom(env, head, name, sizeof(name), ERL_NIF_LATIN1)) {
+      return -1;
+    } else if (strcmp(name, "scanner") == 0) {
+      options |= SPLIT_OPT_SCANNER;
+    } else if (strcmp(name, "parser") == 0) {
+      options &= ~SPLIT_OPT_SCANNER;
+    } else if (strcmp(name, "binaries") == 0) {
+      options |= SPLIT_OPT_BINARIES;
+    } else {
+      return -1;
+    }
+  }
+
+  return enif_is_empty_list(env, list) ? options : -1;
+}
+
+/**
+ * Splits a SQL string into its statements
+ *
+ * Statements are returned as {location, length} byte ranges of the input, or
+ * with the :binaries option as sub-binaries of the input, which share its
+ * memory instead of copying the statement text.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * and a list of options (:parser or :scanner, :binaries); the options default
+ * to [:parser] when left out
+ * @return ERL_NIF_TERM {:ok, [{location, length}] | [binary]} |
+ * {:error, reason}
+ */
+static ERL_NIF_TERM split(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+  int options = 0;
+
+  DEBUG_LOG("Starting split");
+
+  if (argc == 2 && (options = parse_split_options(env, argv[1])) < 0) {
+    return make_error(env, "invalid options");
+  }
+
+  if (!validate_args(env, argc > 1 ? 1 : argc, argv, &query_binary,
+                     &error_term, MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Splitting query of size %zu", query_binary.size);
+  PgQuerySplitResult result;
+  if (options & SPLIT_OPT_SCANNER) {
+    result = pg_query_split_with_scanner_n((const char *)query_binary.data,
+                                           query_binary.size);
+  } else {
+    apply_parse_limits();
+    result = pg_query_split_with_parser_n((const char *)query_binary.data,
+                                          query_binary.size);
+  }
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Split error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_split_result(result);
+    return error_term;
+  }
+
+  // Build the list back to front so it ends up in statement order
+  ERL_NIF_TERM stmts = enif_make_list(env, 0);
+  for (int i = result.n_stmts - 1; i >= 0; i--) {
+    PgQuerySplitStmt *stmt = result.stmts[i];
+    ERL_NIF_TERM stmt_term;
+
+    if (options & SPLIT_OPT_BINARIES) {
+      stmt_term = enif_make_sub_binary(env, argv[0], stmt->stmt_location,
+                                       stmt->stmt_len);
+    } else {
+      stmt_term = enif_make_tuple2(env, enif_make_int(env, stmt->stmt_location),
+                                   enif_make_int(env, stmt->stmt_len));
+    }
+
+    stmts = enif_make_list_cell(env, stmt_term, stmts);
+  }
+
+  DEBUG_LOG("Split successful");
+
+  pg_query_free_split_result(result);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), stmts);
+}
+
+/**
+ * Parses the PL/pgSQL functions (CREATE FUNCTION/PROCEDURE ... LANGUAGE
+ * plpgsql and DO blocks) in a SQL string
+ *
+ * The JSON of all functions is returned as one binary, or with the :functions
+ * option as a list with one sub-binary of it per function, which share its
+ * memory instead of copying the JSON.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * and a list of options (:functions); the options default to [] when left out
+ * @return ERL_NIF_TERM {:ok, json_binary} | {:ok, [json_binary]} |
+ * {:error, reason}
  */
-static ErlNifFunc funcs[] = {{"parse_protobuf", 1, parse_protobuf},
-                             {"deparse_protobuf", 1, deparse_protobuf},
-                             {"scan", 1, scan},
-                             {"fingerprint", 1, fingerprint},
-                             {"normalize", 1, normalize}};
+static ERL_NIF_TERM parse_plpgsql(ErlNifEnv *env, int argc,
+                                  const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+  bool per_function = false;
+
+  DEBUG_LOG("Starting parse_plpgsql");
+
+  if (argc == 2) {
+    ERL_NIF_TERM list = argv[1], head;
+    char name[16];
+
+    while (enif_get_list_cell(env, list, &head, &list)) {
+      if (!enif_get_atom(env, head, name, sizeof(name), ERL_NIF_LATIN1) ||
+          strcmp(name, "functions") != 0) {
+        return make_error(env, "invalid options");
+      }
+      per_function = true;
+    }
+
+    if (!enif_is_empty_list(env, list)) {
+      return make_error(env, "invalid options");
+    }
+  }
+
+  if (!validate_args(env, argc > 1 ? 1 : argc, argv, &query_binary,
+                     &error_term, MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Parsing PL/pgSQL of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryPlpgsqlParseResult result = pg_query_parse_plpgsql_n(
+      (const char *)query_binary.data, query_binary.size);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("PL/pgSQL parse error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_plpgsql_parse_result(result);
+    return error_term;
+  }
 
-ERL_NIF_INIT(Elixir.ExPgQuery.Native, funcs, NULL, NULL, NULL, NULL)
+  ERL_NIF_TERM json = make_output_binary(env, &result.plpgsql_funcs,
+                                         strlen(result.plpgsql_funcs));
+  ERL_NIF_TERM term = json;
+
+  if (per_function) {
+    // Build the list back to front so it ends up in input order
+    term = enif_make_list(env, 0);
+    for (int i = result.n_funcs - 1; i >= 0; i--) {
+      term = enif_make_list_cell(
+          env,
+          enif_make_sub_binary(env, json, result.funcs[i].offset,
+                               result.funcs[i].len),
+          term);
+    }
+  }
+
+  DEBUG_LOG("PL/pgSQL parse successful");
+
+  pg_query_free_plpgsql_parse_result(result);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), term);
+}
+
+/**
+ * Converts references of a dependency summary to a list of
+ * %{name: binary, type: atom} maps
+ */
+static ERL_NIF_TERM make_plpgsql_refs(ErlNifEnv *env,
+                                      const PgQueryPlpgsqlRef *refs,
+                                      int n_refs) {
+  ERL_NIF_TERM list = enif_make_list(env, 0);
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "name"),
+                         enif_make_atom(env, "type")};
+
+  for (int i = n_refs - 1; i >= 0; i--) {
+    ERL_NIF_TERM values[] = {make_c_string_binary(env, refs[i].name),
+                             enif_make_atom(env, refs[i].type)};
+    ERL_NIF_TERM map;
+
+    enif_make_map_from_arrays(env, keys, values, 2, &map);
+    list = enif_make_list_cell(env, map, list);
+  }
+
+  return list;
+}
+
+/**
+ * Returns the tables and functions that the SQL in the body of each function
+ * and DO block in a query refers to
+ *
+ * The embedded SQL is parsed and analyzed within libpg_query in one call, so
+ * no parse tree has to be decoded on the Elixir side.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * @return ERL_NIF_TERM {:ok, [%{name: binary | nil, tables: [map],
+ * functions: [map]}]} | {:error, reason}
+ */
+static ERL_NIF_TERM plpgsql_dependencies(ErlNifEnv *env, int argc,
+                                         const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+
+  DEBUG_LOG("Starting plpgsql_dependencies");
+
+  if (!validate_args(env, argc, argv, &query_binary, &error_term,
+                     MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Analyzing PL/pgSQL of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryPlpgsqlDepsResult result = pg_query_plpgsql_deps_n(
+      (const char *)query_binary.data, query_binary.size);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("PL/pgSQL dependencies error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_plpgsql_deps_result(result);
+    return error_term;
+  }
+
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "name"),
+                         enif_make_atom(env, "tables"),
+                         enif_make_atom(env, "functions")};
+
+  // Build the list back to front so it ends up in input order
+  ERL_NIF_TERM list = enif_make_list(env, 0);
+  for (int i = result.n_funcs - 1; i >= 0; i--) {
+    const PgQueryPlpgsqlDeps *deps = &result.funcs[i];
+    ERL_NIF_TERM values[] = {
+        deps->name ? make_c_string_binary(env, deps->name)
+                   : enif_make_atom(env, "nil"),
+        make_plpgsql_refs(env, deps->tables, deps->n_tables),
+        make_plpgsql_refs(env, deps->functions, deps->n_functions)};
+    ERL_NIF_TERM map;
+
+    enif_make_map_from_arrays(env, keys, values, 3, &map);
+    list = enif_make_list_cell(env, map, list);
+  }
+
+  DEBUG_LOG("PL/pgSQL dependencies successful");
+
+  pg_query_free_plpgsql_deps_result(result);
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), list);
+}
+
+/**
+ * Copies a binary option into a NUL-terminated string, allocated with
+ * enif_alloc
+ *
+ * @return bool false if the term is neither a binary nor nil, or contains a
+ * NUL byte
+ */
+static bool get_rewrite_string(ErlNifEnv *env, ERL_NIF_TERM term,
+                               const char **str) {
+  ErlNifBinary binary;
+  char *copy;
+
+  *str = NULL;
+  if (enif_is_identical(term, enif_make_atom(env, "nil"))) {
+    return true;
+  }
+
+  if (!enif_inspect_binary(env, term, &binary) ||
+      memchr(binary.data, '\0', binary.size) != NULL) {
+    return false;
+  }
+
+  copy = enif_alloc(binary.size + 1);
+  if (copy == NULL) {
+    return false;
+  }
+  memcpy(copy, binary.data, binary.size);
+  copy[binary.size] = '\0';
+  *str = copy;
+  return true;
+}
+
+static bool get_rewrite_limit(ErlNifEnv *env, ERL_NIF_TERM term, int *limit) {
+  *limit = -1;
+  return enif_is_identical(term, enif_make_atom(env, "nil")) ||
+         (enif_get_int(env, term, limit) && *limit >= 0);
+}
+
+static void free_rewrite_string(const char *str) {
+  if (str != NULL) {
+    enif_free((char *)str);
+  }
+}
+
+static void free_rewrite_options(PgQueryRewrite *rewrite) {
+  PgQueryRewriteRelation *relations =
+      (PgQueryRewriteRelation *)rewrite->relations;
+
+  for (int i = 0; i < rewrite->n_relations; i++) {
+    free_rewrite_string(relations[i].schemaname);
+    free_rewrite_string(relations[i].relname);
+    free_rewrite_string(relations[i].new_schemaname);
+    free_rewrite_string(relations[i].new_relname);
+  }
+  if (relations != NULL) {
+    enif_free(relations);
+  }
+  free_rewrite_string(rewrite->schemaname);
+  free_rewrite_string(rewrite->where);
+}
+
+/**
+ * Reads the map of rewrite options built by ExPgQuery.rewrite/2 into a
+ * PgQueryRewrite, to be freed with free_rewrite_options
+ *
+ * @return bool false if the options are invalid or can't be allocated
+ */
+static bool get_rewrite_options(ErlNifEnv *env, ERL_NIF_TERM map,
+                                PgQueryRewrite *rewrite) {
+  ERL_NIF_TERM relations, schema, where, where_statements, limit, max_limit;
+  ERL_NIF_TERM head, tail;
+  PgQueryRewriteRelation *relation;
+  const ERL_NIF_TERM *tuple;
+  unsigned n_relations;
+  int arity;
+  char name[16];
+
+  memset(rewrite, 0, sizeof(*rewrite));
+  rewrite->limit = -1;
+  rewrite->max_limit = -1;
+
+  if (!enif_get_map_value(env, map, enif_make_atom(env, "relations"),
+                          &relations) ||
+      !enif_get_map_value(env, map, enif_make_atom(env, "schema"), &schema) ||
+      !enif_get_map_value(env, map, enif_make_atom(env, "where"), &where) ||
+      !enif_get_map_value(env, map, enif_make_atom(env, "where_statements"),
+                          &where_statements) ||
+      !enif_get_map_value(env, map, enif_make_atom(env, "limit"), &limit) ||
+      !enif_get_map_value(env, map, enif_make_atom(env, "max_limit"),
+                          &max_limit) ||
+      !enif_get_list_length(env, relations, &n_relations)) {
+    return false;
+  }
+
+  rewrite->relations = relation =
+      enif_alloc(sizeof(PgQueryRewriteRelation) * (n_relations + 1));
+  if (relation == NULL) {
+    return false;
+  }
+  for (tail = relations; enif_get_list_cell(env, tail, &head, &tail);) {
+    memset(relation, 0, sizeof(*relation));
+    rewrite->n_relations++;
+
+    if (!enif_get_tuple(env, head, &arity, &tuple) || arity != 4 ||
+        !get_rewrite_string(env, tuple[0], &relation->schemaname) ||
+        !get_rewrite_string(env, tuple[1], &relation->relname) ||
+        !get_rewrite_string(env, tuple[2], &relation->new_schemaname) ||
+        !get_rewrite_string(env, tuple[3], &relation->new_relname) ||
+        relation->relname == NULL) {
+      return false;
+    }
+    relation++;
+  }
+
+  if (!get_rewrite_string(env, schema, &rewrite->schemaname) ||
+      !get_rewrite_string(env, where, &rewrite->where) ||
+      !get_rewrite_limit(env, limit, &rewrite->limit) ||
+      !get_rewrite_limit(env, max_limit, &rewrite->max_limit)) {
+    return false;
+  }
+
+  for (tail = where_statements; enif_get_list_cell(env, tail, &head, &tail);) {
+    if (!enif_get_atom(env, head, name, sizeof(name), ERL_NIF_LATIN1)) {
+      return false;
+    } else if (strcmp(name, "select") == 0) {
+      rewrite->where_stmts |= PG_QUERY_REWRITE_SELECT;
+    } else if (strcmp(name, "update") == 0) {
+      rewrite->where_stmts |= PG_QUERY_REWRITE_UPDATE;
+    } else if (strcmp(name, "delete") == 0) {
+      rewrite->where_stmts |= PG_QUERY_REWRITE_DELETE;
+    } else {
+      return false;
+    }
+  }
+
+  return enif_is_empty_list(env, tail);
+}
+
+/**
+ * Rewrites a SQL query and deparses it in one call
+ *
+ * The query is parsed, relations are renamed or qualified, the WHERE
+ * expression is AND-ed into the targeted statements and the LIMIT is set or
+ * capped, all on the parse tree within libpg_query, so the tree never has to
+ * be decoded and encoded again on the Elixir side.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects one binary argument containing SQL
+ * and a map with the :relations ([{schema, name, new_schema, new_name}]),
+ * :schema, :where, :where_statements ([:select | :update | :delete]), :limit
+ * and :max_limit rewrites; without the map, the query is deparsed unchanged
+ * @return ERL_NIF_TERM {:ok, sql_binary} | {:error, reason}
+ */
+static ERL_NIF_TERM rewrite(ErlNifEnv *env, int argc,
+                            const ERL_NIF_TERM argv[]) {
+  ErlNifBinary query_binary;
+  ERL_NIF_TERM error_term;
+  PgQueryRewrite options = {.limit = -1, .max_limit = -1};
+
+  DEBUG_LOG("Starting rewrite");
+
+  if (!validate_args(env, argc > 1 ? 1 : argc, argv, &query_binary,
+                     &error_term, MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  if (argc == 2 && !get_rewrite_options(env, argv[1], &options)) {
+    free_rewrite_options(&options);
+    return make_error(env, "invalid options");
+  }
+
+  DEBUG_LOG("Rewriting query of size %zu", query_binary.size);
+  apply_parse_limits();
+  PgQueryDeparseResult result = pg_query_rewrite_n(
+      (const char *)query_binary.data, query_binary.size, &options);
+  free_rewrite_options(&options);
+
+  if (result.error != NULL) {
+    DEBUG_LOG("Rewrite error: %s", result.error->message);
+    ERL_NIF_TERM error_term = create_parse_error_map(env, result.error);
+    pg_query_free_deparse_result(result);
+    return error_term;
+  }
+
+  DEBUG_LOG("Rewrite successful");
+  ERL_NIF_TERM ok_term =
+      make_output_success(env, &result.query, strlen(result.query));
+
+  pg_query_free_deparse_result(result);
+  return ok_term;
+}
+
+/*
+ * Streaming split
+ *
+ * split_stream_new/0 returns a resource wrapping a libpg_query split stream,
+ * which is fed the input chunk by chunk with split_stream_feed/2. Each call
+ * returns the statements that were completed by the chunk, as byte ranges
+ * relative to the start of the whole input, and where the next statement may
+ * start, so only the chunk and the statement being read ever need to be in
+ * memory, even across the data of COPY ... FROM STDIN. A process may hand the
+ * resource to another, so calls on the same stream are serialized by a mutex.
+ */
+
+typedef struct SplitStreamResource {
+  PgQuerySplitStream *stream;
+  ErlNifMutex *lock;
+} SplitStreamResource;
+
+static ErlNifResourceType *split_stream_resource_type;
+
+static void split_stream_resource_dtor(ErlNifEnv *env, void *obj) {
+  SplitStreamResource *resource = obj;
+
+  pg_query_split_stream_free(resource->stream);
+  if (resource->lock != NULL) {
+    enif_mutex_destroy(resource->lock);
+  }
+}
+
+/**
+ * Converts the statements of a split stream result into a list of
+ * {location, length} tuples, followed by the pending location if requested
+ */
+static ERL_NIF_TERM make_split_stream_result(ErlNifEnv *env,
+                                             PgQuerySplitStreamResult result,
+                                             bool with_pending_location) {
+  if (result.error != NULL) {
+    DEBUG_LOG("Split stream error: %s", result.error->message);
+    return create_parse_error_map(env, result.error);
+  }
+
+  ERL_NIF_TERM stmts = enif_make_list(env, 0);
+  for (int i = result.n_stmts - 1; i >= 0; i--) {
+    ERL_NIF_TERM stmt =
+        enif_make_tuple2(env,
+                         enif_make_uint64(env, result.stmts[i].stmt_location),
+                         enif_make_uint64(env, result.stmts[i].stmt_len));
+    stmts = enif_make_list_cell(env, stmt, stmts);
+  }
+
+  if (with_pending_location) {
+    return enif_make_tuple3(env, enif_make_atom(env, "ok"), stmts,
+                            enif_make_uint64(env, result.pending_location));
+  }
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), stmts);
+}
+
+/**
+ * Creates a new streaming statement splitter
+ *
+ * @return ERL_NIF_TERM {:ok, reference} | {:error, reason}
+ */
+static ERL_NIF_TERM split_stream_new(ErlNifEnv *env, int argc,
+                                     const ERL_NIF_TERM argv[]) {
+  SplitStreamResource *resource =
+      enif_alloc_resource(split_stream_resource_type, sizeof(*resource));
+
+  if (resource == NULL) {
+    return make_error(env, "failed to allocate split stream");
+  }
+
+  resource->stream = pg_query_split_stream_new();
+  resource->lock = enif_mutex_create("ex_pg_query_split_stream");
+
+  if (resource->stream == NULL || resource->lock == NULL) {
+    enif_release_resource(resource);
+    return make_error(env, "failed to allocate split stream");
+  }
+
+  ERL_NIF_TERM term = enif_make_resource(env, resource);
+  enif_release_resource(resource);
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), term);
+}
+
+/**
+ * Feeds the next chunk of input to a streaming statement splitter
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects the stream and a binary chunk of
+ * SQL, which may end anywhere, even inside a multi-byte character
+ * @return ERL_NIF_TERM {:ok, [{location, length}], pending_location} for the
+ * statements that ended in the chunk, and the location before which no later
+ * statement starts | {:error, reason}
+ */
+static ERL_NIF_TERM split_stream_feed(ErlNifEnv *env, int argc,
+                                      const ERL_NIF_TERM argv[]) {
+  SplitStreamResource *resource;
+  ErlNifBinary chunk_binary;
+  ERL_NIF_TERM error_term;
+
+  if (argc != 2 || !enif_get_resource(env, argv[0], split_stream_resource_type,
+                                      (void **)&resource)) {
+    return make_error(env, "argument must be a split stream");
+  }
+
+  if (!validate_args(env, 1, &argv[1], &chunk_binary, &error_term,
+                     MAX_SQL_LENGTH)) {
+    return error_term;
+  }
+
+  DEBUG_LOG("Feeding chunk of size %zu to split stream", chunk_binary.size);
+  enif_mutex_lock(resource->lock);
+  PgQuerySplitStreamResult result = pg_query_split_stream_feed(
+      resource->stream, (const char *)chunk_binary.data, chunk_binary.size);
+  ERL_NIF_TERM term = make_split_stream_result(env, result, true);
+  enif_mutex_unlock(resource->lock);
+
+  return term;
+}
+
+/**
+ * Ends the input of a streaming statement splitter
+ *
+ * @return ERL_NIF_TERM {:ok, [{location, length}]} with the last statement,
+ * unless it was empty | {:error, reason} when the input ended inside a
+ * string literal, quoted identifier or comment
+ */
+static ERL_NIF_TERM split_stream_finish(ErlNifEnv *env, int argc,
+                                        const ERL_NIF_TERM argv[]) {
+  SplitStreamResource *resource;
+
+  if (argc != 1 || !enif_get_resource(env, argv[0], split_stream_resource_type,
+                                      (void **)&resource)) {
+    return make_error(env, "argument must be a split stream");
+  }
+
+  enif_mutex_lock(resource->lock);
+  ERL_NIF_TERM term = make_split_stream_result(
+      env, pg_query_split_stream_finish(resource->stream), false);
+  enif_mutex_unlock(resource->lock);
+
+  return term;
+}
+
+/*
+ * Batch processing
+ *
+ * batch_start/3 hands a list of queries to a fixed pool of native worker
+ * threads. The list is split into chunks of consecutive queries; each worker
+ * takes a chunk off the shared queue, runs the requested operations on every
+ * query in it and sends the results for the whole chunk to the calling
+ * process with enif_send. libpg_query keeps its state per thread, so the
+ * workers don't need any coordination beyond the queue.
+ *
+ * The job is a resource, which the caller gets back as the reference tagging
+ * its messages and each queued chunk keeps alive. batch_cancel/1 stops the
+ * job: no message is sent for it once that returns.
+ */
+
+#define BATCH_OP_FINGERPRINT (1 << 0)
+#define BATCH_OP_NORMALIZE (1 << 1)
+#define BATCH_OP_PARSE (1 << 2)
+
+typedef struct BatchJob {
+  ErlNifMutex *lock;
+  ErlNifPid caller;
+
+  // Holds the input binaries, which keeps the binary data alive (and
+  // unmoved) without copying it
+  ErlNifEnv *env;
+  ErlNifBinary *queries;
+  unsigned n_queries;
+
+  int ops;
+  bool cancelled;
+} BatchJob;
+
+typedef struct BatchChunk {
+  BatchJob *job;
+  unsigned start;
+  unsigned end;
+  struct BatchChunk *next;
+} BatchChunk;
+
+typedef struct BatchPool {
+  ErlNifMutex *lock;
+  ErlNifCond *cond;
+  BatchChunk *head;
+  BatchChunk *tail;
+  bool shutdown;
+
+  ErlNifTid *threads;
+  int n_threads;
+  int n_workers; // configured worker count, threads start on first use
+} BatchPool;
+
+static BatchPool batch_pool;
+
+static ErlNifResourceType *batch_job_resource_type;
+
+static void batch_job_resource_dtor(ErlNifEnv *env, void *obj) {
+  BatchJob *job = obj;
+
+  if (job->lock != NULL) {
+    enif_mutex_destroy(job->lock);
+  }
+  if (job->env != NULL) {
+    enif_free_env(job->env);
+  }
+  enif_free(job->queries);
+}
+
+/**
+ * Runs the requested operations on a single query
+ *
+ * @param env The environment to create the result terms in
+ * @param ops Bitmask of BATCH_OP_* operations
+ * @param query The query
+ * @return ERL_NIF_TERM map of operation name to its result tuple
+ */
+static ERL_NIF_TERM batch_process_query(ErlNifEnv *env, int ops,
+                                        const ErlNifBinary *query) {
+  ERL_NIF_TERM map = enif_make_new_map(env);
+
+  if (ops & BATCH_OP_PARSE) {
+    PgQueryProtobufParseResult result =
+        pg_query_parse_protobuf_n((const char *)query->data, query->size);
+    ERL_NIF_TERM term =
+        result.error != NULL
+            ? create_parse_error_map(env, result.error)
+            : make_output_success(env, &result.parse_tree.data,
+                                  result.parse_tree.len);
+    pg_query_free_protobuf_parse_result(result);
+    enif_make_map_put(env, map, enif_make_atom(env, "parse"), term, &map);
+  }
+
+  if (ops & BATCH_OP_FINGERPRINT) {
+    PgQueryFingerprintResult result =
+        pg_query_fingerprint_n((const char *)query->data, query->size);
+    ERL_NIF_TERM term = make_fingerprint_result(env, result);
+    pg_query_free_fingerprint_result(result);
+    enif_make_map_put(env, map, enif_make_atom(env, "fingerprint"), term, &map);
+  }
+
+  if (ops & BATCH_OP_NORMALIZE) {
+    PgQueryNormalizeResult result =
+        pg_query_normalize_n((const char *)query->data, query->size);
+    ERL_NIF_TERM term =
+        result.error != NULL
+            ? create_parse_error_map(env, result.error)
+            : make_output_success(env, &result.normalized_query,
+                                  strlen(result.normalized_query));
+    pg_query_free_normalize_result(result);
+    enif_make_map_put(env, map, enif_make_atom(env, "normalize"), term, &map);
+  }
+
+  return map;
+}
+
+/**
+ * Processes one chunk and sends
+ * {:ex_pg_query_batch, ref, {:chunk, start, [result, ...]}} to the caller
+ */
+static void batch_process_chunk(ErlNifEnv *msg_env, BatchChunk *chunk) {
+  BatchJob *job = chunk->job;
+
+  enif_mutex_lock(job->lock);
+  bool cancelled = job->cancelled;
+  enif_mutex_unlock(job->lock);
+
+  if (cancelled) {
+    return;
+  }
+
+  ERL_NIF_TERM results = enif_make_list(msg_env, 0);
+
+  // Build the list back to front so it ends up in input order
+  for (unsigned i = chunk->end; i > chunk->start; i--) {
+    ErlNifBinary *query = &job->queries[i - 1];
+    ERL_NIF_TERM result;
+
+    if (query->size > MAX_SQL_LENGTH) {
+      result = make_error(msg_env, "input too large");
+    } else {
+      result = batch_process_query(msg_env, job->ops, query);
+    }
+
+    results = enif_make_list_cell(msg_env, result, results);
+  }
+
+  ERL_NIF_TERM msg = enif_make_tuple3(
+      msg_env, enif_make_atom(msg_env, "ex_pg_query_batch"),
+      enif_make_resource(msg_env, job),
+      enif_make_tuple3(msg_env, enif_make_atom(msg_env, "chunk"),
+                       enif_make_uint(msg_env, chunk->start), results));
+
+  // Sending under the lock means nothing is sent once batch_cancel returns
+  enif_mutex_lock(job->lock);
+  if (!job->cancelled && !enif_send(NULL, &job->caller, msg_env, msg)) {
+    // The caller is gone, skip the chunks that haven't been started yet
+    DEBUG_LOG("Batch caller is no longer alive, cancelling job");
+    job->cancelled = true;
+  }
+  enif_mutex_unlock(job->lock);
+
+  enif_clear_env(msg_env);
+}
+
+static void *batch_worker(void *arg) {
+  BatchPool *pool = (BatchPool *)arg;
+  ErlNifEnv *msg_env = enif_alloc_env();
+
+  apply_parse_limits();
+
+  for (;;) {
+    enif_mutex_lock(pool->lock);
+    while (pool->head == NULL && !pool->shutdown) {
+      enif_cond_wait(pool->cond, pool->lock);
+    }
+    if (pool->head == NULL) {
+      enif_mutex_unlock(pool->lock);
+      break;
+    }
+    BatchChunk *chunk = pool->head;
+    pool->head = chunk->next;
+    if (pool->head == NULL) {
+      pool->tail = NULL;
+    }
+    enif_mutex_unlock(pool->lock);
+
+    batch_process_chunk(msg_env, chunk);
+    enif_release_resource(chunk->job);
+    enif_free(chunk);
+  }
+
+  enif_free_env(msg_env);
+
+  // libpg_query releases this thread's memory context from its own
+  // thread-exit destructor, so there is nothing left to clean up here
+  return NULL;
+}
+
+/**
+ * Starts the worker threads if they aren't running yet. Must be called with
+ * the pool lock held.
+ *
+ * @return bool true if the workers are running
+ */
+static bool batch_pool_ensure_started(BatchPool *pool) {
+  if (pool->threads != NULL) {
+    return true;
+  }
+
+  pool->threads = enif_alloc(sizeof(ErlNifTid) * pool->n_workers);
+  if (pool->threads == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < pool->n_workers; i++) {
+    if (enif_thread_create("ex_pg_query_batch_worker", &pool->threads[i],
+                           batch_worker, pool, NULL) != 0) {
+      DEBUG_LOG("Failed to create batch worker thread %d", i);
+      break;
+    }
+    pool->n_threads++;
+  }
+
+  return pool->n_threads > 0;
+}
+
+static void batch_pool_stop(BatchPool *pool) {
+  if (pool->lock == NULL) {
+    return;
+  }
+
+  enif_mutex_lock(pool->lock);
+  pool->shutdown = true;
+  enif_cond_broadcast(pool->cond);
+  enif_mutex_unlock(pool->lock);
+
+  // Workers drain the queue before exiting
+  for (int i = 0; i < pool->n_threads; i++) {
+    enif_thread_join(pool->threads[i], NULL);
+  }
+
+  enif_free(pool->threads);
+  enif_cond_destroy(pool->cond);
+  enif_mutex_destroy(pool->lock);
+  memset(pool, 0, sizeof(*pool));
+}
+
+/**
+ * Parses the list of operation atoms into a BATCH_OP_* bitmask
+ *
+ * @return int bitmask, 0 if the list is empty or contains unknown operations
+ */
+static int parse_batch_ops(ErlNifEnv *env, ERL_NIF_TERM list) {
+  ERL_NIF_TERM head;
+  int ops = 0;
+  char name[16];
+
+  while (enif_get_list_cell(env, list, &head, &list)) {
+    if (!enif_get_atom(env, head, name, sizeof(name), ERL_NIF_LATIN1)) {
+      return 0;
+    } else if (strcmp(name, "fingerprint") == 0) {
+      ops |= BATCH_OP_FINGERPRINT;
+    } else if (strcmp(name, "normalize") == 0) {
+      ops |= BATCH_OP_NORMALIZE;
+    } else if (strcmp(name, "parse") == 0) {
+      ops |= BATCH_OP_PARSE;
+    } else {
+      return 0;
+    }
+  }
+
+  return ops;
+}
+
+/**
+ * Queues a list of queries for processing by the batch worker pool
+ *
+ * Results are sent to the calling process as
+ * {:ex_pg_query_batch, ref, {:chunk, start_index, results}} messages, where
+ * results holds one map per query (keyed by operation) in input order.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects a list of binaries, a list of
+ * operations (:parse, :fingerprint, :normalize) and the chunk size
+ * @return ERL_NIF_TERM {:ok, ref} | {:error, reason}
+ */
+static ERL_NIF_TERM batch_start(ErlNifEnv *env, int argc,
+                                const ERL_NIF_TERM argv[]) {
+  unsigned n_queries;
+  unsigned chunk_size;
+
+  if (argc != 3) {
+    return make_error(env, "invalid number of arguments");
+  }
+
+  if (!enif_get_list_length(env, argv[0], &n_queries)) {
+    return make_error(env, "queries must be a list of binaries");
+  }
+
+  int ops = parse_batch_ops(env, argv[1]);
+  if (ops == 0) {
+    return make_error(env, "invalid operations");
+  }
+
+  if (!enif_get_uint(env, argv[2], &chunk_size) || chunk_size == 0) {
+    return make_error(env, "chunk size must be a positive integer");
+  }
+
+  BatchJob *job =
+      enif_alloc_resource(batch_job_resource_type, sizeof(BatchJob));
+  if (job == NULL) {
+    return make_error(env, "memory allocation failed");
+  }
+  memset(job, 0, sizeof(*job));
+
+  // From here on, releasing the job frees whatever was set up
+  job->env = enif_alloc_env();
+  job->queries =
+      enif_alloc(sizeof(ErlNifBinary) * (n_queries > 0 ? n_queries : 1));
+  job->lock = enif_mutex_create("ex_pg_query_batch_job");
+  if (job->env == NULL || job->queries == NULL || job->lock == NULL) {
+    enif_release_resource(job);
+    return make_error(env, "memory allocation failed");
+  }
+
+  ERL_NIF_TERM list = argv[0], head;
+  for (unsigned i = 0; enif_get_list_cell(env, list, &head, &list); i++) {
+    // Copying a (refc) binary into the job environment only bumps its
+    // reference count, the query data itself isn't copied
+    ERL_NIF_TERM copy = enif_make_copy(job->env, head);
+    if (!enif_inspect_binary(job->env, copy, &job->queries[i])) {
+      enif_release_resource(job);
+      return make_error(env, "queries must be a list of binaries");
+    }
+  }
+
+  ERL_NIF_TERM ref = enif_make_resource(env, job);
+  job->n_queries = n_queries;
+  job->ops = ops;
+  enif_self(env, &job->caller);
+
+  if (n_queries == 0) {
+    enif_release_resource(job);
+    return enif_make_tuple2(env, enif_make_atom(env, "ok"), ref);
+  }
+
+  // Build all chunks first so the job is either queued completely or not at all
+  BatchChunk *first = NULL, *last = NULL;
+  for (unsigned start = 0; start < n_queries; start += chunk_size) {
+    BatchChunk *chunk = enif_alloc(sizeof(BatchChunk));
+    if (chunk == NULL) {
+      while (first != NULL) {
+        BatchChunk *next = first->next;
+        enif_free(first);
+        first = next;
+      }
+      enif_release_resource(job);
+      return make_error(env, "memory allocation failed");
+    }
+    chunk->job = job;
+    chunk->start = start;
+    chunk->end =
+        start + chunk_size < n_queries ? start + chunk_size : n_queries;
+    chunk->next = NULL;
+    if (last == NULL) {
+      first = chunk;
+    } else {
+      last->next = chunk;
+    }
+    last = chunk;
+  }
+
+  enif_mutex_lock(batch_pool.lock);
+  if (!batch_pool_ensure_started(&batch_pool)) {
+    enif_mutex_unlock(batch_pool.lock);
+    while (first != NULL) {
+      BatchChunk *next = first->next;
+      enif_free(first);
+      first = next;
+    }
+    enif_release_resource(job);
+    return make_error(env, "failed to start batch workers");
+  }
+
+  // Each queued chunk keeps the job alive until a worker is done with it
+  for (BatchChunk *chunk = first; chunk != NULL; chunk = chunk->next) {
+    enif_keep_resource(job);
+  }
+  enif_release_resource(job);
+
+  if (batch_pool.tail == NULL) {
+    batch_pool.head = first;
+  } else {
+    batch_pool.tail->next = first;
+  }
+  batch_pool.tail = last;
+  enif_cond_broadcast(batch_pool.cond);
+  enif_mutex_unlock(batch_pool.lock);
+
+  DEBUG_LOG("Queued batch of %u queries in chunks of %u", n_queries,
+            chunk_size);
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), ref);
+}
+
+/**
+ * Cancels a batch job
+ *
+ * Chunks that haven't been sent yet are skipped, and no message for the job
+ * is sent after this returns, so the caller can flush the ones it already got.
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects the reference returned by
+ * batch_start/3
+ * @return ERL_NIF_TERM :ok | {:error, reason}
+ */
+static ERL_NIF_TERM batch_cancel(ErlNifEnv *env, int argc,
+                                 const ERL_NIF_TERM argv[]) {
+  BatchJob *job;
+
+  if (argc != 1 || !enif_get_resource(env, argv[0], batch_job_resource_type,
+                                      (void **)&job)) {
+    return make_error(env, "argument must be a batch reference");
+  }
+
+  enif_mutex_lock(job->lock);
+  job->cancelled = true;
+  enif_mutex_unlock(job->lock);
+
+  return enif_make_atom(env, "ok");
+}
+
+/*
+ * Instrumentation
+ *
+ * Every single-query NIF is registered through a wrapper that counts calls,
+ * errors, input and output bytes and records the call duration in a
+ * histogram with power-of-two buckets (in nanoseconds). The counters are kept
+ * in shards: each scheduler thread claims a shard the first time it runs a
+ * NIF, so the counters of a shard are normally only written by one thread.
+ * Since there can be more threads than shards, updates still use relaxed
+ * atomic adds. stats/0 sums up the shards.
+ *
+ * Calls slower than the slow_query_threshold load option are also copied
+ * (truncated) into a small ring buffer, which take_slow_queries/0 drains.
+ *
+ * The wrapper also reads libpg_query's memory accounting for the call (peak
+ * bytes held by its memory contexts and blocks obtained from malloc), which
+ * is summed up per function and can be returned for a single call by
+ * with_memory_stats/2. Calls answered from the result cache report zeros.
+ */
+
+#ifndef STATS_SHARDS
+#define STATS_SHARDS 64
+#endif
+
+// Bucket i holds durations below 2^i ns, the last bucket everything above
+#define STATS_BUCKETS 40
+
+#define SLOW_QUERY_SAMPLES 64
+#define SLOW_QUERY_MAX_LENGTH 1024
+
+typedef enum {
+  STATS_PARSE_PROTOBUF,
+  STATS_DEPARSE_PROTOBUF,
+  STATS_SCAN,
+  STATS_FINGERPRINT,
+  STATS_FINGERPRINT_SUBTREES,
+  STATS_NORMALIZE,
+  STATS_CLASSIFY,
+  STATS_SPLIT,
+  STATS_PARSE_PLPGSQL,
+  STATS_PLPGSQL_DEPENDENCIES,
+  STATS_PARSE_JSON,
+  STATS_DEPARSE_NODE_PROTOBUF,
+  STATS_DEPARSE_STRUCT,
+  STATS_REWRITE,
+  STATS_PARAM_REFS,
+  STATS_FUNCTIONS
+} StatsFunction;
+
+static const char *stats_function_names[STATS_FUNCTIONS] = {
+    "parse_protobuf",       "deparse_protobuf",     "scan",
+    "fingerprint",          "fingerprint_subtrees", "normalize",
+    "classify",             "split",                "parse_plpgsql",
+    "plpgsql_dependencies", "parse_json",           "deparse_node_protobuf",
+    "deparse_struct",       "rewrite",              "param_refs"};
+
+typedef struct {
+  uint64_t calls;
+  uint64_t errors;
+  uint64_t input_bytes;
+  uint64_t output_bytes;
+  uint64_t duration_ns;
+  uint64_t peak_memory;     // sum of the per-call peaks
+  uint64_t peak_memory_max; // highest per-call peak
+  uint64_t blocks;
+  uint64_t histogram[STATS_BUCKETS];
+} FunctionStats;
+
+typedef struct {
+  FunctionStats functions[STATS_FUNCTIONS];
+} __attribute__((aligned(64))) StatsShard;
+
+typedef struct {
+  StatsFunction function;
+  uint64_t duration_ns;
+  size_t input_bytes;
+  size_t query_len; // bytes stored in query, at most SLOW_QUERY_MAX_LENGTH
+  char query[SLOW_QUERY_MAX_LENGTH];
+} SlowQuery;
+
+typedef struct {
+  ErlNifMutex *lock;
+  uint64_t threshold_ns; // 0 when sampling is disabled
+  SlowQuery samples[SLOW_QUERY_SAMPLES];
+  unsigned head; // index of the oldest sample
+  unsigned count;
+  uint64_t dropped; // overwritten before they were taken
+} SlowQueryLog;
+
+static StatsShard stats_shards[STATS_SHARDS];
+static unsigned stats_next_shard;
+static __thread int stats_shard_index = -1;
+static __thread PgQueryMemoryStats stats_last_memory;
+static SlowQueryLog slow_query_log;
+
+#define STATS_ADD(field, value)                                                \
+  __atomic_fetch_add(&(field), (value), __ATOMIC_RELAXED)
+#define STATS_LOAD(field) __atomic_load_n(&(field), __ATOMIC_RELAXED)
+
+static StatsShard *stats_shard(void) {
+  if (stats_shard_index < 0) {
+    stats_shard_index =
+        (int)(STATS_ADD(stats_next_shard, 1) % STATS_SHARDS);
+  }
+
+  return &stats_shards[stats_shard_index];
+}
+
+static int stats_bucket(uint64_t duration_ns) {
+  int bucket = duration_ns == 0 ? 0 : 64 - __builtin_clzll(duration_ns);
+  return bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1;
+}
+
+static void slow_query_record(StatsFunction function, uint64_t duration_ns,
+                              const ErlNifBinary *input) {
+  SlowQueryLog *log = &slow_query_log;
+
+  enif_mutex_lock(log->lock);
+  unsigned index = (log->head + log->count) % SLOW_QUERY_SAMPLES;
+  if (log->count == SLOW_QUERY_SAMPLES) {
+    // Overwrite the oldest sample
+    log->head = (log->head + 1) % SLOW_QUERY_SAMPLES;
+    log->dropped++;
+  } else {
+    log->count++;
+  }
+
+  SlowQuery *sample = &log->samples[index];
+  sample->function = function;
+  sample->duration_ns = duration_ns;
+  sample->input_bytes = input->size;
+  sample->query_len = input->size < SLOW_QUERY_MAX_LENGTH
+                          ? input->size
+                          : SLOW_QUERY_MAX_LENGTH;
+  memcpy(sample->query, input->data, sample->query_len);
+  enif_mutex_unlock(log->lock);
+}
+
+/**
+ * Runs a NIF and records its statistics
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - the first one is counted as input if it
+ * is a binary
+ * @param function Which function's counters to update
+ * @param nif The NIF to run
+ * @return ERL_NIF_TERM the result of the NIF
+ */
+static ERL_NIF_TERM stats_call(ErlNifEnv *env, int argc,
+                               const ERL_NIF_TERM argv[],
+                               StatsFunction function,
+                               ERL_NIF_TERM (*nif)(ErlNifEnv *, int,
+                                                   const ERL_NIF_TERM[])) {
+  pg_query_reset_memory_stats();
+  ErlNifTime start = enif_monotonic_time(ERL_NIF_NSEC);
+  ERL_NIF_TERM result = nif(env, argc, argv);
+  uint64_t duration_ns = (uint64_t)(enif_monotonic_time(ERL_NIF_NSEC) - start);
+  PgQueryMemoryStats memory = pg_query_last_memory_stats();
+  stats_last_memory = memory;
+
+  FunctionStats *stats = &stats_shard()->functions[function];
+  ErlNifBinary input, output;
+  int arity;
+  const ERL_NIF_TERM *elements;
+
+  STATS_ADD(stats->calls, 1);
+  STATS_ADD(stats->duration_ns, duration_ns);
+  STATS_ADD(stats->histogram[stats_bucket(duration_ns)], 1);
+  STATS_ADD(stats->peak_memory, memory.peak_mem_allocated);
+  STATS_ADD(stats->blocks, memory.n_blocks);
+
+  uint64_t peak_max = STATS_LOAD(stats->peak_memory_max);
+  while (memory.peak_mem_allocated > peak_max &&
+         !__atomic_compare_exchange_n(&stats->peak_memory_max, &peak_max,
+                                      memory.peak_mem_allocated, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+
+  bool has_input = argc > 0 && enif_inspect_binary(env, argv[0], &input);
+  if (has_input) {
+    STATS_ADD(stats->input_bytes, input.size);
+  }
+
+  if (enif_get_tuple(env, result, &arity, &elements) && arity == 2) {
+    if (enif_is_identical(elements[0], enif_make_atom(env, "error"))) {
+      STATS_ADD(stats->errors, 1);
+    } else if (enif_inspect_binary(env, elements[1], &output)) {
+      STATS_ADD(stats->output_bytes, output.size);
+    }
+  }
+
+  if (slow_query_log.threshold_ns > 0 &&
+      duration_ns >= slow_query_log.threshold_ns && has_input) {
+    slow_query_record(function, duration_ns, &input);
+  }
+
+  return result;
+}
+
+#define STATS_NIF(nif, function)                                               \
+  static ERL_NIF_TERM nif##_with_stats(ErlNifEnv *env, int argc,               \
+                                       const ERL_NIF_TERM argv[]) {            \
+    return stats_call(env, argc, argv, function, nif);                         \
+  }
+
+STATS_NIF(parse_protobuf, STATS_PARSE_PROTOBUF)
+STATS_NIF(deparse_protobuf, STATS_DEPARSE_PROTOBUF)
+STATS_NIF(scan, STATS_SCAN)
+STATS_NIF(fingerprint, STATS_FINGERPRINT)
+STATS_NIF(fingerprint_subtrees, STATS_FINGERPRINT_SUBTREES)
+STATS_NIF(normalize, STATS_NORMALIZE)
+STATS_NIF(classify, STATS_CLASSIFY)
+STATS_NIF(split, STATS_SPLIT)
+STATS_NIF(parse_plpgsql, STATS_PARSE_PLPGSQL)
+STATS_NIF(plpgsql_dependencies, STATS_PLPGSQL_DEPENDENCIES)
+STATS_NIF(parse_json, STATS_PARSE_JSON)
+STATS_NIF(deparse_node_protobuf, STATS_DEPARSE_NODE_PROTOBUF)
+STATS_NIF(deparse_struct, STATS_DEPARSE_STRUCT)
+STATS_NIF(rewrite, STATS_REWRITE)
+STATS_NIF(param_refs, STATS_PARAM_REFS)
+
+// Indexed by StatsFunction
+static ERL_NIF_TERM (*const stats_nifs[STATS_FUNCTIONS])(
+    ErlNifEnv *, int, const ERL_NIF_TERM[]) = {
+    parse_protobuf_with_stats,       deparse_protobuf_with_stats,
+    scan_with_stats,                 fingerprint_with_stats,
+    fingerprint_subtrees_with_stats, normalize_with_stats,
+    classify_with_stats,             split_with_stats,
+    parse_plpgsql_with_stats,        plpgsql_dependencies_with_stats,
+    parse_json_with_stats,           deparse_node_protobuf_with_stats,
+    deparse_struct_with_stats,       rewrite_with_stats,
+    param_refs_with_stats};
+
+static ERL_NIF_TERM make_memory_stats(ErlNifEnv *env,
+                                      const PgQueryMemoryStats *memory) {
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "peak_memory"),
+                         enif_make_atom(env, "memory"),
+                         enif_make_atom(env, "blocks")};
+  ERL_NIF_TERM values[] = {enif_make_uint64(env, memory->peak_mem_allocated),
+                           enif_make_uint64(env, memory->mem_allocated),
+                           enif_make_uint64(env, memory->n_blocks)};
+  ERL_NIF_TERM map;
+  enif_make_map_from_arrays(env, keys, values, 3, &map);
+
+  return map;
+}
+
+/**
+ * Runs one of the single-query functions and returns its memory usage along
+ * with the result
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects the function name as an atom and
+ * its argument
+ * @return ERL_NIF_TERM {:ok, {result, %{peak_memory: integer, memory: integer,
+ * blocks: integer}}} or {:error, reason}
+ */
+static ERL_NIF_TERM with_memory_stats(ErlNifEnv *env, int argc,
+                                      const ERL_NIF_TERM argv[]) {
+  char name[32];
+
+  if (argc != 2 ||
+      !enif_get_atom(env, argv[0], name, sizeof(name), ERL_NIF_LATIN1)) {
+    return make_error(env, "invalid function");
+  }
+
+  for (int function = 0; function < STATS_FUNCTIONS; function++) {
+    if (strcmp(name, stats_function_names[function]) == 0) {
+      ERL_NIF_TERM result = stats_nifs[function](env, 1, &argv[1]);
+
+      return enif_make_tuple2(
+          env, enif_make_atom(env, "ok"),
+          enif_make_tuple2(env, result,
+                           make_memory_stats(env, &stats_last_memory)));
+    }
+  }
+
+  return make_error(env, "invalid function");
+}
+
+static ERL_NIF_TERM make_function_stats(ErlNifEnv *env,
+                                        const FunctionStats *stats) {
+  ERL_NIF_TERM histogram = enif_make_list(env, 0);
+
+  // Only non-empty buckets, built back to front so the list is ascending
+  for (int bucket = STATS_BUCKETS - 1; bucket >= 0; bucket--) {
+    if (stats->histogram[bucket] == 0) {
+      continue;
+    }
+
+    ERL_NIF_TERM upper_bound =
+        bucket == STATS_BUCKETS - 1
+            ? enif_make_atom(env, "infinity")
+            : enif_make_uint64(env, (uint64_t)1 << bucket);
+    histogram = enif_make_list_cell(
+        env,
+        enif_make_tuple2(env, upper_bound,
+                         enif_make_uint64(env, stats->histogram[bucket])),
+        histogram);
+  }
+
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "calls"),
+                         enif_make_atom(env, "errors"),
+                         enif_make_atom(env, "input_bytes"),
+                         enif_make_atom(env, "output_bytes"),
+                         enif_make_atom(env, "duration"),
+                         enif_make_atom(env, "peak_memory"),
+                         enif_make_atom(env, "peak_memory_max"),
+                         enif_make_atom(env, "blocks"),
+                         enif_make_atom(env, "histogram")};
+  ERL_NIF_TERM values[] = {enif_make_uint64(env, stats->calls),
+                           enif_make_uint64(env, stats->errors),
+                           enif_make_uint64(env, stats->input_bytes),
+                           enif_make_uint64(env, stats->output_bytes),
+                           enif_make_uint64(env, stats->duration_ns),
+                           enif_make_uint64(env, stats->peak_memory),
+                           enif_make_uint64(env, stats->peak_memory_max),
+                           enif_make_uint64(env, stats->blocks),
+                           histogram};
+  ERL_NIF_TERM map;
+  enif_make_map_from_arrays(env, keys, values, 9, &map);
+
+  return map;
+}
+
+/**
+ * Returns a snapshot of the per-function counters, summed over all shards
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects none
+ * @return ERL_NIF_TERM {:ok, %{function_name => %{calls: integer,
+ * errors: integer, input_bytes: integer, output_bytes: integer,
+ * duration: integer, peak_memory: integer, peak_memory_max: integer,
+ * blocks: integer, histogram: [{upper_bound_ns, count}]}}}
+ */
+static ERL_NIF_TERM stats(ErlNifEnv *env, int argc,
+                          const ERL_NIF_TERM argv[]) {
+  ERL_NIF_TERM map = enif_make_new_map(env);
+
+  for (int function = 0; function < STATS_FUNCTIONS; function++) {
+    FunctionStats total;
+    memset(&total, 0, sizeof(total));
+
+    for (int i = 0; i < STATS_SHARDS; i++) {
+      FunctionStats *shard = &stats_shards[i].functions[function];
+      total.calls += STATS_LOAD(shard->calls);
+      total.errors += STATS_LOAD(shard->errors);
+      total.input_bytes += STATS_LOAD(shard->input_bytes);
+      total.output_bytes += STATS_LOAD(shard->output_bytes);
+      total.duration_ns += STATS_LOAD(shard->duration_ns);
+      total.peak_memory += STATS_LOAD(shard->peak_memory);
+      total.blocks += STATS_LOAD(shard->blocks);
+      uint64_t peak_max = STATS_LOAD(shard->peak_memory_max);
+      if (peak_max > total.peak_memory_max) {
+        total.peak_memory_max = peak_max;
+      }
+      for (int bucket = 0; bucket < STATS_BUCKETS; bucket++) {
+        total.histogram[bucket] += STATS_LOAD(shard->histogram[bucket]);
+      }
+    }
+
+    enif_make_map_put(env, map,
+                      enif_make_atom(env, stats_function_names[function]),
+                      make_function_stats(env, &total), &map);
+  }
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+}
+
+/**
+ * Returns and clears the sampled slow queries, oldest first
+ *
+ * @param env The NIF environment
+ * @param argc Number of arguments
+ * @param argv Array of arguments - expects none
+ * @return ERL_NIF_TERM {:ok, %{queries: [%{function: atom, duration: integer,
+ * input_bytes: integer, query: binary}], dropped: integer}}
+ */
+static ERL_NIF_TERM take_slow_queries(ErlNifEnv *env, int argc,
+                                      const ERL_NIF_TERM argv[]) {
+  SlowQueryLog *log = &slow_query_log;
+  ERL_NIF_TERM list = enif_make_list(env, 0);
+
+  enif_mutex_lock(log->lock);
+  for (unsigned i = log->count; i > 0; i--) {
+    SlowQuery *sample = &log->samples[(log->head + i - 1) % SLOW_QUERY_SAMPLES];
+    ERL_NIF_TERM query;
+    unsigned char *data = enif_make_new_binary(env, sample->query_len, &query);
+    memcpy(data, sample->query, sample->query_len);
+
+    ERL_NIF_TERM keys[] = {
+        enif_make_atom(env, "function"), enif_make_atom(env, "duration"),
+        enif_make_atom(env, "input_bytes"), enif_make_atom(env, "query")};
+    ERL_NIF_TERM values[] = {
+        enif_make_atom(env, stats_function_names[sample->function]),
+        enif_make_uint64(env, sample->duration_ns),
+        enif_make_uint64(env, sample->input_bytes), query};
+    ERL_NIF_TERM map;
+    enif_make_map_from_arrays(env, keys, values, 4, &map);
+
+    list = enif_make_list_cell(env, map, list);
+  }
+  ERL_NIF_TERM dropped = enif_make_uint64(env, log->dropped);
+  log->head = 0;
+  log->count = 0;
+  log->dropped = 0;
+  enif_mutex_unlock(log->lock);
+
+  ERL_NIF_TERM keys[] = {enif_make_atom(env, "queries"),
+                         enif_make_atom(env, "dropped")};
+  ERL_NIF_TERM values[] = {list, dropped};
+  ERL_NIF_TERM map;
+  enif_make_map_from_arrays(env, keys, values, 2, &map);
+
+  return enif_make_tuple2(env, enif_make_atom(env, "ok"), map);
+}
+
+/**
+ * Reads an optional positive integer from the load_info map
+ */
+static ErlNifUInt64 get_load_option(ErlNifEnv *env, ERL_NIF_TERM load_info,
+                                    const char *key,
+                                    ErlNifUInt64 default_value) {
+  ERL_NIF_TERM value;
+  ErlNifUInt64 result;
+
+  if (!enif_is_map(env, load_info) ||
+      !enif_get_map_value(env, load_info, enif_make_atom(env, key), &value) ||
+      !enif_get_uint64(env, value, &result) || result == 0) {
+    return default_value;
+  }
+
+  return result;
+}
+
+static int load(ErlNifEnv *env, void **priv_data, ERL_NIF_TERM load_info) {
+  pg_query_set_output_allocator(&output_allocator);
+
+  split_stream_resource_type = enif_open_resource_type(
+      env, NULL, "ex_pg_query_split_stream", split_stream_resource_dtor,
+      ERL_NIF_RT_CREATE, NULL);
+
+  if (split_stream_resource_type == NULL) {
+    return 1;
+  }
+
+  batch_job_resource_type = enif_open_resource_type(
+      env, NULL, "ex_pg_query_batch_job", batch_job_resource_dtor,
+      ERL_NIF_RT_CREATE, NULL);
+
+  if (batch_job_resource_type == NULL) {
+    return 1;
+  }
+
+  if (!struct_reader_load(env)) {
+    return 1;
+  }
+
+  parse_limits.max_memory =
+      get_load_option(env, load_info, "parse_max_memory", 0);
+  parse_limits.max_nodes =
+      get_load_option(env, load_info, "parse_max_nodes", 0);
+  parse_limits.max_depth =
+      (int)get_load_option(env, load_info, "parse_max_depth", 0);
+
+  batch_pool.n_workers =
+      (int)get_load_option(env, load_info, "batch_workers", 1);
+  batch_pool.lock = enif_mutex_create("ex_pg_query_batch_pool");
+  batch_pool.cond = enif_cond_create("ex_pg_query_batch_pool");
+
+  if (batch_pool.lock == NULL || batch_pool.cond == NULL) {
+    return 1;
+  }
+
+  size_t cache_size = get_load_option(env, load_info, "cache_size", 0);
+  unsigned cache_shards = (unsigned)get_load_option(
+      env, load_info, "cache_shards", CACHE_DEFAULT_SHARDS);
+
+  if (!cache_init(cache_size, cache_shards)) {
+    cache_destroy();
+    return 1;
+  }
+
+  slow_query_log.threshold_ns =
+      get_load_option(env, load_info, "slow_query_threshold", 0) * 1000;
+  slow_query_log.lock = enif_mutex_create("ex_pg_query_slow_query_log");
+
+  return slow_query_log.lock != NULL ? 0 : 1;
+}
+
+static void unload(ErlNifEnv *env, void *priv_data) {
+  batch_pool_stop(&batch_pool);
+  cache_destroy();
+  if (slow_query_log.lock != NULL) {
+    enif_mutex_destroy(slow_query_log.lock);
+    slow_query_log.lock = NULL;
+  }
+}
+
+/**
+ * ExPgQuery NIF Implementation
+ *
+ * This module provides NIFs for PostgreSQL query parsing, deparsing,
+ * scanning and fingerprinting functionality. It wraps the libpg_query
+ * library to provide these capabilities to Elixir applications.
+ *
+ * The module exposes the following functions:
+ * - parse_protobuf/1, parse_protobuf/2: Parses SQL to protobuf format,
+ *   optionally collapsing long constant lists
+ * - parse_json/1: Parses SQL to JSON format
+ * - deparse_protobuf/1: Converts protobuf back to SQL
+ * - deparse_node_protobuf/1: Converts a single protobuf node back to SQL
+ * - deparse_struct/1: Converts a tree of PgQuery structs back to SQL
+ * - rewrite/2: Renames relations, adds a WHERE expression and sets the LIMIT
+ *   of a query, returning the rewritten SQL
+ * - scan/1: Performs lexical analysis of SQL
+ * - fingerprint/1, fingerprint/2: Generates query fingerprints
+ * - fingerprint_subtrees/1: Generates fingerprints for a query and each of
+ *   its statements, subqueries and CTEs
+ * - param_refs/1: Returns the location, length and type cast of each param
+ *   ref in SQL
+ * - classify/1: Returns the statement types of a query and whether it is
+ *   read-only, mostly without parsing it
+ * - split/2: Splits SQL into statements, as byte ranges or sub-binaries
+ * - parse_plpgsql/2: Parses the PL/pgSQL functions in SQL into JSON
+ * - plpgsql_dependencies/1: Returns the tables and functions used by the
+ *   body of each function in SQL
+ * - split_stream_new/0, split_stream_feed/2, split_stream_finish/1: Split
+ *   SQL that arrives in chunks into statements
+ * - batch_start/3: Processes a list of queries on native worker threads
+ * - batch_cancel/1: Stops sending the results of a batch
+ * - cache_stats/0: Returns the result cache counters
+ * - stats/0: Returns call counters and latency histograms per function
+ * - take_slow_queries/0: Returns and clears the sampled slow queries
+ * - with_memory_stats/2: Runs one of the functions above and returns its
+ *   memory usage along with the result
+ *
+ * All functions expect binary input and return tagged tuples:
+ * {:ok, result} | {:error, reason}
+ */
+static ErlNifFunc funcs[] = {
+    {"parse_protobuf", 1, parse_protobuf_with_stats},
+    {"parse_protobuf", 2, parse_protobuf_with_stats},
+    {"parse_json", 1, parse_json_with_stats},
+    {"deparse_protobuf", 1, deparse_protobuf_with_stats},
+    {"deparse_node_protobuf", 1, deparse_node_protobuf_with_stats},
+    {"deparse_struct", 1, deparse_struct_with_stats},
+    {"rewrite", 2, rewrite_with_stats},
+    {"scan", 1, scan_with_stats},
+    {"fingerprint", 1, fingerprint_with_stats},
+    {"fingerprint", 2, fingerprint_with_stats},
+    {"fingerprint_subtrees", 1, fingerprint_subtrees_with_stats},
+    {"batch_start", 3, batch_start, ERL_NIF_DIRTY_JOB_CPU_BOUND},
+    {"batch_cancel", 1, batch_cancel},
+    {"cache_stats", 0, cache_stats},
+    {"stats", 0, stats},
+    {"take_slow_queries", 0, take_slow_queries},
+    {"with_memory_stats", 2, with_memory_stats},
+    {"normalize", 1, normalize_with_stats},
+    {"param_refs", 1, param_refs_with_stats},
+    {"classify", 1, classify_with_stats},
+    {"split", 2, split_with_stats},
+    {"parse_plpgsql", 2, parse_plpgsql_with_stats},
+    {"plpgsql_dependencies", 1, plpgsql_dependencies_with_stats},
+    {"split_stream_new", 0, split_stream_new},
+    {"split_stream_feed", 2, split_stream_feed},
+    {"split_stream_finish", 1, split_stream_finish}};
+
+ERL_NIF_INIT(Elixir.ExPgQuery.Native, funcs, load, NULL, NULL, unload)
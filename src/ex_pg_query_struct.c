@@ -0,0 +1,547 @@
+/**
+ * Reads trees of PgQuery structs, as decoded by Protox, directly into
+ * Postgres parse nodes for deparsing, without encoding them to protobuf and
+ * decoding that again.
+ *
+ * The nodes are built by the same generated read functions as in
+ * pg_query_readfuncs_protobuf.c, with the protobuf message accessors replaced
+ * by map lookups. Each message is a struct map, a Node is
+ * %PgQuery.Node{node: {oneof_name, struct}}, repeated fields are lists and
+ * enums are atoms. Missing and nil fields are treated like unset protobuf
+ * fields.
+ */
+#include "../libpg_query/pg_query.h"
+#include "pg_query_internal.h"
+#include "pg_query_readfuncs.h"
+#include "postgres_deparse.h"
+
+#include "nodes/nodes.h"
+#include "nodes/parsenodes.h"
+#include "nodes/pg_list.h"
+
+#include "ex_pg_query_struct.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// The read functions take no environment argument, so it's passed aside
+static __thread ErlNifEnv *reader_env;
+
+static ERL_NIF_TERM atom_nil;
+static ERL_NIF_TERM atom_true;
+static ERL_NIF_TERM atom_false;
+static ERL_NIF_TERM atom_struct;
+static ERL_NIF_TERM atom_parse_result;
+static ERL_NIF_TERM atom_stmts;
+static ERL_NIF_TERM atom_node;
+static ERL_NIF_TERM atom_items;
+static ERL_NIF_TERM atom_val;
+static ERL_NIF_TERM atom_isnull;
+static ERL_NIF_TERM atom_ival;
+static ERL_NIF_TERM atom_fval;
+static ERL_NIF_TERM atom_boolval;
+static ERL_NIF_TERM atom_sval;
+static ERL_NIF_TERM atom_bsval;
+
+// Atoms of the struct keys, e.g. field_target_list for :target_list
+#define READ_FIELD_NAME(name) static ERL_NIF_TERM field_##name;
+#include "pg_query_readfuncs_fields.c"
+#undef READ_FIELD_NAME
+
+typedef struct {
+  ERL_NIF_TERM atom;
+  Node *(*read)(ERL_NIF_TERM msg);
+} NodeReader;
+
+typedef struct {
+  ERL_NIF_TERM atom;
+  int value;
+} EnumValue;
+
+// Both sorted by atom, for bsearch. Loading the NIF fails if the generated
+// readers or enum values don't fit
+#define MAX_NODE_READERS 512
+static NodeReader node_readers[MAX_NODE_READERS];
+static size_t n_node_readers;
+
+#define MAX_ENUM_VALUES 1024
+static EnumValue enum_values[MAX_ENUM_VALUES];
+static size_t n_enum_values;
+
+static int compare_atoms(const void *a, const void *b) {
+  ERL_NIF_TERM atom_a = *(const ERL_NIF_TERM *)a;
+  ERL_NIF_TERM atom_b = *(const ERL_NIF_TERM *)b;
+
+  return atom_a < atom_b ? -1 : atom_a > atom_b;
+}
+
+// Returns the field of the struct, or false if it's missing or nil
+static bool get_field(ERL_NIF_TERM msg, ERL_NIF_TERM key,
+                      ERL_NIF_TERM *value) {
+  return enif_get_map_value(reader_env, msg, key, value) &&
+         !enif_is_identical(*value, atom_nil);
+}
+
+static void invalid_field(const char *name) pg_attribute_noreturn();
+
+static void invalid_field(const char *name) {
+  elog(ERROR, "deparse: invalid value for struct field %s", name);
+}
+
+static int64 read_integer(ERL_NIF_TERM value, const char *name) {
+  ErlNifSInt64 result;
+
+  if (!enif_get_int64(reader_env, value, &result))
+    invalid_field(name);
+
+  return result;
+}
+
+static uint64 read_unsigned(ERL_NIF_TERM value, const char *name) {
+  ErlNifUInt64 result;
+
+  if (!enif_get_uint64(reader_env, value, &result))
+    invalid_field(name);
+
+  return result;
+}
+
+static double read_float(ERL_NIF_TERM value, const char *name) {
+  double result;
+
+  if (!enif_get_double(reader_env, value, &result))
+    result = (double)read_integer(value, name);
+
+  return result;
+}
+
+static bool read_bool(ERL_NIF_TERM value, const char *name) {
+  if (enif_is_identical(value, atom_true))
+    return true;
+  if (!enif_is_identical(value, atom_false))
+    invalid_field(name);
+
+  return false;
+}
+
+// Returns a palloc'd copy of the string, or NULL if it's empty
+static char *read_string(ERL_NIF_TERM value, const char *name) {
+  ErlNifBinary binary;
+  char *result;
+
+  if (!enif_inspect_binary(reader_env, value, &binary))
+    invalid_field(name);
+
+  if (binary.size == 0)
+    return NULL;
+
+  result = palloc(binary.size + 1);
+  memcpy(result, binary.data, binary.size);
+  result[binary.size] = '\0';
+
+  return result;
+}
+
+// Like read_string, but an empty string for a missing or empty field
+static char *read_string_field(ERL_NIF_TERM msg, ERL_NIF_TERM key,
+                               const char *name) {
+  ERL_NIF_TERM value;
+  char *result = NULL;
+
+  if (get_field(msg, key, &value))
+    result = read_string(value, name);
+
+  return result != NULL ? result : pstrdup("");
+}
+
+// Returns the protobuf number of an enum value, given as atom or integer
+static int read_enum(ERL_NIF_TERM value, const char *name) {
+  EnumValue *found;
+  int result;
+
+  if (enif_get_int(reader_env, value, &result))
+    return result;
+
+  found = bsearch(&value, enum_values, n_enum_values, sizeof(EnumValue),
+                  compare_atoms);
+  if (found == NULL)
+    invalid_field(name);
+
+  return found->value;
+}
+
+static Node *_readNode(ERL_NIF_TERM msg);
+
+static List *read_list(ERL_NIF_TERM value, const char *name) {
+  List *list = NIL;
+  ERL_NIF_TERM head;
+
+  while (enif_get_list_cell(reader_env, value, &head, &value))
+    list = lappend(list, _readNode(head));
+
+  if (!enif_is_empty_list(reader_env, value))
+    invalid_field(name);
+
+  return list;
+}
+
+#define OUT_TYPE(typename, typename_c) ERL_NIF_TERM
+
+#define READ_SCALAR_FIELD(outname, fldname, read)                              \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = read(value, #outname);                                   \
+  }
+
+#define READ_INT_FIELD(outname, outname_json, fldname)                         \
+  READ_SCALAR_FIELD(outname, fldname, read_integer)
+#define READ_UINT_FIELD(outname, outname_json, fldname)                        \
+  READ_SCALAR_FIELD(outname, fldname, read_unsigned)
+#define READ_UINT64_FIELD(outname, outname_json, fldname)                      \
+  READ_SCALAR_FIELD(outname, fldname, read_unsigned)
+#define READ_LONG_FIELD(outname, outname_json, fldname)                        \
+  READ_SCALAR_FIELD(outname, fldname, read_integer)
+#define READ_FLOAT_FIELD(outname, outname_json, fldname)                       \
+  READ_SCALAR_FIELD(outname, fldname, read_float)
+#define READ_BOOL_FIELD(outname, outname_json, fldname)                        \
+  READ_SCALAR_FIELD(outname, fldname, read_bool)
+#define READ_STRING_FIELD(outname, outname_json, fldname)                      \
+  READ_SCALAR_FIELD(outname, fldname, read_string)
+#define READ_LIST_FIELD(outname, outname_json, fldname)                        \
+  READ_SCALAR_FIELD(outname, fldname, read_list)
+
+#define READ_CHAR_FIELD(outname, outname_json, fldname)                        \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    char *str;                                                                 \
+    if (get_field(msg, field_##outname, &value) &&                             \
+        (str = read_string(value, #outname)) != NULL)                          \
+      node->fldname = str[0];                                                  \
+  }
+
+#define READ_ENUM_FIELD(typename, outname, outname_json, fldname)              \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = _intToEnum##typename(read_enum(value, #outname));        \
+    else                                                                       \
+      node->fldname = _intToEnum##typename(0);                                 \
+  }
+
+// Only the nodes of analyzed trees (Var, TableFunc, RangeTblFunction,
+// RTEPermissionInfo) have bitmapsets, and deparsing raw parse trees never
+// reads them, so they're left empty
+#define READ_BITMAPSET_FIELD(outname, outname_json, fldname)
+
+#define READ_NODE_FIELD(outname, outname_json, fldname)                        \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (!get_field(msg, field_##outname, &value))                              \
+      invalid_field(#outname);                                                 \
+    node->fldname = *read_required_node(value, #outname);                      \
+  }
+
+#define READ_NODE_PTR_FIELD(outname, outname_json, fldname)                    \
+  READ_SCALAR_FIELD(outname, fldname, read_node)
+
+#define READ_ABSTRACT_PTR_FIELD(outname, outname_json, fldname, fldtype)       \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = (fldtype)_readNode(value);                               \
+  }
+
+#define READ_VALUE_FIELD(outname, outname_json, fldname)                       \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = *((Value *)read_required_node(value, #outname));         \
+  }
+
+#define READ_VALUE_PTR_FIELD(outname, outname_json, fldname)                   \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = (Value *)_readNode(value);                               \
+  }
+
+#define READ_SPECIFIC_NODE_FIELD(typename, typename_underscore, outname,       \
+                                 outname_json, fldname)                        \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (!get_field(msg, field_##outname, &value))                              \
+      invalid_field(#outname);                                                 \
+    node->fldname = *_read##typename(value);                                   \
+  }
+
+#define READ_SPECIFIC_NODE_PTR_FIELD(typename, typename_underscore, outname,   \
+                                     outname_json, fldname)                    \
+  {                                                                            \
+    ERL_NIF_TERM value;                                                        \
+    if (get_field(msg, field_##outname, &value))                               \
+      node->fldname = _read##typename(value);                                  \
+  }
+
+static Node *read_node(ERL_NIF_TERM value, const char *name) {
+  return _readNode(value);
+}
+
+// Like _readNode, but for fields that are embedded in their parent node
+static Node *read_required_node(ERL_NIF_TERM value, const char *name) {
+  Node *result = _readNode(value);
+
+  if (result == NULL)
+    invalid_field(name);
+
+  return result;
+}
+
+static String *_readString(ERL_NIF_TERM msg) {
+  return makeString(read_string_field(msg, atom_sval, "sval"));
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "pg_query_enum_defs.c"
+#include "pg_query_readfuncs_defs.c"
+#pragma GCC diagnostic pop
+
+// Wraps the read function of each node type for the node_readers table
+#define READ_COND(typename, typename_c, typename_underscore,                   \
+                  typename_underscore_upcase, typename_cast, outname)          \
+  static Node *_readNode##typename_c(ERL_NIF_TERM msg) {                       \
+    return (Node *)_read##typename_c(msg);                                     \
+  }
+#include "pg_query_readfuncs_conds.c"
+#undef READ_COND
+
+static Node *_readNodeInteger(ERL_NIF_TERM msg) {
+  ERL_NIF_TERM value;
+  int ival = 0;
+
+  if (get_field(msg, atom_ival, &value))
+    ival = (int)read_integer(value, "ival");
+
+  return (Node *)makeInteger(ival);
+}
+
+static Node *_readNodeFloat(ERL_NIF_TERM msg) {
+  return (Node *)makeFloat(read_string_field(msg, atom_fval, "fval"));
+}
+
+static Node *_readNodeBoolean(ERL_NIF_TERM msg) {
+  ERL_NIF_TERM value;
+  bool boolval = false;
+
+  if (get_field(msg, atom_boolval, &value))
+    boolval = read_bool(value, "boolval");
+
+  return (Node *)makeBoolean(boolval);
+}
+
+static Node *_readNodeString(ERL_NIF_TERM msg) {
+  return (Node *)_readString(msg);
+}
+
+static Node *_readNodeBitString(ERL_NIF_TERM msg) {
+  return (Node *)makeBitString(read_string_field(msg, atom_bsval, "bsval"));
+}
+
+static Node *_readNodeList(ERL_NIF_TERM msg) {
+  ERL_NIF_TERM value;
+
+  if (!get_field(msg, atom_items, &value))
+    return (Node *)NIL;
+
+  return (Node *)read_list(value, "items");
+}
+
+static Node *_readNodeAConst(ERL_NIF_TERM msg) {
+  A_Const *ac = makeNode(A_Const);
+  ERL_NIF_TERM value;
+  const ERL_NIF_TERM *val;
+  int arity;
+
+  if (get_field(msg, field_location, &value))
+    ac->location = (int)read_integer(value, "location");
+
+  if (get_field(msg, atom_isnull, &value) && read_bool(value, "isnull")) {
+    ac->isnull = true;
+    return (Node *)ac;
+  }
+
+  // The val oneof is {:ival, %PgQuery.Integer{}} and so on
+  if (!get_field(msg, atom_val, &value) ||
+      !enif_get_tuple(reader_env, value, &arity, &val) || arity != 2)
+    invalid_field("val");
+
+  if (enif_is_identical(val[0], atom_ival))
+    ac->val.ival = *castNode(Integer, _readNodeInteger(val[1]));
+  else if (enif_is_identical(val[0], atom_fval))
+    ac->val.fval = *castNode(Float, _readNodeFloat(val[1]));
+  else if (enif_is_identical(val[0], atom_boolval))
+    ac->val.boolval = *castNode(Boolean, _readNodeBoolean(val[1]));
+  else if (enif_is_identical(val[0], atom_sval))
+    ac->val.sval = *castNode(String, _readNodeString(val[1]));
+  else if (enif_is_identical(val[0], atom_bsval))
+    ac->val.bsval = *castNode(BitString, _readNodeBitString(val[1]));
+  else
+    invalid_field("val");
+
+  return (Node *)ac;
+}
+
+static Node *_readNode(ERL_NIF_TERM msg) {
+  ERL_NIF_TERM value;
+  const ERL_NIF_TERM *oneof;
+  int arity;
+  NodeReader *reader;
+
+  // Anything but a %PgQuery.Node{} is invalid here, only node: nil is NULL
+  if (!enif_is_map(reader_env, msg) ||
+      !enif_get_map_value(reader_env, msg, atom_node, &value))
+    invalid_field("node");
+
+  if (enif_is_identical(value, atom_nil))
+    return NULL;
+
+  if (!enif_get_tuple(reader_env, value, &arity, &oneof) || arity != 2)
+    invalid_field("node");
+
+  reader = bsearch(&oneof[0], node_readers, n_node_readers,
+                   sizeof(NodeReader), compare_atoms);
+  if (reader == NULL)
+    elog(ERROR, "deparse: unsupported node type in struct");
+
+  return reader->read(oneof[1]);
+}
+
+static bool add_node_reader(ErlNifEnv *env, const char *name,
+                            Node *(*read)(ERL_NIF_TERM msg)) {
+  if (n_node_readers >= MAX_NODE_READERS)
+    return false;
+  node_readers[n_node_readers].atom = enif_make_atom(env, name);
+  node_readers[n_node_readers].read = read;
+  n_node_readers++;
+  return true;
+}
+
+static bool add_enum_value(ErlNifEnv *env, const char *name, int value) {
+  if (n_enum_values >= MAX_ENUM_VALUES)
+    return false;
+  enum_values[n_enum_values].atom = enif_make_atom(env, name);
+  enum_values[n_enum_values].value = value;
+  n_enum_values++;
+  return true;
+}
+
+bool struct_reader_load(ErlNifEnv *env) {
+  atom_nil = enif_make_atom(env, "nil");
+  atom_true = enif_make_atom(env, "true");
+  atom_false = enif_make_atom(env, "false");
+  atom_struct = enif_make_atom(env, "__struct__");
+  atom_parse_result = enif_make_atom(env, "Elixir.PgQuery.ParseResult");
+  atom_stmts = enif_make_atom(env, "stmts");
+  atom_node = enif_make_atom(env, "node");
+  atom_items = enif_make_atom(env, "items");
+  atom_val = enif_make_atom(env, "val");
+  atom_isnull = enif_make_atom(env, "isnull");
+  atom_ival = enif_make_atom(env, "ival");
+  atom_fval = enif_make_atom(env, "fval");
+  atom_boolval = enif_make_atom(env, "boolval");
+  atom_sval = enif_make_atom(env, "sval");
+  atom_bsval = enif_make_atom(env, "bsval");
+
+#define READ_FIELD_NAME(name) field_##name = enif_make_atom(env, #name);
+#include "pg_query_readfuncs_fields.c"
+#undef READ_FIELD_NAME
+
+  n_node_readers = 0;
+#define READ_COND(typename, typename_c, typename_underscore,                   \
+                  typename_underscore_upcase, typename_cast, outname)          \
+  if (!add_node_reader(env, #outname, _readNode##typename_c))                 \
+    return false
+#include "pg_query_readfuncs_conds.c"
+#undef READ_COND
+  if (!add_node_reader(env, "integer", _readNodeInteger) ||
+      !add_node_reader(env, "float", _readNodeFloat) ||
+      !add_node_reader(env, "boolean", _readNodeBoolean) ||
+      !add_node_reader(env, "string", _readNodeString) ||
+      !add_node_reader(env, "bit_string", _readNodeBitString) ||
+      !add_node_reader(env, "list", _readNodeList) ||
+      !add_node_reader(env, "a_const", _readNodeAConst))
+    return false;
+  qsort(node_readers, n_node_readers, sizeof(NodeReader), compare_atoms);
+
+  n_enum_values = 0;
+#define READ_ENUM_VALUE(typename, name, value)                                 \
+  if (!add_enum_value(env, #name, value))                                      \
+    return false;
+#include "pg_query_readfuncs_enum_values.c"
+#undef READ_ENUM_VALUE
+  qsort(enum_values, n_enum_values, sizeof(EnumValue), compare_atoms);
+
+  return true;
+}
+
+PgQueryDeparseResult deparse_struct_tree(ErlNifEnv *env, ERL_NIF_TERM tree) {
+  PgQueryDeparseResult result = {0};
+  StringInfoData str;
+  MemoryContext ctx;
+
+  ctx = pg_query_enter_memory_context();
+
+  PG_TRY();
+  {
+    ERL_NIF_TERM module;
+    ERL_NIF_TERM stmts;
+    ERL_NIF_TERM head;
+
+    reader_env = env;
+    initStringInfo(&str);
+
+    if (enif_get_map_value(env, tree, atom_struct, &module) &&
+        enif_is_identical(module, atom_parse_result)) {
+      if (!get_field(tree, atom_stmts, &stmts))
+        stmts = enif_make_list(env, 0);
+
+      while (enif_get_list_cell(env, stmts, &head, &stmts)) {
+        deparseRawStmt(&str, _readRawStmt(head));
+        if (!enif_is_empty_list(env, stmts))
+          appendStringInfoString(&str, "; ");
+      }
+    } else {
+      deparseNode(&str, read_required_node(tree, "node"));
+    }
+
+    result.query = pg_query_output_strdup(str.data, str.len);
+  }
+  PG_CATCH();
+  {
+    ErrorData *error_data;
+    PgQueryError *error;
+
+    MemoryContextSwitchTo(ctx);
+    error_data = CopyErrorData();
+
+    // Note: This is intentionally malloc so exiting the memory context
+    // doesn't free this
+    error = calloc(1, sizeof(PgQueryError));
+    error->message = strdup(error_data->message);
+    error->filename = strdup(error_data->filename);
+    error->funcname = strdup(error_data->funcname);
+    error->context = NULL;
+    error->lineno = error_data->lineno;
+    error->cursorpos = error_data->cursorpos;
+
+    result.error = error;
+    FlushErrorState();
+  }
+  PG_END_TRY();
+
+  reader_env = NULL;
+  pg_query_exit_memory_context(ctx);
+
+  return result;
+}
@@ -0,0 +1,30 @@
+#ifndef EX_PG_QUERY_STRUCT_H
+#define EX_PG_QUERY_STRUCT_H
+
+#include <erl_nif.h>
+#include <stdbool.h>
+
+#include "../libpg_query/pg_query.h"
+
+/**
+ * Creates the atoms used to read PgQuery structs, called once on load
+ *
+ * @param env The NIF environment
+ * @return bool true on success
+ */
+bool struct_reader_load(ErlNifEnv *env);
+
+/**
+ * Deparses a tree of PgQuery structs, as decoded by Protox, back to SQL
+ *
+ * The tree is either a %PgQuery.ParseResult{}, whose statements are deparsed
+ * like by pg_query_deparse_protobuf, or a single %PgQuery.Node{}, which is
+ * deparsed like by pg_query_deparse_node_protobuf.
+ *
+ * @param env The NIF environment the tree lives in
+ * @param tree The struct to deparse
+ * @return PgQueryDeparseResult to be freed with pg_query_free_deparse_result
+ */
+PgQueryDeparseResult deparse_struct_tree(ErlNifEnv *env, ERL_NIF_TERM tree);
+
+#endif
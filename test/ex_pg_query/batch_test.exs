@@ -0,0 +1,63 @@
+defmodule ExPgQuery.BatchTest do
+  use ExUnit.Case
+
+  alias ExPgQuery.Batch
+  alias ExPgQuery.Native
+
+  doctest ExPgQuery.Batch
+
+  describe "run" do
+    test "returns the same results as the single-query functions" do
+      queries = Enum.map(ExPgQuery.TestData.fingerprints(), & &1.input)
+
+      assert {:ok, results} = Batch.run(queries, [:parse, :fingerprint, :normalize])
+      assert length(results) == length(queries)
+
+      for {query, result} <- Enum.zip(queries, results) do
+        assert result.parse == Native.parse_protobuf(query)
+        assert result.fingerprint == Native.fingerprint(query)
+        assert result.normalize == Native.normalize(query)
+      end
+    end
+
+    test "keeps input order across chunks" do
+      queries = Enum.map(1..1_000, &"SELECT col_#{&1} FROM tbl")
+
+      assert {:ok, results} = Batch.run(queries, [:normalize], chunk_size: 7)
+
+      assert Enum.map(results, & &1.normalize) ==
+               Enum.map(1..1_000, &{:ok, "SELECT col_#{&1} FROM tbl"})
+    end
+
+    test "returns errors per query" do
+      assert {:ok, [%{parse: {:ok, _}}, %{parse: {:error, %{message: message, cursorpos: 0}}}]} =
+               Batch.run(["SELECT 1", "sellect 1"], [:parse])
+
+      assert message == "syntax error at or near \"sellect\""
+    end
+
+    test "cancels the job and leaves no results in the mailbox on timeout" do
+      queries = Enum.map(1..5_000, &"SELECT col_#{&1} FROM tbl WHERE id = #{&1}")
+
+      assert Batch.run(queries, [:parse, :fingerprint, :normalize], chunk_size: 1, timeout: 0) ==
+               {:error, :timeout}
+
+      # Give workers that were still running a chance to (wrongly) send more
+      Process.sleep(100)
+      refute_received {:ex_pg_query_batch, _, _}
+    end
+
+    test "handles an empty list" do
+      assert Batch.run([], [:fingerprint]) == {:ok, []}
+    end
+
+    test "rejects invalid arguments" do
+      assert Batch.run(["SELECT 1"], [:deparse]) == {:error, "invalid operations"}
+      assert Batch.run(["SELECT 1"], []) == {:error, "invalid operations"}
+      assert Batch.run(["SELECT 1", 1], [:fingerprint]) == {:error, "queries must be a list of binaries"}
+
+      assert Batch.run(["SELECT 1"], [:fingerprint], chunk_size: 0) ==
+               {:error, "chunk size must be a positive integer"}
+    end
+  end
+end
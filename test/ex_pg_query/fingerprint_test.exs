@@ -18,7 +18,7 @@ defmodule ExPgQuery.FingerprintTest do
     end
 
     test "returns error on invalid query" do
-      assert {:error, "syntax error at or near \"sellect\""} ==
+      assert {:error, %{message: "syntax error at or near \"sellect\"", cursorpos: 0}} =
                Fingerprint.fingerprint("sellect 1")
     end
 
@@ -99,5 +99,69 @@ defmodule ExPgQuery.FingerprintTest do
       q2 = "SELECT * FROM x WHERE y IN ( $1::uuid )"
       assert fingerprint(q1) == fingerprint(q2)
     end
+
+    test "is the same with long lists collapsed" do
+      ids = Enum.map_join(1..1000, ", ", &Integer.to_string/1)
+      rows = Enum.map_join(1..1000, ", ", &"(#{&1}, 'name #{&1}')")
+
+      for query <- [
+            "SELECT * FROM users WHERE id IN (#{ids}) AND tag = ANY(ARRAY[#{ids}])",
+            "INSERT INTO users (id, name) VALUES #{rows}",
+            "SELECT * FROM users WHERE id IN (SELECT user_id FROM orders WHERE id NOT IN (#{ids}))"
+          ] do
+        assert Fingerprint.fingerprint(query, max_list_length: 10) == {:ok, fingerprint(query)}
+      end
+    end
+  end
+
+  describe "subtree_fingerprints" do
+    defp subtree_fingerprints(query) do
+      {:ok, result} = Fingerprint.subtree_fingerprints(query)
+      result
+    end
+
+    test "returns error on invalid query" do
+      assert {:error, %{message: "syntax error at or near \"sellect\"", cursorpos: 0}} =
+               Fingerprint.subtree_fingerprints("sellect 1")
+    end
+
+    test "returns no subtrees for statements without selects" do
+      assert subtree_fingerprints("UPDATE x SET y = 1") == []
+    end
+
+    test "records CTEs, sublinks and range subselects with their parents" do
+      subtrees =
+        subtree_fingerprints(
+          "WITH a AS (SELECT 1) SELECT * FROM (SELECT * FROM a) s WHERE y IN (SELECT z FROM b)"
+        )
+
+      assert Enum.map(subtrees, &{&1.node_type, &1.parent}) == [
+               {:select_stmt, nil},
+               {:range_subselect, 0},
+               {:select_stmt, 1},
+               {:sub_link, 0},
+               {:select_stmt, 3},
+               {:common_table_expr, 0},
+               {:select_stmt, 5}
+             ]
+    end
+
+    test "subtree fingerprints match the fingerprint of the same select elsewhere" do
+      [top_level] = subtree_fingerprints("SELECT z FROM b WHERE c = 2")
+
+      nested =
+        subtree_fingerprints("DELETE FROM x WHERE y IN (SELECT z FROM b WHERE c = 1)")
+        |> Enum.filter(&(&1.node_type == :select_stmt))
+
+      assert [%{fingerprint: fingerprint}] = nested
+      assert fingerprint == top_level.fingerprint
+    end
+
+    test "leaves the statement fingerprint unchanged" do
+      for %{input: input, expected_hash: expected_hash} <- ExPgQuery.TestData.fingerprints() do
+        assert {:ok, %{fingerprint_str: ^expected_hash}} =
+                 ExPgQuery.Native.fingerprint_subtrees(input)
+      end
+    end
   end
 end
@@ -1,5 +1,175 @@
 defmodule ExPgQuery.NativeTest do
   use ExUnit.Case
 
+  alias ExPgQuery.Native
+
   doctest ExPgQuery.Native
+
+  describe "result cache" do
+    # The test environment enables the cache, see config/config.exs
+    test "answers repeated fingerprint and normalize calls from the cache" do
+      query = "SELECT * FROM cache_test_#{System.unique_integer([:positive])} WHERE id = 1"
+
+      {:ok, before} = Native.cache_stats()
+      assert {:ok, fingerprint} = Native.fingerprint(query)
+      assert {:ok, normalized} = Native.normalize(query)
+      assert Native.fingerprint(query) == {:ok, fingerprint}
+      assert Native.normalize(query) == {:ok, normalized}
+      {:ok, stats} = Native.cache_stats()
+
+      assert stats.misses - before.misses >= 2
+      assert stats.hits - before.hits >= 2
+      assert stats.memory <= stats.max_memory
+    end
+
+    test "does not cache errors" do
+      assert {:error, %{message: "syntax error at or near \"SELEC\""}} = Native.normalize("SELEC 1")
+      assert {:error, %{message: "syntax error at or near \"SELEC\""}} = Native.normalize("SELEC 1")
+      assert {:error, _} = Native.fingerprint("SELEC 1")
+    end
+  end
+
+  describe "input binaries" do
+    # The query is read straight out of the binary, sub-binaries end at their size
+    test "only reads the bytes of a sub-binary" do
+      <<query::binary-size(8), _rest::binary>> = "SELECT 1 + 'unterminated"
+
+      assert Native.parse_protobuf(query) == Native.parse_protobuf("SELECT 1")
+      assert Native.fingerprint(query) == Native.fingerprint("SELECT 1")
+      assert Native.normalize(query) == {:ok, "SELECT $1"}
+      assert Native.scan(query) == Native.scan("SELECT 1")
+    end
+  end
+
+  describe "parse limits" do
+    # The test environment sets low limits, see config/config.exs
+    test "rejects queries that nest too deep" do
+      query = "SELECT " <> Enum.join(List.duplicate("1", 1_100), " + ")
+
+      assert {:error, %{code: :depth_limit, message: "nesting depth limit exceeded"}} =
+               Native.parse_protobuf(query)
+
+      assert {:error, %{code: :depth_limit, message: "nesting depth limit exceeded"}} =
+               Native.fingerprint(query)
+
+      assert {:error, %{code: :depth_limit}} = Native.fingerprint_subtrees(query)
+
+      assert {:error, %{code: :depth_limit, message: "nesting depth limit exceeded"}} =
+               Native.normalize(query)
+    end
+
+    test "rejects queries with too many nodes" do
+      query = "SELECT * FROM t WHERE id IN (#{Enum.join(1..25_000, ", ")})"
+
+      assert {:error, %{code: :node_limit, message: "node limit exceeded"}} =
+               Native.parse_protobuf(query)
+    end
+
+    test "rejects queries that need too much memory" do
+      query = "SELECT '#{String.duplicate("a", 12 * 1024 * 1024)}'"
+
+      assert {:error, %{code: :memory_limit, message: "memory limit exceeded"}} =
+               Native.parse_protobuf(query)
+    end
+
+    test "keeps parsing other queries normally" do
+      assert {:ok, _} = Native.parse_protobuf("SELECT " <> Enum.join(List.duplicate("1", 100), " + "))
+      assert {:error, error} = Native.parse_protobuf("SELEC 1")
+      refute Map.has_key?(error, :code)
+    end
+  end
+
+  describe "deparse_struct" do
+    test "deparses like deparse_protobuf" do
+      for query <- [
+            "SELECT a, count(*) AS n FROM t WHERE b IN (1, 2.5, 'x') GROUP BY a HAVING count(*) > 1",
+            "INSERT INTO t (a, b) VALUES ($1, DEFAULT) ON CONFLICT (a) DO UPDATE SET b = excluded.b",
+            "WITH x AS MATERIALIZED (SELECT 1) SELECT * FROM x, LATERAL f(x.a) AS y(b) FOR UPDATE",
+            "CREATE TABLE t (id bigint PRIMARY KEY, v varchar(10)[] NOT NULL DEFAULT '{}')",
+            "SELECT B'101', true, NULL::int, x'1f', -1.5e10; DELETE FROM t WHERE NOT a"
+          ] do
+        {:ok, bytes} = Native.parse_protobuf(query)
+        tree = Protox.decode!(bytes, PgQuery.ParseResult)
+
+        assert Native.deparse_struct(tree) == Native.deparse_protobuf(bytes)
+      end
+    end
+
+    test "deparses modified trees" do
+      {:ok, tree} = ExPgQuery.Protobuf.from_sql("SELECT * FROM users LIMIT 10")
+      [%{stmt: %{node: {:select_stmt, stmt}}} = raw_stmt] = tree.stmts
+
+      limit = %PgQuery.Node{
+        node: {:a_const, %PgQuery.A_Const{val: {:ival, %PgQuery.Integer{ival: 5}}}}
+      }
+
+      stmt = %{stmt | limit_count: limit, from_clause: [], op: :SETOP_NONE}
+      tree = %{tree | stmts: [%{raw_stmt | stmt: %PgQuery.Node{node: {:select_stmt, stmt}}}]}
+
+      assert Native.deparse_struct(tree) == {:ok, "SELECT * LIMIT 5"}
+    end
+
+    test "deparses a single node" do
+      node = %PgQuery.Node{node: {:string, %PgQuery.String{sval: "a"}}}
+      column_ref = %PgQuery.Node{node: {:column_ref, %PgQuery.ColumnRef{fields: [node]}}}
+
+      assert Native.deparse_struct(column_ref) == {:ok, "a"}
+    end
+
+    test "returns errors for invalid trees" do
+      assert Native.deparse_struct("SELECT 1") == {:error, "expected a PgQuery struct"}
+      assert {:error, _} = Native.deparse_struct(%PgQuery.Node{})
+
+      select = %PgQuery.SelectStmt{op: :NOT_AN_OPERATION}
+
+      assert Native.deparse_struct(%PgQuery.Node{node: {:select_stmt, select}}) ==
+               {:error, "deparse: invalid value for struct field op"}
+
+      range_var = %PgQuery.RangeVar{relname: :users}
+
+      assert Native.deparse_struct(%PgQuery.Node{node: {:range_var, range_var}}) ==
+               {:error, "deparse: invalid value for struct field relname"}
+
+      # List items have to be wrapped in %PgQuery.Node{}
+      star = %PgQuery.Node{node: {:a_star, %PgQuery.A_Star{}}}
+      column_ref = %PgQuery.Node{node: {:column_ref, %PgQuery.ColumnRef{fields: [star]}}}
+      select = %PgQuery.SelectStmt{target_list: [%PgQuery.ResTarget{val: column_ref}], op: :SETOP_NONE}
+
+      assert Native.deparse_struct(%PgQuery.Node{node: {:select_stmt, select}}) ==
+               {:error, "deparse: invalid value for struct field node"}
+    end
+  end
+
+  describe "with_memory_stats" do
+    test "returns the memory used by the call" do
+      query = "SELECT a, b FROM t WHERE x IN (SELECT y FROM z WHERE z.id = t.id)"
+
+      assert {:ok, {{:ok, tree}, memory}} = Native.with_memory_stats(:parse_protobuf, query)
+      assert {:ok, tree} == Native.parse_protobuf(query)
+      assert memory.peak_memory >= memory.memory
+      assert memory.blocks > 0
+    end
+
+    test "reports errors of the function as its result" do
+      assert {:ok, {{:error, %{message: "syntax error at or near \"SELEC\""}}, _memory}} =
+               Native.with_memory_stats(:parse_protobuf, "SELEC 1")
+    end
+
+    test "reports no memory for cached results" do
+      query = "SELECT * FROM memory_test_#{System.unique_integer([:positive])}"
+
+      assert {:ok, {{:ok, _}, %{peak_memory: peak_memory}}} =
+               Native.with_memory_stats(:fingerprint, query)
+
+      assert peak_memory > 0
+
+      assert {:ok, {{:ok, _}, %{peak_memory: 0, memory: 0, blocks: 0}}} =
+               Native.with_memory_stats(:fingerprint, query)
+    end
+
+    test "rejects unknown functions" do
+      assert Native.with_memory_stats(:deparse, "SELECT 1") == {:error, "invalid function"}
+      assert Native.with_memory_stats("scan", "SELECT 1") == {:error, "invalid function"}
+    end
+  end
 end
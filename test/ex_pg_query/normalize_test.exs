@@ -12,7 +12,8 @@ defmodule ExPgQuery.NormalizeTest do
     end
 
     test "returns error on invalid query" do
-      assert {:error, "syntax error at or near \"sellect\""} == Normalize.normalize("sellect 1")
+      assert {:error, %{message: "syntax error at or near \"sellect\"", cursorpos: 0}} =
+               Normalize.normalize("sellect 1")
     end
 
     test "normalizes IN(...)" do
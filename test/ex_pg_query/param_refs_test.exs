@@ -56,4 +56,35 @@ defmodule ExPgQuery.ParamRefsTest do
              ]
     end
   end
+
+  describe "param_refs_from_sql" do
+    test "matches the tree walk" do
+      queries = [
+        "SELECT * FROM x WHERE y = $1 AND z = $2",
+        "SELECT * FROM x WHERE y = $1 AND z = $2::timestamptz",
+        "SELECT * FROM x WHERE y = $1::text AND z < now() - INTERVAL $2",
+        "SELECT * FROM a WHERE x = $1 AND y = $12 AND z = $255",
+        "SELECT $2, count(*) FROM x GROUP BY 1 ORDER BY 1 LIMIT $1",
+        "UPDATE x SET a = $1 WHERE b = $2; DELETE FROM y WHERE c = $3",
+        "WITH a AS (SELECT $1) INSERT INTO x SELECT * FROM a RETURNING $2",
+        "PREPARE p AS SELECT $1; CREATE VIEW v AS SELECT $2; CALL f($3)",
+        "CREATE TABLE t (a int DEFAULT $1, b int CHECK (b > $2), CHECK (a < $3))",
+        "ALTER TABLE t ADD COLUMN c int DEFAULT $1::int, ALTER COLUMN a SET DEFAULT $2"
+      ]
+
+      for query <- queries do
+        {:ok, tree} = Protobuf.from_sql(query)
+        assert ParamRefs.param_refs_from_sql(query) == {:ok, ParamRefs.param_refs(tree)}
+      end
+    end
+
+    test "query without param refs" do
+      assert ParamRefs.param_refs_from_sql("SELECT 1") == {:ok, []}
+    end
+
+    test "invalid query" do
+      assert {:error, %{message: "syntax error at end of input"}} =
+               ParamRefs.param_refs_from_sql("SELECT $1 FROM")
+    end
+  end
 end
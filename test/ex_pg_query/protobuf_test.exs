@@ -3,6 +3,9 @@ defmodule ExPgQuery.ProtobufTest do
 
   doctest ExPgQuery.Protobuf
 
+  defp collapsed(%PgQuery.Node{node: {:int_list, %PgQuery.IntList{items: items}}}),
+    do: Enum.map(items, fn %PgQuery.Node{node: {:integer, %{ival: ival}}} -> ival end)
+
   describe "from_sql/1" do
     test "successfully parses valid SQL" do
       query = "SELECT * FROM users WHERE id = 1"
@@ -16,6 +19,49 @@ defmodule ExPgQuery.ProtobufTest do
     end
   end
 
+  describe "from_sql/2 with :max_list_length" do
+    test "collapses IN lists of constants" do
+      query = "SELECT * FROM t WHERE id IN (1, -2, 'x', -(3) )"
+      {:ok, result} = ExPgQuery.Protobuf.from_sql(query, max_list_length: 2)
+      [%{stmt: %{node: {:select_stmt, stmt}}}] = result.stmts
+      %{node: {:a_expr, %{rexpr: %{node: {:list, %{items: [item]}}}}}} = stmt.where_clause
+
+      assert collapsed(item) == [4, 29, 16]
+      assert binary_part(query, 29, 16) == "1, -2, 'x', -(3)"
+    end
+
+    test "collapses VALUES lists into one row" do
+      query = "INSERT INTO t VALUES (1, 'a'), (2, 'b'), (3, 'c')"
+      {:ok, result} = ExPgQuery.Protobuf.from_sql(query, max_list_length: 2)
+      [%{stmt: %{node: {:insert_stmt, %{select_stmt: select}}}}] = result.stmts
+      %{node: {:select_stmt, %{values_lists: [row]}}} = select
+
+      assert %{node: {:list, %{items: [item]}}} = row
+      assert collapsed(item) == [3, 22, 26]
+    end
+
+    test "keeps short lists and lists that aren't all constants" do
+      for query <- [
+            "SELECT * FROM t WHERE id IN (1, 2)",
+            "SELECT * FROM t WHERE id IN (1, b, 3)",
+            "SELECT ARRAY[1, 2, 3::int]"
+          ] do
+        assert ExPgQuery.Protobuf.from_sql(query, max_list_length: 2) ==
+                 ExPgQuery.Protobuf.from_sql(query)
+      end
+    end
+
+    test "can't deparse a collapsed tree" do
+      result = ExPgQuery.Protobuf.from_sql!("SELECT * FROM t WHERE id IN (1, 2, 3)", max_list_length: 2)
+      assert {:error, _} = ExPgQuery.Protobuf.to_sql(result)
+    end
+
+    test "rejects lengths out of range" do
+      assert {:error, "invalid options"} = ExPgQuery.Protobuf.from_sql("SELECT 1", max_list_length: 0)
+      assert {:error, "invalid options"} = ExPgQuery.Protobuf.from_sql("SELECT 1", max_list_length: 32768)
+    end
+  end
+
   describe "from_sql!/1" do
     test "returns ParseResult for valid SQL" do
       query = "SELECT * FROM users WHERE id = 1"
@@ -127,6 +173,60 @@ defmodule ExPgQuery.ProtobufTest do
     end
   end
 
+  describe "node_to_sql/1" do
+    setup do
+      {:ok, %PgQuery.ParseResult{stmts: [%{stmt: %{node: {:select_stmt, stmt}}}]}} =
+        ExPgQuery.Protobuf.from_sql(
+          "SELECT a, b + 1 AS c FROM ONLY s.t x WHERE a > 1 AND b IS NULL GROUP BY a, ROLLUP (b)"
+        )
+
+      {:ok, stmt: stmt}
+    end
+
+    test "deparses a statement", %{stmt: stmt} do
+      assert ExPgQuery.Protobuf.node_to_sql(stmt) ==
+               {:ok,
+                "SELECT a, b + 1 AS c FROM ONLY s.t x WHERE a > 1 AND b IS NULL GROUP BY a, ROLLUP (b)"}
+    end
+
+    test "deparses an expression", %{stmt: stmt} do
+      assert ExPgQuery.Protobuf.node_to_sql(stmt.where_clause) ==
+               {:ok, "a > 1 AND b IS NULL"}
+    end
+
+    test "deparses lists", %{stmt: stmt} do
+      assert ExPgQuery.Protobuf.node_to_sql(stmt.target_list) == {:ok, "a, b + 1 AS c"}
+      assert ExPgQuery.Protobuf.node_to_sql(stmt.group_clause) == {:ok, "a, ROLLUP (b)"}
+    end
+
+    test "deparses a relation", %{stmt: stmt} do
+      assert ExPgQuery.Protobuf.node_to_sql(hd(stmt.from_clause)) == {:ok, "ONLY s.t x"}
+    end
+
+    test "deparses a type name" do
+      type_name = %PgQuery.TypeName{
+        names: [%PgQuery.Node{node: {:string, %PgQuery.String{sval: "text"}}}],
+        array_bounds: [%PgQuery.Node{node: {:integer, %PgQuery.Integer{ival: -1}}}]
+      }
+
+      assert ExPgQuery.Protobuf.node_to_sql(type_name) == {:ok, "text[]"}
+    end
+
+    test "returns an error for an empty node" do
+      assert {:error, _} = ExPgQuery.Protobuf.node_to_sql(%PgQuery.Node{})
+    end
+
+    test "returns an error for a struct that isn't a node" do
+      assert {:error, _} = ExPgQuery.Protobuf.node_to_sql(%PgQuery.ParseResult{})
+    end
+
+    test "raises with node_to_sql!/1" do
+      assert_raise RuntimeError, ~r/Deparse error:/, fn ->
+        ExPgQuery.Protobuf.node_to_sql!(%PgQuery.Node{})
+      end
+    end
+  end
+
   describe "roundtrip parsing and deparsing" do
     test "with simple SELECT query" do
       query = "SELECT * FROM users WHERE active = true"
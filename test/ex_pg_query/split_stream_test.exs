@@ -0,0 +1,106 @@
+defmodule ExPgQuery.SplitStreamTest do
+  use ExUnit.Case
+
+  alias ExPgQuery.Native
+  alias ExPgQuery.SplitStream
+
+  doctest ExPgQuery.SplitStream
+
+  @copy_data """
+  1\tit's; here
+  2\t"a;b"\t\\N
+  3\t$$ /* -- \\.
+  \\.
+  """
+
+  @dump """
+  SET statement_timeout = 0;
+  -- Name: f; Type: FUNCTION
+  CREATE FUNCTION public.f() RETURNS trigger
+      LANGUAGE plpgsql
+      AS $_$
+  BEGIN
+    NEW.note := 'it''s; fine';
+    RETURN NEW;
+  END;
+  $_$;
+  /* a /* nested */ comment; */
+  CREATE RULE r AS ON INSERT TO t DO ALSO (INSERT INTO log VALUES (1); NOTIFY t);
+  CREATE FUNCTION g() RETURNS int LANGUAGE sql BEGIN ATOMIC SELECT 1; END;
+  COPY t (a, "b;") FROM stdin;
+  #{@copy_data}SELECT E'\\';', 1
+  """
+
+  defp chunks(binary, size) when byte_size(binary) <= size, do: [binary]
+
+  defp chunks(binary, size) do
+    <<chunk::binary-size(size), rest::binary>> = binary
+    [chunk | chunks(rest, size)]
+  end
+
+  describe "stream" do
+    test "returns the same statements for any chunk size" do
+      # The COPY data isn't SQL, the splitter skips it
+      {:ok, expected} = ExPgQuery.split(String.replace(@dump, "\n" <> @copy_data, ""), [:binaries])
+
+      for size <- [1, 2, 3, 7, 64, byte_size(@dump)] do
+        chunks = chunks(@dump, size)
+        assert Enum.to_list(SplitStream.stream(chunks)) == expected, "chunk size #{size}"
+      end
+    end
+
+    test "streams a large input with bounded state" do
+      count = 20_000
+
+      statements =
+        Stream.repeatedly(fn -> "INSERT INTO t VALUES ('a;b', $$c;d$$); " end)
+        |> Stream.take(count)
+        |> SplitStream.stream()
+        |> Enum.reduce(0, fn statement, n ->
+          assert statement =~ ~r/^ ?INSERT INTO t VALUES \('a;b', \$\$c;d\$\$\)$/
+          n + 1
+        end)
+
+      assert statements == count
+    end
+
+    test "skips large COPY data" do
+      rows = Stream.repeatedly(fn -> "1\t'a;b\t\"c\n" end) |> Stream.take(20_000)
+
+      statements =
+        Stream.concat([["COPY t FROM stdin;\n"], rows, ["\\.\nSELECT 1"]])
+        |> SplitStream.stream()
+        |> Enum.to_list()
+
+      assert statements == ["COPY t FROM stdin", "SELECT 1"]
+    end
+
+    test "raises when the input ends inside a string" do
+      assert_raise RuntimeError, ~r/unterminated quoted string/, fn ->
+        ["SELECT 1; SELECT 'a", "bc"] |> SplitStream.stream() |> Enum.to_list()
+      end
+    end
+  end
+
+  describe "native" do
+    test "returns byte ranges relative to the whole input" do
+      {:ok, stream} = Native.split_stream_new()
+
+      assert {:ok, [], 0} = Native.split_stream_feed(stream, "SELECT 1")
+      assert {:ok, [{0, 8}, {9, 9}], 19} = Native.split_stream_feed(stream, "; SELECT 2;")
+      assert {:ok, [], 21} = Native.split_stream_feed(stream, " ; SELECT 3")
+      assert {:ok, [{21, 9}]} = Native.split_stream_finish(stream)
+
+      assert {:error, %{message: "split stream is already finished"}} =
+               Native.split_stream_finish(stream)
+    end
+
+    test "rejects invalid arguments" do
+      assert {:error, "argument must be a split stream"} =
+               Native.split_stream_feed(make_ref(), "SELECT 1")
+
+      {:ok, stream} = Native.split_stream_new()
+      assert {:error, "argument must be a binary"} = Native.split_stream_feed(stream, :select)
+    end
+  end
+end
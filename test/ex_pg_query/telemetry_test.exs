@@ -0,0 +1,58 @@
+defmodule ExPgQuery.TelemetryTest do
+  use ExUnit.Case
+
+  alias ExPgQuery.Telemetry
+
+  doctest ExPgQuery.Telemetry
+
+  setup do
+    test_pid = self()
+    handler_id = "telemetry-test-#{inspect(make_ref())}"
+
+    :telemetry.attach_many(
+      handler_id,
+      [[:ex_pg_query, :nif, :stats], [:ex_pg_query, :slow_query]],
+      fn event, measurements, metadata, _config ->
+        send(test_pid, {:telemetry, event, measurements, metadata})
+      end,
+      nil
+    )
+
+    on_exit(fn -> :telemetry.detach(handler_id) end)
+  end
+
+  describe "emit" do
+    test "emits the counters of every function" do
+      {:ok, _} = ExPgQuery.Native.normalize("SELECT 1")
+      {:error, _} = ExPgQuery.Native.normalize("SELEC 1")
+
+      assert Telemetry.emit() == :ok
+
+      assert_received {:telemetry, [:ex_pg_query, :nif, :stats], measurements,
+                       %{function: :normalize, histogram: histogram}}
+
+      assert measurements.calls >= 2
+      assert measurements.errors >= 1
+      assert measurements.input_bytes >= 15
+      assert measurements.duration > 0
+      assert measurements.peak_memory >= measurements.peak_memory_max
+      assert measurements.peak_memory_max > 0
+      assert measurements.blocks > 0
+      assert Enum.sum(Enum.map(histogram, &elem(&1, 1))) == measurements.calls
+
+      assert_received {:telemetry, [:ex_pg_query, :nif, :stats], _, %{function: :parse_protobuf}}
+    end
+
+    test "emits sampled slow queries" do
+      # The test environment samples every call, see config/config.exs
+      {:ok, _} = ExPgQuery.Native.scan("SELECT 'slow query'")
+
+      assert Telemetry.emit() == :ok
+
+      assert_received {:telemetry, [:ex_pg_query, :slow_query], %{duration: duration},
+                       %{function: :scan, query: "SELECT 'slow query'"}}
+
+      assert duration > 0
+    end
+  end
+end
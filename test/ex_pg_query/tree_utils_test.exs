@@ -115,6 +115,102 @@ defmodule ExPgQuery.TreeUtilsTest do
     end
   end
 
+  describe "update_many/2" do
+    test "gives the same result as updating one path after another" do
+      {:ok, tree} =
+        ExPgQuery.Protobuf.from_sql("SELECT a, b FROM t WHERE x = 1 AND y = 2 GROUP BY a, b")
+
+      edits =
+        for path <- [
+              [:stmts, 0, :stmt, :select_stmt, :target_list, 1],
+              [:stmts, 0, :stmt, :select_stmt, :where_clause, :bool_expr, :args, 0],
+              [:stmts, 0, :stmt, :select_stmt, :where_clause, :bool_expr, :args, 1],
+              [:stmts, 0, :stmt, :select_stmt, :group_clause, 0]
+            ] do
+          {path, fn _ -> %PgQuery.Node{node: {:a_star, %PgQuery.A_Star{}}} end}
+        end
+
+      expected =
+        Enum.reduce(edits, tree, fn {path, update_fn}, acc ->
+          TreeUtils.update_in_tree!(acc, path, update_fn)
+        end)
+
+      assert {:ok, ^expected} = TreeUtils.update_many(tree, edits)
+    end
+
+    test "updates many items of a long list in one pass" do
+      tree = %{items: Enum.to_list(0..9999)}
+      edits = for index <- [9999, 5, 0, 5000, -2], do: {[:items, index], &(-&1)}
+
+      {:ok, %{items: items}} = TreeUtils.update_many(tree, edits)
+
+      assert Enum.at(items, 0) == 0
+      assert Enum.at(items, 5) == -5
+      assert Enum.at(items, 6) == 6
+      assert Enum.at(items, 5000) == -5000
+      assert Enum.at(items, 9998) == -9998
+      assert Enum.at(items, 9999) == -9999
+      assert length(items) == 10000
+    end
+
+    test "applies deeper updates before the ones at their ancestors" do
+      tree = %{a: %{b: 1}}
+
+      assert {:ok, %{a: %{b: 2, c: 3}}} =
+               TreeUtils.update_many(tree, [
+                 {[:a], &Map.put(&1, :c, &1.b + 1)},
+                 {[:a, :b], &(&1 + 1)}
+               ])
+    end
+
+    test "applies updates at the same path in order" do
+      assert {:ok, %{a: 4}} =
+               TreeUtils.update_many(%{a: 1}, [{[:a], &(&1 + 1)}, {[:a], &(&1 * 2)}])
+    end
+
+    test "updates oneof fields and nodes" do
+      tree = %{
+        key: {:type1, %{value: 1}},
+        node: %PgQuery.Node{node: {:select_stmt, %PgQuery.SelectStmt{}}}
+      }
+
+      {:ok, updated} =
+        TreeUtils.update_many(tree, [
+          {[:key, :value], fn _ -> 2 end},
+          {[:node, :select_stmt, :all], fn _ -> true end}
+        ])
+
+      assert updated == %{
+               key: {:type1, %{value: 2}},
+               node: %PgQuery.Node{node: {:select_stmt, %PgQuery.SelectStmt{all: true}}}
+             }
+    end
+
+    test "returns errors" do
+      node = %PgQuery.Node{node: {:select_stmt, %PgQuery.SelectStmt{}}}
+
+      assert {:error, "key b not found"} = TreeUtils.update_many(%{a: 1}, [{[:b], & &1}])
+      assert {:error, "key c not found"} = TreeUtils.update_many(%{a: 1}, [{[:a, :c], & &1}])
+
+      assert {:error, "index 0 out of bounds"} =
+               TreeUtils.update_many(%{items: [nil]}, [{[:items, 0], & &1}])
+
+      assert {:error, "expected an index but found a"} =
+               TreeUtils.update_many(%{items: [1]}, [{[:items, :a], & &1}])
+
+      assert {:error, "expected node type update_stmt but found select_stmt"} =
+               TreeUtils.update_many(node, [{[:update_stmt], & &1}])
+    end
+  end
+
+  describe "update_many!/2" do
+    test "raises error on failure" do
+      assert_raise RuntimeError, "Update error: \"key b not found\"", fn ->
+        TreeUtils.update_many!(%{a: 1}, [{[:b], & &1}])
+      end
+    end
+  end
+
   describe "put_in_tree/3" do
     test "sets a value directly" do
       tree = %{a: 1}
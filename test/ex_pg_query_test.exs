@@ -2191,6 +2191,347 @@ defmodule ExPgQueryTest do
     end
   end
 
+  describe "parse_json" do
+    test "returns the parse tree as JSON" do
+      assert {:ok, json} =
+               ExPgQuery.parse_json("SELECT 'a\"b<c', x FROM t WHERE y = -5 AND z = 4294967296")
+
+      assert json =~ ~s("sval":{"sval":"a\\"b\\u003cc"})
+      assert json =~ ~s("ival":{"ival":-5})
+      assert json =~ ~s("fval":{"fval":"4294967296"})
+      assert json =~ ~s("RangeVar":{"relname":"t","inh":true,"relpersistence":"p","location":23})
+    end
+
+    test "returns an empty statement list for empty input" do
+      assert {:ok, ~s({"version":170000,"stmts":[]})} = ExPgQuery.parse_json("")
+    end
+
+    test "returns errors" do
+      assert {:error, %{message: "syntax error at or near \"FROM\"", cursorpos: 12}} =
+               ExPgQuery.parse_json("SELECT FROM FROM")
+    end
+  end
+
+  describe "classify" do
+    test "returns the same statement types as parse" do
+      queries = [
+        "SELECT * FROM users WHERE id = 1",
+        "(SELECT 1) UNION (SELECT 2); VALUES (1); TABLE users",
+        "WITH a AS (SELECT 1), b (x) AS NOT MATERIALIZED (SELECT 2) SELECT * FROM a, b",
+        "WITH d AS (DELETE FROM t RETURNING *) INSERT INTO archive SELECT * FROM d",
+        "INSERT INTO t VALUES (1); UPDATE t SET a = 2; DELETE FROM t",
+        "MERGE INTO t USING s ON t.id = s.id WHEN MATCHED THEN DELETE",
+        "BEGIN; SAVEPOINT s; RELEASE s; ROLLBACK; COMMIT PREPARED 'x'",
+        "SET search_path = public; RESET search_path; SHOW search_path",
+        "SET CONSTRAINTS ALL IMMEDIATE; SET LOCAL statement_timeout TO 100",
+        "EXPLAIN (ANALYZE, FORMAT JSON) SELECT 1",
+        "COPY (SELECT 1) TO STDOUT; COPY t (a, b) FROM STDIN",
+        "PREPARE q AS SELECT $1; EXECUTE q(1); DEALLOCATE ALL",
+        "DECLARE c SCROLL CURSOR WITH HOLD FOR SELECT 1; FETCH NEXT FROM c; CLOSE c",
+        "DO $$ BEGIN RAISE NOTICE 'x;'; END $$; CALL p(1)",
+        "VACUUM (ANALYZE) t; ANALYZE t; CLUSTER t; REINDEX TABLE t; CHECKPOINT",
+        "GRANT SELECT ON t TO u; REVOKE admin FROM u; LOCK t IN SHARE MODE",
+        "CREATE TABLE t (a int); CREATE UNLOGGED TABLE u AS SELECT 1",
+        "CREATE OR REPLACE TEMP VIEW v AS SELECT 1; CREATE MATERIALIZED VIEW m AS SELECT 1",
+        "CREATE UNIQUE INDEX CONCURRENTLY i ON t (a); CREATE SEQUENCE s",
+        "CREATE FUNCTION f() RETURNS int LANGUAGE sql AS 'SELECT 1'",
+        "CREATE PROCEDURE p() BEGIN ATOMIC INSERT INTO t VALUES (1); END",
+        "CREATE CONSTRAINT TRIGGER tr AFTER INSERT ON t FOR EACH ROW EXECUTE FUNCTION f()",
+        "DROP TABLE t; DROP INDEX i; DROP ROLE r; DROP OWNED BY r; DROP DATABASE d",
+        "ALTER TABLE t ADD COLUMN b int; ALTER TABLE t RENAME COLUMN a TO c",
+        "ALTER TABLE t SET SCHEMA s; ALTER TABLE ALL IN TABLESPACE a SET TABLESPACE b",
+        "ALTER INDEX i RENAME TO j; ALTER TYPE mood ADD VALUE 'happy'",
+        "CREATE TYPE mood AS ENUM ('sad'); COMMENT ON TABLE t IS 'x'; TRUNCATE t"
+      ]
+
+      for query <- queries do
+        {:ok, result} = ExPgQuery.parse(query)
+
+        assert {:ok, %{statement_types: statement_types}} = ExPgQuery.classify(query)
+        assert statement_types == ExPgQuery.statement_types(result), query
+      end
+    end
+
+    test "tells read-only queries apart" do
+      read_only = [
+        "SELECT * FROM users",
+        "SELECT 'FOR UPDATE' AS \"into\" FROM t",
+        "WITH a AS (SELECT 1) SELECT * FROM a",
+        "BEGIN READ ONLY; SELECT 1; COMMIT",
+        "EXPLAIN DELETE FROM t",
+        "EXPLAIN ANALYZE SELECT 1",
+        "COPY t TO STDOUT",
+        "SHOW ALL; SET statement_timeout = 0",
+        ""
+      ]
+
+      writes = [
+        "SELECT * FROM t FOR UPDATE",
+        "SELECT * FROM t FOR KEY SHARE",
+        "SELECT * INTO t2 FROM t",
+        "WITH d AS (DELETE FROM t RETURNING *) SELECT * FROM d",
+        "(WITH d AS (DELETE FROM t RETURNING *) SELECT * FROM d)",
+        "EXPLAIN ANALYZE DELETE FROM t",
+        "COPY t FROM STDIN",
+        "SELECT 1; INSERT INTO t VALUES (1)",
+        "CREATE TABLE t (a int)",
+        "ALTER INDEX i RENAME TO j"
+      ]
+
+      for query <- read_only do
+        assert {:ok, %{read_only: true}} = ExPgQuery.classify(query), query
+      end
+
+      for query <- writes do
+        assert {:ok, %{read_only: false}} = ExPgQuery.classify(query), query
+      end
+    end
+
+    test "returns parse errors" do
+      assert {:error, %{message: "syntax error at or near \"SELEC\""}} =
+               ExPgQuery.classify("SELEC 1")
+
+      assert {:error, %{message: "unterminated quoted string at or near \"'x\""}} =
+               ExPgQuery.classify("SELECT 'x")
+
+      assert {:error, %{message: "syntax error at end of input"}} =
+               ExPgQuery.classify("(SELECT 1")
+    end
+  end
+
+  describe "split" do
+    test "returns the byte ranges of the statements" do
+      query =
+        "CREATE FUNCTION f() RETURNS int AS $$ SELECT 1; $$ LANGUAGE sql;\nSELECT \"a;\" FROM t; /* ; */ "
+
+      assert {:ok, [{0, 63}, {64, 19}]} = ExPgQuery.split(query)
+      assert {:ok, [{0, 63}, {64, 19}]} = ExPgQuery.split(query, [:scanner])
+      assert {:ok, []} = ExPgQuery.split("  ")
+    end
+
+    test "returns sub-binaries of the input" do
+      query = String.duplicate("SELECT 'a;b' FROM t; ", 1000)
+
+      assert {:ok, ranges} = ExPgQuery.split(query)
+      assert {:ok, statements} = ExPgQuery.split(query, [:binaries])
+      assert {:ok, ^statements} = ExPgQuery.split(query, [:scanner, :binaries])
+
+      assert length(statements) == 1000
+      assert statements == Enum.map(ranges, &binary_part(query, elem(&1, 0), elem(&1, 1)))
+
+      for statement <- statements do
+        assert :binary.referenced_byte_size(statement) == byte_size(query)
+      end
+    end
+
+    test "only the parser reports syntax errors" do
+      assert {:error, %{message: "syntax error at or near \"SELEC\""}} =
+               ExPgQuery.split("SELECT 1; SELEC 2")
+
+      assert {:ok, [{0, 8}]} = ExPgQuery.split("SELECT 1; SELEC 2", [:scanner])
+
+      assert {:error, %{message: "unterminated quoted string at or near \"'x\""}} =
+               ExPgQuery.split("SELECT 'x", [:scanner])
+    end
+
+    test "rejects invalid options" do
+      assert {:error, "invalid options"} = ExPgQuery.split("SELECT 1", [:fast])
+      assert {:error, "invalid options"} = ExPgQuery.split("SELECT 1", :scanner)
+    end
+  end
+
+  describe "parse_plpgsql" do
+    test "returns the functions as one JSON array or one by one" do
+      query = """
+      CREATE FUNCTION f(a int) RETURNS int AS $$
+      BEGIN
+        IF a > 0 THEN RETURN a; END IF;
+        RETURN 0;
+      END
+      $$ LANGUAGE plpgsql;
+      SELECT 1;
+      DO $$ BEGIN RAISE NOTICE 'hi'; END $$;
+      """
+
+      assert {:ok, json} = ExPgQuery.parse_plpgsql(query)
+      assert {:ok, [f, do_block] = functions} = ExPgQuery.parse_plpgsql(query, [:functions])
+
+      assert json == "[\n" <> Enum.join(functions, ",\n") <> "\n]"
+      assert f =~ "PLpgSQL_stmt_if"
+      assert do_block =~ "PLpgSQL_stmt_raise"
+
+      for function <- functions do
+        assert :binary.referenced_byte_size(function) == byte_size(json)
+      end
+    end
+
+    test "handles input without functions" do
+      assert {:ok, "[]"} = ExPgQuery.parse_plpgsql("SELECT 1")
+      assert {:ok, []} = ExPgQuery.parse_plpgsql("SELECT 1", [:functions])
+    end
+
+    test "handles many functions" do
+      query =
+        Enum.map_join(1..2_000, "\n", fn i ->
+          "CREATE FUNCTION f#{i}() RETURNS int AS $$ BEGIN RETURN #{i}; END $$ LANGUAGE plpgsql;"
+        end)
+
+      assert {:ok, functions} = ExPgQuery.parse_plpgsql(query, [:functions])
+      assert length(functions) == 2_000
+      assert List.last(functions) =~ ~s("query":"2000")
+    end
+
+    test "returns errors" do
+      assert {:error, %{message: "syntax error at end of input"}} =
+               ExPgQuery.parse_plpgsql(
+                 "CREATE FUNCTION f() RETURNS int AS $$ BEGIN RETURN 1 END $$ LANGUAGE plpgsql"
+               )
+
+      assert {:error, "invalid options"} = ExPgQuery.parse_plpgsql("SELECT 1", [:json])
+    end
+  end
+
+  describe "plpgsql_dependencies" do
+    test "summarizes the tables and functions of each function" do
+      query = """
+      CREATE FUNCTION public.refresh(p int) RETURNS int AS $$
+      DECLARE
+        n int := (SELECT count(*) FROM stats);
+      BEGIN
+        WITH recent AS (SELECT * FROM events WHERE id > p)
+        UPDATE totals SET n = (SELECT count(*) FROM recent);
+        CALL audit(p);
+        RETURN n;
+      END
+      $$ LANGUAGE plpgsql;
+      CREATE FUNCTION total() RETURNS bigint LANGUAGE sql RETURN (SELECT sum(n) FROM totals);
+      DO $$ BEGIN TRUNCATE staging; END $$;
+      """
+
+      assert {:ok, [refresh, total, do_block]} = ExPgQuery.plpgsql_dependencies(query)
+
+      assert refresh == %{
+               name: "public.refresh",
+               tables: [
+                 %{name: "stats", type: :select},
+                 %{name: "totals", type: :dml},
+                 %{name: "events", type: :select}
+               ],
+               functions: [%{name: "count", type: :call}, %{name: "audit", type: :call}]
+             }
+
+      assert total == %{
+               name: "total",
+               tables: [%{name: "totals", type: :select}],
+               functions: [%{name: "sum", type: :call}]
+             }
+
+      assert do_block == %{name: nil, tables: [%{name: "staging", type: :ddl}], functions: []}
+    end
+
+    test "handles input without functions" do
+      assert {:ok, []} = ExPgQuery.plpgsql_dependencies("SELECT 1")
+    end
+
+    test "returns errors" do
+      assert {:error, %{message: "syntax error at end of input"}} =
+               ExPgQuery.plpgsql_dependencies(
+                 "CREATE FUNCTION f() RETURNS int AS $$ BEGIN RETURN 1 END $$ LANGUAGE plpgsql"
+               )
+    end
+  end
+
+  describe "rewrite" do
+    test "renames and qualifies relations" do
+      query =
+        "WITH recent AS (SELECT * FROM events) SELECT users.name FROM users " <>
+          "JOIN recent ON recent.user_id = users.id " <>
+          "WHERE users.id IN (SELECT user_id FROM public.admins)"
+
+      assert ExPgQuery.rewrite(query,
+               rename: [{"users", "accounts"}, {{"public", "admins"}, {"auth", "admins"}}],
+               schema: "tenant_1"
+             ) ==
+               {:ok,
+                "WITH recent AS (SELECT * FROM tenant_1.events) SELECT users.name " <>
+                  "FROM tenant_1.accounts users JOIN recent ON recent.user_id = users.id " <>
+                  "WHERE users.id IN (SELECT user_id FROM auth.admins)"}
+    end
+
+    test "only leaves references to CTEs in scope unqualified" do
+      assert ExPgQuery.rewrite(
+               "WITH orders AS (SELECT * FROM orders WHERE paid) SELECT * FROM orders",
+               schema: "tenant_1"
+             ) ==
+               {:ok,
+                "WITH orders AS (SELECT * FROM tenant_1.orders WHERE paid) SELECT * FROM orders"}
+
+      assert ExPgQuery.rewrite(
+               "SELECT * FROM (WITH accounts AS (SELECT 1) SELECT * FROM accounts) x, accounts",
+               schema: "tenant_1"
+             ) ==
+               {:ok,
+                "SELECT * FROM (WITH accounts AS (SELECT 1) SELECT * FROM accounts) x, tenant_1.accounts"}
+
+      assert ExPgQuery.rewrite(
+               "SELECT * FROM t WHERE EXISTS (WITH users AS (SELECT 1) SELECT 1) " <>
+                 "AND id IN (SELECT id FROM users)",
+               schema: "tenant_1"
+             ) ==
+               {:ok,
+                "SELECT * FROM tenant_1.t WHERE EXISTS (WITH users AS (SELECT 1) SELECT 1) " <>
+                  "AND id IN (SELECT id FROM tenant_1.users)"}
+    end
+
+    test "adds the WHERE expression to the given statements" do
+      query = "UPDATE t SET a = 1 WHERE b; DELETE FROM t; INSERT INTO t VALUES (1)"
+
+      assert ExPgQuery.rewrite(query, where: "tenant_id = $1", where_statements: [:update]) ==
+               {:ok,
+                "UPDATE t SET a = 1 WHERE b AND tenant_id = $1; DELETE FROM t; INSERT INTO t VALUES (1)"}
+    end
+
+    test "adds the WHERE expression to data-modifying CTEs" do
+      assert ExPgQuery.rewrite("WITH d AS (DELETE FROM x RETURNING *) SELECT * FROM d",
+               where: "tenant_id = 1"
+             ) ==
+               {:ok,
+                "WITH d AS (DELETE FROM x WHERE tenant_id = 1 RETURNING *) " <>
+                  "SELECT * FROM d WHERE tenant_id = 1"}
+
+      assert ExPgQuery.rewrite("WITH u AS (UPDATE x SET a = 1 RETURNING id) SELECT id FROM u",
+               where: "tenant_id = 1",
+               where_statements: [:update]
+             ) ==
+               {:ok, "WITH u AS (UPDATE x SET a = 1 WHERE tenant_id = 1 RETURNING id) SELECT id FROM u"}
+    end
+
+    test "leaves SELECTs without FROM alone" do
+      assert ExPgQuery.rewrite("SELECT 2", where: "tenant_id = $1", max_limit: 100) ==
+               {:ok, "SELECT 2 LIMIT 100"}
+    end
+
+    test "sets and caps the LIMIT" do
+      assert ExPgQuery.rewrite("SELECT * FROM t ORDER BY a LIMIT 50", limit: 10) ==
+               {:ok, "SELECT * FROM t ORDER BY a LIMIT 10"}
+
+      assert ExPgQuery.rewrite("SELECT * FROM t LIMIT $1", max_limit: 20) ==
+               {:ok, "SELECT * FROM t LIMIT LEAST($1, 20)"}
+    end
+
+    test "returns errors" do
+      assert {:error, %{message: "syntax error at end of input", cursorpos: 22}} =
+               ExPgQuery.rewrite("SELECT * FROM t WHERE", limit: 1)
+
+      assert {:error, %{message: "rewrite error: WHERE must be a single expression"}} =
+               ExPgQuery.rewrite("SELECT 1", where: "a FROM b")
+
+      assert ExPgQuery.rewrite("SELECT 1", rename: [{"users", 1}]) == {:error, "invalid options"}
+      assert ExPgQuery.rewrite("SELECT 1", where_statements: [:insert]) == {:error, "invalid options"}
+      assert ExPgQuery.rewrite("SELECT 1", max_limit: -1) == {:error, "invalid options"}
+    end
+  end
+
   describe "truncate" do
     test "convenience wrapper for truncate works" do
       query = "WITH x AS (SELECT * FROM y) SELECT * FROM x"